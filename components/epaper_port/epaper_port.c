@@ -1,10 +1,18 @@
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 #include "epaper_port.h"
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
 
 #define EPD_DC_PIN 8
 #define EPD_CS_PIN 9
@@ -21,9 +29,64 @@
 #define epaper_dc_0 gpio_set_level(EPD_DC_PIN, 0)
 #define ReadBusy gpio_get_level(EPD_BUSY_PIN)
 
+// Frame data goes out through a pair of DMA-capable bounce buffers so one
+// chunk can be filled while the previous one is still being clocked out.
+// 4800 bytes = 12 panel rows; the 192 KB frame is exactly 40 chunks.
+#define EPD_DMA_CHUNK_BYTES 4800
+#define EPD_DMA_BUF_COUNT 2
+
+static const char *TAG = "epaper_port";
+
 static spi_device_handle_t spi;
 static void                spi_send_byte(uint8_t cmd);
 
+static uint8_t          *s_dma_buf[EPD_DMA_BUF_COUNT];
+static spi_transaction_t s_dma_trans[EPD_DMA_BUF_COUNT];
+static int               s_dma_next;     // Next bounce buffer to fill
+static int               s_dma_inflight; // Queued transactions not yet collected
+static size_t            s_dma_fill;     // Bytes already in s_dma_buf[s_dma_next]
+static bool              s_stream_open;
+static int64_t           s_stream_start_us;
+static uint32_t          s_last_transfer_us;
+static uint32_t          s_last_refresh_us;
+
+// Hash of the frame currently on the panel. Kept in RTC memory so it survives deep
+// sleep (the panel keeps its image); lost on power-up, which forces a refresh.
+#define EPD_FRAME_HASH_MAGIC 0x45504448u
+
+RTC_DATA_ATTR static uint64_t s_shown_hash;
+RTC_DATA_ATTR static uint32_t s_shown_hash_magic;
+
+// BUSY is high when the controller is idle. Waits block on a semaphore given by
+// a level interrupt instead of polling, so the idle task (and power management,
+// when enabled) gets the CPU for the whole 15-30 s refresh.
+#define EPD_BUSY_TIMEOUT_MS 60000
+#define EPD_BUSY_LOW_FREQ_MHZ 80
+
+static SemaphoreHandle_t   s_busy_sem;
+static epaper_busy_power_t s_busy_power = EPAPER_BUSY_POWER_NORMAL;
+static uint32_t            s_last_busy_us;
+
+// Band pipeline: a sender task on the other core streams panel rows as the
+// renderer releases them, in bands of EPD_BAND_ROWS.
+#define EPD_BAND_ROWS 40
+#define EPD_ROW_BYTES (EXAMPLE_LCD_WIDTH / 2)
+
+static TaskHandle_t      s_pipe_task;
+static SemaphoreHandle_t s_pipe_done;
+static const uint8_t    *s_pipe_image;
+static volatile uint16_t s_pipe_ready; // Panel rows released by the renderer
+static esp_err_t         s_pipe_err;
+
+static void epaper_busy_isr(void *arg) {
+    (void) arg;
+    // Level interrupt: mask it until the next wait re-arms it.
+    gpio_intr_disable(EPD_BUSY_PIN);
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(s_busy_sem, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
 static void epaper_gpio_init(void) {
     gpio_config_t gpio_conf = {};
     gpio_conf.intr_type     = GPIO_INTR_DISABLE;
@@ -40,6 +103,19 @@ static void epaper_gpio_init(void) {
     gpio_conf.pull_up_en   = GPIO_PULLDOWN_ENABLE;
     ESP_ERROR_CHECK_WITHOUT_ABORT(gpio_config(&gpio_conf));
 
+    s_busy_sem = xSemaphoreCreateBinary();
+    esp_err_t ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) { // Already installed by another driver is fine
+        ESP_LOGW(TAG, "GPIO ISR service unavailable (%s); polling BUSY", esp_err_to_name(ret));
+    } else if (s_busy_sem) {
+        gpio_set_intr_type(EPD_BUSY_PIN, GPIO_INTR_HIGH_LEVEL);
+        gpio_intr_disable(EPD_BUSY_PIN);
+        if (gpio_isr_handler_add(EPD_BUSY_PIN, epaper_busy_isr, NULL) != ESP_OK) {
+            vSemaphoreDelete(s_busy_sem);
+            s_busy_sem = NULL;
+        }
+    }
+
     epaper_rst_1;
 }
 
@@ -76,18 +152,115 @@ static void epaper_spi_init(void) {
     ESP_ERROR_CHECK(ret);
     ret = spi_bus_add_device(SPI3_HOST, &devcfg, &spi);
     ESP_ERROR_CHECK(ret);
+
+    for (int i = 0; i < EPD_DMA_BUF_COUNT; i++) {
+        s_dma_buf[i] = (uint8_t *) heap_caps_malloc(EPD_DMA_CHUNK_BYTES, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (!s_dma_buf[i]) {
+            ESP_LOGE(TAG, "DMA bounce buffer allocation failed");
+        }
+    }
 }
 
 /*
-  Waiting for the idle signal
+  Lower the CPU clock (and optionally allow light sleep) for a long BUSY wait.
+  Needs CONFIG_EPAPER_BUSY_POWER_SAVE; returns false when nothing was changed.
 */
-static void epaper_readbusyh(void) {
-    while (1) {
-        if (ReadBusy) {
-            return;
+static bool epaper_busy_power_enter(esp_pm_config_t *saved) {
+    if (s_busy_power == EPAPER_BUSY_POWER_NORMAL) {
+        return false;
+    }
+    esp_err_t ret = esp_pm_get_configuration(saved);
+    if (ret != ESP_OK) {
+        ESP_LOGD(TAG, "Power management unavailable (%s)", esp_err_to_name(ret));
+        return false;
+    }
+
+    // epaper_port_init pinned min to max, so both come down.
+    esp_pm_config_t low  = *saved;
+    low.max_freq_mhz     = (saved->max_freq_mhz < EPD_BUSY_LOW_FREQ_MHZ) ? saved->max_freq_mhz : EPD_BUSY_LOW_FREQ_MHZ;
+    low.min_freq_mhz     = (saved->min_freq_mhz < low.max_freq_mhz) ? saved->min_freq_mhz : low.max_freq_mhz;
+    low.light_sleep_enable = (s_busy_power == EPAPER_BUSY_POWER_LIGHT_SLEEP);
+    if (low.light_sleep_enable) {
+        // Let BUSY going high end the sleep right away.
+        gpio_wakeup_enable(EPD_BUSY_PIN, GPIO_INTR_HIGH_LEVEL);
+        esp_sleep_enable_gpio_wakeup();
+    }
+    if (esp_pm_configure(&low) != ESP_OK) {
+        if (low.light_sleep_enable) {
+            gpio_wakeup_disable(EPD_BUSY_PIN);
         }
-        vTaskDelay(pdMS_TO_TICKS(10));
+        return false;
     }
+    return true;
+}
+
+static void epaper_busy_power_exit(const esp_pm_config_t *saved) {
+    esp_pm_configure(saved);
+    if (s_busy_power == EPAPER_BUSY_POWER_LIGHT_SLEEP) {
+        gpio_wakeup_disable(EPD_BUSY_PIN);
+    }
+}
+
+/*
+  Waiting for the idle signal (BUSY high)
+*/
+static esp_err_t epaper_wait_busy(uint32_t timeout_ms, bool long_wait) {
+    const int64_t t0 = esp_timer_get_time();
+    if (ReadBusy) {
+        if (long_wait) {
+            s_last_busy_us = 0;
+        }
+        return ESP_OK;
+    }
+
+    esp_pm_config_t saved      = {};
+    const bool      power_held = long_wait && epaper_busy_power_enter(&saved);
+    esp_err_t       ret        = ESP_OK;
+
+    if (s_busy_sem) {
+        xSemaphoreTake(s_busy_sem, 0); // Drop a stale give
+        gpio_set_intr_type(EPD_BUSY_PIN, GPIO_INTR_HIGH_LEVEL);
+        gpio_intr_enable(EPD_BUSY_PIN);
+        if (xSemaphoreTake(s_busy_sem, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+            gpio_intr_disable(EPD_BUSY_PIN);
+            ret = ESP_ERR_TIMEOUT;
+        }
+    } else {
+        while (!ReadBusy) {
+            if ((esp_timer_get_time() - t0) / 1000 >= timeout_ms) {
+                ret = ESP_ERR_TIMEOUT;
+                break;
+            }
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+    }
+
+    if (power_held) {
+        epaper_busy_power_exit(&saved);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "BUSY still low after %lu ms", (unsigned long) timeout_ms);
+    }
+    if (long_wait) {
+        s_last_busy_us = (uint32_t) (esp_timer_get_time() - t0);
+    }
+    return ret;
+}
+
+static void epaper_readbusyh(void) {
+    epaper_wait_busy(EPD_BUSY_TIMEOUT_MS, false);
+}
+
+void epaper_port_set_busy_power(epaper_busy_power_t mode) {
+#if CONFIG_EPAPER_BUSY_POWER_SAVE
+    s_busy_power = mode;
+#else
+    (void) mode;
+#endif
+}
+
+uint32_t epaper_port_get_last_busy_us(void) {
+    return s_last_busy_us;
 }
 
 /*
@@ -110,29 +283,304 @@ void epaper_SendData(uint8_t Data) {
     epaper_cs_1;
 }
 
-/*send bytes data*/
-void epaper_Sendbuffera(uint8_t *Data, int len) {
+/*
+  Collect the oldest queued transaction (blocks until it has been clocked out)
+*/
+static esp_err_t epaper_dma_wait_one(void) {
+    spi_transaction_t *done = NULL;
+    esp_err_t          ret  = spi_device_get_trans_result(spi, &done, portMAX_DELAY);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "SPI transfer failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    s_dma_inflight--;
+    return ESP_OK;
+}
+
+/*
+  Queue the current bounce buffer and move on to the next one
+*/
+static esp_err_t epaper_dma_flush(void) {
+    if (s_dma_fill == 0) {
+        return ESP_OK;
+    }
+
+    spi_transaction_t *t = &s_dma_trans[s_dma_next];
+    memset(t, 0, sizeof(*t));
+    t->length    = 8 * s_dma_fill;
+    t->tx_buffer = s_dma_buf[s_dma_next];
+
+    esp_err_t ret = spi_device_queue_trans(spi, t, portMAX_DELAY);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "SPI queue failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    s_dma_inflight++;
+    s_dma_next = (s_dma_next + 1) % EPD_DMA_BUF_COUNT;
+    s_dma_fill = 0;
+    return ESP_OK;
+}
+
+/*
+  Polling fallback used when the bounce buffers could not be allocated
+*/
+static void epaper_Sendbuffer_polling(const uint8_t *Data, size_t len) {
+    spi_transaction_t t;
+    while (len) {
+        const size_t n = (len > EPD_DMA_CHUNK_BYTES) ? EPD_DMA_CHUNK_BYTES : len;
+        memset(&t, 0, sizeof(t));
+        t.length    = 8 * n;
+        t.tx_buffer = Data;
+        esp_err_t ret = spi_device_polling_transmit(spi, &t); //Transmit!
+        assert(ret == ESP_OK);                                //Should have had no issues.
+        Data += n;
+        len -= n;
+    }
+}
+
+/*
+  Start a data phase for the command that was just sent
+*/
+static esp_err_t epaper_stream_open(void) {
+    if (s_stream_open) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
     epaper_dc_1;
     epaper_cs_0;
-    esp_err_t         ret;
-    spi_transaction_t t;
-    memset(&t, 0, sizeof(t));
-    int      len_scl = len / 5000; //每次发送5000
-    int      len_dcl = len % 5000;
-    uint8_t *ptr     = Data;
-    while (len_scl) {
-        t.length    = 8 * 5000;
-        t.tx_buffer = ptr;
-        ret         = spi_device_polling_transmit(spi, &t); //Transmit!
-        assert(ret == ESP_OK);                              //Should have had no issues
-        len_scl--;
-        ptr += 5000;
-    }
-    t.length    = 8 * len_dcl;
-    t.tx_buffer = ptr;
-    ret         = spi_device_polling_transmit(spi, &t); //Transmit!
-    assert(ret == ESP_OK);                              //Should have had no issues.
+
+    s_dma_next        = 0;
+    s_dma_inflight    = 0;
+    s_dma_fill        = 0;
+    s_stream_open     = true;
+    s_stream_start_us = esp_timer_get_time();
+    return ESP_OK;
+}
+
+esp_err_t epaper_port_stream_begin(void) {
+    if (s_stream_open) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    epaper_SendCommand(0x10); // DATA_START_TRANSMISSION
+    return epaper_stream_open();
+}
+
+esp_err_t epaper_port_stream_write(const uint8_t *Data, size_t len) {
+    if (!s_stream_open) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!s_dma_buf[0] || !s_dma_buf[EPD_DMA_BUF_COUNT - 1]) {
+        epaper_Sendbuffer_polling(Data, len);
+        return ESP_OK;
+    }
+
+    while (len) {
+        // Reuse a bounce buffer only once its previous transfer is done.
+        if (s_dma_fill == 0 && s_dma_inflight >= EPD_DMA_BUF_COUNT) {
+            esp_err_t ret = epaper_dma_wait_one();
+            if (ret != ESP_OK) {
+                return ret;
+            }
+        }
+
+        size_t n = EPD_DMA_CHUNK_BYTES - s_dma_fill;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(s_dma_buf[s_dma_next] + s_dma_fill, Data, n);
+        s_dma_fill += n;
+        Data += n;
+        len -= n;
+
+        if (s_dma_fill == EPD_DMA_CHUNK_BYTES) {
+            esp_err_t ret = epaper_dma_flush();
+            if (ret != ESP_OK) {
+                return ret;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t epaper_port_stream_end(void) {
+    if (!s_stream_open) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = epaper_dma_flush();
+    while (s_dma_inflight > 0) {
+        esp_err_t r = epaper_dma_wait_one();
+        if (r != ESP_OK) {
+            // The transaction is lost to us; don't spin on it.
+            s_dma_inflight = 0;
+            ret            = r;
+        }
+    }
     epaper_cs_1;
+    s_stream_open = false;
+
+    s_last_transfer_us = (uint32_t) (esp_timer_get_time() - s_stream_start_us);
+    ESP_LOGI(TAG, "Frame transfer %lu us", (unsigned long) s_last_transfer_us);
+    return ret;
+}
+
+/*
+  FNV-1a over 32-bit words; ~192 KB in a few ms from PSRAM
+*/
+uint64_t epaper_port_frame_hash(const uint8_t *Image) {
+    const size_t len = (size_t) EPD_ROW_BYTES * EXAMPLE_LCD_HEIGHT;
+    uint64_t     h   = 0xCBF29CE484222325ull;
+    size_t       i   = 0;
+    for (; i + 4 <= len; i += 4) {
+        uint32_t w;
+        memcpy(&w, Image + i, sizeof(w));
+        h = (h ^ w) * 0x100000001B3ull;
+    }
+    for (; i < len; i++) {
+        h = (h ^ Image[i]) * 0x100000001B3ull;
+    }
+    return h;
+}
+
+static bool epaper_frame_is_shown(uint64_t hash) {
+    return s_shown_hash_magic == EPD_FRAME_HASH_MAGIC && s_shown_hash == hash;
+}
+
+static void epaper_frame_set_shown(uint64_t hash) {
+    s_shown_hash       = hash;
+    s_shown_hash_magic = EPD_FRAME_HASH_MAGIC;
+}
+
+void epaper_port_invalidate_frame_hash(void) {
+    s_shown_hash_magic = 0;
+}
+
+uint32_t epaper_port_get_last_transfer_us(void) {
+    return s_last_transfer_us;
+}
+
+uint32_t epaper_port_get_last_refresh_us(void) {
+    return s_last_refresh_us;
+}
+
+/*
+  Band sender: waits for released rows and streams them in whole bands
+*/
+static void epaper_pipeline_task(void *arg) {
+    (void) arg;
+    uint16_t sent = 0;
+    // Keep consuming releases after an error, so the renderer never notifies a deleted task.
+    while (sent < EXAMPLE_LCD_HEIGHT) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        const uint16_t ready = s_pipe_ready;
+        while (sent < ready) {
+            uint16_t n = ready - sent;
+            if (n < EPD_BAND_ROWS && ready < EXAMPLE_LCD_HEIGHT) {
+                break; // Wait for a full band
+            }
+            if (n > EPD_BAND_ROWS) {
+                n = EPD_BAND_ROWS;
+            }
+            if (s_pipe_err == ESP_OK) {
+                s_pipe_err = epaper_port_stream_write(s_pipe_image + (size_t) sent * EPD_ROW_BYTES,
+                                                      (size_t) n * EPD_ROW_BYTES);
+            }
+            sent += n;
+        }
+    }
+
+    esp_err_t ret = epaper_port_stream_end();
+    if (s_pipe_err == ESP_OK) {
+        s_pipe_err = ret;
+    }
+    xSemaphoreGive(s_pipe_done);
+    vTaskDelete(NULL);
+}
+
+esp_err_t epaper_port_pipeline_begin(const uint8_t *Image) {
+    if (s_pipe_task || !Image) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!s_pipe_done) {
+        s_pipe_done = xSemaphoreCreateBinary();
+        if (!s_pipe_done) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    esp_err_t ret = epaper_port_stream_begin();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    s_pipe_image = Image;
+    s_pipe_ready = 0;
+    s_pipe_err   = ESP_OK;
+
+    // Run the sender on the other core and above the caller, so it picks up a
+    // released band right away instead of waiting for the renderer to yield.
+    const BaseType_t core = (xPortGetCoreID() == 0) ? 1 : 0;
+    if (xTaskCreatePinnedToCore(epaper_pipeline_task, "epd_band_tx", 3 * 1024, NULL, uxTaskPriorityGet(NULL) + 1,
+                                &s_pipe_task, core) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start band sender");
+        s_pipe_task = NULL;
+        epaper_port_stream_end();
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void epaper_port_pipeline_release_rows(uint16_t rows) {
+    if (!s_pipe_task) {
+        return;
+    }
+    if (rows > EXAMPLE_LCD_HEIGHT) {
+        rows = EXAMPLE_LCD_HEIGHT;
+    }
+    // The sender exits once every row is released; never notify it after that.
+    if (rows <= s_pipe_ready) {
+        return;
+    }
+    s_pipe_ready = rows;
+    xTaskNotifyGive(s_pipe_task);
+}
+
+esp_err_t epaper_port_pipeline_end(bool refresh) {
+    if (!s_pipe_task) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const int64_t t0 = esp_timer_get_time();
+    epaper_port_pipeline_release_rows(EXAMPLE_LCD_HEIGHT);
+    xSemaphoreTake(s_pipe_done, portMAX_DELAY);
+    s_pipe_task = NULL;
+
+    ESP_LOGI(TAG, "Band pipeline: %lu us on the wire, %lu us left after rendering",
+             (unsigned long) s_last_transfer_us, (unsigned long) (esp_timer_get_time() - t0));
+
+    if (s_pipe_err != ESP_OK) {
+        return s_pipe_err;
+    }
+    if (refresh) {
+        // The data already went out with the bands, but the refresh is what costs.
+        const uint64_t hash = epaper_port_frame_hash(s_pipe_image);
+        if (epaper_frame_is_shown(hash)) {
+            ESP_LOGI(TAG, "Frame unchanged; skipping refresh");
+            return ESP_OK;
+        }
+        epaper_port_refresh();
+        epaper_frame_set_shown(hash);
+    }
+    return ESP_OK;
+}
+
+/*send bytes data*/
+void epaper_Sendbuffera(uint8_t *Data, int len) {
+    if (epaper_stream_open() != ESP_OK) {
+        return;
+    }
+    epaper_port_stream_write(Data, (size_t) len);
+    epaper_port_stream_end();
 }
 
 /*
@@ -152,17 +600,37 @@ static void epaper_TurnOnDisplay(void) {
 
     epaper_SendCommand(0x12); // DISPLAY_REFRESH
     epaper_SendData(0x00);
-    epaper_readbusyh();
+    epaper_wait_busy(EPD_BUSY_TIMEOUT_MS, true);
 
     epaper_SendCommand(0x02); // POWER_OFF
     epaper_SendData(0X00);
     epaper_readbusyh();
 }
 
+void epaper_port_refresh(void) {
+    const int64_t t0 = esp_timer_get_time();
+    // Callers that know the frame record its hash afterwards.
+    epaper_port_invalidate_frame_hash();
+    epaper_TurnOnDisplay();
+    s_last_refresh_us = (uint32_t) (esp_timer_get_time() - t0);
+    ESP_LOGI(TAG, "Panel refresh %lu ms (BUSY %lu ms)", (unsigned long) (s_last_refresh_us / 1000),
+             (unsigned long) (s_last_busy_us / 1000));
+}
+
 /*
 epaper init
 */
 void epaper_port_init(void) {
+#if CONFIG_EPAPER_BUSY_POWER_SAVE
+    // Pin the clock so power management only ever changes it around a BUSY wait.
+    esp_pm_config_t pm = {};
+    pm.max_freq_mhz    = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+    pm.min_freq_mhz    = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+    esp_err_t ret      = esp_pm_configure(&pm);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Could not pin the CPU clock (%s)", esp_err_to_name(ret));
+    }
+#endif
     epaper_spi_init();  //spi init
     epaper_gpio_init(); //ws gpio init
     epaper_reset();     //reset
@@ -264,12 +732,10 @@ void epaper_port_clear(uint8_t *Image, uint8_t color) {
     Width  = (EXAMPLE_LCD_WIDTH % 2 == 0) ? (EXAMPLE_LCD_WIDTH / 2) : (EXAMPLE_LCD_WIDTH / 2 + 1);
     Height = EXAMPLE_LCD_HEIGHT;
 
-    epaper_SendCommand(0x10);
     for (int j = 0; j < Height * Width; j++) {
         Image[j] = (color << 4) | color;
     }
-    epaper_Sendbuffera(Image, Height * Width);
-    epaper_TurnOnDisplay();
+    epaper_port_display(Image);
 }
 
 /*
@@ -280,7 +746,19 @@ void epaper_port_display(uint8_t *Image) {
     Width  = (EXAMPLE_LCD_WIDTH % 2 == 0) ? (EXAMPLE_LCD_WIDTH / 2) : (EXAMPLE_LCD_WIDTH / 2 + 1);
     Height = EXAMPLE_LCD_HEIGHT;
 
-    epaper_SendCommand(0x10);
-    epaper_Sendbuffera(Image, Height * Width);
-    epaper_TurnOnDisplay();
+    const uint64_t hash = epaper_port_frame_hash(Image);
+    if (epaper_frame_is_shown(hash)) {
+        ESP_LOGI(TAG, "Frame unchanged; skipping transfer and refresh");
+        return;
+    }
+
+    if (epaper_port_stream_begin() != ESP_OK) {
+        return;
+    }
+    epaper_port_stream_write(Image, (size_t) Height * Width);
+    if (epaper_port_stream_end() != ESP_OK) {
+        return;
+    }
+    epaper_port_refresh();
+    epaper_frame_set_shown(hash);
 }
\ No newline at end of file
@@ -1,6 +1,12 @@
 #ifndef EPAPER_PORT_H
 #define EPAPER_PORT_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
 /**********************************
 Color Index
 **********************************/
@@ -15,6 +21,16 @@ Color Index
 #define EXAMPLE_LCD_WIDTH 800
 #define EXAMPLE_LCD_HEIGHT 480
 
+// What the CPU may do while the panel refreshes (BUSY low for ~15-30 s).
+// The reduced modes need CONFIG_EPAPER_BUSY_POWER_SAVE (light sleep also needs tickless
+// idle); without it they behave like EPAPER_BUSY_POWER_NORMAL.
+typedef enum
+{
+  EPAPER_BUSY_POWER_NORMAL = 0,  // Keep the configured CPU clock
+  EPAPER_BUSY_POWER_LOW_FREQ,    // Cap the CPU at 80 MHz
+  EPAPER_BUSY_POWER_LIGHT_SLEEP, // Also allow automatic light sleep; BUSY wakes the chip
+} epaper_busy_power_t;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -22,7 +38,54 @@ extern "C"
 
   void epaper_port_init(void);
   void epaper_port_clear(uint8_t *Image, uint8_t color);
+  // Sends Image and refreshes, unless it hashes the same as the frame already shown
+  // (tracked across deep sleep), in which case nothing is sent.
   void epaper_port_display(uint8_t *Image);
+  uint64_t epaper_port_frame_hash(const uint8_t *Image);
+  // Forces the next display/pipeline frame to refresh even if it is unchanged.
+  void epaper_port_invalidate_frame_hash(void);
+
+  /*
+   * Banded frame upload. Data written between begin and end is copied into
+   * DMA bounce buffers and queued, so the caller can prepare the next band
+   * while the previous one is still on the wire. Bands must be written in
+   * framebuffer order and together cover the whole frame.
+   *
+   *   epaper_port_stream_begin();
+   *   epaper_port_stream_write(band, len); // repeat
+   *   epaper_port_stream_end();            // waits for the last transfer
+   *   epaper_port_refresh();               // power on, refresh, power off
+   */
+  esp_err_t epaper_port_stream_begin(void);
+  esp_err_t epaper_port_stream_write(const uint8_t *Data, size_t len);
+  esp_err_t epaper_port_stream_end(void);
+  void epaper_port_refresh(void);
+
+  /*
+   * Band pipeline on top of the stream API. After begin, the caller draws into
+   * Image and releases finished panel rows (top-down, in memory order); a task
+   * on the other core sends them in 40-row bands meanwhile. Released rows must
+   * not be modified. End releases the rest, waits for the transfer and, when
+   * `refresh` is set, refreshes the panel (skipped if the frame is unchanged). Without it the caller can still send
+   * a corrected frame with epaper_port_display() instead.
+   * The frame is only complete, and so can only be hashed, once every band is sent:
+   * a caller holding a finished frame (e.g. a cached one) should use
+   * epaper_port_display(), which skips the transfer too when nothing changed.
+   */
+  esp_err_t epaper_port_pipeline_begin(const uint8_t *Image);
+  void epaper_port_pipeline_release_rows(uint16_t rows);
+  esp_err_t epaper_port_pipeline_end(bool refresh);
+
+  // Duration of the last completed stream (begin to end) and panel refresh.
+  uint32_t epaper_port_get_last_transfer_us(void);
+  uint32_t epaper_port_get_last_refresh_us(void);
+
+  // Applies to refreshes from now on. Only pick a reduced mode while Wi-Fi is off (the
+  // deep-sleep wake paths): the radio needs the full clock and no light sleep.
+  void epaper_port_set_busy_power(epaper_busy_power_t mode);
+  // How long BUSY stayed low during the last refresh (0 if it was already high); useful for
+  // power budgeting.
+  uint32_t epaper_port_get_last_busy_us(void);
 
 #ifdef __cplusplus
 }
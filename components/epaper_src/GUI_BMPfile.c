@@ -44,7 +44,10 @@
 ******************************************************************************/
 
 #include "GUI_BMPfile.h"
+#include "GUI_Dither.h"
 #include "GUI_Paint.h"
+#include "GUI_PixelKernel.h"
+#include "GUI_Resample.h"
 
 #include <fcntl.h>
 #include <unistd.h>
@@ -58,9 +61,12 @@
 #include "esp_log.h"
 
 #include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
 
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
 
 static const char *TAG = "GUI_BMPfile";
 
@@ -460,274 +466,272 @@ UBYTE GUI_ReadBmp_RGB_4Color(const char *path, UWORD Xstart, UWORD Ystart)
     return 0;
 }
 #if 1
-UBYTE GUI_ReadBmp_RGB_6Color(const char *path, UWORD Xstart, UWORD Ystart)
+/******************************************************************************
+ * Streaming 24-bit BMP reader.
+ * Keeps a small block of consecutive file rows in DMA-capable RAM so FATFS can
+ * read whole sectors straight into it, instead of staging the full image.
+ * Rows are addressed top-down; bottom-up files (positive biHeight) are read
+ * backwards block by block when the caller walks them top to bottom.
+ ******************************************************************************/
+#define GUI_BMP_STREAM_BYTES (8 * 1024)
+
+typedef struct {
+    FILE *fp;
+    UDOUBLE dataOffset;
+    UDOUBLE rowSize;
+    UWORD width;
+    UWORD height;
+    bool topDown;
+    UBYTE *block;
+    UWORD blockRows;
+    int blockFirst;  // File row of block[0]; -1 when empty
+    UWORD blockCount;
+    int lastFileRow;
+} GUI_BmpStream;
+
+static void GUI_BmpStream_Close(GUI_BmpStream *s)
 {
-#if 0
-    FILE *fp;                     //Define a file pointer
-    BMPFILEHEADER bmpFileHeader;  //Define a bmp file header structure
-    BMPINFOHEADER bmpInfoHeader;  //Define a bmp info header structure
-    
-    // Binary file open
-    if((fp = fopen(path, "rb")) == NULL) {
-        ESP_LOGE(TAG,"Cann't open the file!");
-        return 0;
+    if (s->fp) {
+        fclose(s->fp);
+        s->fp = NULL;
     }
+    if (s->block) {
+        heap_caps_free(s->block);
+        s->block = NULL;
+    }
+}
 
-    // Set the file pointer from the beginning
-    fseek(fp, 0, SEEK_SET);
-    fread(&bmpFileHeader, sizeof(BMPFILEHEADER), 1, fp);    //sizeof(BMPFILEHEADER) must be 14
-    fread(&bmpInfoHeader, sizeof(BMPINFOHEADER), 1, fp);    //sizeof(BMPFILEHEADER) must be 50
-    printf("pixel = %ld * %ld\r\n", bmpInfoHeader.biWidth, bmpInfoHeader.biHeight);
-	
-    UDOUBLE Image_Byte = bmpInfoHeader.biWidth * bmpInfoHeader.biHeight * 3;
+static bool GUI_BmpStream_Open(GUI_BmpStream *s, const char *path)
+{
+    BMPFILEHEADER bmpFileHeader;
+    BMPINFOHEADER bmpInfoHeader;
 
-    UBYTE *Image = (UBYTE *)heap_caps_malloc(1000 * sizeof(uint8_t), MALLOC_CAP_8BIT);    
-    //for(int i = 0; i<Image_Byte; i++)
-    memset(Image, 0xFF, Image_Byte);
-    return 0;
-#else
-    FILE *fp;                     //Define a file pointer
-    BMPFILEHEADER bmpFileHeader;  //Define a bmp file header structure
-    BMPINFOHEADER bmpInfoHeader;  //Define a bmp info header structure
-    
-    // Binary file open
-    if((fp = fopen(path, "rb")) == NULL) {
-        ESP_LOGE(TAG,"Cann't open the file!");
-        return 0;
+    memset(s, 0, sizeof(*s));
+    s->blockFirst = -1;
+    s->lastFileRow = -1;
+
+    s->fp = fopen(path, "rb");
+    if (!s->fp) {
+        ESP_LOGE(TAG, "Can't open file: %s", path);
+        return false;
     }
 
-    // Set the file pointer from the beginning
-    fseek(fp, 0, SEEK_SET);
-    fread(&bmpFileHeader, sizeof(BMPFILEHEADER), 1, fp);    //sizeof(BMPFILEHEADER) must be 14
-    fread(&bmpInfoHeader, sizeof(BMPINFOHEADER), 1, fp);    //sizeof(BMPFILEHEADER) must be 50
-    printf("pixel = %ld * %ld\r\n", bmpInfoHeader.biWidth, bmpInfoHeader.biHeight);
-	
-    UDOUBLE Image_Byte = bmpInfoHeader.biWidth * bmpInfoHeader.biHeight * 3;
+    if (fread(&bmpFileHeader, sizeof(BMPFILEHEADER), 1, s->fp) != 1 ||
+        fread(&bmpInfoHeader, sizeof(BMPINFOHEADER), 1, s->fp) != 1) {
+        ESP_LOGE(TAG, "Failed to read BMP header");
+        GUI_BmpStream_Close(s);
+        return false;
+    }
 
-    UBYTE *Image = (UBYTE *)heap_caps_malloc(Image_Byte * sizeof(uint8_t), MALLOC_CAP_SPIRAM);    
-    //for(int i = 0; i<Image_Byte; i++)
-    //memset(Image, 0xFF, Image_Byte);
-    //ESP_LOGE("FILE","%ld",Image_Byte);
-    // Determine if it is a monochrome bitmap
-    int readbyte = bmpInfoHeader.biBitCount;
-    if(readbyte != 24){
-        ESP_LOGE(TAG,"Bmp image is not 24 bitmap!");
-        exit(0);
+    if (bmpInfoHeader.biBitCount != 24) {
+        ESP_LOGE(TAG, "Bmp image is not 24-bit!");
+        GUI_BmpStream_Close(s);
+        return false;
     }
-    // Read image data into the cache
-    UWORD x, y;
-    UBYTE Rdata[3];
-    fseek(fp, bmpFileHeader.bOffset, SEEK_SET);
-    
-    for(y = 0; y < bmpInfoHeader.biHeight; y++) {//Total display column
-        for(x = 0; x < bmpInfoHeader.biWidth ; x++) {//Show a line in the line
-            if(fread((char *)Rdata, 1, 1, fp) != 1) {
-                perror("get bmpdata:\r\n");
-                break;
-            }
-			if(fread((char *)Rdata+1, 1, 1, fp) != 1) {
-                perror("get bmpdata:\r\n");
-                break;
-            }
-			if(fread((char *)Rdata+2, 1, 1, fp) != 1) {
-                perror("get bmpdata:\r\n");
-                break;
-            }
 
-			if(Rdata[0] == 0 && Rdata[1] == 0 && Rdata[2] == 0){
-				Image[x+(y* bmpInfoHeader.biWidth )] =  0;//Black
-			}else if(Rdata[0] == 255 && Rdata[1] == 255 && Rdata[2] == 255){
-				Image[x+(y* bmpInfoHeader.biWidth )] =  1;//White
-			}else if(Rdata[0] == 0 && Rdata[1] == 255 && Rdata[2] == 255){
-				Image[x+(y* bmpInfoHeader.biWidth )] =  2;//Yellow
-			}else if(Rdata[0] == 0 && Rdata[1] == 0 && Rdata[2] == 255){
-				Image[x+(y* bmpInfoHeader.biWidth )] =  3;//Red
-			// }else if(Rdata[0] == 0 && Rdata[1] == 128 && Rdata[2] == 255){
-			// 	Image[x+(y* bmpInfoHeader.biWidth )] =  4;//Orange
-			}else if(Rdata[0] == 255 && Rdata[1] == 0 && Rdata[2] == 0){
-				Image[x+(y* bmpInfoHeader.biWidth )] =  5;//Blue
-			}else if(Rdata[0] == 0 && Rdata[1] == 255 && Rdata[2] == 0){
-				Image[x+(y* bmpInfoHeader.biWidth )] =  6;//Green
-			}
-        }
+    // biHeight is signed in the file format: negative means top-down rows.
+    const int32_t w = (int32_t)bmpInfoHeader.biWidth;
+    const int32_t h = (int32_t)bmpInfoHeader.biHeight;
+    if (w <= 0 || w > 0xFFFF || h == 0 || h < -0xFFFF || h > 0xFFFF) {
+        ESP_LOGE(TAG, "Unsupported BMP size %ld x %ld", (long)w, (long)h);
+        GUI_BmpStream_Close(s);
+        return false;
     }
-    fclose(fp);
-   
-    // Refresh the image to the display buffer based on the displayed orientation.
-    // Yield periodically to avoid starving lower-priority tasks / triggering the task watchdog.
-    for(y = 0; y < bmpInfoHeader.biHeight; y++) {
-        if ((y % 16) == 0 && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
-            vTaskDelay(pdMS_TO_TICKS(1));
-        }
-        for(x = 0; x < bmpInfoHeader.biWidth; x++) {
-            if(x > Paint.Width || y > Paint.Height) {
-                break;
-            }
-            Paint_SetPixel(Xstart + x, Ystart + y, Image[bmpInfoHeader.biHeight *  bmpInfoHeader.biWidth - 1 -(bmpInfoHeader.biWidth-x-1+(y* bmpInfoHeader.biWidth))]);
 
-		}
+    s->width = (UWORD)w;
+    s->height = (UWORD)((h < 0) ? -h : h);
+    s->topDown = (h < 0);
+    s->dataOffset = bmpFileHeader.bOffset;
+    s->rowSize = ((UDOUBLE)s->width * 3 + 3) & ~3u;
+
+    s->blockRows = (UWORD)(GUI_BMP_STREAM_BYTES / s->rowSize);
+    if (s->blockRows == 0) {
+        s->blockRows = 1;
+    }
+    if (s->blockRows > s->height) {
+        s->blockRows = s->height;
     }
-    heap_caps_free(Image);
-    Image = NULL;
-    return 0;
-#endif
-}
 
-static UWORD GUI_NormalizeRotate(UWORD Rotate)
-{
-    if (Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270)
-    {
-        return Rotate;
+    const size_t blockBytes = (size_t)s->blockRows * s->rowSize;
+    s->block = (UBYTE *)heap_caps_malloc(blockBytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (!s->block) {
+        s->block = (UBYTE *)heap_caps_malloc(blockBytes, MALLOC_CAP_8BIT);
     }
-    return ROTATE_0;
+    if (!s->block) {
+        ESP_LOGE(TAG, "Memory allocation failed!");
+        GUI_BmpStream_Close(s);
+        return false;
+    }
+
+    // Whole blocks are read at once; stdio buffering would only add a copy.
+    setvbuf(s->fp, NULL, _IONBF, 0);
+    return true;
 }
 
-UBYTE GUI_ReadBmp_RGB_6Color_Rotate(const char *path, UWORD Xstart, UWORD Ystart, UWORD srcRotate, UWORD dstRotate)
+// BGR pixels of file row `fileRow` (0 = first row stored in the file), or NULL on read error.
+static const UBYTE *GUI_BmpStream_FileRow(GUI_BmpStream *s, UWORD fileRow)
 {
-    FILE *fp;
-    BMPFILEHEADER bmpFileHeader;
-    BMPINFOHEADER bmpInfoHeader;
+    const int fr = (int)fileRow;
+    const bool backwards = (s->lastFileRow >= 0 && fr < s->lastFileRow);
+    s->lastFileRow = fr;
 
-    fp = fopen(path, "rb");
-    if (!fp) {
-        ESP_LOGE(TAG, "Can't open file: %s", path);
-        return 0;
+    if (s->blockFirst >= 0 && fr >= s->blockFirst && fr < s->blockFirst + (int)s->blockCount) {
+        return s->block + (size_t)(fr - s->blockFirst) * s->rowSize;
     }
 
-    if (fread(&bmpFileHeader, sizeof(BMPFILEHEADER), 1, fp) != 1 ||
-        fread(&bmpInfoHeader, sizeof(BMPINFOHEADER), 1, fp) != 1) {
-        ESP_LOGE(TAG, "Failed to read BMP header");
-        fclose(fp);
-        return 0;
+    // Fill the block in the direction the caller is walking.
+    int first = fr;
+    if (backwards) {
+        first = fr - (int)s->blockRows + 1;
+        if (first < 0) {
+            first = 0;
+        }
+    }
+    UWORD count = s->blockRows;
+    if (first + (int)count > (int)s->height) {
+        count = (UWORD)(s->height - first);
     }
 
-    if (bmpInfoHeader.biBitCount != 24) {
-        ESP_LOGE(TAG, "Bmp image is not 24-bit!");
-        fclose(fp);
-        return 0;
+    s->blockFirst = -1;
+    if (fseek(s->fp, (long)(s->dataOffset + (UDOUBLE)first * s->rowSize), SEEK_SET) != 0) {
+        ESP_LOGE(TAG, "fseek failed");
+        return NULL;
+    }
+    const size_t want = (size_t)count * s->rowSize;
+    const size_t got = fread(s->block, 1, want, s->fp);
+    if (got != want) {
+        ESP_LOGE(TAG, "BMP read error at line %d (got %u, want %u)", first, (unsigned)got, (unsigned)want);
+        return NULL;
     }
 
-    const UWORD width = (UWORD)bmpInfoHeader.biWidth;
-    const UWORD height = (UWORD)bmpInfoHeader.biHeight;
-    const int rowSize = ((width * 3 + 3) & ~3);
+    s->blockFirst = first;
+    s->blockCount = count;
+    return s->block + (size_t)(fr - first) * s->rowSize;
+}
 
-    UBYTE *rowBuf = (UBYTE *)heap_caps_malloc(rowSize, MALLOC_CAP_SPIRAM);
-    UBYTE *Image = (UBYTE *)heap_caps_malloc((size_t)width * (size_t)height, MALLOC_CAP_SPIRAM);
+// BGR pixels of image row `y` (0 = top), or NULL on read error.
+static const UBYTE *GUI_BmpStream_Row(GUI_BmpStream *s, UWORD y)
+{
+    return GUI_BmpStream_FileRow(s, s->topDown ? y : (UWORD)(s->height - 1 - y));
+}
 
-    if (!rowBuf || !Image) {
-        ESP_LOGE(TAG, "Memory allocation failed!");
-        if (rowBuf) heap_caps_free(rowBuf);
-        if (Image) heap_caps_free(Image);
-        fclose(fp);
+// Image row of a file row (the mapping is its own inverse).
+static inline UWORD GUI_BmpStream_ImageRow(const GUI_BmpStream *s, UWORD fileRow)
+{
+    return s->topDown ? fileRow : (UWORD)(s->height - 1 - fileRow);
+}
+
+UBYTE GUI_ReadBmp_RGB_6Color(const char *path, UWORD Xstart, UWORD Ystart)
+{
+    GUI_BmpStream s;
+    if (!GUI_BmpStream_Open(&s, path)) {
         return 0;
     }
+    printf("pixel = %u * %u\r\n", (unsigned)s.width, (unsigned)s.height);
 
-    if (fseek(fp, bmpFileHeader.bOffset, SEEK_SET) != 0) {
-        ESP_LOGE(TAG, "fseek failed");
-        heap_caps_free(rowBuf);
-        heap_caps_free(Image);
-        fclose(fp);
+    UBYTE *rowIdx = (UBYTE *)malloc(s.width);
+    if (!rowIdx) {
+        ESP_LOGE(TAG, "Memory allocation failed!");
+        GUI_BmpStream_Close(&s);
         return 0;
     }
 
-    // Read rows (BMP bottom-up) into a top-down color-index image.
-    for (UWORD y = 0; y < height; y++) {
-        const size_t got = fread(rowBuf, 1, rowSize, fp);
-        if (got != (size_t)rowSize) {
-            ESP_LOGE(TAG, "BMP read error at line %u (got %zu, want %u)", (unsigned)y, got, (unsigned)rowSize);
+    // No error diffusion here, so rows are drawn in file order (no seeking).
+    // Yield periodically to avoid starving lower-priority tasks / triggering the task watchdog.
+    for (UWORD fr = 0; fr < s.height; fr++) {
+        if ((fr % 16) == 0 && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
+        const UBYTE *bgr = GUI_BmpStream_FileRow(&s, fr);
+        if (!bgr) {
             break;
         }
+        GUI_Kernel_ExactRow6(bgr, rowIdx, s.width);
+        Paint_SetRow(Xstart, Ystart + GUI_BmpStream_ImageRow(&s, fr), rowIdx, s.width);
+    }
 
-        const UBYTE *p = rowBuf;
-        for (UWORD x = 0; x < width; x++) {
-            const UBYTE d0 = *p++; // Blue
-            const UBYTE d1 = *p++; // Green
-            const UBYTE d2 = *p++; // Red
-
-            UBYTE color;
-            if (d0 == 0 && d1 == 0 && d2 == 0) {
-                color = 0; // Black
-            } else if (d0 == 255 && d1 == 255 && d2 == 255) {
-                color = 1; // White
-            } else if (d0 == 0 && d1 == 255 && d2 == 255) {
-                color = 2; // Yellow
-            } else if (d0 == 0 && d1 == 0 && d2 == 255) {
-                color = 3; // Red
-            } else if (d0 == 255 && d1 == 0 && d2 == 0) {
-                color = 5; // Blue
-            } else if (d0 == 0 && d1 == 255 && d2 == 0) {
-                color = 6; // Green
-            } else {
-                color = 1; // Default white
-            }
+    free(rowIdx);
+    GUI_BmpStream_Close(&s);
+    return 0;
+}
 
-            Image[(size_t)(height - 1 - y) * (size_t)width + x] = color;
-        }
+static UWORD GUI_NormalizeRotate(UWORD Rotate)
+{
+    if (Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270)
+    {
+        return Rotate;
     }
+    return ROTATE_0;
+}
 
-    fclose(fp);
+UBYTE GUI_ReadBmp_RGB_6Color_Rotate(const char *path, UWORD Xstart, UWORD Ystart, UWORD srcRotate, UWORD dstRotate)
+{
+    GUI_BmpStream s;
+    if (!GUI_BmpStream_Open(&s, path)) {
+        return 0;
+    }
 
     const int src = (int)GUI_NormalizeRotate(srcRotate);
     const int dst = (int)GUI_NormalizeRotate(dstRotate);
     int delta = (dst - src) % 360;
     if (delta < 0) delta += 360;
 
-    UWORD outW = width;
-    UWORD outH = height;
-    if (delta == 90 || delta == 270) {
-        outW = height;
-        outH = width;
+    const UWORD width = s.width;
+    const UWORD height = s.height;
+
+    UBYTE *rowIdx = (UBYTE *)malloc(width);
+    UBYTE *rowRev = (UBYTE *)malloc(width);
+    if (!rowIdx || !rowRev) {
+        ESP_LOGE(TAG, "Memory allocation failed!");
+        free(rowIdx);
+        free(rowRev);
+        GUI_BmpStream_Close(&s);
+        return 0;
     }
 
-    // Draw (rotating from src -> dst) into the current Paint coordinate system.
+    // Each source row lands on one output row or column (rotating from src -> dst):
+    //   0:   src(sx, sy) -> out(sx, sy)
+    //   90:  src(sx, sy) -> out(height-1-sy, sx)       (clockwise)
+    //   180: src(sx, sy) -> out(width-1-sx, height-1-sy)
+    //   270: src(sx, sy) -> out(sy, width-1-sx)
+    // so rows can be drawn in file order without keeping the image.
     // Yield periodically to avoid starving lower-priority tasks / triggering the task watchdog.
-    for (UWORD y = 0; y < outH; y++) {
-        if ((y % 16) == 0 && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
+    for (UWORD fr = 0; fr < height; fr++) {
+        if ((fr % 16) == 0 && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
             vTaskDelay(pdMS_TO_TICKS(1));
         }
-        if ((UWORD)(Ystart + y) >= Paint.Height) break;
-        for (UWORD x = 0; x < outW; x++) {
-            if ((UWORD)(Xstart + x) >= Paint.Width) break;
-
-            int sx = 0;
-            int sy = 0;
-
-            switch (delta) {
-            case 0:
-                sx = x;
-                sy = y;
-                break;
-            case 90:
-                // Rotate clockwise 90: out(x,y) reads from src(y, height-1-x)
-                sx = (int)y;
-                sy = (int)height - 1 - (int)x;
-                break;
-            case 180:
-                sx = (int)width - 1 - (int)x;
-                sy = (int)height - 1 - (int)y;
-                break;
-            case 270:
-                // Rotate clockwise 270 (= counter-clockwise 90): out(x,y) reads from src(width-1-y, x)
-                sx = (int)width - 1 - (int)y;
-                sy = (int)x;
-                break;
-            default:
-                sx = x;
-                sy = y;
-                break;
-            }
+        const UBYTE *bgr = GUI_BmpStream_FileRow(&s, fr);
+        if (!bgr) {
+            break;
+        }
+        const UWORD sy = GUI_BmpStream_ImageRow(&s, fr);
+        GUI_Kernel_ExactRow6(bgr, rowIdx, width);
 
-            if (sx < 0 || sy < 0 || sx >= (int)width || sy >= (int)height) {
-                continue;
+        if (delta == 180 || delta == 270) {
+            for (UWORD x = 0; x < width; x++) {
+                rowRev[x] = rowIdx[width - 1 - x];
             }
+        }
 
-            const UBYTE color = Image[(size_t)sy * (size_t)width + (size_t)sx];
-            Paint_SetPixel(Xstart + x, Ystart + y, color);
+        switch (delta) {
+        case 90:
+            Paint_SetColumn(Xstart + (height - 1 - sy), Ystart, rowIdx, width);
+            break;
+        case 180:
+            Paint_SetRow(Xstart, Ystart + (height - 1 - sy), rowRev, width);
+            break;
+        case 270:
+            Paint_SetColumn(Xstart + sy, Ystart, rowRev, width);
+            break;
+        default:
+            Paint_SetRow(Xstart, Ystart + sy, rowIdx, width);
+            break;
         }
     }
 
-    heap_caps_free(rowBuf);
-    heap_caps_free(Image);
+    free(rowIdx);
+    free(rowRev);
+    GUI_BmpStream_Close(&s);
     return 0;
 }
 
@@ -769,14 +773,17 @@ bool GUI_Bmp_GetDimensions(const char *path, int *out_width, int *out_height)
         return false;
     }
 
-    if (bmpInfoHeader.biWidth <= 0 || bmpInfoHeader.biHeight == 0)
+    // The header fields are declared unsigned but are signed in the file format.
+    const int32_t rawW = (int32_t)bmpInfoHeader.biWidth;
+    const int32_t rawH = (int32_t)bmpInfoHeader.biHeight;
+    if (rawW <= 0 || rawH == 0)
     {
         return false;
     }
 
     // BMP height can be negative (top-down). Treat as absolute size.
-    const int w = (int)bmpInfoHeader.biWidth;
-    const int h = (bmpInfoHeader.biHeight < 0) ? (int)(-bmpInfoHeader.biHeight) : (int)bmpInfoHeader.biHeight;
+    const int w = (int)rawW;
+    const int h = (rawH < 0) ? (int)(-rawH) : (int)rawH;
 
     *out_width = w;
     *out_height = h;
@@ -788,142 +795,336 @@ static inline UWORD GUI_MinUword(UWORD a, UWORD b)
     return (a < b) ? a : b;
 }
 
-static inline float GUI_Clamp255f(float v)
+UBYTE GUI_DrawBmp_RGB_6Color_Fit(const char *path, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH, bool allow_upscale)
+{
+    return GUI_DrawBmp_RGB_6Color_FitRows(path, Xstart, Ystart, boxW, boxH, allow_upscale, GUI_DITHER_FLOYD_STEINBERG, NULL, NULL);
+}
+
+static const UBYTE *GUI_BmpStream_SourceRow(void *self, UWORD y)
+{
+    return GUI_BmpStream_Row((GUI_BmpStream *)self, y);
+}
+
+UBYTE GUI_DrawBmp_RGB_6Color_FitRows(const char *path, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH,
+                                     bool allow_upscale, GUI_DitherMode dither, GUI_RowDoneCallback onRow, void *ctx)
 {
-    if (v < 0.0f)
-        return 0.0f;
-    if (v > 255.0f)
-        return 255.0f;
-    return v;
+    GUI_BmpStream s;
+    if (!GUI_BmpStream_Open(&s, path))
+    {
+        return 0;
+    }
+
+    const GUI_RowSource src = {s.width, s.height, true, GUI_BmpStream_SourceRow, &s, false};
+    const UBYTE ret = GUI_DrawRows_RGB_6Color_FitRows(&src, Xstart, Ystart, boxW, boxH, allow_upscale, dither, onRow, ctx);
+    GUI_BmpStream_Close(&s);
+    return ret;
 }
 
+// Scaled rows in flight between the resampling task and the dither worker.
+#define GUI_FIT_RING_ROWS 4
+// Finished rows the worker can report ahead of the calling task.
+#define GUI_FIT_DRAWN_ROWS (2 * GUI_FIT_RING_ROWS)
+#define GUI_FIT_ROW_END 0xFFFF
+// Lower-priority tasks get a turn at most this often while a frame renders (a fixed
+// row count yields far more often on small images and slow sources alike).
+#define GUI_FIT_YIELD_US (50 * 1000)
+
 typedef struct {
-    uint8_t r;
-    uint8_t g;
-    uint8_t b;
-    uint8_t paint;
-} GUI_PaletteEntry;
-
-static const GUI_PaletteEntry GUI_PALETTE_6[6] = {
-    {0, 0, 0, 0},         // black
-    {255, 255, 255, 1},   // white
-    {255, 255, 0, 2},     // yellow
-    {255, 0, 0, 3},       // red
-    {0, 0, 255, 5},       // blue (note: paint index 5)
-    {0, 255, 0, 6},       // green
-};
-
-static inline uint8_t GUI_ClosestPaletteColor6(float r, float g, float b)
+    UWORD py;   // panel row, or GUI_FIT_ROW_END
+    UWORD n;    // rows dithered before this one
+    UBYTE slot; // index into GUI_FitPipe.rows
+} GUI_FitRowMsg;
+
+// How the rows of one fit render are shared between the calling task and a worker
+// pinned to the other core. In the striped splits each task dithers alternate row pairs:
+// independently in the ordered modes, through a GUI_DitherWave for error diffusion.
+typedef enum {
+    GUI_FIT_SERIAL,      // everything on the calling task
+    GUI_FIT_PIPELINE,    // the caller resamples, the worker dithers every row in order
+    GUI_FIT_STRIPES,     // shared source: each task also reads and resamples its own rows
+    GUI_FIT_STRIPES_FED, // the caller reads and resamples every row and hands the worker its own
+} GUI_FitSplit;
+
+// Worker-side fields are prefixed with w. The worker posts each row it stores to `drawn`,
+// so onRow always runs on the calling task, in production order.
+typedef struct {
+    GUI_FitSplit split;
+    const GUI_RowSource *src;
+    UWORD dx0;
+    UWORD dy0;
+    UWORD outW;
+    UWORD outH;
+    bool bottomUp;
+    GUI_RowDoneCallback onRow;
+    void *ctx;
+
+    GUI_Dither ds;
+    UBYTE *rows[GUI_FIT_RING_ROWS]; // rows[0] is the caller's; the rest only with a worker
+    UBYTE *paintRow;
+    UWORD reported;                 // stripes: rows produced and passed to onRow so far
+
+    GUI_Dither wds;                // wave: only its busyUs
+    GUI_Resampler wrs;             // stripes only
+    UBYTE *wPaintRow;
+    volatile bool abort;           // stripes: the caller failed, stop early
+
+    bool useWave; // striped error diffusion: both tasks dither through `wave`
+    GUI_DitherWave wave;
+
+    QueueHandle_t filled; // pipeline, fed stripes: GUI_FitRowMsg, caller -> worker
+    QueueHandle_t empty;  // pipeline, fed stripes: free slots, worker -> caller
+    QueueHandle_t drawn;  // UWORD panel rows stored by the worker, then GUI_FIT_ROW_END
+} GUI_FitPipe;
+
+static void GUI_FitMaybeYield(int64_t *lastYieldUs)
 {
-    int best = 0;
-    int bestD = 0x7FFFFFFF;
-    for (int i = 0; i < 6; i++)
+    const int64_t now = esp_timer_get_time();
+    if (now - *lastYieldUs >= GUI_FIT_YIELD_US && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
     {
-        const int dr = (int)r - (int)GUI_PALETTE_6[i].r;
-        const int dg = (int)g - (int)GUI_PALETTE_6[i].g;
-        const int db = (int)b - (int)GUI_PALETTE_6[i].b;
-        const int d = dr * dr + dg * dg + db * db;
-        if (d < bestD)
-        {
-            bestD = d;
-            best = i;
-        }
+        vTaskDelay(pdMS_TO_TICKS(1));
+        *lastYieldUs = esp_timer_get_time();
     }
-    return GUI_PALETTE_6[best].paint;
 }
 
-UBYTE GUI_DrawBmp_RGB_6Color_Fit(const char *path, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH, bool allow_upscale)
+// Output row (y) and panel row (py) of the i-th row produced; false if it lies off the panel.
+// Rows are produced in panel memory order: bottom-up when that is how rows are stored.
+static bool GUI_FitPipe_RowAt(const GUI_FitPipe *pipe, UWORD i, UWORD *y, UWORD *py)
 {
-    FILE *fp;
-    BMPFILEHEADER bmpFileHeader;
-    BMPINFOHEADER bmpInfoHeader;
+    *y = pipe->bottomUp ? (UWORD)(pipe->outH - 1 - i) : i;
+    *py = (UWORD)(pipe->dy0 + *y);
+    return *py < Paint.Height;
+}
 
-    fp = fopen(path, "rb");
-    if (!fp)
+// Stripes go by pairs of panel rows: at 90/270 degrees panel rows are memory columns and
+// two of them share each byte, so both must be written by the same task.
+static inline bool GUI_FitPipe_IsWorkerRow(UWORD py)
+{
+    return (py >> 1) & 1;
+}
+
+static inline bool GUI_FitPipe_IsStriped(const GUI_FitPipe *pipe)
+{
+    return pipe->split == GUI_FIT_STRIPES || pipe->split == GUI_FIT_STRIPES_FED;
+}
+
+// Dithers and stores the row of panel row py, with n rows dithered before it (by
+// either task). False if the wave was aborted.
+static bool GUI_FitPipe_StoreRow(GUI_FitPipe *pipe, GUI_Dither *ds, UBYTE *paintRow, const UBYTE *scaled, UWORD py,
+                                 UWORD n)
+{
+    if (pipe->useWave)
     {
-        ESP_LOGE(TAG, "Can't open file: %s", path);
-        return 0;
+        if (!GUI_DitherWave_Row(&pipe->wave, n, scaled, paintRow, &ds->busyUs))
+            return false;
+    }
+    else
+    {
+        ds->row = n;
+        GUI_Dither_Row(ds, scaled, paintRow);
     }
+    Paint_SetRow(pipe->dx0, py, paintRow, pipe->outW);
+    return true;
+}
 
-    if (fread(&bmpFileHeader, sizeof(BMPFILEHEADER), 1, fp) != 1 ||
-        fread(&bmpInfoHeader, sizeof(BMPINFOHEADER), 1, fp) != 1)
+// Calls onRow for the rows the worker has stored, waiting up to `wait` for each.
+// Returns false once the worker has finished.
+static bool GUI_FitPipe_ReportDrawn(GUI_FitPipe *pipe, TickType_t wait)
+{
+    UWORD py;
+    while (xQueueReceive(pipe->drawn, &py, wait) == pdTRUE)
     {
-        ESP_LOGE(TAG, "Failed to read BMP header");
-        fclose(fp);
-        return 0;
+        if (py == GUI_FIT_ROW_END)
+            return false;
+        if (pipe->onRow)
+            pipe->onRow(py, pipe->ctx);
     }
+    return true;
+}
 
-    if (bmpInfoHeader.biBitCount != 24)
+// Stripes: calls onRow, in production order, for the rows produced before `end`: the
+// caller's as they are (it has stored all of them), the worker's as they come in on
+// `drawn`, waiting up to `wait` for each. Returns false if the worker finished early.
+static bool GUI_FitPipe_ReportStripes(GUI_FitPipe *pipe, UWORD end, TickType_t wait)
+{
+    for (; pipe->reported < end; pipe->reported++)
     {
-        ESP_LOGE(TAG, "Bmp image is not 24-bit!");
-        fclose(fp);
-        return 0;
+        UWORD y;
+        UWORD py;
+        if (!GUI_FitPipe_RowAt(pipe, pipe->reported, &y, &py))
+            continue;
+        if (GUI_FitPipe_IsWorkerRow(py))
+        {
+            UWORD drawn;
+            if (xQueueReceive(pipe->drawn, &drawn, wait) != pdTRUE)
+                return true;
+            if (drawn == GUI_FIT_ROW_END)
+                return false;
+        }
+        if (pipe->onRow)
+            pipe->onRow(py, pipe->ctx);
     }
+    return true;
+}
 
-    const int width = (int)bmpInfoHeader.biWidth;
-    const int height_abs = (bmpInfoHeader.biHeight < 0) ? (int)(-bmpInfoHeader.biHeight) : (int)bmpInfoHeader.biHeight;
+static void GUI_FitPipe_Task(void *arg)
+{
+    GUI_FitPipe *pipe = (GUI_FitPipe *)arg;
+    int64_t lastYield = esp_timer_get_time();
 
-    if (width <= 0 || height_abs <= 0)
+    if (pipe->split == GUI_FIT_STRIPES)
     {
-        fclose(fp);
-        return 0;
+        UBYTE *scaled = pipe->rows[1];
+        UWORD n = 0;
+        for (UWORD i = 0; i < pipe->outH && !pipe->abort; i++)
+        {
+            UWORD y;
+            UWORD py;
+            if (!GUI_FitPipe_RowAt(pipe, i, &y, &py))
+                continue;
+            const UWORD rowN = n++;
+            if (!GUI_FitPipe_IsWorkerRow(py))
+                continue;
+            if (!GUI_Resampler_Row(&pipe->wrs, pipe->src, y, scaled))
+            {
+                // Release the caller if it is waiting on this row.
+                if (pipe->useWave)
+                    GUI_DitherWave_Abort(&pipe->wave);
+                break;
+            }
+            if (!GUI_FitPipe_StoreRow(pipe, &pipe->wds, pipe->wPaintRow, scaled, py, rowN))
+                break;
+            xQueueSend(pipe->drawn, &py, portMAX_DELAY);
+            GUI_FitMaybeYield(&lastYield);
+        }
+    }
+    else
+    {
+        GUI_FitRowMsg msg;
+        while (xQueueReceive(pipe->filled, &msg, portMAX_DELAY) == pdTRUE && msg.py != GUI_FIT_ROW_END)
+        {
+            const bool stored =
+                GUI_FitPipe_StoreRow(pipe, &pipe->wds, pipe->wPaintRow, pipe->rows[msg.slot], msg.py, msg.n);
+            xQueueSend(pipe->empty, &msg.slot, portMAX_DELAY);
+            if (stored)
+                xQueueSend(pipe->drawn, &msg.py, portMAX_DELAY);
+            GUI_FitMaybeYield(&lastYield);
+        }
     }
 
-    const UWORD srcW = (UWORD)width;
-    const UWORD srcH = (UWORD)height_abs;
-
-    const int rowSize = (((int)srcW * 3 + 3) & ~3);
+    const UWORD end = GUI_FIT_ROW_END;
+    xQueueSend(pipe->drawn, &end, portMAX_DELAY);
+    vTaskDelete(NULL);
+}
 
-    UBYTE *rowBuf = (UBYTE *)heap_caps_malloc((size_t)rowSize, MALLOC_CAP_SPIRAM);
-    uint8_t *srcRgb = (uint8_t *)heap_caps_malloc((size_t)srcW * (size_t)srcH * 3, MALLOC_CAP_SPIRAM);
+static void GUI_FitPipe_Free(GUI_FitPipe *pipe)
+{
+    if (pipe->filled)
+        vQueueDelete(pipe->filled);
+    if (pipe->empty)
+        vQueueDelete(pipe->empty);
+    if (pipe->drawn)
+        vQueueDelete(pipe->drawn);
+    pipe->filled = NULL;
+    pipe->empty = NULL;
+    pipe->drawn = NULL;
+    for (int i = 0; i < GUI_FIT_RING_ROWS; i++)
+    {
+        free(pipe->rows[i]);
+        pipe->rows[i] = NULL;
+    }
+    free(pipe->paintRow);
+    free(pipe->wPaintRow);
+    pipe->paintRow = NULL;
+    pipe->wPaintRow = NULL;
+    GUI_Dither_Deinit(&pipe->ds);
+    GUI_Dither_Deinit(&pipe->wds);
+    GUI_Resampler_Deinit(&pipe->wrs);
+    GUI_DitherWave_Deinit(&pipe->wave);
+}
 
-    if (!rowBuf || !srcRgb)
+// Allocates the worker's half for `split` and starts it on the other core.
+// On failure (single core, out of memory) the caller renders serially.
+static bool GUI_FitPipe_StartWorker(GUI_FitPipe *pipe, GUI_FitSplit split, GUI_DitherMode dither)
+{
+#if CONFIG_FREERTOS_UNICORE
+    (void)pipe;
+    (void)split;
+    (void)dither;
+    return false;
+#else
+    if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING)
     {
-        ESP_LOGE(TAG, "Memory allocation failed!");
-        if (rowBuf)
-            heap_caps_free(rowBuf);
-        if (srcRgb)
-            heap_caps_free(srcRgb);
-        fclose(fp);
-        return 0;
+        return false;
     }
 
-    if (fseek(fp, bmpFileHeader.bOffset, SEEK_SET) != 0)
+    const int ringRows = (split == GUI_FIT_STRIPES) ? 2 : GUI_FIT_RING_ROWS;
+    for (int i = 1; i < ringRows; i++)
     {
-        ESP_LOGE(TAG, "fseek failed");
-        heap_caps_free(rowBuf);
-        heap_caps_free(srcRgb);
-        fclose(fp);
-        return 0;
+        pipe->rows[i] = (UBYTE *)malloc((size_t)pipe->outW * 3);
+        if (!pipe->rows[i])
+            return false;
+    }
+    // Striped error diffusion keeps its errors in the shared wave; wds then only keeps time.
+    const bool wave = (split != GUI_FIT_PIPELINE) && !GUI_Dither_IsOrdered(dither);
+    pipe->wPaintRow = (UBYTE *)malloc(pipe->outW);
+    pipe->drawn = xQueueCreate(GUI_FIT_DRAWN_ROWS, sizeof(UWORD));
+    if (!pipe->wPaintRow || !pipe->drawn ||
+        !(wave ? GUI_DitherWave_Init(&pipe->wave, pipe->outW, dither) : GUI_Dither_Init(&pipe->wds, pipe->outW, dither)))
+    {
+        return false;
     }
 
-    // Decode BMP into a top-down RGB888 buffer.
-    for (UWORD y = 0; y < srcH; y++)
+    if (split == GUI_FIT_STRIPES)
+    {
+        if (!GUI_Resampler_Init(&pipe->wrs, pipe->src->width, pipe->src->height, pipe->outW, pipe->outH))
+            return false;
+    }
+    else
     {
-        const size_t got = fread(rowBuf, 1, (size_t)rowSize, fp);
-        if (got != (size_t)rowSize)
+        // Fed stripes keep rows[0] for the caller's own rows.
+        pipe->filled = xQueueCreate(GUI_FIT_RING_ROWS + 1, sizeof(GUI_FitRowMsg));
+        pipe->empty = xQueueCreate(GUI_FIT_RING_ROWS, sizeof(UBYTE));
+        if (!pipe->filled || !pipe->empty)
+            return false;
+        for (UBYTE i = (split == GUI_FIT_STRIPES_FED) ? 1 : 0; i < GUI_FIT_RING_ROWS; i++)
         {
-            ESP_LOGE(TAG, "BMP read error at line %u (got %zu, want %u)", (unsigned)y, got, (unsigned)rowSize);
-            break;
+            xQueueSend(pipe->empty, &i, 0);
         }
+    }
+
+    pipe->split = split;
+    pipe->useWave = wave;
+    const BaseType_t core = (xPortGetCoreID() == 0) ? 1 : 0;
+    if (xTaskCreatePinnedToCore(GUI_FitPipe_Task, "fit_dither", 3 * 1024, pipe, uxTaskPriorityGet(NULL), NULL,
+                                core) != pdPASS)
+    {
+        pipe->split = GUI_FIT_SERIAL;
+        pipe->useWave = false;
+        return false;
+    }
+    return true;
+#endif
+}
 
-        // BMP is bottom-up unless height is negative.
-        const UWORD dstY = (bmpInfoHeader.biHeight < 0) ? y : (UWORD)(srcH - 1 - y);
-        uint8_t *dst = srcRgb + ((size_t)dstY * (size_t)srcW * 3);
+// Rows are produced in panel memory order so finished bands can be sent early.
+// At 180 degrees that means bottom-up; the dither then runs top-down on the panel,
+// exactly as it does at 0 degrees. At 90/270 rows are panel columns, so order doesn't matter.
+bool GUI_FitRows_BottomUp(void)
+{
+    const bool rowsAreMemRows = (Paint.Rotate == ROTATE_0 || Paint.Rotate == ROTATE_180);
+    return rowsAreMemRows && Paint_GetMemoryRow(0, 0) > Paint_GetMemoryRow(0, 1);
+}
 
-        const UBYTE *p = rowBuf;
-        for (UWORD x = 0; x < srcW; x++)
-        {
-            const uint8_t b = *p++;
-            const uint8_t g = *p++;
-            const uint8_t r = *p++;
-            dst[(size_t)x * 3 + 0] = r;
-            dst[(size_t)x * 3 + 1] = g;
-            dst[(size_t)x * 3 + 2] = b;
-        }
+UBYTE GUI_DrawRows_RGB_6Color_FitRows(const GUI_RowSource *src, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH,
+                                      bool allow_upscale, GUI_DitherMode dither, GUI_RowDoneCallback onRow, void *ctx)
+{
+    if (!src || !src->row || src->width == 0 || src->height == 0)
+    {
+        return 0;
     }
 
-    fclose(fp);
+    const UWORD srcW = src->width;
+    const UWORD srcH = src->height;
 
     // Compute fit-scaled output size.
     UWORD outW = boxW;
@@ -962,153 +1163,165 @@ UBYTE GUI_DrawBmp_RGB_6Color_Fit(const char *path, UWORD Xstart, UWORD Ystart, U
     const int dx0 = (int)Xstart + (int)(boxW - outW) / 2;
     const int dy0 = (int)Ystart + (int)(boxH - outH) / 2;
 
-    // Floyd–Steinberg dithering in destination space.
-    float *errR = (float *)malloc(sizeof(float) * ((size_t)outW + 2));
-    float *errG = (float *)malloc(sizeof(float) * ((size_t)outW + 2));
-    float *errB = (float *)malloc(sizeof(float) * ((size_t)outW + 2));
-
-    float *nextErrR = (float *)malloc(sizeof(float) * ((size_t)outW + 2));
-    float *nextErrG = (float *)malloc(sizeof(float) * ((size_t)outW + 2));
-    float *nextErrB = (float *)malloc(sizeof(float) * ((size_t)outW + 2));
-
-    if (!errR || !errG || !errB || !nextErrR || !nextErrG || !nextErrB)
+    // Dithering in destination space (fixed point, see GUI_Dither.c).
+    // Source rows are streamed as needed and resampled (see GUI_Resample.c). With two cores
+    // the work is split as described at GUI_FitSplit; the output is the same either way.
+    GUI_FitPipe pipe;
+    memset(&pipe, 0, sizeof(pipe));
+    pipe.src = src;
+    pipe.dx0 = (UWORD)dx0;
+    pipe.dy0 = (UWORD)dy0;
+    pipe.outW = outW;
+    pipe.outH = outH;
+    pipe.onRow = onRow;
+    pipe.ctx = ctx;
+
+    pipe.bottomUp = GUI_FitRows_BottomUp();
+
+    GUI_Resampler rs;
+    pipe.rows[0] = (UBYTE *)malloc((size_t)outW * 3);
+    pipe.paintRow = (UBYTE *)malloc((size_t)outW);
+    const bool dsOk = GUI_Dither_Init(&pipe.ds, outW, dither);
+    const bool rsOk = GUI_Resampler_Init(&rs, srcW, srcH, outW, outH);
+
+    if (!pipe.rows[0] || !pipe.paintRow || !dsOk || !rsOk)
     {
-        if (errR)
-            free(errR);
-        if (errG)
-            free(errG);
-        if (errB)
-            free(errB);
-        if (nextErrR)
-            free(nextErrR);
-        if (nextErrG)
-            free(nextErrG);
-        if (nextErrB)
-            free(nextErrB);
-
-        heap_caps_free(rowBuf);
-        heap_caps_free(srcRgb);
+        ESP_LOGE(TAG, "Memory allocation failed!");
+        GUI_FitPipe_Free(&pipe);
+        GUI_Resampler_Deinit(&rs);
         return 0;
     }
 
-    memset(errR, 0, sizeof(float) * ((size_t)outW + 2));
-    memset(errG, 0, sizeof(float) * ((size_t)outW + 2));
-    memset(errB, 0, sizeof(float) * ((size_t)outW + 2));
-    memset(nextErrR, 0, sizeof(float) * ((size_t)outW + 2));
-    memset(nextErrG, 0, sizeof(float) * ((size_t)outW + 2));
-    memset(nextErrB, 0, sizeof(float) * ((size_t)outW + 2));
-
-    for (UWORD y = 0; y < outH; y++)
+    // Ordered modes depend only on position, so each task can dither its own rows; the
+    // left-to-right diffusion kernels can too, each row trailing the one above it through a
+    // GUI_DitherWave. Serpentine scans alternate rows right-to-left, which needs the whole
+    // row above first, so it only overlaps resampling with dithering (pipeline), or runs
+    // serially when the rows are a plain copy and there is nothing to overlap.
+    // A shared source lets each task read its own rows; otherwise the caller reads them all,
+    // which only pays off over the pipeline when reading is cheap, i.e. unscaled.
+    const bool unscaled = rs.x.identity && rs.y.identity;
+    const bool stripable = GUI_Dither_IsOrdered(pipe.ds.mode) || GUI_Dither_WaveSupported(pipe.ds.mode);
+    GUI_FitSplit want = GUI_FIT_SERIAL;
+    if (stripable && src->shared)
+        want = GUI_FIT_STRIPES;
+    else if (stripable && unscaled)
+        want = GUI_FIT_STRIPES_FED;
+    else if (!unscaled)
+        want = GUI_FIT_PIPELINE;
+    if (want != GUI_FIT_SERIAL && !GUI_FitPipe_StartWorker(&pipe, want, pipe.ds.mode))
     {
-        if ((y % 16) == 0 && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
-        {
-            vTaskDelay(pdMS_TO_TICKS(1));
-        }
-
-        const UWORD py = (UWORD)(dy0 + (int)y);
-        if (py >= Paint.Height)
-            break;
-
-        const UWORD sy = (UWORD)((uint64_t)y * (uint64_t)srcH / (uint64_t)outH);
-        const uint8_t *srcRow = srcRgb + ((size_t)sy * (size_t)srcW * 3);
-
-        for (UWORD x = 0; x < outW; x++)
-        {
-            const UWORD px = (UWORD)(dx0 + (int)x);
-            if (px >= Paint.Width)
-                break;
-
-            const UWORD sx = (UWORD)((uint64_t)x * (uint64_t)srcW / (uint64_t)outW);
-            const uint8_t *sp = srcRow + ((size_t)sx * 3);
-
-            float r = (float)sp[0] + errR[x];
-            float g = (float)sp[1] + errG[x];
-            float b = (float)sp[2] + errB[x];
-
-            r = GUI_Clamp255f(r);
-            g = GUI_Clamp255f(g);
-            b = GUI_Clamp255f(b);
+        pipe.split = GUI_FIT_SERIAL;
+    }
 
-            // Quantize
-            const uint8_t paint = GUI_ClosestPaletteColor6(r, g, b);
-            Paint_SetPixel(px, py, paint);
+    const int64_t t0 = esp_timer_get_time();
+    int64_t lastYield = t0;
+    bool complete = true;
+    bool workerRunning = (pipe.split != GUI_FIT_SERIAL);
+    const bool striped = GUI_FitPipe_IsStriped(&pipe);
+    UWORD n = 0; // rows dithered (or handed to the worker) so far
 
-            // Find the palette RGB we used (for error calc).
-            uint8_t pr = 255, pg = 255, pb = 255;
-            for (int i = 0; i < 6; i++)
-            {
-                if (GUI_PALETTE_6[i].paint == paint)
-                {
-                    pr = GUI_PALETTE_6[i].r;
-                    pg = GUI_PALETTE_6[i].g;
-                    pb = GUI_PALETTE_6[i].b;
-                    break;
-                }
-            }
+    for (UWORD i = 0; i < outH; i++)
+    {
+        GUI_FitMaybeYield(&lastYield);
 
-            const float er = r - (float)pr;
-            const float eg = g - (float)pg;
-            const float eb = b - (float)pb;
+        UWORD y;
+        UWORD py;
+        if (!GUI_FitPipe_RowAt(&pipe, i, &y, &py))
+            continue;
 
-            // Right pixel (7/16)
-            if (x + 1 < outW)
+        GUI_FitRowMsg msg = {py, n++, 0};
+        const bool workerRow = striped && GUI_FitPipe_IsWorkerRow(py);
+        if (workerRow && pipe.split == GUI_FIT_STRIPES)
+        {
+            // The worker reads this one itself.
+            if (!GUI_FitPipe_ReportStripes(&pipe, i, 0))
             {
-                errR[x + 1] += er * (7.0f / 16.0f);
-                errG[x + 1] += eg * (7.0f / 16.0f);
-                errB[x + 1] += eb * (7.0f / 16.0f);
+                ESP_LOGE(TAG, "Fit: worker stopped before output row %u", (unsigned)y);
+                workerRunning = false;
+                complete = false;
+                break;
             }
+            continue;
+        }
 
-            // Next row
-            if (y + 1 < outH)
-            {
-                if (x > 0)
-                {
-                    nextErrR[x - 1] += er * (3.0f / 16.0f);
-                    nextErrG[x - 1] += eg * (3.0f / 16.0f);
-                    nextErrB[x - 1] += eb * (3.0f / 16.0f);
-                }
-
-                nextErrR[x] += er * (5.0f / 16.0f);
-                nextErrG[x] += eg * (5.0f / 16.0f);
-                nextErrB[x] += eb * (5.0f / 16.0f);
+        if (pipe.split == GUI_FIT_PIPELINE || workerRow)
+        {
+            if (pipe.split == GUI_FIT_PIPELINE)
+                (void)GUI_FitPipe_ReportDrawn(&pipe, 0);
+            xQueueReceive(pipe.empty, &msg.slot, portMAX_DELAY);
+        }
 
-                if (x + 1 < outW)
-                {
-                    nextErrR[x + 1] += er * (1.0f / 16.0f);
-                    nextErrG[x + 1] += eg * (1.0f / 16.0f);
-                    nextErrB[x + 1] += eb * (1.0f / 16.0f);
-                }
-            }
+        // Scale (and convert BGR -> RGB) in one pass.
+        if (!GUI_Resampler_Row(&rs, src, y, pipe.rows[msg.slot]))
+        {
+            ESP_LOGE(TAG, "Fit: source row for output row %u unavailable", (unsigned)y);
+            complete = false;
+            break;
         }
 
-        // Swap row buffers.
-        float *tmp;
-        tmp = errR;
-        errR = nextErrR;
-        nextErrR = tmp;
-        memset(nextErrR, 0, sizeof(float) * ((size_t)outW + 2));
+        if (pipe.split == GUI_FIT_PIPELINE || workerRow)
+        {
+            xQueueSend(pipe.filled, &msg, portMAX_DELAY);
+            continue;
+        }
 
-        tmp = errG;
-        errG = nextErrG;
-        nextErrG = tmp;
-        memset(nextErrG, 0, sizeof(float) * ((size_t)outW + 2));
+        if (!GUI_FitPipe_StoreRow(&pipe, &pipe.ds, pipe.paintRow, pipe.rows[0], py, msg.n))
+        {
+            // The worker gave up on a row this one depends on.
+            ESP_LOGE(TAG, "Fit: worker stopped before output row %u", (unsigned)y);
+            complete = false;
+            break;
+        }
+        if (!striped)
+        {
+            if (onRow)
+                onRow(py, ctx);
+        }
+        else if (!GUI_FitPipe_ReportStripes(&pipe, (UWORD)(i + 1), 0))
+        {
+            ESP_LOGE(TAG, "Fit: worker stopped before output row %u", (unsigned)y);
+            workerRunning = false;
+            complete = false;
+            break;
+        }
+    }
 
-        tmp = errB;
-        errB = nextErrB;
-        nextErrB = tmp;
-        memset(nextErrB, 0, sizeof(float) * ((size_t)outW + 2));
+    if (workerRunning)
+    {
+        // Pipeline and fed stripes: the worker stores the rows still queued before it sees
+        // the end marker. Stripes: after a failure the worker stops at its next row.
+        if (pipe.split == GUI_FIT_PIPELINE || pipe.split == GUI_FIT_STRIPES_FED)
+        {
+            const GUI_FitRowMsg end = {GUI_FIT_ROW_END, 0, 0};
+            xQueueSend(pipe.filled, &end, portMAX_DELAY);
+        }
+        if (!complete)
+        {
+            pipe.abort = true;
+            if (pipe.useWave)
+                GUI_DitherWave_Abort(&pipe.wave);
+            pipe.onRow = NULL;
+        }
+        else if (striped && !GUI_FitPipe_ReportStripes(&pipe, outH, portMAX_DELAY))
+        {
+            ESP_LOGE(TAG, "Fit: worker stopped before the last row");
+            workerRunning = false;
+            complete = false;
+        }
+        if (workerRunning)
+            (void)GUI_FitPipe_ReportDrawn(&pipe, portMAX_DELAY);
     }
 
-    free(errR);
-    free(errG);
-    free(errB);
-    free(nextErrR);
-    free(nextErrG);
-    free(nextErrB);
+    static const char *const splitNames[] = {"1 core", "2 cores, pipelined", "2 cores, striped",
+                                             "2 cores, striped, rows read by the caller"};
+    ESP_LOGI(TAG, "Fit %ux%u -> %ux%u: read+scale+dither %lld ms (dither %s %lld ms, %s%s)", (unsigned)srcW,
+             (unsigned)srcH, (unsigned)outW, (unsigned)outH, (long long)((esp_timer_get_time() - t0) / 1000),
+             GUI_Dither_ModeName(pipe.ds.mode), (long long)((pipe.ds.busyUs + pipe.wds.busyUs) / 1000),
+             splitNames[pipe.split], pipe.useWave ? ", wavefront" : "");
 
-    heap_caps_free(rowBuf);
-    heap_caps_free(srcRgb);
-    return 0;
+    GUI_Resampler_Deinit(&rs);
+    GUI_FitPipe_Free(&pipe);
+    return complete ? 1 : 0;
 }
 #else
 
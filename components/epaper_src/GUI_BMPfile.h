@@ -52,6 +52,7 @@
 #include <stdbool.h>
 
 #include "DEV_Config.h"
+#include "GUI_Dither.h"
 
 /*Bitmap file header   14bit*/
 typedef struct BMP_FILE_HEADER {
@@ -108,6 +109,35 @@ bool GUI_Bmp_GetDimensions(const char *path, int *out_width, int *out_height);
 // Draw a 24-bit BMP (6-color palette) fit-scaled into a box and centered.
 // If allow_upscale is false, images smaller than the box are not upscaled.
 UBYTE GUI_DrawBmp_RGB_6Color_Fit(const char *path, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH, bool allow_upscale);
+// Same as GUI_DrawBmp_RGB_6Color_Fit (which uses Floyd-Steinberg), but dithers with `dither`
+// and calls onRow(Y, ctx) after each output row is drawn (always on the calling task, even
+// when part of the work runs on the other core). Rows are produced in panel memory
+// order (bottom-up at 180 degrees), so the caller can send finished bands while the rest
+// of the image is still being rendered. Returns 1 only if every output row was drawn, 0 if the
+// file could not be opened or decoded, memory ran out, or a row could not be read.
+typedef void (*GUI_RowDoneCallback)(UWORD Ypoint, void *ctx);
+UBYTE GUI_DrawBmp_RGB_6Color_FitRows(const char *path, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH,
+                                     bool allow_upscale, GUI_DitherMode dither, GUI_RowDoneCallback onRow, void *ctx);
+
+// 24-bit rows of a decoded image, addressed top-down (0 = top row), for the fit renderer.
+// row() returns NULL on a read/decode error. Pixels are B,G,R when bgr is set, else R,G,B.
+// Set shared when row() may be called from two tasks at once (e.g. the image is already
+// decoded in memory); the renderer can then let each core read and resample its own rows.
+typedef struct {
+    UWORD width;
+    UWORD height;
+    bool bgr;
+    const UBYTE *(*row)(void *self, UWORD y);
+    void *self;
+    bool shared;
+} GUI_RowSource;
+
+// Fit renderer behind GUI_DrawBmp_RGB_6Color_FitRows, for other image formats (same return value).
+UBYTE GUI_DrawRows_RGB_6Color_FitRows(const GUI_RowSource *src, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH,
+                                      bool allow_upscale, GUI_DitherMode dither, GUI_RowDoneCallback onRow, void *ctx);
+// True when the fit renderer will produce rows bottom-up for the current Paint rotation
+// (180 degrees), i.e. ask its source for the last rows first.
+bool GUI_FitRows_BottomUp(void);
 
 UBYTE GUI_ReadBmp_RGB_7Color(const char *path, UWORD Xstart, UWORD Ystart);
 
@@ -0,0 +1,76 @@
+/*****************************************************************************
+* | File      	:   GUI_BlueNoise.c
+* | Function    :   Blue-noise threshold tile for ordered dithering
+* | Info        :
+*                Generated by tools/gen_blue_noise.py (void-and-cluster,
+*                sigma 1.5, seed 1); re-run it instead of changing this file.
+******************************************************************************/
+#include "GUI_Dither.h"
+
+// Rank of each pixel scaled to 0..255, row-major; tiles seamlessly.
+const UBYTE GUI_BLUE_NOISE[GUI_BLUE_NOISE_SIZE * GUI_BLUE_NOISE_SIZE] = {
+    245, 130, 168, 73, 214, 95, 7, 111, 44, 177, 145, 221, 170, 236, 129, 86, 187, 68, 108, 192, 88, 178, 228, 8, 77, 42, 196, 96, 78, 203, 162, 132, 245, 189, 64, 100, 243, 19, 214, 132, 172, 54, 88, 180, 108, 218, 194, 14, 132, 183, 9, 207, 167, 132, 194, 249, 41, 71, 240, 7, 176, 135, 228, 192,
+    20, 100, 41, 181, 19, 255, 165, 188, 231, 65, 15, 94, 51, 202, 149, 38, 246, 158, 50, 139, 255, 19, 99, 201, 238, 122, 217, 15, 146, 45, 232, 113, 6, 90, 222, 141, 117, 155, 77, 251, 2, 147, 199, 19, 232, 57, 140, 236, 70, 49, 246, 105, 84, 54, 0, 97, 172, 19, 146, 219, 61, 36, 103, 54,
+    157, 219, 140, 230, 121, 55, 138, 27, 87, 130, 241, 194, 119, 0, 100, 211, 12, 124, 225, 26, 67, 210, 132, 59, 161, 23, 171, 255, 109, 188, 26, 65, 182, 156, 41, 26, 195, 59, 183, 43, 98, 235, 68, 130, 162, 83, 34, 174, 115, 200, 142, 27, 180, 238, 150, 213, 126, 195, 106, 84, 164, 254, 124, 180,
+    197, 67, 23, 89, 194, 76, 224, 106, 159, 210, 35, 152, 72, 255, 181, 66, 166, 82, 201, 171, 114, 151, 38, 191, 85, 106, 39, 69, 130, 224, 87, 140, 208, 107, 255, 82, 216, 8, 112, 206, 166, 118, 36, 210, 11, 241, 104, 213, 2, 92, 164, 66, 215, 109, 34, 76, 59, 245, 43, 201, 25, 210, 0, 84,
+    34, 115, 249, 164, 3, 150, 41, 200, 6, 57, 109, 186, 23, 126, 48, 136, 239, 19, 99, 46, 235, 80, 218, 11, 246, 148, 207, 181, 2, 51, 169, 240, 13, 53, 176, 131, 166, 233, 143, 83, 16, 222, 152, 96, 176, 123, 64, 145, 250, 36, 230, 125, 19, 143, 186, 227, 167, 25, 157, 134, 111, 75, 151, 240,
+    212, 147, 52, 205, 107, 237, 181, 84, 228, 168, 245, 83, 213, 163, 224, 90, 35, 216, 122, 189, 2, 164, 110, 177, 129, 53, 228, 89, 158, 205, 103, 37, 125, 219, 67, 21, 95, 36, 63, 245, 190, 54, 77, 253, 46, 196, 23, 168, 54, 187, 78, 203, 57, 254, 85, 11, 120, 98, 220, 57, 236, 174, 49, 131,
+    9, 92, 173, 31, 133, 61, 22, 116, 136, 69, 13, 141, 43, 102, 9, 196, 148, 174, 69, 136, 251, 62, 33, 233, 74, 17, 121, 31, 248, 72, 146, 190, 80, 154, 193, 238, 119, 209, 161, 132, 32, 122, 182, 4, 140, 226, 85, 209, 130, 100, 151, 6, 174, 102, 42, 138, 209, 177, 5, 90, 192, 17, 224, 101,
+    187, 229, 71, 241, 87, 217, 172, 247, 46, 215, 194, 118, 236, 183, 63, 249, 109, 49, 227, 26, 90, 209, 145, 94, 201, 155, 185, 99, 134, 11, 222, 25, 249, 108, 2, 141, 50, 181, 11, 91, 227, 156, 208, 107, 66, 161, 114, 10, 223, 29, 245, 119, 218, 155, 190, 232, 52, 74, 251, 145, 41, 123, 71, 161,
+    58, 129, 17, 184, 156, 12, 101, 150, 30, 96, 159, 20, 76, 154, 31, 131, 81, 6, 200, 156, 180, 120, 13, 170, 42, 245, 64, 219, 48, 175, 117, 62, 164, 41, 90, 215, 76, 252, 108, 199, 62, 18, 86, 232, 29, 246, 44, 182, 73, 165, 49, 89, 32, 71, 14, 110, 161, 31, 198, 111, 168, 243, 204, 35,
+    252, 198, 95, 118, 40, 197, 72, 207, 127, 184, 253, 50, 226, 108, 215, 193, 170, 242, 114, 75, 37, 240, 58, 221, 128, 105, 5, 195, 151, 241, 93, 206, 133, 234, 197, 170, 28, 150, 44, 168, 242, 116, 47, 175, 128, 193, 97, 146, 232, 126, 206, 179, 234, 133, 201, 246, 89, 130, 222, 59, 20, 82, 141, 107,
+    25, 144, 51, 221, 248, 138, 48, 239, 4, 61, 88, 140, 177, 1, 88, 52, 20, 140, 56, 229, 149, 104, 189, 83, 24, 214, 141, 88, 33, 73, 16, 182, 52, 10, 123, 62, 115, 229, 84, 3, 141, 188, 217, 150, 74, 7, 216, 58, 14, 102, 25, 64, 146, 100, 55, 28, 182, 6, 153, 101, 184, 226, 0, 172,
+    83, 213, 167, 74, 8, 108, 177, 83, 162, 217, 116, 29, 206, 124, 248, 149, 221, 94, 191, 22, 213, 9, 135, 253, 157, 51, 173, 234, 125, 213, 156, 103, 223, 82, 155, 244, 21, 192, 126, 222, 72, 32, 93, 19, 241, 120, 160, 84, 251, 194, 158, 240, 1, 218, 166, 117, 206, 76, 240, 45, 210, 118, 68, 235,
+    40, 120, 20, 186, 151, 212, 29, 124, 193, 20, 237, 155, 71, 39, 167, 63, 119, 35, 165, 128, 88, 169, 69, 38, 203, 115, 67, 13, 190, 48, 255, 29, 137, 188, 37, 208, 99, 174, 56, 202, 107, 249, 135, 170, 56, 198, 37, 176, 137, 46, 115, 88, 187, 42, 80, 142, 228, 36, 174, 86, 149, 28, 137, 193,
+    161, 247, 103, 224, 88, 56, 231, 149, 64, 105, 48, 183, 223, 101, 193, 14, 207, 233, 72, 248, 47, 187, 230, 99, 0, 181, 243, 101, 147, 79, 117, 174, 59, 239, 113, 76, 11, 153, 39, 144, 14, 178, 46, 211, 109, 229, 99, 22, 226, 74, 210, 31, 125, 255, 177, 11, 61, 109, 133, 9, 254, 179, 53, 94,
+    8, 142, 62, 38, 130, 196, 98, 15, 242, 204, 145, 91, 10, 134, 238, 79, 156, 105, 3, 199, 113, 26, 144, 123, 222, 81, 135, 23, 202, 165, 15, 217, 90, 1, 164, 134, 252, 212, 89, 237, 66, 227, 85, 129, 2, 71, 150, 184, 121, 6, 167, 228, 151, 65, 105, 195, 244, 160, 219, 192, 72, 110, 227, 209,
+    77, 198, 235, 166, 5, 253, 45, 175, 78, 121, 34, 251, 61, 176, 31, 122, 49, 184, 141, 59, 158, 243, 63, 200, 45, 161, 58, 216, 41, 233, 66, 141, 193, 231, 51, 182, 64, 28, 123, 187, 112, 151, 23, 164, 254, 192, 51, 243, 89, 193, 56, 101, 17, 204, 29, 131, 90, 24, 53, 100, 37, 164, 18, 127,
+    178, 31, 116, 81, 185, 139, 113, 155, 223, 2, 187, 160, 110, 217, 148, 196, 253, 27, 225, 97, 208, 9, 89, 152, 15, 250, 188, 124, 86, 110, 183, 33, 103, 127, 21, 202, 102, 229, 169, 4, 51, 215, 199, 40, 92, 114, 14, 133, 35, 217, 142, 238, 79, 172, 232, 48, 215, 185, 126, 237, 203, 138, 244, 49,
+    103, 146, 212, 24, 227, 63, 28, 194, 52, 135, 73, 231, 45, 84, 5, 66, 100, 169, 81, 38, 178, 128, 227, 176, 113, 97, 28, 145, 242, 8, 155, 251, 57, 209, 79, 146, 42, 154, 75, 247, 101, 137, 73, 179, 219, 153, 231, 173, 66, 159, 10, 127, 40, 111, 144, 72, 157, 2, 83, 152, 22, 63, 88, 217,
+    0, 250, 55, 97, 161, 107, 211, 85, 247, 102, 209, 22, 128, 201, 238, 116, 215, 12, 137, 240, 108, 29, 75, 39, 235, 203, 72, 173, 49, 210, 71, 132, 12, 161, 241, 114, 219, 16, 127, 190, 36, 227, 10, 119, 57, 27, 79, 207, 111, 249, 93, 185, 209, 247, 11, 180, 108, 251, 58, 220, 177, 120, 190, 156,
+    72, 172, 131, 200, 10, 244, 143, 16, 169, 36, 151, 182, 95, 165, 37, 182, 152, 49, 198, 61, 219, 148, 193, 134, 59, 156, 4, 227, 95, 117, 192, 223, 87, 177, 34, 67, 180, 93, 209, 59, 144, 173, 84, 236, 135, 193, 104, 17, 49, 195, 32, 70, 137, 56, 92, 223, 33, 195, 136, 42, 104, 12, 233, 40,
+    119, 231, 35, 79, 178, 44, 70, 187, 117, 234, 68, 13, 249, 55, 136, 18, 83, 244, 121, 166, 0, 87, 255, 16, 218, 91, 123, 196, 34, 169, 18, 43, 111, 233, 138, 5, 251, 157, 24, 233, 96, 26, 197, 159, 42, 248, 166, 143, 233, 123, 153, 224, 21, 165, 200, 124, 68, 163, 96, 202, 246, 146, 82, 207,
+    22, 100, 217, 154, 114, 235, 130, 221, 48, 89, 137, 219, 114, 79, 210, 229, 106, 187, 22, 96, 211, 48, 180, 118, 168, 45, 248, 141, 62, 236, 134, 156, 58, 205, 99, 195, 121, 53, 82, 167, 124, 253, 63, 108, 1, 91, 59, 216, 75, 6, 175, 87, 115, 242, 45, 149, 20, 235, 6, 73, 30, 171, 54, 137,
+    162, 187, 5, 60, 206, 26, 86, 3, 163, 202, 25, 188, 160, 2, 173, 63, 39, 141, 67, 233, 127, 153, 68, 97, 28, 208, 78, 15, 186, 102, 78, 245, 171, 23, 77, 42, 227, 143, 193, 5, 210, 45, 149, 224, 205, 180, 118, 34, 185, 102, 253, 60, 186, 1, 78, 228, 192, 115, 179, 131, 220, 109, 199, 243,
+    87, 67, 253, 134, 95, 168, 196, 148, 107, 254, 59, 98, 43, 244, 117, 149, 204, 252, 164, 34, 200, 11, 221, 244, 187, 147, 106, 164, 222, 31, 196, 0, 120, 220, 150, 175, 106, 28, 244, 109, 72, 179, 15, 130, 71, 21, 238, 135, 205, 25, 144, 40, 208, 155, 131, 103, 31, 86, 254, 56, 153, 91, 9, 42,
+    222, 113, 151, 39, 228, 53, 244, 72, 38, 175, 128, 210, 143, 88, 193, 26, 93, 5, 112, 80, 176, 104, 41, 133, 58, 3, 239, 67, 127, 52, 147, 213, 89, 46, 249, 9, 211, 88, 55, 162, 234, 120, 92, 245, 167, 97, 152, 53, 84, 168, 222, 125, 93, 236, 50, 216, 170, 146, 38, 211, 25, 237, 189, 127,
+    170, 13, 203, 179, 18, 110, 136, 15, 227, 81, 8, 239, 22, 62, 234, 49, 221, 131, 194, 50, 242, 144, 205, 86, 172, 122, 214, 24, 182, 255, 110, 66, 182, 137, 113, 63, 157, 185, 133, 36, 202, 24, 190, 53, 36, 196, 218, 10, 242, 109, 65, 12, 176, 24, 189, 68, 10, 204, 77, 121, 178, 72, 143, 57,
+    241, 101, 51, 125, 80, 191, 214, 166, 122, 203, 149, 108, 185, 157, 121, 177, 73, 167, 228, 24, 122, 62, 14, 236, 30, 199, 95, 157, 82, 8, 166, 35, 238, 21, 197, 83, 237, 16, 217, 99, 142, 67, 159, 222, 140, 114, 68, 184, 130, 35, 191, 246, 148, 85, 114, 247, 138, 102, 231, 159, 2, 111, 215, 30,
+    192, 77, 213, 238, 161, 33, 63, 93, 47, 182, 64, 34, 225, 83, 7, 208, 103, 15, 151, 88, 211, 158, 189, 100, 148, 64, 38, 229, 137, 198, 225, 98, 155, 55, 224, 145, 40, 123, 61, 252, 3, 229, 106, 81, 8, 254, 28, 94, 162, 215, 80, 118, 38, 229, 158, 45, 179, 27, 60, 195, 46, 248, 94, 156,
+    133, 38, 141, 2, 97, 222, 146, 252, 25, 231, 101, 211, 135, 46, 252, 142, 38, 239, 59, 110, 254, 36, 75, 220, 118, 248, 183, 112, 54, 29, 122, 69, 189, 125, 5, 168, 104, 201, 177, 80, 167, 197, 32, 128, 208, 171, 148, 226, 51, 6, 143, 199, 60, 207, 3, 76, 218, 123, 242, 84, 132, 185, 65, 14,
+    113, 250, 177, 67, 195, 120, 11, 178, 110, 159, 0, 76, 166, 114, 186, 69, 174, 129, 203, 184, 8, 130, 180, 47, 6, 159, 22, 73, 241, 153, 209, 16, 251, 85, 212, 68, 246, 19, 143, 37, 121, 56, 245, 184, 62, 40, 109, 77, 186, 250, 102, 20, 169, 93, 135, 192, 97, 164, 12, 150, 224, 24, 170, 208,
+    54, 89, 21, 156, 243, 52, 83, 205, 61, 133, 246, 193, 28, 236, 17, 95, 221, 27, 79, 48, 165, 87, 233, 141, 203, 86, 217, 134, 190, 94, 47, 175, 107, 38, 134, 185, 48, 93, 231, 208, 97, 153, 16, 145, 92, 238, 201, 21, 127, 158, 69, 237, 122, 224, 24, 255, 57, 37, 204, 105, 41, 119, 79, 230,
+    161, 189, 222, 108, 32, 136, 230, 151, 38, 216, 90, 48, 147, 104, 204, 54, 159, 121, 246, 143, 216, 105, 26, 61, 172, 106, 51, 169, 1, 220, 77, 140, 229, 163, 24, 225, 114, 162, 70, 11, 181, 225, 75, 215, 116, 1, 138, 230, 59, 33, 210, 179, 46, 73, 162, 112, 144, 237, 175, 71, 212, 252, 147, 4,
+    104, 37, 129, 78, 214, 174, 18, 100, 191, 14, 122, 179, 225, 74, 136, 232, 4, 102, 195, 20, 67, 192, 243, 123, 225, 16, 252, 115, 40, 124, 245, 11, 54, 204, 91, 150, 1, 192, 127, 250, 49, 108, 30, 178, 50, 163, 82, 173, 197, 117, 89, 5, 138, 200, 34, 185, 16, 90, 128, 7, 162, 96, 49, 199,
+    69, 228, 152, 7, 193, 65, 123, 248, 75, 163, 238, 64, 7, 167, 35, 190, 69, 173, 43, 234, 117, 1, 153, 39, 77, 190, 139, 71, 206, 177, 155, 99, 183, 121, 70, 236, 57, 212, 31, 88, 139, 165, 241, 129, 199, 251, 40, 101, 12, 246, 150, 221, 104, 243, 86, 232, 66, 198, 228, 55, 190, 25, 125, 240,
+    16, 179, 56, 254, 99, 35, 166, 204, 50, 109, 32, 140, 202, 117, 89, 251, 128, 212, 92, 163, 139, 85, 178, 211, 100, 159, 31, 223, 89, 20, 60, 214, 33, 249, 15, 177, 136, 104, 171, 220, 197, 19, 60, 95, 14, 70, 147, 216, 129, 74, 48, 171, 61, 18, 159, 119, 147, 40, 101, 139, 243, 77, 170, 140,
+    110, 84, 207, 116, 144, 232, 87, 2, 136, 186, 219, 95, 244, 52, 181, 24, 148, 13, 58, 220, 34, 253, 50, 133, 12, 242, 56, 184, 149, 109, 239, 133, 82, 147, 200, 95, 41, 245, 62, 7, 78, 120, 212, 151, 224, 119, 189, 20, 178, 234, 27, 203, 132, 192, 44, 219, 1, 172, 208, 18, 113, 218, 34, 202,
+    231, 165, 40, 17, 185, 51, 214, 155, 236, 21, 80, 170, 15, 154, 223, 65, 100, 237, 113, 182, 75, 198, 112, 225, 66, 201, 124, 7, 231, 44, 197, 3, 170, 47, 115, 217, 18, 158, 116, 148, 236, 168, 42, 185, 81, 37, 244, 61, 91, 159, 119, 81, 253, 108, 74, 184, 93, 250, 78, 161, 62, 181, 94, 53,
+    5, 129, 243, 153, 75, 132, 27, 104, 67, 126, 208, 57, 111, 37, 125, 210, 169, 194, 30, 131, 10, 160, 25, 90, 171, 150, 105, 77, 136, 164, 70, 98, 189, 228, 65, 166, 85, 189, 230, 47, 93, 22, 253, 105, 4, 168, 135, 109, 207, 43, 223, 22, 153, 10, 234, 136, 52, 126, 30, 234, 142, 13, 252, 149,
+    191, 96, 64, 219, 194, 94, 247, 200, 179, 42, 254, 136, 198, 239, 86, 3, 45, 76, 152, 241, 97, 216, 139, 245, 42, 19, 214, 255, 32, 205, 116, 247, 28, 129, 11, 254, 138, 27, 74, 203, 176, 139, 65, 126, 229, 201, 54, 227, 8, 139, 190, 99, 54, 169, 200, 27, 163, 205, 103, 190, 44, 125, 207, 74,
+    226, 173, 29, 113, 7, 167, 45, 120, 13, 157, 98, 7, 74, 183, 162, 139, 252, 120, 213, 60, 190, 46, 70, 178, 119, 191, 50, 95, 180, 13, 218, 58, 157, 83, 199, 107, 54, 223, 127, 0, 111, 221, 191, 45, 147, 93, 20, 156, 83, 173, 65, 241, 211, 116, 90, 65, 237, 16, 69, 224, 86, 171, 104, 24,
+    44, 122, 202, 52, 235, 147, 71, 230, 86, 219, 193, 147, 229, 28, 53, 103, 197, 22, 92, 6, 166, 123, 230, 12, 84, 225, 158, 128, 68, 153, 43, 138, 183, 237, 36, 173, 209, 98, 160, 248, 39, 85, 12, 169, 74, 241, 187, 123, 249, 32, 129, 2, 141, 37, 226, 145, 107, 180, 131, 151, 4, 235, 59, 144,
+    160, 84, 251, 139, 90, 211, 17, 172, 134, 30, 67, 46, 122, 92, 220, 174, 68, 229, 181, 146, 248, 30, 101, 207, 144, 63, 3, 233, 201, 110, 240, 92, 4, 111, 69, 149, 9, 43, 183, 65, 199, 152, 233, 208, 26, 107, 41, 68, 202, 110, 229, 180, 79, 192, 13, 171, 43, 249, 54, 209, 34, 186, 112, 243,
+    189, 1, 66, 182, 23, 124, 191, 51, 250, 100, 178, 243, 160, 200, 9, 147, 32, 133, 49, 112, 74, 199, 162, 41, 251, 113, 174, 39, 81, 17, 169, 64, 196, 216, 127, 226, 91, 239, 140, 20, 125, 102, 55, 120, 140, 177, 215, 159, 14, 52, 91, 160, 47, 245, 124, 83, 197, 9, 96, 118, 163, 78, 214, 21,
+    131, 231, 110, 164, 43, 226, 80, 111, 158, 2, 215, 110, 21, 70, 234, 106, 247, 82, 208, 226, 18, 132, 59, 187, 91, 23, 216, 132, 247, 188, 123, 230, 39, 156, 24, 55, 188, 116, 73, 220, 169, 243, 33, 79, 252, 2, 92, 238, 140, 186, 211, 19, 109, 214, 58, 157, 231, 137, 219, 65, 241, 134, 48, 98,
+    61, 33, 196, 219, 98, 154, 239, 35, 204, 138, 81, 39, 143, 186, 127, 57, 166, 1, 153, 39, 97, 239, 149, 6, 124, 196, 73, 154, 95, 55, 25, 142, 100, 180, 82, 251, 158, 14, 207, 46, 87, 7, 185, 160, 198, 62, 128, 35, 76, 115, 254, 69, 139, 174, 22, 103, 33, 74, 184, 25, 175, 12, 157, 204,
+    176, 143, 78, 15, 60, 133, 9, 71, 184, 57, 235, 169, 212, 88, 18, 218, 197, 93, 188, 124, 173, 204, 80, 224, 165, 242, 47, 28, 213, 163, 223, 72, 244, 7, 211, 133, 37, 96, 178, 148, 228, 132, 213, 97, 44, 150, 226, 205, 172, 5, 153, 39, 226, 80, 191, 251, 122, 206, 152, 47, 103, 221, 76, 250,
+    18, 236, 122, 161, 253, 206, 173, 117, 218, 97, 26, 118, 53, 255, 154, 36, 119, 52, 241, 71, 14, 50, 116, 35, 63, 105, 147, 185, 116, 0, 106, 201, 43, 149, 111, 65, 195, 235, 120, 60, 27, 107, 63, 22, 234, 115, 18, 102, 53, 232, 93, 200, 121, 11, 143, 50, 166, 4, 90, 247, 188, 127, 39, 114,
+    56, 91, 199, 46, 110, 31, 86, 144, 18, 245, 134, 198, 5, 105, 180, 77, 228, 145, 27, 216, 156, 255, 188, 143, 206, 9, 226, 82, 249, 60, 176, 132, 86, 171, 232, 18, 163, 79, 1, 246, 191, 154, 240, 136, 175, 193, 81, 157, 187, 133, 25, 179, 60, 240, 98, 217, 71, 228, 116, 61, 146, 6, 198, 152,
+    218, 167, 9, 223, 186, 64, 240, 181, 50, 159, 70, 177, 227, 63, 132, 203, 8, 101, 176, 129, 82, 104, 23, 232, 90, 175, 128, 21, 138, 198, 35, 225, 15, 55, 205, 99, 45, 215, 139, 171, 89, 43, 202, 76, 4, 58, 249, 36, 220, 66, 247, 106, 162, 207, 34, 179, 18, 135, 195, 27, 225, 80, 242, 101,
+    30, 130, 76, 148, 95, 135, 0, 225, 101, 202, 37, 88, 145, 28, 242, 44, 158, 249, 61, 203, 4, 181, 59, 130, 30, 68, 194, 49, 231, 75, 153, 95, 246, 118, 183, 142, 254, 111, 31, 67, 222, 12, 122, 165, 110, 210, 142, 121, 10, 87, 151, 45, 3, 128, 82, 148, 104, 238, 44, 176, 99, 160, 46, 179,
+    206, 249, 44, 234, 25, 213, 164, 75, 126, 15, 250, 116, 215, 170, 94, 118, 191, 85, 31, 114, 235, 145, 210, 168, 246, 115, 217, 96, 170, 114, 6, 213, 135, 36, 70, 23, 85, 178, 201, 126, 159, 98, 252, 32, 225, 90, 47, 173, 206, 111, 195, 221, 71, 230, 189, 56, 205, 161, 73, 126, 212, 16, 137, 70,
+    3, 103, 175, 117, 184, 56, 112, 32, 211, 172, 151, 52, 8, 75, 207, 17, 55, 138, 221, 160, 47, 77, 16, 97, 43, 157, 11, 143, 29, 255, 179, 58, 194, 165, 236, 213, 156, 57, 15, 243, 48, 206, 183, 62, 150, 186, 23, 231, 57, 160, 19, 131, 173, 113, 15, 253, 31, 91, 0, 248, 56, 187, 230, 118,
+    196, 55, 152, 12, 80, 252, 194, 145, 233, 64, 98, 237, 194, 125, 146, 239, 174, 202, 21, 92, 189, 250, 119, 219, 191, 79, 240, 201, 72, 44, 126, 80, 17, 92, 112, 4, 130, 233, 105, 150, 78, 20, 136, 84, 8, 239, 102, 134, 77, 246, 41, 94, 239, 50, 162, 137, 107, 224, 174, 148, 112, 29, 84, 163,
+    244, 91, 232, 204, 140, 41, 96, 7, 87, 40, 131, 176, 29, 62, 223, 41, 106, 69, 126, 229, 33, 138, 64, 162, 24, 128, 55, 106, 182, 216, 158, 238, 204, 142, 53, 186, 76, 206, 42, 192, 119, 233, 172, 107, 212, 52, 166, 201, 1, 214, 146, 189, 29, 87, 220, 69, 197, 130, 37, 78, 208, 236, 142, 39,
+    19, 131, 69, 30, 173, 124, 237, 158, 183, 203, 14, 220, 111, 160, 91, 6, 164, 248, 13, 168, 105, 180, 1, 242, 94, 150, 231, 5, 138, 92, 22, 108, 38, 227, 167, 249, 28, 96, 170, 8, 218, 60, 38, 244, 123, 146, 30, 89, 121, 172, 106, 65, 211, 143, 7, 171, 22, 57, 241, 181, 17, 102, 64, 180,
+    220, 160, 105, 224, 53, 209, 23, 68, 118, 246, 142, 78, 46, 253, 186, 135, 212, 86, 144, 60, 205, 81, 214, 52, 198, 34, 212, 168, 40, 245, 66, 187, 129, 73, 14, 121, 151, 224, 66, 139, 85, 162, 202, 12, 70, 196, 254, 63, 232, 48, 17, 250, 125, 182, 99, 247, 119, 210, 89, 139, 51, 168, 205, 117,
+    44, 198, 10, 167, 84, 109, 179, 221, 32, 54, 96, 170, 214, 21, 67, 112, 50, 30, 191, 234, 43, 152, 127, 108, 176, 70, 115, 81, 194, 122, 221, 2, 155, 213, 93, 197, 40, 111, 188, 254, 26, 106, 145, 94, 175, 25, 100, 184, 135, 203, 85, 165, 26, 53, 226, 36, 72, 159, 5, 194, 120, 255, 8, 86,
+    138, 62, 250, 145, 235, 0, 140, 92, 154, 189, 232, 3, 126, 148, 198, 240, 169, 222, 117, 94, 9, 253, 30, 226, 10, 142, 250, 20, 149, 52, 170, 101, 247, 49, 175, 64, 240, 4, 50, 125, 171, 237, 47, 216, 132, 225, 157, 40, 10, 153, 222, 115, 196, 81, 155, 134, 188, 238, 98, 220, 34, 75, 152, 230,
+    185, 90, 114, 36, 69, 195, 51, 255, 13, 73, 112, 205, 60, 99, 33, 80, 4, 139, 70, 175, 135, 186, 74, 162, 96, 188, 56, 215, 98, 204, 32, 76, 141, 24, 125, 217, 141, 161, 92, 208, 72, 9, 184, 79, 17, 56, 119, 242, 73, 103, 32, 58, 240, 3, 209, 107, 16, 47, 147, 63, 165, 209, 105, 27,
+    239, 14, 214, 188, 129, 218, 117, 167, 210, 131, 28, 152, 243, 176, 223, 155, 106, 203, 19, 239, 45, 113, 215, 51, 236, 31, 130, 163, 13, 229, 120, 183, 232, 200, 102, 17, 78, 192, 235, 29, 140, 225, 117, 152, 248, 188, 85, 206, 167, 230, 183, 127, 149, 94, 174, 65, 223, 124, 181, 19, 234, 131, 51, 171,
+    124, 154, 53, 163, 17, 96, 26, 82, 43, 237, 178, 87, 44, 16, 123, 49, 182, 230, 60, 158, 195, 88, 13, 145, 120, 200, 68, 241, 83, 144, 60, 7, 87, 42, 164, 251, 38, 113, 58, 178, 102, 41, 201, 61, 104, 33, 142, 0, 50, 134, 20, 77, 217, 45, 254, 29, 196, 74, 247, 107, 82, 0, 199, 70,
+    32, 226, 105, 78, 247, 177, 227, 148, 195, 103, 62, 200, 137, 213, 75, 252, 91, 37, 129, 104, 26, 244, 172, 207, 81, 1, 172, 113, 44, 197, 252, 154, 218, 129, 67, 181, 137, 227, 11, 154, 248, 83, 165, 6, 233, 174, 216, 112, 197, 93, 244, 190, 12, 165, 118, 141, 91, 163, 35, 142, 190, 161, 250, 98,
+    144, 183, 4, 202, 136, 48, 66, 126, 21, 163, 5, 248, 109, 160, 191, 8, 146, 171, 207, 75, 218, 133, 66, 33, 250, 103, 223, 27, 181, 125, 99, 33, 175, 108, 234, 3, 85, 206, 126, 68, 191, 21, 134, 209, 76, 128, 54, 253, 30, 158, 61, 144, 100, 204, 57, 228, 10, 212, 55, 230, 27, 114, 46, 212,
+    87, 58, 235, 115, 33, 155, 199, 242, 79, 214, 121, 39, 81, 23, 59, 221, 116, 29, 237, 3, 157, 47, 115, 154, 185, 137, 58, 155, 238, 10, 71, 211, 55, 23, 150, 199, 47, 169, 95, 35, 220, 112, 242, 42, 154, 23, 97, 168, 80, 222, 118, 42, 235, 26, 79, 156, 112, 184, 128, 94, 205, 73, 154, 13,
+};
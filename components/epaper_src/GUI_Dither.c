@@ -0,0 +1,414 @@
+/*****************************************************************************
+* | File      	:   GUI_Dither.c
+* | Function    :   6-color palette quantization and dithering
+* | Info        :
+*                Quantization is one lookup in GUI_PALETTE_6_LUT (32x32x32,
+*                indexed by the top 5 bits of each channel), precomputed by
+*                tools/gen_palette6.py with the CIELAB-nearest calibrated
+*                panel color for each cell. The 12% of cells a palette
+*                boundary runs through point instead at a bit table holding
+*                the nearest color of each of their 512 colors, so every
+*                color is two table reads at most. Errors are diffused against the
+*                calibrated colors, i.e. against what the panel really shows.
+*                Diffusion kernels are tap tables with Q12 weights; ordered
+*                modes add a tiled threshold to all three channels instead.
+******************************************************************************/
+#include "GUI_Dither.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_timer.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+// Lets a same-priority task run while waiting on the other core's row; otherwise a spin.
+#define GUI_DITHER_WAVE_RELAX() taskYIELD()
+#else
+#include <sched.h>
+#define GUI_DITHER_WAVE_RELAX() sched_yield()
+#endif
+
+#define GUI_LUT_BITS 5
+#define GUI_LUT_SHIFT (8 - GUI_LUT_BITS)
+
+// Guard pixels on each side of an error row (the widest kernel reaches two pixels out).
+#define GUI_DITHER_GUARD 2
+// Pixels a wavefront row does between checks on the row above it.
+#define GUI_DITHER_WAVE_CHUNK 16
+// Ordered modes shift each pixel by up to +/- half this many color levels: about the
+// panel's black-to-white span, so every gray between them gets a mix of both.
+#define GUI_DITHER_ORDERED_SPREAD 208
+
+typedef struct {
+    int8_t dx;  // along the scan direction
+    int8_t dy;  // rows below
+    int16_t w;  // share of the error, Q12
+} GUI_DitherTap;
+
+// 7/16 right, 3/16 down-left, 5/16 down, 1/16 down-right.
+static const GUI_DitherTap GUI_TAPS_FLOYD_STEINBERG[] = {
+    {1, 0, 1792}, {-1, 1, 768}, {0, 1, 1280}, {1, 1, 256},
+};
+
+// 1/8 to each of six neighbours; the remaining 2/8 is dropped.
+static const GUI_DitherTap GUI_TAPS_ATKINSON[] = {
+    {1, 0, 512}, {2, 0, 512}, {-1, 1, 512}, {0, 1, 512}, {1, 1, 512}, {0, 2, 512},
+};
+
+// 8 4 / 2 4 8 4 2 / 1 2 4 2 1, over 42 (rounded so the weights still sum to 4096).
+static const GUI_DitherTap GUI_TAPS_STUCKI[] = {
+    {1, 0, 780}, {2, 0, 390},
+    {-2, 1, 195}, {-1, 1, 390}, {0, 1, 780}, {1, 1, 390}, {2, 1, 195},
+    {-2, 2, 98}, {-1, 2, 195}, {0, 2, 390}, {1, 2, 195}, {2, 2, 98},
+};
+
+// 8x8 Bayer matrix scaled to 0..255.
+static const UBYTE GUI_BAYER_8[8 * 8] = {
+    0, 128, 32, 160, 8, 136, 40, 168,
+    192, 64, 224, 96, 200, 72, 232, 104,
+    48, 176, 16, 144, 56, 184, 24, 152,
+    240, 112, 208, 80, 248, 120, 216, 88,
+    12, 140, 44, 172, 4, 132, 36, 164,
+    204, 76, 236, 108, 196, 68, 228, 100,
+    60, 188, 28, 156, 52, 180, 20, 148,
+    252, 124, 220, 92, 244, 116, 212, 84,
+};
+
+static const char *const GUI_DITHER_MODE_NAMES[GUI_DITHER_MODE_COUNT] = {
+    "floyd-steinberg", "fs-serpentine", "atkinson", "stucki", "bayer", "blue-noise",
+};
+
+static inline UBYTE GUI_Palette6_Lookup(int r, int g, int b)
+{
+    const UWORD i = GUI_PALETTE_6_LUT[((r >> GUI_LUT_SHIFT) << (2 * GUI_LUT_BITS)) |
+                                      ((g >> GUI_LUT_SHIFT) << GUI_LUT_BITS) | (b >> GUI_LUT_SHIFT)];
+    if (i < GUI_PALETTE_6_COUNT)
+    {
+        return (UBYTE)i;
+    }
+    const unsigned s = ((r & 7) << 6) | ((g & 7) << 3) | (b & 7);
+    if (i & GUI_PALETTE_6_SPLIT_PAIR)
+    {
+        const GUI_Palette6SplitPair *p = &GUI_PALETTE_6_PAIRS[i & GUI_PALETTE_6_SPLIT_INDEX];
+        return p->color[(p->pick[s >> 5] >> (s & 31)) & 1];
+    }
+    const GUI_Palette6SplitQuad *q = &GUI_PALETTE_6_QUADS[i & GUI_PALETTE_6_SPLIT_INDEX];
+    return q->color[(q->pick[s >> 4] >> ((s & 15) * 2)) & 3];
+}
+
+UBYTE GUI_Palette6_Nearest(UBYTE r, UBYTE g, UBYTE b)
+{
+    return GUI_Palette6_Lookup(r, g, b);
+}
+
+const char *GUI_Dither_ModeName(GUI_DitherMode mode)
+{
+    return ((unsigned)mode < GUI_DITHER_MODE_COUNT) ? GUI_DITHER_MODE_NAMES[mode] : GUI_DITHER_MODE_NAMES[0];
+}
+
+bool GUI_Dither_ModeFromName(const char *name, GUI_DitherMode *out_mode)
+{
+    if (!name)
+    {
+        return false;
+    }
+    for (int i = 0; i < GUI_DITHER_MODE_COUNT; i++)
+    {
+        if (strcmp(name, GUI_DITHER_MODE_NAMES[i]) == 0)
+        {
+            if (out_mode)
+                *out_mode = (GUI_DitherMode)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GUI_Dither_IsOrdered(GUI_DitherMode mode)
+{
+    return mode == GUI_DITHER_BAYER || mode == GUI_DITHER_BLUE_NOISE;
+}
+
+bool GUI_Dither_Init(GUI_Dither *d, UWORD width, GUI_DitherMode mode)
+{
+    if (!d)
+    {
+        return false;
+    }
+    memset(d, 0, sizeof(*d));
+
+    if (width == 0)
+    {
+        return false;
+    }
+
+    const size_t rowLen = ((size_t)width + 2 * GUI_DITHER_GUARD) * 3;
+    for (int i = 0; i < 3; i++)
+    {
+        d->err[i] = (int16_t *)calloc(rowLen, sizeof(int16_t));
+        if (!d->err[i])
+        {
+            GUI_Dither_Deinit(d);
+            return false;
+        }
+    }
+    d->width = width;
+    d->mode = ((unsigned)mode < GUI_DITHER_MODE_COUNT) ? mode : GUI_DITHER_FLOYD_STEINBERG;
+    return true;
+}
+
+void GUI_Dither_Deinit(GUI_Dither *d)
+{
+    if (!d)
+    {
+        return;
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        free(d->err[i]);
+        d->err[i] = NULL;
+    }
+    d->width = 0;
+}
+
+static inline int GUI_Clamp4080(int v)
+{
+    return (v < 0) ? 0 : ((v > 255 * 16) ? 255 * 16 : v);
+}
+
+static inline int GUI_Clamp255(int v)
+{
+    return (v < 0) ? 0 : ((v > 255) ? 255 : v);
+}
+
+// Error diffusion with `taps` over `count` pixels from x, stepping by `step` (the kernel is
+// mirrored with it). rows[0] holds the errors carried into this row, rows[1..2] the rows below.
+static inline void GUI_Dither_DiffuseSpan(int16_t *const rows[3], const UBYTE *rgb, UBYTE *outPaint,
+                                          const GUI_DitherTap *taps, int tapCount, int x, int count, int step)
+{
+    for (int n = 0; n < count; n++, x += step)
+    {
+        const UBYTE *px = rgb + x * 3;
+        const int16_t *cur = rows[0] + x * 3;
+
+        // Working values are color level * 16.
+        const int r = GUI_Clamp4080(((int)px[0] << 4) + cur[0]);
+        const int g = GUI_Clamp4080(((int)px[1] << 4) + cur[1]);
+        const int b = GUI_Clamp4080(((int)px[2] << 4) + cur[2]);
+
+        const GUI_PaletteEntry *p = &GUI_PALETTE_6[GUI_Palette6_Lookup(r >> 4, g >> 4, b >> 4)];
+        outPaint[x] = p->paint;
+
+        const int er = r - ((int)p->r << 4);
+        const int eg = g - ((int)p->g << 4);
+        const int eb = b - ((int)p->b << 4);
+
+        for (int t = 0; t < tapCount; t++)
+        {
+            int16_t *e = rows[taps[t].dy] + (x + taps[t].dx * step) * 3;
+            const int w = taps[t].w;
+            e[0] += (int16_t)((er * w + 2048) >> 12);
+            e[1] += (int16_t)((eg * w + 2048) >> 12);
+            e[2] += (int16_t)((eb * w + 2048) >> 12);
+        }
+    }
+}
+
+// One row of error diffusion with `taps`, scanning right-to-left when `reverse`.
+static inline void GUI_Dither_DiffuseRow(GUI_Dither *d, const UBYTE *rgb, UBYTE *outPaint,
+                                         const GUI_DitherTap *taps, int tapCount, bool reverse)
+{
+    const int width = d->width;
+
+    // Pixel x of each error row lives in slot x + GUI_DITHER_GUARD.
+    int16_t *rows[3];
+    for (int i = 0; i < 3; i++)
+    {
+        rows[i] = d->err[i] + GUI_DITHER_GUARD * 3;
+    }
+
+    GUI_Dither_DiffuseSpan(rows, rgb, outPaint, taps, tapCount, reverse ? width - 1 : 0, width, reverse ? -1 : 1);
+
+    // Shift the rows up; the one falling off becomes the (cleared) bottom row.
+    int16_t *tmp = d->err[0];
+    d->err[0] = d->err[1];
+    d->err[1] = d->err[2];
+    d->err[2] = tmp;
+    memset(tmp, 0, ((size_t)width + 2 * GUI_DITHER_GUARD) * 3 * sizeof(int16_t));
+}
+
+// One row of ordered dithering against a square threshold tile (power-of-two side).
+static void GUI_Dither_OrderedRow(GUI_Dither *d, const UBYTE *rgb, UBYTE *outPaint, const UBYTE *tile, UWORD side)
+{
+    const UBYTE *trow = tile + (size_t)(d->row & (side - 1)) * side;
+    for (UWORD x = 0; x < d->width; x++, rgb += 3)
+    {
+        // Centered threshold in [-SPREAD/2, SPREAD/2], the same for all channels.
+        const int t = ((2 * (int)trow[x & (side - 1)] + 1 - 256) * GUI_DITHER_ORDERED_SPREAD) / 512;
+        *outPaint++ = GUI_PALETTE_6[GUI_Palette6_Lookup(GUI_Clamp255(rgb[0] + t), GUI_Clamp255(rgb[1] + t),
+                                                        GUI_Clamp255(rgb[2] + t))]
+                          .paint;
+    }
+}
+
+#define GUI_DITHER_TAPS(t) (t), (int)(sizeof(t) / sizeof((t)[0]))
+
+void GUI_Dither_Row(GUI_Dither *d, const UBYTE *rgb, UBYTE *outPaint)
+{
+    const int64_t t0 = esp_timer_get_time();
+
+    switch (d->mode)
+    {
+    case GUI_DITHER_FS_SERPENTINE:
+        GUI_Dither_DiffuseRow(d, rgb, outPaint, GUI_DITHER_TAPS(GUI_TAPS_FLOYD_STEINBERG), (d->row & 1) != 0);
+        break;
+    case GUI_DITHER_ATKINSON:
+        GUI_Dither_DiffuseRow(d, rgb, outPaint, GUI_DITHER_TAPS(GUI_TAPS_ATKINSON), false);
+        break;
+    case GUI_DITHER_STUCKI:
+        GUI_Dither_DiffuseRow(d, rgb, outPaint, GUI_DITHER_TAPS(GUI_TAPS_STUCKI), false);
+        break;
+    case GUI_DITHER_BAYER:
+        GUI_Dither_OrderedRow(d, rgb, outPaint, GUI_BAYER_8, 8);
+        break;
+    case GUI_DITHER_BLUE_NOISE:
+        GUI_Dither_OrderedRow(d, rgb, outPaint, GUI_BLUE_NOISE, GUI_BLUE_NOISE_SIZE);
+        break;
+    case GUI_DITHER_FLOYD_STEINBERG:
+    default:
+        GUI_Dither_DiffuseRow(d, rgb, outPaint, GUI_DITHER_TAPS(GUI_TAPS_FLOYD_STEINBERG), false);
+        break;
+    }
+
+    d->row++;
+    d->busyUs += esp_timer_get_time() - t0;
+}
+
+bool GUI_Dither_WaveSupported(GUI_DitherMode mode)
+{
+    return mode == GUI_DITHER_FLOYD_STEINBERG || mode == GUI_DITHER_ATKINSON || mode == GUI_DITHER_STUCKI;
+}
+
+bool GUI_DitherWave_Init(GUI_DitherWave *w, UWORD width, GUI_DitherMode mode)
+{
+    if (!w)
+    {
+        return false;
+    }
+    memset(w, 0, sizeof(*w));
+
+    if (width == 0 || !GUI_Dither_WaveSupported(mode))
+    {
+        return false;
+    }
+
+    const size_t rowLen = ((size_t)width + 2 * GUI_DITHER_GUARD) * 3;
+    for (int i = 0; i < GUI_DITHER_WAVE_ROWS; i++)
+    {
+        w->err[i] = (int16_t *)calloc(rowLen, sizeof(int16_t));
+        if (!w->err[i])
+        {
+            GUI_DitherWave_Deinit(w);
+            return false;
+        }
+    }
+    w->width = width;
+    w->mode = mode;
+    return true;
+}
+
+void GUI_DitherWave_Deinit(GUI_DitherWave *w)
+{
+    if (!w)
+    {
+        return;
+    }
+    for (int i = 0; i < GUI_DITHER_WAVE_ROWS; i++)
+    {
+        free(w->err[i]);
+        w->err[i] = NULL;
+    }
+    w->width = 0;
+}
+
+void GUI_DitherWave_Abort(GUI_DitherWave *w)
+{
+    __atomic_store_n(&w->abort, true, __ATOMIC_RELEASE);
+}
+
+// Waits until row n has finished `pixels` pixels (it may be further along, or done).
+static bool GUI_DitherWave_WaitFor(GUI_DitherWave *w, UDOUBLE n, UDOUBLE pixels)
+{
+    const UDOUBLE want = (n << 16) | pixels;
+    while (__atomic_load_n(&w->done[n % GUI_DITHER_WAVE_ROWS], __ATOMIC_ACQUIRE) < want)
+    {
+        if (__atomic_load_n(&w->abort, __ATOMIC_ACQUIRE))
+        {
+            return false;
+        }
+        GUI_DITHER_WAVE_RELAX();
+    }
+    return true;
+}
+
+bool GUI_DitherWave_Row(GUI_DitherWave *w, UDOUBLE n, const UBYTE *rgb, UBYTE *outPaint, int64_t *busyUs)
+{
+    const int64_t t0 = esp_timer_get_time();
+    const int width = w->width;
+    const GUI_DitherTap *taps = GUI_TAPS_FLOYD_STEINBERG;
+    int tapCount = (int)(sizeof(GUI_TAPS_FLOYD_STEINBERG) / sizeof(GUI_TAPS_FLOYD_STEINBERG[0]));
+    if (w->mode == GUI_DITHER_ATKINSON)
+    {
+        taps = GUI_TAPS_ATKINSON;
+        tapCount = (int)(sizeof(GUI_TAPS_ATKINSON) / sizeof(GUI_TAPS_ATKINSON[0]));
+    }
+    else if (w->mode == GUI_DITHER_STUCKI)
+    {
+        taps = GUI_TAPS_STUCKI;
+        tapCount = (int)(sizeof(GUI_TAPS_STUCKI) / sizeof(GUI_TAPS_STUCKI[0]));
+    }
+
+    // Pixels [x, x + C) of row n read what row n - 1 spread up to x + C + 1, and write row
+    // n + 1 up to x + C + 1, which row n - 1 must be done writing: so it has to be
+    // 2 * GUARD pixels past the chunk. Once row n - 1 has started, row n - 2 (before it in
+    // the same task, or before this row in ours) is done, and its slot is free for row n + 2.
+    const UDOUBLE lag = 2 * GUI_DITHER_GUARD;
+    int x = 0;
+    int chunk = (width < GUI_DITHER_WAVE_CHUNK) ? width : GUI_DITHER_WAVE_CHUNK;
+    bool ok = (n == 0) || GUI_DitherWave_WaitFor(w, n - 1, 0);
+    if (ok)
+    {
+        memset(w->err[(n + 2) % GUI_DITHER_WAVE_ROWS], 0, ((size_t)width + 2 * GUI_DITHER_GUARD) * 3 * sizeof(int16_t));
+        __atomic_store_n(&w->done[n % GUI_DITHER_WAVE_ROWS], (UDOUBLE)(n << 16), __ATOMIC_RELEASE);
+    }
+
+    int16_t *rows[3];
+    for (int i = 0; i < 3; i++)
+    {
+        rows[i] = w->err[(n + i) % GUI_DITHER_WAVE_ROWS] + GUI_DITHER_GUARD * 3;
+    }
+    while (ok && x < width)
+    {
+        if (x + chunk > width)
+        {
+            chunk = width - x;
+        }
+        const UDOUBLE need = (UDOUBLE)(x + chunk) + lag;
+        if (n > 0 && !GUI_DitherWave_WaitFor(w, n - 1, (need < (UDOUBLE)width) ? need : (UDOUBLE)width))
+        {
+            ok = false;
+            break;
+        }
+        GUI_Dither_DiffuseSpan(rows, rgb, outPaint, taps, tapCount, x, chunk, 1);
+        x += chunk;
+        __atomic_store_n(&w->done[n % GUI_DITHER_WAVE_ROWS], (UDOUBLE)((n << 16) | (UDOUBLE)x), __ATOMIC_RELEASE);
+    }
+
+    if (busyUs)
+    {
+        *busyUs += esp_timer_get_time() - t0;
+    }
+    return ok;
+}
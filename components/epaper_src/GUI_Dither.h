@@ -0,0 +1,140 @@
+/*****************************************************************************
+* | File      	:   GUI_Dither.h
+* | Function    :   6-color palette quantization and dithering
+* | Info        :
+*                Fixed-point dither engine used by the photo decoders:
+*                error diffusion (Floyd-Steinberg, serpentine, Atkinson,
+*                Stucki) or ordered thresholds (Bayer, blue noise). Works on
+*                one RGB888 row at a time and emits Paint color indices, so
+*                callers can stream rows without a frame buffer.
+******************************************************************************/
+#ifndef __GUI_DITHER_H
+#define __GUI_DITHER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DEV_Config.h"
+
+typedef struct {
+    UBYTE r;
+    UBYTE g;
+    UBYTE b;
+    UBYTE paint;
+} GUI_PaletteEntry;
+
+#define GUI_PALETTE_6_COUNT 6
+#define GUI_PALETTE_6_LUT_SIZE (32 * 32 * 32)
+// GUI_PALETTE_6_LUT values for cells whose colors don't all share one nearest palette color:
+// the flag ORed with an index into GUI_PALETTE_6_PAIRS or GUI_PALETTE_6_QUADS.
+#define GUI_PALETTE_6_SPLIT_PAIR 0x4000
+#define GUI_PALETTE_6_SPLIT_QUAD 0x8000
+#define GUI_PALETTE_6_SPLIT_INDEX 0x3FFF
+
+// Nearest color of each of the 8x8x8 colors of a split cell, bit s of pick (s = (r & 7) << 6 |
+// (g & 7) << 3 | (b & 7)) choosing between two palette colors, or two bits among four.
+typedef struct {
+    UBYTE color[2];
+    UDOUBLE pick[16];
+} GUI_Palette6SplitPair;
+
+typedef struct {
+    UBYTE color[4];
+    UDOUBLE pick[32];
+} GUI_Palette6SplitQuad;
+
+// Black, white, yellow, red, blue, green (paint indices 0, 1, 2, 3, 5, 6), as the panel
+// shows them. Generated into GUI_Palette6.c by tools/gen_palette6.py, with the nearest-color
+// LUT and the tables of the cells it splits.
+extern const GUI_PaletteEntry GUI_PALETTE_6[GUI_PALETTE_6_COUNT];
+extern const UWORD GUI_PALETTE_6_LUT[GUI_PALETTE_6_LUT_SIZE];
+extern const GUI_Palette6SplitPair GUI_PALETTE_6_PAIRS[];
+extern const GUI_Palette6SplitQuad GUI_PALETTE_6_QUADS[];
+
+#define GUI_BLUE_NOISE_SIZE 64
+
+// 64x64 blue-noise threshold tile (0..255). Generated into GUI_BlueNoise.c by
+// tools/gen_blue_noise.py.
+extern const UBYTE GUI_BLUE_NOISE[GUI_BLUE_NOISE_SIZE * GUI_BLUE_NOISE_SIZE];
+
+// Values are stored (NVS, library.json), so only append.
+typedef enum {
+    GUI_DITHER_FLOYD_STEINBERG = 0,
+    GUI_DITHER_FS_SERPENTINE = 1, // Floyd-Steinberg, alternate rows right-to-left
+    GUI_DITHER_ATKINSON = 2,      // diffuses 6/8 of the error; more contrast, clipped shadows
+    GUI_DITHER_STUCKI = 3,        // 12 taps over two rows; smoothest, slowest
+    GUI_DITHER_BAYER = 4,         // 8x8 ordered
+    GUI_DITHER_BLUE_NOISE = 5,    // ordered with GUI_BLUE_NOISE
+    GUI_DITHER_MODE_COUNT
+} GUI_DitherMode;
+
+/**
+ * Dither state for one output width.
+ * Errors are kept as int16 in 1/16 of a color level, interleaved RGB, for the
+ * current row and the two below it, with two guard pixels on each side so the
+ * kernels need no edge checks. Ordered modes don't use them.
+**/
+typedef struct {
+    int16_t *err[3];
+    UWORD width;
+    GUI_DitherMode mode;
+    UDOUBLE row;    // rows fed so far (ordered modes: the row being dithered; may be set)
+    int64_t busyUs; // time spent in GUI_Dither_Row since init
+} GUI_Dither;
+
+#define GUI_DITHER_WAVE_ROWS 4
+
+/**
+ * Error diffusion split over two tasks ("wavefront"): each row may be dithered by
+ * either task, and a row starts while the one above it is still running, trailing it
+ * by a few pixels. The output is the same as GUI_Dither_Row fed the same rows in order.
+ * Left-to-right kernels only (GUI_Dither_WaveSupported); a serpentine row would need
+ * the whole row above it first.
+**/
+typedef struct {
+    int16_t *err[GUI_DITHER_WAVE_ROWS]; // row n carries its incoming errors in err[n % ROWS]
+    UDOUBLE done[GUI_DITHER_WAVE_ROWS]; // n << 16 | pixels finished, of the latest row n per slot
+    bool abort;
+    UWORD width;
+    GUI_DitherMode mode;
+} GUI_DitherWave;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Index into GUI_PALETTE_6 of the perceptually nearest color (CIELAB distance).
+UBYTE GUI_Palette6_Nearest(UBYTE r, UBYTE g, UBYTE b);
+
+// API / storage names ("floyd-steinberg", "fs-serpentine", "atkinson", "stucki",
+// "bayer", "blue-noise"). FromName returns false for unknown names.
+const char *GUI_Dither_ModeName(GUI_DitherMode mode);
+bool GUI_Dither_ModeFromName(const char *name, GUI_DitherMode *out_mode);
+
+// True for the ordered modes, whose output depends only on the pixel and its position
+// (x and `row`), so rows may be dithered in any order or by separate states.
+bool GUI_Dither_IsOrdered(GUI_DitherMode mode);
+
+// Allocates the error rows. Unknown modes fall back to Floyd-Steinberg.
+bool GUI_Dither_Init(GUI_Dither *d, UWORD width, GUI_DitherMode mode);
+void GUI_Dither_Deinit(GUI_Dither *d);
+
+// Dithers `width` RGB888 pixels (R, G, B byte order) into Paint color indices.
+// Rows must be fed in order; the error carries into the next row fed, whichever way that runs.
+void GUI_Dither_Row(GUI_Dither *d, const UBYTE *rgb, UBYTE *outPaint);
+
+bool GUI_Dither_WaveSupported(GUI_DitherMode mode);
+bool GUI_DitherWave_Init(GUI_DitherWave *w, UWORD width, GUI_DitherMode mode);
+void GUI_DitherWave_Deinit(GUI_DitherWave *w);
+
+// Dithers row n (rows 0, 1, 2, ... once each; each task in increasing order), waiting on
+// row n - 1 as needed, and adds the time spent to *busyUs. Returns false, with the row
+// unfinished, once GUI_DitherWave_Abort has been called.
+bool GUI_DitherWave_Row(GUI_DitherWave *w, UDOUBLE n, const UBYTE *rgb, UBYTE *outPaint, int64_t *busyUs);
+void GUI_DitherWave_Abort(GUI_DitherWave *w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
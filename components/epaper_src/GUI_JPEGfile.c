@@ -0,0 +1,541 @@
+/*****************************************************************************
+* | File      	:   GUI_JPEGfile.c
+* | Function    :   Baseline JPEG photo decoding (esp_new_jpeg)
+* | Info        :
+*                The decoder reads its input from memory only, so the file is
+*                loaded into PSRAM (at most GUI_JPEG_MAX_FILE_BYTES, freed
+*                before the image is drawn) and decoded to an RGB888 image
+*                there. The decoder's 1/2..1/8 scaling lands the image close
+*                to the size it is drawn at; it needs both sides to be a
+*                multiple of 8 << n, so up to that many pixels minus one are
+*                cropped off the right and bottom edges first. When no scale
+*                fits (or the result would exceed GUI_JPEG_MAX_DECODED_BYTES)
+*                the image is decoded block by block at full size and area
+*                averaged down to the drawn size as the blocks come in, with
+*                the same resampler the fit renderer uses.
+******************************************************************************/
+#include "GUI_JPEGfile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "esp_jpeg_common.h"
+#include "esp_jpeg_dec.h"
+
+#include "GUI_Resample.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "GUI_JPEGfile";
+
+// Largest decoded RGB888 image kept for the scaled path (about 1024x1024).
+#define GUI_JPEG_MAX_DECODED_BYTES (3 * 1024 * 1024)
+
+typedef struct {
+    UBYTE *pixels; // RGB888, width * height, 16-byte aligned
+    UWORD width;
+    UWORD height;
+} GUI_JpegImage;
+
+bool GUI_Jpeg_IsJpegPath(const char *path)
+{
+    if (!path)
+    {
+        return false;
+    }
+    const size_t n = strlen(path);
+    return n >= 4 && strcasecmp(path + n - 4, ".jpg") == 0;
+}
+
+// Walks the marker segments up to the frame header (skipping EXIF, thumbnails, tables).
+static bool GUI_Jpeg_ReadFrameHeader(FILE *fp, UWORD *out_width, UWORD *out_height, bool *out_baseline)
+{
+    UBYTE b[5];
+    if (fread(b, 1, 2, fp) != 2 || b[0] != 0xFF || b[1] != 0xD8)
+    {
+        return false;
+    }
+
+    for (;;)
+    {
+        int c = fgetc(fp);
+        if (c != 0xFF)
+        {
+            return false;
+        }
+        while (c == 0xFF)
+        {
+            c = fgetc(fp); // fill bytes
+        }
+        if (c == EOF)
+        {
+            return false;
+        }
+
+        const UBYTE marker = (UBYTE)c;
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8))
+        {
+            continue; // standalone markers carry no length
+        }
+        if (marker == 0xD9 || marker == 0xDA)
+        {
+            return false; // end of image / scan data before any frame header
+        }
+
+        if (fread(b, 1, 2, fp) != 2)
+        {
+            return false;
+        }
+        const UWORD len = (UWORD)((b[0] << 8) | b[1]);
+        if (len < 2)
+        {
+            return false;
+        }
+
+        // SOF0..SOF15, except DHT (C4), JPG (C8) and DAC (CC).
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+        {
+            if (len < 7 || fread(b, 1, 5, fp) != 5)
+            {
+                return false;
+            }
+            *out_height = (UWORD)((b[1] << 8) | b[2]);
+            *out_width = (UWORD)((b[3] << 8) | b[4]);
+            *out_baseline = (marker == 0xC0 || marker == 0xC1) && b[0] == 8;
+            return true;
+        }
+
+        if (fseek(fp, (long)len - 2, SEEK_CUR) != 0)
+        {
+            return false;
+        }
+    }
+}
+
+bool GUI_Jpeg_GetDimensions(const char *path, int *out_width, int *out_height)
+{
+    if (out_width)
+        *out_width = 0;
+    if (out_height)
+        *out_height = 0;
+
+    if (!path || !out_width || !out_height)
+    {
+        return false;
+    }
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+    {
+        ESP_LOGE(TAG, "Can't open file: %s", path);
+        return false;
+    }
+
+    long size = -1;
+    if (fseek(fp, 0, SEEK_END) == 0)
+    {
+        size = ftell(fp);
+    }
+    UWORD w = 0;
+    UWORD h = 0;
+    bool baseline = false;
+    const bool ok = size > 0 && fseek(fp, 0, SEEK_SET) == 0 && GUI_Jpeg_ReadFrameHeader(fp, &w, &h, &baseline);
+    fclose(fp);
+
+    if (!ok || w == 0 || h == 0)
+    {
+        ESP_LOGE(TAG, "Not a JPEG: %s", path);
+        return false;
+    }
+    if (!baseline)
+    {
+        ESP_LOGE(TAG, "Only baseline 8-bit JPEGs are supported: %s", path);
+        return false;
+    }
+    if (size > GUI_JPEG_MAX_FILE_BYTES)
+    {
+        ESP_LOGE(TAG, "JPEG too large (%ld bytes): %s", size, path);
+        return false;
+    }
+
+    *out_width = w;
+    *out_height = h;
+    return true;
+}
+
+static UBYTE *GUI_Jpeg_LoadFile(const char *path, int *out_len)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+    {
+        ESP_LOGE(TAG, "Can't open file: %s", path);
+        return NULL;
+    }
+    setvbuf(fp, NULL, _IONBF, 0);
+
+    long size = -1;
+    if (fseek(fp, 0, SEEK_END) == 0)
+    {
+        size = ftell(fp);
+    }
+    UBYTE *buf = NULL;
+    if (size > 0 && size <= GUI_JPEG_MAX_FILE_BYTES && fseek(fp, 0, SEEK_SET) == 0)
+    {
+        buf = (UBYTE *)heap_caps_malloc((size_t)size, MALLOC_CAP_SPIRAM);
+        if (buf && fread(buf, 1, (size_t)size, fp) != (size_t)size)
+        {
+            ESP_LOGE(TAG, "JPEG read error: %s", path);
+            heap_caps_free(buf);
+            buf = NULL;
+        }
+    }
+    fclose(fp);
+
+    *out_len = buf ? (int)size : 0;
+    return buf;
+}
+
+// Size the fit renderer would draw a w x h image at inside the box, without upscaling
+// (rounded up, so sampling down to it never costs the renderer a row or column).
+static void GUI_Jpeg_TargetSize(UWORD w, UWORD h, UWORD boxW, UWORD boxH, UWORD *tw, UWORD *th)
+{
+    if (w <= boxW && h <= boxH)
+    {
+        *tw = w;
+        *th = h;
+    }
+    else if ((uint32_t)w * boxH > (uint32_t)h * boxW)
+    {
+        *tw = boxW;
+        *th = (UWORD)(((uint32_t)h * boxW + w - 1) / w);
+    }
+    else
+    {
+        *th = boxH;
+        *tw = (UWORD)(((uint32_t)w * boxH + h - 1) / h);
+    }
+}
+
+// Largest decoder scale (1/2^n) that keeps the image at least tw x th, and the region
+// (*cw x *ch, from the top left) it is taken from. The decoder scales an exact 1/2^n of
+// that region to a multiple of 8 on both sides, so the region is the image cropped to a
+// multiple of 8 << n: a few pixels of the right and bottom edges at most.
+static int GUI_Jpeg_ScaleShift(UWORD w, UWORD h, UWORD tw, UWORD th, UWORD *cw, UWORD *ch)
+{
+    for (int n = 3; n > 0; n--)
+    {
+        const UWORD step = (UWORD)(8u << n);
+        const UWORD rw = (UWORD)(w - w % step);
+        const UWORD rh = (UWORD)(h - h % step);
+        if ((rw >> n) >= tw && (rh >> n) >= th)
+        {
+            *cw = rw;
+            *ch = rh;
+            return n;
+        }
+    }
+    *cw = w;
+    *ch = h;
+    return 0;
+}
+
+// Decodes the cw x ch top-left region of the w x h image at 1/2^shift.
+static bool GUI_Jpeg_DecodeScaled(UBYTE *jpg, int len, UWORD w, UWORD h, UWORD cw, UWORD ch, int shift,
+                                  GUI_JpegImage *img)
+{
+    const UWORD sw = (UWORD)(cw >> shift);
+    const UWORD sh = (UWORD)(ch >> shift);
+    const size_t want = (size_t)sw * sh * 3;
+
+    jpeg_dec_config_t config = DEFAULT_JPEG_DEC_CONFIG();
+    config.output_type = JPEG_PIXEL_FORMAT_RGB888;
+    if (cw != w || ch != h)
+    {
+        config.clipper.width = cw;
+        config.clipper.height = ch;
+    }
+    if (shift > 0)
+    {
+        config.scale.width = sw;
+        config.scale.height = sh;
+    }
+
+    jpeg_dec_handle_t dec = NULL;
+    if (jpeg_dec_open(&config, &dec) != JPEG_ERR_OK)
+    {
+        return false;
+    }
+
+    jpeg_dec_io_t io;
+    jpeg_dec_header_info_t info;
+    memset(&io, 0, sizeof(io));
+    memset(&info, 0, sizeof(info));
+    io.inbuf = jpg;
+    io.inbuf_len = len;
+
+    UBYTE *out = NULL;
+    int outLen = 0;
+    jpeg_error_t ret = jpeg_dec_parse_header(dec, &io, &info);
+    if (ret == JPEG_ERR_OK)
+    {
+        ret = jpeg_dec_get_outbuf_len(dec, &outLen);
+    }
+    if (ret == JPEG_ERR_OK && (size_t)outLen == want)
+    {
+        out = (UBYTE *)heap_caps_aligned_alloc(16, want, MALLOC_CAP_SPIRAM);
+        if (out)
+        {
+            io.outbuf = out;
+            ret = jpeg_dec_process(dec, &io);
+        }
+    }
+    jpeg_dec_close(dec);
+
+    if (!out || ret != JPEG_ERR_OK)
+    {
+        ESP_LOGW(TAG, "Scaled decode 1/%d failed (%d, out %d bytes)", 1 << shift, (int)ret, outLen);
+        if (out)
+        {
+            heap_caps_free(out);
+        }
+        return false;
+    }
+
+    img->pixels = out;
+    img->width = sw;
+    img->height = sh;
+    return true;
+}
+
+// Full-size rows of a block decode, as a row source for the resampler. Each block is a
+// strip of whole rows; the last few strips are kept, enough for the rows one output row
+// averages, and the next is decoded when a row past them is asked for.
+typedef struct {
+    jpeg_dec_handle_t dec;
+    jpeg_dec_io_t *io;
+    UBYTE **strips;   // ring of decoded strips, stripCount of blockLen bytes
+    int stripCount;
+    int blockLen;
+    int blocksLeft;
+    UWORD stripRows;  // rows per strip (the last one may have fewer)
+    size_t stride;
+    uint32_t decoded; // rows decoded so far
+    jpeg_error_t err;
+} GUI_JpegStrips;
+
+static const UBYTE *GUI_JpegStrips_Row(void *self, UWORD y)
+{
+    GUI_JpegStrips *s = (GUI_JpegStrips *)self;
+    while (y >= s->decoded)
+    {
+        if (s->blocksLeft <= 0 || s->err != JPEG_ERR_OK)
+        {
+            return NULL;
+        }
+        const uint32_t strip = s->decoded / s->stripRows;
+        if ((strip % 16) == 15 && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+        {
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
+        s->io->outbuf = s->strips[strip % s->stripCount];
+        s->err = jpeg_dec_process(s->dec, s->io);
+        const uint32_t rows = (uint32_t)s->io->out_size / s->stride;
+        s->blocksLeft--;
+        // Only the last strip may be short, or row y would not be where we look for it.
+        if (s->err == JPEG_ERR_OK && (rows == 0 || rows > s->stripRows || (rows < s->stripRows && s->blocksLeft > 0)))
+        {
+            s->err = JPEG_ERR_FAIL;
+        }
+        if (s->err != JPEG_ERR_OK)
+        {
+            return NULL;
+        }
+        s->decoded += rows;
+    }
+
+    const uint32_t strip = y / s->stripRows;
+    if (strip + s->stripCount <= (s->decoded - 1) / s->stripRows)
+    {
+        return NULL; // already dropped; rows are only asked for going down
+    }
+    return s->strips[strip % s->stripCount] + (size_t)(y % s->stripRows) * s->stride;
+}
+
+static bool GUI_Jpeg_DecodeResampled(UBYTE *jpg, int len, UWORD w, UWORD h, UWORD tw, UWORD th, GUI_JpegImage *img)
+{
+    jpeg_dec_config_t config = DEFAULT_JPEG_DEC_CONFIG();
+    config.output_type = JPEG_PIXEL_FORMAT_RGB888;
+    config.block_enable = true;
+
+    jpeg_dec_handle_t dec = NULL;
+    if (jpeg_dec_open(&config, &dec) != JPEG_ERR_OK)
+    {
+        return false;
+    }
+
+    jpeg_dec_io_t io;
+    jpeg_dec_header_info_t info;
+    memset(&io, 0, sizeof(io));
+    memset(&info, 0, sizeof(info));
+    io.inbuf = jpg;
+    io.inbuf_len = len;
+
+    GUI_JpegStrips s;
+    memset(&s, 0, sizeof(s));
+    s.dec = dec;
+    s.io = &io;
+    s.stride = (size_t)w * 3;
+
+    GUI_Resampler rs;
+    memset(&rs, 0, sizeof(rs));
+    UBYTE *out = NULL;
+    UWORD ty = 0;
+
+    jpeg_error_t ret = jpeg_dec_parse_header(dec, &io, &info);
+    if (ret == JPEG_ERR_OK)
+    {
+        ret = jpeg_dec_get_outbuf_len(dec, &s.blockLen);
+    }
+    if (ret == JPEG_ERR_OK)
+    {
+        ret = jpeg_dec_get_process_count(dec, &s.blocksLeft);
+    }
+    if (ret != JPEG_ERR_OK || s.blockLen < (int)s.stride || s.blocksLeft <= 0)
+    {
+        goto done;
+    }
+    s.stripRows = (UWORD)((size_t)s.blockLen / s.stride);
+
+    out = (UBYTE *)heap_caps_aligned_alloc(16, (size_t)tw * th * 3, MALLOC_CAP_SPIRAM);
+    if (!out || !GUI_Resampler_Init(&rs, w, h, tw, th))
+    {
+        ESP_LOGE(TAG, "Memory allocation failed!");
+        goto done;
+    }
+
+    // Enough strips for the rows of the tallest output row, wherever they start.
+    UWORD maxTaps = 1;
+    for (UWORD y = 0; y < th; y++)
+    {
+        maxTaps = (rs.y.taps[y] > maxTaps) ? rs.y.taps[y] : maxTaps;
+    }
+    s.stripCount = (maxTaps + s.stripRows - 2) / s.stripRows + 1;
+    s.strips = (UBYTE **)calloc((size_t)s.stripCount, sizeof(UBYTE *));
+    for (int i = 0; s.strips && i < s.stripCount; i++)
+    {
+        s.strips[i] = (UBYTE *)jpeg_calloc_align(s.blockLen, 16);
+        if (!s.strips[i])
+        {
+            break;
+        }
+    }
+    if (!s.strips || !s.strips[s.stripCount - 1])
+    {
+        ESP_LOGE(TAG, "Memory allocation failed!");
+        goto done;
+    }
+
+    const GUI_RowSource src = {w, h, false, GUI_JpegStrips_Row, &s, false};
+    while (ty < th && GUI_Resampler_Row(&rs, &src, ty, out + (size_t)ty * tw * 3))
+    {
+        ty++;
+    }
+    ret = s.err;
+
+done:
+    jpeg_dec_close(dec);
+    if (s.strips)
+    {
+        for (int i = 0; i < s.stripCount; i++)
+        {
+            if (s.strips[i])
+            {
+                jpeg_free_align(s.strips[i]);
+            }
+        }
+        free(s.strips);
+    }
+    GUI_Resampler_Deinit(&rs);
+
+    if (!out || ty != th)
+    {
+        ESP_LOGE(TAG, "Block decode failed (%d) after %u of %u rows", (int)ret, (unsigned)ty, (unsigned)th);
+        if (out)
+        {
+            heap_caps_free(out);
+        }
+        return false;
+    }
+
+    img->pixels = out;
+    img->width = tw;
+    img->height = th;
+    return true;
+}
+
+static const UBYTE *GUI_JpegImage_SourceRow(void *self, UWORD y)
+{
+    const GUI_JpegImage *img = (const GUI_JpegImage *)self;
+    return img->pixels + (size_t)y * img->width * 3;
+}
+
+UBYTE GUI_DrawJpeg_RGB_6Color_FitRows(const char *path, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH,
+                                      bool allow_upscale, GUI_DitherMode dither, GUI_RowDoneCallback onRow, void *ctx)
+{
+    int w = 0;
+    int h = 0;
+    if (!GUI_Jpeg_GetDimensions(path, &w, &h))
+    {
+        return 0;
+    }
+
+    int len = 0;
+    UBYTE *jpg = GUI_Jpeg_LoadFile(path, &len);
+    if (!jpg)
+    {
+        ESP_LOGE(TAG, "Memory allocation failed!");
+        return 0;
+    }
+
+    const int64_t t0 = esp_timer_get_time();
+
+    UWORD tw = 0;
+    UWORD th = 0;
+    GUI_Jpeg_TargetSize((UWORD)w, (UWORD)h, boxW, boxH, &tw, &th);
+
+    GUI_JpegImage img = {NULL, 0, 0};
+    UWORD cw = 0;
+    UWORD ch = 0;
+    const int shift = GUI_Jpeg_ScaleShift((UWORD)w, (UWORD)h, tw, th, &cw, &ch);
+    const size_t scaledBytes = (size_t)(cw >> shift) * (size_t)(ch >> shift) * 3;
+    bool ok = false;
+    if (scaledBytes <= GUI_JPEG_MAX_DECODED_BYTES)
+    {
+        ok = GUI_Jpeg_DecodeScaled(jpg, len, (UWORD)w, (UWORD)h, cw, ch, shift, &img);
+    }
+    if (!ok)
+    {
+        ok = GUI_Jpeg_DecodeResampled(jpg, len, (UWORD)w, (UWORD)h, tw, th, &img);
+    }
+    heap_caps_free(jpg);
+
+    if (!ok)
+    {
+        return 0;
+    }
+
+    ESP_LOGI(TAG, "Decoded %dx%d -> %ux%u in %lld ms", w, h, (unsigned)img.width, (unsigned)img.height,
+             (long long)((esp_timer_get_time() - t0) / 1000));
+
+    const GUI_RowSource src = {img.width, img.height, false, GUI_JpegImage_SourceRow, &img, true};
+    const UBYTE ret = GUI_DrawRows_RGB_6Color_FitRows(&src, Xstart, Ystart, boxW, boxH, allow_upscale, dither, onRow, ctx);
+    heap_caps_free(img.pixels);
+    return ret;
+}
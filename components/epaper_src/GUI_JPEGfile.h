@@ -0,0 +1,40 @@
+/*****************************************************************************
+* | File      	:   GUI_JPEGfile.h
+* | Function    :   Baseline JPEG photo decoding (esp_new_jpeg)
+* | Info        :
+*                Uploaded JPEGs are stored as sent and decoded at render time
+*                straight to about the size they will be drawn at, then fed
+*                to the same fit/dither renderer as BMP and QOI photos.
+******************************************************************************/
+#ifndef __GUI_JPEGFILE_H
+#define __GUI_JPEGFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DEV_Config.h"
+#include "GUI_BMPfile.h"
+
+// Whole file is loaded into PSRAM for the decoder, which only reads from memory.
+#define GUI_JPEG_MAX_FILE_BYTES (4 * 1024 * 1024)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// True when the path ends in ".jpg" (case-insensitive).
+bool GUI_Jpeg_IsJpegPath(const char *path);
+
+// Read dimensions from the frame header. Returns false for anything the decoder
+// can't render (not a JPEG, progressive/lossless, or larger than GUI_JPEG_MAX_FILE_BYTES).
+bool GUI_Jpeg_GetDimensions(const char *path, int *out_width, int *out_height);
+
+// Same contract as GUI_DrawBmp_RGB_6Color_FitRows, for a baseline JPEG file.
+UBYTE GUI_DrawJpeg_RGB_6Color_FitRows(const char *path, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH,
+                                      bool allow_upscale, GUI_DitherMode dither, GUI_RowDoneCallback onRow, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -77,8 +77,10 @@
 ******************************************************************************/
 #include "GUI_Paint.h"
 #include "DEV_Config.h"
+#include "GUI_PixelKernel.h"
 #include <stdio.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h> //memset()
 #include <math.h>
@@ -261,6 +263,197 @@ void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
 	}
 }
 
+/******************************************************************************
+function: Pack a run of 4bpp colors into one framebuffer row
+parameter:
+    Row    : Start of the memory row
+    X      : Memory X of the first pixel written
+    Colors : First color to write; advanced by Step for each next memory X
+    Step   : +1 (same direction as memory) or -1 (reversed)
+    Count  : Number of pixels
+******************************************************************************/
+static void Paint_PackRow4(UBYTE *Row, UWORD X, const UBYTE *Colors, int Step, UWORD Count)
+{
+    if (X & 1) {
+        Row[X / 2] = (Row[X / 2] & 0xF0) | (*Colors & 0x0F);
+        Colors += Step;
+        X++;
+        Count--;
+    }
+
+    UBYTE *p = Row + X / 2;
+    const UWORD Pairs = Count / 2;
+    GUI_Kernel_Pack4(p, Colors, Step, Pairs);
+
+    if (Count & 1) {
+        p[Pairs] = (p[Pairs] & 0x0F) | (UBYTE)(Colors[2 * (int)Pairs * Step] << 4);
+    }
+}
+
+/******************************************************************************
+function: Write a run of 4bpp colors in memory coordinates
+parameter:
+    X, Y   : Memory position of the first color
+    DirX   : -1, 0 or +1 memory X step per color
+    DirY   : -1, 0 or +1 memory Y step per color (exactly one of DirX/DirY is 0)
+    Colors : One color index per pixel
+    Count  : Number of pixels (already clipped)
+******************************************************************************/
+static void Paint_WriteRun4(UWORD X, UWORD Y, int DirX, int DirY, const UBYTE *Colors, UWORD Count)
+{
+    const UWORD WidthByte = Paint.WidthByte;
+
+    if (DirY == 0) {
+        // Memory row; for a backwards run start from the leftmost pixel (last color).
+        if (DirX > 0) {
+            Paint_PackRow4(Paint.Image + (UDOUBLE)Y * WidthByte, X, Colors, 1, Count);
+        } else {
+            Paint_PackRow4(Paint.Image + (UDOUBLE)Y * WidthByte, X - (Count - 1), Colors + Count - 1, -1, Count);
+        }
+        return;
+    }
+
+    // Memory column: fixed nibble, one row stride per pixel.
+    const int Stride = (DirY > 0) ? (int)WidthByte : -(int)WidthByte;
+    const int Shift = (X % 2) ? 0 : 4;
+    const UBYTE Keep = (UBYTE)~(0x0F << Shift);
+    UBYTE *p = Paint.Image + (UDOUBLE)Y * WidthByte + X / 2;
+    for (UWORD i = 0; i < Count; i++) {
+        *p = (*p & Keep) | (UBYTE)((Colors[i] & 0x0F) << Shift);
+        p += Stride;
+    }
+}
+
+static bool Paint_RunIsPacked4(void)
+{
+    return Paint.Mirror == MIRROR_NONE && (Paint.Scale == 6 || Paint.Scale == 7 || Paint.Scale == 16);
+}
+
+/******************************************************************************
+function: Draw a horizontal run of pixels (logical coordinates)
+parameter:
+    Xstart : Start point X
+    Ypoint : Row Y
+    Colors : One color index per pixel
+    Count  : Number of pixels; clipped to the image
+info:
+    Same result as calling Paint_SetPixel() for each pixel, but with the
+    rotation resolved once per run. For 4bpp images at 0/180 the run is a
+    memory row and two pixels are stored per byte; at 90/270 it is a
+    memory column, written with a fixed nibble mask and a row stride.
+    Mirrored images and other scales fall back to Paint_SetPixel().
+******************************************************************************/
+void Paint_SetRow(UWORD Xstart, UWORD Ypoint, const UBYTE *Colors, UWORD Count)
+{
+    if (Xstart >= Paint.Width || Ypoint >= Paint.Height || Count == 0) {
+        return;
+    }
+    if (Count > Paint.Width - Xstart) {
+        Count = Paint.Width - Xstart;
+    }
+
+    if (!Paint_RunIsPacked4()) {
+        for (UWORD i = 0; i < Count; i++) {
+            Paint_SetPixel(Xstart + i, Ypoint, Colors[i]);
+        }
+        return;
+    }
+
+    switch (Paint.Rotate) {
+    case 0:
+        Paint_WriteRun4(Xstart, Ypoint, 1, 0, Colors, Count);
+        break;
+    case 90:
+        Paint_WriteRun4(Paint.WidthMemory - Ypoint - 1, Xstart, 0, 1, Colors, Count);
+        break;
+    case 180:
+        Paint_WriteRun4(Paint.WidthMemory - Xstart - 1, Paint.HeightMemory - Ypoint - 1, -1, 0, Colors, Count);
+        break;
+    case 270:
+        Paint_WriteRun4(Ypoint, Paint.HeightMemory - Xstart - 1, 0, -1, Colors, Count);
+        break;
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+function: Draw a vertical run of pixels (logical coordinates)
+parameter:
+    Xpoint : Column X
+    Ystart : Start point Y
+    Colors : One color index per pixel
+    Count  : Number of pixels; clipped to the image
+info:
+    Column counterpart of Paint_SetRow(); at 90/270 the run is a memory row.
+******************************************************************************/
+void Paint_SetColumn(UWORD Xpoint, UWORD Ystart, const UBYTE *Colors, UWORD Count)
+{
+    if (Xpoint >= Paint.Width || Ystart >= Paint.Height || Count == 0) {
+        return;
+    }
+    if (Count > Paint.Height - Ystart) {
+        Count = Paint.Height - Ystart;
+    }
+
+    if (!Paint_RunIsPacked4()) {
+        for (UWORD i = 0; i < Count; i++) {
+            Paint_SetPixel(Xpoint, Ystart + i, Colors[i]);
+        }
+        return;
+    }
+
+    switch (Paint.Rotate) {
+    case 0:
+        Paint_WriteRun4(Xpoint, Ystart, 0, 1, Colors, Count);
+        break;
+    case 90:
+        Paint_WriteRun4(Paint.WidthMemory - Ystart - 1, Xpoint, -1, 0, Colors, Count);
+        break;
+    case 180:
+        Paint_WriteRun4(Paint.WidthMemory - Xpoint - 1, Paint.HeightMemory - Ystart - 1, 0, -1, Colors, Count);
+        break;
+    case 270:
+        Paint_WriteRun4(Ystart, Paint.HeightMemory - Xpoint - 1, 1, 0, Colors, Count);
+        break;
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+function: Memory (panel) row that a logical pixel lands on
+parameter:
+    Xpoint : At point X
+    Ypoint : At point Y
+info:
+    Same mapping as Paint_SetPixel(); used to tell which panel rows a drawing
+    touches, e.g. for sending finished bands while the rest is still drawn.
+******************************************************************************/
+UWORD Paint_GetMemoryRow(UWORD Xpoint, UWORD Ypoint)
+{
+    UWORD Y;
+    switch(Paint.Rotate) {
+    case 90:
+        Y = Xpoint;
+        break;
+    case 180:
+        Y = Paint.HeightMemory - Ypoint - 1;
+        break;
+    case 270:
+        Y = Paint.HeightMemory - Xpoint - 1;
+        break;
+    default:
+        Y = Ypoint;
+        break;
+    }
+
+    if(Paint.Mirror == MIRROR_VERTICAL || Paint.Mirror == MIRROR_ORIGIN) {
+        Y = Paint.HeightMemory - Y - 1;
+    }
+    return Y;
+}
+
 /******************************************************************************
 function: Clear the color of the picture
 parameter:
@@ -192,6 +192,9 @@ void Paint_SelectImage(UBYTE *image);
 void Paint_SetRotate(UWORD Rotate);
 void Paint_SetMirroring(UBYTE mirror);
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color);
+void Paint_SetRow(UWORD Xstart, UWORD Ypoint, const UBYTE *Colors, UWORD Count);
+void Paint_SetColumn(UWORD Xpoint, UWORD Ystart, const UBYTE *Colors, UWORD Count);
+UWORD Paint_GetMemoryRow(UWORD Xpoint, UWORD Ypoint);
 void Paint_SetScale(UBYTE scale);
 
 void Paint_Clear(UWORD Color);
@@ -0,0 +1,6028 @@
+/*****************************************************************************
+* | File      	:   GUI_Palette6.c
+* | Function    :   Calibrated 6-color palette and nearest-color LUT
+* | Info        :
+*                Generated by tools/gen_palette6.py; edit the palette there
+*                and re-run it instead of changing this file.
+******************************************************************************/
+#include "GUI_Dither.h"
+
+const GUI_PaletteEntry GUI_PALETTE_6[GUI_PALETTE_6_COUNT] = {
+    {25, 30, 33, 0}, // black
+    {232, 232, 232, 1}, // white
+    {239, 222, 68, 2}, // yellow
+    {178, 19, 24, 3}, // red
+    {33, 87, 186, 5}, // blue
+    {18, 95, 32, 6}, // green
+};
+
+// Index into GUI_PALETTE_6 of the CIELAB-nearest color of every color in each cell, or
+// GUI_PALETTE_6_SPLIT_PAIR / GUI_PALETTE_6_SPLIT_QUAD | table index where that depends on
+// the color, indexed by (r >> 3) << 10 | (g >> 3) << 5 | (b >> 3).
+const UWORD GUI_PALETTE_6_LUT[GUI_PALETTE_6_LUT_SIZE] = {
+    0, 0, 0, 0, 0, 0, 0, 16384, 16385, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 16386, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 16387, 16388, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16389, 16390, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    16391, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16392, 16393, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    16394, 16395, 16396, 0, 0, 0, 0, 0, 0, 0, 0, 16397, 16398, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 16399, 16400, 0, 0, 0, 0, 0, 0, 0, 0, 16401, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 16402, 16403, 0, 0, 0, 0, 0, 0, 0, 16404, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 16405, 16406, 0, 0, 0, 0, 0, 0, 0, 16407, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 16408, 16409, 16410, 0, 0, 0, 0, 0, 16411, 16412,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 16413, 16414, 0, 0, 0, 0, 0, 16415,
+    16416, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 16417, 16418, 16419, 0, 0, 0, 0,
+    16420, 16421, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16422, 16423, 0, 0, 0,
+    0, 16424, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16425, 16426, 16427, 0,
+    0, 0, 16428, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16429, 16430,
+    0, 0, 16431, 16432, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16433,
+    16434, 16435, 0, 16436, 16437, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 16438, 16439, 0, 16440, 16441, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 16442, 32768, 16443, 32769, 16444, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 16445, 1, 1, 16446, 16447, 16448, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 16449, 16450, 1, 1, 1, 16451, 16452, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16453, 1, 1, 1, 1, 1, 16454, 16455, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16456, 16457, 1, 1, 1, 1, 1, 16458, 16459, 16460, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 16461, 1, 1, 1, 1, 1, 1, 1, 16462, 16463, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 16464, 16465, 1, 1, 1, 1, 1, 1, 1, 1, 16466,
+    16467, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16468, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 16469, 16470, 16471, 16472, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16473, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 16474, 16475, 16476, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16477, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 16478, 16479, 16480, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16481, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 16482, 16483, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16484, 16485, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16486, 16487, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 16488, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16489, 16490, 16491, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 16492, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16493, 16494, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 16495, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 16496, 16497, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 16498, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 16499, 16500, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16501, 16502, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16503, 16504, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    16505, 16506, 16507, 0, 0, 0, 0, 0, 0, 0, 0, 16508, 16509, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 16510, 16511, 0, 0, 0, 0, 0, 0, 0, 0, 16512, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 16513, 16514, 16515, 0, 0, 0, 0, 0, 0, 0, 16516, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 16517, 16518, 0, 0, 0, 0, 0, 0, 16519, 16520, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 16521, 16522, 16523, 0, 0, 0, 0, 0, 16524, 16525,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 16526, 16527, 0, 0, 0, 0, 0, 16528,
+    16529, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 16530, 16531, 16532, 0, 0, 0, 0,
+    16533, 16534, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16535, 16536, 0, 0, 0,
+    0, 16537, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16538, 16539, 16540, 0,
+    0, 0, 16541, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16542, 16543,
+    0, 0, 16544, 16545, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16546,
+    16547, 0, 0, 16548, 16549, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 16550, 16551, 0, 16552, 16553, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 16554, 32770, 16555, 32771, 16556, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 16557, 1, 1, 16558, 16559, 16560, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 16561, 16562, 1, 1, 1, 16563, 16564, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16565, 1, 1, 1, 1, 1, 16566, 16567, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16568, 16569, 1, 1, 1, 1, 1, 16570, 16571, 16572, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 16573, 1, 1, 1, 1, 1, 1, 1, 16574, 16575, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 16576, 16577, 1, 1, 1, 1, 1, 1, 1, 1, 16578,
+    16579, 16580, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16581, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 16582, 16583, 16584, 16585, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16586, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 16587, 16588, 16589, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16590, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 16591, 16592, 16593, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16594, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 16595, 16596, 16597, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16598, 16599, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16600, 16601, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 16602, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16603, 16604, 16605, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 16606, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16607, 16608, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 16609, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 16610, 16611, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 16612, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 16613, 16614, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16615, 16616, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16617, 16618, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    16619, 16620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16621, 16622, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 16623, 16624, 16625, 0, 0, 0, 0, 0, 0, 0, 0, 16626, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 16627, 16628, 16629, 0, 0, 0, 0, 0, 0, 0, 16630, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 16631, 16632, 0, 0, 0, 0, 0, 0, 16633, 16634, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 16635, 16636, 16637, 0, 0, 0, 0, 0, 16638, 16639,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 16640, 16641, 0, 0, 0, 0, 0, 16642,
+    16643, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 16644, 16645, 0, 0, 0, 0, 0,
+    16646, 16647, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16648, 16649, 0, 0, 0,
+    0, 16650, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16651, 16652, 0, 0,
+    0, 0, 16653, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16654, 16655,
+    0, 0, 16656, 16657, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16658,
+    16659, 0, 0, 16660, 16661, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 16662, 16663, 0, 16664, 16665, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 32772, 32773, 16666, 32774, 16667, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 16668, 1, 1, 16669, 16670, 16671, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 16672, 16673, 1, 1, 1, 16674, 16675, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16676, 1, 1, 1, 1, 1, 16677, 16678, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16679, 16680, 1, 1, 1, 1, 1, 16681, 16682, 16683, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 16684, 1, 1, 1, 1, 1, 1, 1, 16685, 16686, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 16687, 1, 1, 1, 1, 1, 1, 1, 1, 1, 16688,
+    16689, 16690, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16691, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 16692, 16693, 16694, 16695, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16696, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 16697, 16698, 16699, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16700, 16701, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 16702, 16703, 16704, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16705, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 16706, 16707, 16708, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16709, 16710, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16711, 16712, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 16713, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16714, 16715, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 16716, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16717, 16718, 16719,
+    5, 5, 5, 5, 5, 5, 5, 5, 16720, 16721, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 16722, 16723, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 16724, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16725, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16726, 16727, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16728, 16729, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    16730, 16731, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16732, 16733, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 16734, 16735, 16736, 0, 0, 0, 0, 0, 0, 0, 0, 16737, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 16738, 16739, 0, 0, 0, 0, 0, 0, 0, 0, 16740, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 16741, 16742, 16743, 0, 0, 0, 0, 0, 0, 16744, 16745, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 16746, 16747, 0, 0, 0, 0, 0, 0, 16748, 16749,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 16750, 16751, 0, 0, 0, 0, 0, 16752,
+    16753, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 16754, 16755, 0, 0, 0, 0, 0,
+    16756, 16757, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16758, 16759, 0, 0, 0,
+    0, 16760, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16761, 16762, 0, 0,
+    0, 0, 16763, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16764, 16765,
+    0, 0, 16766, 16767, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16768,
+    16769, 0, 0, 16770, 16771, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 16772, 16773, 0, 16774, 16775, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 32775, 32776, 16776, 32777, 16777, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 16778, 1, 1, 16779, 16780, 16781, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 16782, 16783, 1, 1, 1, 16784, 16785, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16786, 1, 1, 1, 1, 1, 16787, 16788, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16789, 16790, 1, 1, 1, 1, 1, 16791, 16792, 16793, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 16794, 1, 1, 1, 1, 1, 1, 1, 16795, 16796, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 16797, 1, 1, 1, 1, 1, 1, 1, 1, 1, 16798,
+    16799, 16800, 16801, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16802, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 16803, 16804, 16805, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16806, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 16807, 16808, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16809, 16810, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 16811, 16812, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16813, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 16814, 16815, 16816, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16817, 16818, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16819, 16820, 16821, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 16822, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16823, 16824, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 16825, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16826, 16827, 16828,
+    5, 5, 5, 5, 5, 5, 5, 5, 16829, 16830, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 16831, 16832, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 16833, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16834, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16835, 16836, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16837, 16838, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    16839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16840, 16841, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    16842, 16843, 16844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16845, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 16846, 16847, 16848, 0, 0, 0, 0, 0, 0, 0, 0, 16849, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 16850, 16851, 16852, 0, 0, 0, 0, 0, 0, 16853, 16854, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 16855, 16856, 0, 0, 0, 0, 0, 0, 16857, 16858,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 16859, 16860, 16861, 0, 0, 0, 0, 0, 16862,
+    16863, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 16864, 16865, 0, 0, 0, 0, 0,
+    16866, 16867, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16868, 16869, 16870, 0, 0, 0,
+    0, 16871, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16872, 16873, 0, 0,
+    0, 0, 16874, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16875, 16876, 16877,
+    0, 0, 16878, 16879, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16880,
+    16881, 0, 0, 16882, 16883, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    16884, 16885, 16886, 0, 16887, 16888, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 32778, 32779, 16889, 16890, 16891, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 16892, 1, 1, 16893, 16894, 16895, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 16896, 1, 1, 1, 1, 16897, 16898, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16899, 1, 1, 1, 1, 1, 16900, 16901, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16902, 1, 1, 1, 1, 1, 1, 16903, 16904, 16905, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 16906, 16907, 1, 1, 1, 1, 1, 1, 1, 16908, 16909, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 16910, 1, 1, 1, 1, 1, 1, 1, 1, 1, 16911,
+    16912, 16913, 16914, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 16915, 16916, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 16917, 16918, 16919, 16920, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16921, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 16922, 16923, 16924, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 16925, 16926, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 16927, 16928, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16929, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 16930, 16931, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 16932, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16933, 16934, 16935, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 16936, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16937, 16938, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 16939, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16940, 16941, 16942,
+    5, 5, 5, 5, 5, 5, 5, 5, 16943, 16944, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 16945, 16946, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 16947, 16948, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16949, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16950, 16951, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16952, 16953, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16954, 16955, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    16956, 16957, 16958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16959, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 16960, 16961, 16962, 0, 0, 0, 0, 0, 0, 0, 0, 16963, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 16964, 16965, 0, 0, 0, 0, 0, 0, 0, 16966, 16967, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 16968, 16969, 16970, 0, 0, 0, 0, 0, 0, 16971, 16972,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 16973, 16974, 0, 0, 0, 0, 0, 0, 16975,
+    16976, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 16977, 16978, 0, 0, 0, 0, 0,
+    16979, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16980, 16981, 16982, 0, 0, 0,
+    0, 16983, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16984, 16985, 0, 0,
+    0, 16986, 16987, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16988, 16989, 16990,
+    0, 0, 16991, 16992, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16993,
+    16994, 0, 0, 16995, 16996, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    16997, 16998, 16999, 0, 32780, 32781, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 32782, 17000, 1, 17001, 17002, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17003, 17004, 1, 1, 17005, 17006, 17007, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17008, 1, 1, 1, 1, 17009, 17010, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17011, 17012, 1, 1, 1, 1, 1, 17013, 17014, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17015, 1, 1, 1, 1, 1, 1, 17016, 17017, 17018, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17019, 17020, 1, 1, 1, 1, 1, 1, 1, 17021, 17022, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17023, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17024,
+    17025, 17026, 17027, 17028, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17029, 17030, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 17031, 17032, 17033, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17034, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 17035, 17036, 17037, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17038, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 17039, 17040, 17041, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 17042, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 17043, 17044, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 17045, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17046, 17047, 17048, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 17049, 17050, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17051, 17052, 17053, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 17054, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17055, 17056,
+    5, 5, 5, 5, 5, 5, 5, 5, 17057, 17058, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 17059, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 17060, 17061, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17062, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17063, 17064, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17065, 17066, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17067, 17068, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17069, 17070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17071, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 17072, 17073, 17074, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17075, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 17076, 17077, 17078, 0, 0, 0, 0, 0, 0, 0, 17079, 17080, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 17081, 17082, 17083, 0, 0, 0, 0, 0, 0, 17084, 17085,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 17086, 17087, 0, 0, 0, 0, 0, 0, 17088,
+    17089, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 17090, 17091, 17092, 0, 0, 0, 0, 0,
+    17093, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17094, 17095, 0, 0, 0, 0,
+    0, 17096, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17097, 17098, 17099, 0, 0,
+    0, 17100, 17101, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17102, 17103, 0,
+    0, 0, 17104, 17105, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17106,
+    17107, 0, 0, 17108, 17109, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    17110, 17111, 17112, 17113, 32783, 17114, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 32784, 1, 1, 17115, 17116, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17117, 17118, 1, 1, 17119, 17120, 17121, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17122, 1, 1, 1, 1, 17123, 17124, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17125, 17126, 1, 1, 1, 1, 1, 17127, 17128, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17129, 1, 1, 1, 1, 1, 1, 17130, 17131, 17132, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17133, 17134, 1, 1, 1, 1, 1, 1, 1, 17135, 17136, 4,
+    17137, 17138, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17139, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17140,
+    17141, 17142, 17143, 17144, 17145, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17146, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 17147, 17148, 17149, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17150, 17151, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 17152, 17153, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17154, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 17155, 17156, 17157, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17158, 17159, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 17160, 17161, 17162, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 17163, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17164, 17165, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 17166, 17167, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17168, 17169, 17170, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 17171, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17172, 17173,
+    5, 5, 5, 5, 5, 5, 5, 5, 17174, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 17175, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 17176, 17177, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17178, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17179, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17180, 17181, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17182, 17183, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17185, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17186, 17187, 17188, 17189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17190, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 17191, 17192, 17193, 0, 0, 0, 0, 0, 0, 0, 17194, 17195, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 17196, 17197, 17198, 0, 0, 0, 0, 0, 0, 0, 17199, 17200,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 17201, 17202, 17203, 0, 0, 0, 0, 0, 0, 17204,
+    17205, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 17206, 17207, 17208, 0, 0, 0, 0, 0,
+    17209, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17210, 17211, 0, 0, 0, 0,
+    0, 17212, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17213, 17214, 17215, 0, 0,
+    0, 17216, 17217, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17218, 17219, 0,
+    0, 0, 17220, 17221, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17222, 17223,
+    17224, 0, 0, 17225, 17226, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    17227, 32785, 17228, 17229, 32786, 17230, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 17231, 17232, 1, 1, 17233, 17234, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17235, 1, 1, 1, 1, 17236, 17237, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17238, 17239, 1, 1, 1, 1, 17240, 17241, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17242, 1, 1, 1, 1, 1, 1, 17243, 17244, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17245, 17246, 1, 1, 1, 1, 1, 1, 17247, 17248, 17249, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17250, 1, 1, 1, 1, 1, 1, 1, 1, 17251, 17252, 4,
+    17253, 17254, 17255, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17256, 17257, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17258,
+    2, 2, 17259, 17260, 17261, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17262, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 17263, 17264, 17265, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17266, 17267, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 17268, 17269, 17270, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17271, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 17272, 17273, 17274, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17275, 17276, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 17277, 17278, 17279, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 17280, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17281, 17282, 17283, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 17284, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17285, 17286, 5,
+    5, 5, 5, 5, 5, 5, 5, 17287, 17288, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17289, 17290,
+    17291, 5, 5, 5, 5, 5, 5, 5, 17292, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 17293, 17294, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17295, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17296, 17297, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17298, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17299, 17300, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17301, 17302, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17303, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17304, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17305, 17306, 17307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17308, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 17309, 17310, 17311, 0, 0, 0, 0, 0, 0, 0, 0, 17312, 17313, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 17314, 17315, 17316, 0, 0, 0, 0, 0, 0, 0, 17317, 17318,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 17319, 17320, 17321, 0, 0, 0, 0, 0, 0, 17322,
+    17323, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 17324, 17325, 0, 0, 0, 0, 0, 0,
+    17326, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 17327, 17328, 17329, 0, 0, 0, 0,
+    0, 17330, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17331, 17332, 0, 0, 0,
+    0, 17333, 17334, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17335, 17336, 0,
+    0, 0, 17337, 17338, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17339, 17340,
+    17341, 0, 0, 17342, 17343, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    17344, 32787, 17345, 17346, 32788, 17347, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 17348, 17349, 1, 1, 17350, 17351, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17352, 1, 1, 1, 1, 17353, 17354, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17355, 17356, 1, 1, 1, 1, 17357, 17358, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17359, 1, 1, 1, 1, 1, 1, 17360, 17361, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17362, 17363, 1, 1, 1, 1, 1, 1, 17364, 17365, 17366, 4, 4,
+    17367, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17368, 1, 1, 1, 1, 1, 1, 1, 1, 17369, 17370, 4,
+    17371, 17372, 17373, 17374, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17375, 17376, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17377,
+    2, 2, 2, 17378, 17379, 17380, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17381, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 17382, 17383, 17384, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17385, 17386, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 17387, 17388, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17389, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 17390, 17391, 17392, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17393, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17394, 17395, 17396, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17397, 17398, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17399, 17400, 17401, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 17402, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17403, 17404, 17405,
+    5, 5, 5, 5, 5, 5, 5, 17406, 17407, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17408, 17409,
+    17410, 5, 5, 5, 5, 5, 5, 5, 17411, 1, 1, 1, 1, 1, 1, 1,
+    17412, 17413, 0, 0, 0, 0, 0, 0, 17414, 17415, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17416, 0, 0, 0, 0, 0, 0, 0, 0, 17417, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17418, 17419, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17420, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17421, 17422, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17423, 17424, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17425, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17426, 17427, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17428, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 17429, 17430, 17431, 17432, 0, 0, 0, 0, 0, 0, 0, 0, 17433, 17434, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 17435, 17436, 0, 0, 0, 0, 0, 0, 0, 0, 17437, 17438,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 17439, 17440, 17441, 0, 0, 0, 0, 0, 0, 0, 17442,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 17443, 17444, 17445, 0, 0, 0, 0, 0, 0,
+    17446, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 17447, 17448, 17449, 0, 0, 0, 0,
+    17450, 17451, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17452, 17453, 0, 0, 0,
+    0, 17454, 17455, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17456, 17457, 17458, 0,
+    0, 0, 17459, 17460, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17461, 17462,
+    0, 0, 0, 17463, 17464, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    32789, 32790, 17465, 17466, 32791, 17467, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 17468, 1, 1, 1, 17469, 17470, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 17471, 17472, 1, 1, 1, 1, 17473, 17474, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17475, 1, 1, 1, 1, 1, 17476, 17477, 17478, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17479, 17480, 1, 1, 1, 1, 1, 1, 17481, 17482, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17483, 1, 1, 1, 1, 1, 1, 1, 17484, 17485, 17486, 4, 4,
+    17487, 17488, 17489, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17490, 17491, 1, 1, 1, 1, 1, 1, 1, 1, 17492, 17493, 4,
+    2, 17494, 17495, 17496, 17497, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17498, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17499,
+    2, 2, 2, 2, 17500, 17501, 17502, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17503, 17504, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 17505, 17506, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17507, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 17508, 17509, 17510, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17511, 17512, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 17513, 17514, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17515, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17516, 17517, 17518, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17519, 17520, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17521, 17522, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 17523, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17524, 17525, 17526,
+    5, 5, 5, 5, 5, 5, 5, 17527, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17528,
+    17529, 5, 5, 5, 5, 5, 5, 17530, 17531, 1, 1, 1, 1, 1, 1, 1,
+    17532, 17533, 17534, 0, 0, 0, 0, 0, 0, 17535, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17536, 17537, 17538, 0, 0, 0, 0, 0, 0, 17539, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17540, 17541, 17542, 0, 0, 0, 0, 0, 0, 17543, 17544, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17545, 17546, 0, 0, 0, 0, 0, 0, 0, 0, 17547, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17548, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17549, 17550, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17551, 17552, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17553, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17554, 17555, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17556, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 17557, 17558, 17559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17560, 17561, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 17562, 17563, 17564, 0, 0, 0, 0, 0, 0, 0, 0, 17565, 17566,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 17567, 17568, 17569, 0, 0, 0, 0, 0, 0, 0, 17570,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 17571, 17572, 17573, 0, 0, 0, 0, 0, 0,
+    17574, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 17575, 17576, 0, 0, 0, 0, 0,
+    17577, 17578, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17579, 17580, 17581, 0, 0, 0,
+    0, 17582, 17583, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17584, 17585, 17586, 0,
+    0, 0, 17587, 17588, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17589, 17590,
+    0, 0, 0, 17591, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17592,
+    32792, 17593, 17594, 17595, 32793, 17596, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    17597, 17598, 1, 1, 1, 17599, 17600, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 17601, 17602, 1, 1, 1, 1, 17603, 17604, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 17605, 17606, 1, 1, 1, 1, 1, 17607, 17608, 17609, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17610, 17611, 1, 1, 1, 1, 1, 1, 17612, 17613, 4, 4, 4, 4,
+    17614, 17615, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17616, 17617, 1, 1, 1, 1, 1, 1, 1, 17618, 17619, 17620, 4, 4,
+    17621, 17622, 17623, 17624, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17625, 17626, 1, 1, 1, 1, 1, 1, 1, 1, 17627, 17628, 4,
+    2, 2, 17629, 17630, 17631, 17632, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17633, 17634, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17635,
+    2, 2, 2, 2, 2, 17636, 17637, 17638, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17639, 17640, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 17641, 17642, 17643, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17644, 17645, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 17646, 17647, 17648, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17649, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 17650, 17651, 17652, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17653, 17654, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17655, 17656, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 17657, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17658, 17659, 17660, 5,
+    5, 5, 5, 5, 5, 5, 17661, 17662, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17663, 17664,
+    5, 5, 5, 5, 5, 5, 5, 17665, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17666,
+    17667, 17668, 5, 5, 5, 5, 5, 17669, 17670, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 17671, 17672, 17673, 0, 0, 0, 0, 17674, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 17675, 17676, 17677, 0, 0, 0, 0, 17678, 17679, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 17680, 17681, 17682, 0, 0, 0, 0, 0, 0, 17683, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 17684, 17685, 17686, 0, 0, 0, 0, 0, 0, 17687, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17688, 17689, 17690, 0, 0, 0, 0, 0, 0, 0, 0, 17691, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17692, 17693, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17694, 17695, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17696, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17697, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17698, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17699, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17700, 17701, 17702, 17703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17704, 17705, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 17706, 17707, 17708, 17709, 0, 0, 0, 0, 0, 0, 0, 0, 17710, 17711,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 17712, 17713, 0, 0, 0, 0, 0, 0, 0, 0, 17714,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 17715, 17716, 17717, 0, 0, 0, 0, 0, 0, 0,
+    17718, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 17719, 17720, 17721, 0, 0, 0, 0, 0,
+    17722, 17723, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17724, 17725, 17726, 0, 0, 0,
+    0, 17727, 17728, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17729, 17730, 0, 0,
+    0, 0, 17731, 17732, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17733, 17734, 17735,
+    0, 0, 0, 17736, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 32794,
+    32795, 17737, 17738, 17739, 32796, 17740, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    17741, 17742, 1, 1, 1, 17743, 17744, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    17745, 17746, 1, 1, 1, 1, 1, 17747, 17748, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 17749, 17750, 1, 1, 1, 1, 1, 17751, 17752, 17753, 4, 4, 4, 4, 4,
+    17754, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17755, 1, 1, 1, 1, 1, 1, 1, 17756, 17757, 4, 4, 4, 4,
+    17758, 17759, 17760, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17761, 17762, 1, 1, 1, 1, 1, 1, 1, 1, 17763, 17764, 4, 4,
+    2, 17765, 17766, 17767, 17768, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17769, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17770, 17771, 17772,
+    2, 2, 2, 2, 17773, 17774, 17775, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17776, 17777, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17778,
+    2, 2, 2, 2, 2, 17779, 17780, 17781, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17782, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 17783, 17784, 17785, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17786, 17787, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 17788, 17789, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 17790, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17791, 17792, 17793, 5, 5, 5,
+    5, 5, 5, 5, 5, 17794, 17795, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17796, 17797, 17798, 5, 5,
+    5, 5, 5, 5, 5, 5, 17799, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17800, 17801, 5,
+    5, 5, 5, 5, 5, 5, 17802, 17803, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17804, 17805,
+    17806, 5, 5, 5, 5, 5, 17807, 17808, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    17809, 17810, 5, 5, 5, 5, 5, 17811, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 17812, 17813, 0, 0, 0, 17814, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 17815, 17816, 0, 0, 0, 17817, 17818, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 17819, 17820, 17821, 0, 0, 0, 0, 17822, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 17823, 17824, 0, 0, 0, 0, 0, 17825, 17826, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 17827, 17828, 17829, 0, 0, 0, 0, 0, 0, 17830, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 17831, 17832, 17833, 0, 0, 0, 0, 0, 0, 0, 17834, 17835, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17836, 17837, 17838, 17839, 0, 0, 0, 0, 0, 0, 0, 0, 17840, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17841, 17842, 17843, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17844, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    32797, 17845, 17846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17847, 17848, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 17849, 17850, 17851, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17852, 17853,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 17854, 17855, 17856, 0, 0, 0, 0, 0, 0, 0, 0, 17857,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 17858, 17859, 17860, 0, 0, 0, 0, 0, 0, 0,
+    17861, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 17862, 17863, 17864, 0, 0, 0, 0, 0,
+    17865, 17866, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17867, 17868, 0, 0, 0, 0,
+    0, 17869, 17870, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17871, 17872, 17873, 0, 0,
+    0, 0, 17874, 17875, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17876, 17877, 17878,
+    0, 17879, 17880, 32798, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 32799,
+    32800, 17881, 17882, 1, 17883, 17884, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 17885,
+    17886, 1, 1, 1, 1, 17887, 17888, 17889, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    17890, 17891, 1, 1, 1, 1, 1, 17892, 17893, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 17894, 1, 1, 1, 1, 1, 1, 17895, 17896, 17897, 4, 4, 4, 4, 4,
+    17898, 17899, 17900, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 17901, 17902, 1, 1, 1, 1, 1, 1, 1, 17903, 17904, 4, 4, 4, 4,
+    2, 17905, 17906, 17907, 17908, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17909, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17910, 17911, 4, 4,
+    2, 2, 2, 17912, 17913, 17914, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 17915, 17916, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17917, 17918, 17919,
+    2, 2, 2, 2, 2, 17920, 17921, 17922, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17923, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17924,
+    2, 2, 2, 2, 2, 2, 17925, 17926, 17927, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 17928, 17929, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 17930, 17931, 17932, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17933, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 17934, 17935, 17936, 5, 5, 5, 5,
+    5, 5, 5, 5, 17937, 17938, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17939, 17940, 5, 5, 5,
+    5, 5, 5, 5, 5, 17941, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17942, 17943, 17944, 5,
+    5, 5, 5, 5, 5, 17945, 17946, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17947, 17948, 17949,
+    5, 5, 5, 5, 5, 5, 17950, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17951,
+    17952, 5, 5, 5, 5, 5, 17953, 17954, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    17955, 17956, 17957, 5, 5, 5, 5, 17958, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 17959, 17960, 0, 17961, 17962, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 17963, 17964, 17965, 0, 0, 17966, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 17967, 17968, 17969, 0, 0, 17970, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 17971, 17972, 17973, 0, 0, 0, 17974, 17975, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 17976, 17977, 17978, 0, 0, 0, 0, 17979, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 17980, 17981, 17982, 0, 0, 0, 0, 0, 17983, 17984, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 17985, 17986, 17987, 0, 0, 0, 0, 0, 0, 0, 17988, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 17989, 17990, 17991, 17992, 0, 0, 0, 0, 0, 0, 0, 0, 17993, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    32801, 32802, 17994, 17995, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17996, 17997, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    17998, 32803, 32804, 17999, 18000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18001, 18002,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 18003, 18004, 18005, 0, 0, 0, 0, 0, 0, 0, 0, 18006,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 18007, 18008, 0, 0, 0, 0, 0, 0, 0, 0,
+    18009, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 18010, 18011, 18012, 0, 0, 0, 0, 0, 0,
+    18013, 18014, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 18015, 18016, 18017, 0, 0, 0, 0,
+    0, 18018, 18019, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18020, 18021, 18022, 0, 0,
+    0, 0, 18023, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18024, 32805, 18025,
+    18026, 18027, 18028, 32806, 18029, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18030, 18031,
+    1, 1, 1, 1, 18032, 18033, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18034,
+    18035, 1, 1, 1, 1, 18036, 18037, 18038, 4, 4, 4, 4, 4, 4, 4, 4,
+    18039, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18040,
+    18041, 1, 1, 1, 1, 1, 1, 18042, 18043, 4, 4, 4, 4, 4, 4, 4,
+    18044, 18045, 18046, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    18047, 18048, 1, 1, 1, 1, 1, 1, 18049, 18050, 18051, 4, 4, 4, 4, 4,
+    18052, 18053, 18054, 18055, 18056, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 18057, 1, 1, 1, 1, 1, 1, 1, 1, 18058, 18059, 4, 4, 4, 4,
+    2, 2, 2, 18060, 18061, 18062, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 18063, 18064, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18065, 18066, 4, 4,
+    2, 2, 2, 2, 18067, 18068, 18069, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 18070, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18071, 18072, 18073,
+    2, 2, 2, 2, 2, 2, 18074, 18075, 18076, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 18077, 18078, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18079,
+    2, 2, 2, 2, 2, 2, 2, 18080, 18081, 18082, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 18083, 18084, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 18085, 18086, 5, 5, 5, 5, 5,
+    5, 5, 5, 18087, 18088, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18089, 18090, 18091, 5, 5, 5,
+    5, 5, 5, 5, 18092, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18093, 18094, 18095, 5, 5,
+    5, 5, 5, 5, 18096, 18097, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18098, 18099, 5,
+    5, 5, 5, 5, 5, 18100, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18101, 18102,
+    18103, 5, 5, 5, 5, 18104, 18105, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18106,
+    18107, 18108, 5, 5, 5, 5, 18109, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 18110, 18111, 5, 5, 5, 18112, 18113, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 18114, 18115, 18116, 18117, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 18118, 18119, 18120, 18121, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 18122, 18123, 0, 18124, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 18125, 18126, 18127, 0, 18128, 18129, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 18130, 18131, 18132, 0, 0, 0, 18133, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 18134, 18135, 18136, 0, 0, 0, 18137, 18138, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 18139, 18140, 18141, 0, 0, 0, 0, 0, 18142, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 18143, 18144, 18145, 18146, 0, 0, 0, 0, 0, 0, 18147, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 18148, 18149, 18150, 18151, 0, 0, 0, 0, 0, 0, 0, 18152, 18153, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18154, 18155, 32807, 32808, 18156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18157, 18158,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18159, 18160, 18161, 32809, 18162, 18163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18164,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 18165, 18166, 18167, 0, 0, 0, 0, 0, 0, 0, 18168,
+    18169, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 18170, 18171, 18172, 0, 0, 0, 0, 0, 0,
+    18173, 18174, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 18175, 18176, 18177, 0, 0, 0, 0,
+    0, 18178, 18179, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18180, 18181, 0, 0, 0,
+    0, 0, 18182, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18183, 32810, 32811, 18184,
+    18185, 18186, 18187, 32812, 18188, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18189, 18190,
+    1, 1, 1, 1, 18191, 18192, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18193, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18194, 18195,
+    1, 1, 1, 1, 1, 18196, 18197, 18198, 4, 4, 4, 4, 4, 4, 4, 4,
+    18199, 18200, 18201, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18202,
+    18203, 1, 1, 1, 1, 1, 1, 18204, 18205, 4, 4, 4, 4, 4, 4, 4,
+    18206, 18207, 18208, 18209, 18210, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18211,
+    18212, 1, 1, 1, 1, 1, 1, 1, 1, 18213, 18214, 4, 4, 4, 4, 4,
+    2, 2, 2, 18215, 18216, 18217, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    18218, 18219, 1, 1, 1, 1, 1, 1, 1, 1, 18220, 18221, 18222, 4, 4, 4,
+    2, 2, 2, 2, 18223, 18224, 18225, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 18226, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18227, 18228, 4, 4,
+    2, 2, 2, 2, 2, 18229, 18230, 18231, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 18232, 18233, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18234, 18235, 18236,
+    2, 2, 2, 2, 2, 2, 2, 18237, 18238, 18239, 5, 5, 5, 5, 5, 5,
+    5, 5, 18240, 18241, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18242,
+    2, 2, 2, 2, 2, 2, 2, 2, 18243, 18244, 18245, 5, 5, 5, 5, 5,
+    5, 5, 18246, 18247, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 18248, 18249, 18250, 5, 5, 5, 5,
+    5, 5, 5, 18251, 18252, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18253, 18254, 5, 5, 5,
+    5, 5, 5, 18255, 18256, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18257, 18258, 18259, 5,
+    5, 5, 5, 5, 18260, 18261, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18262, 18263, 18264,
+    5, 5, 5, 5, 18265, 18266, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18267,
+    18268, 5, 5, 5, 5, 18269, 18270, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    18271, 18272, 18273, 5, 5, 18274, 18275, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 18276, 18277, 18278, 5, 5, 18279, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 18280, 32813, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 18281, 32814, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 18282, 18283, 32815, 18284, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 18285, 18286, 18287, 18288, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 18289, 18290, 18291, 0, 18292, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 18293, 18294, 18295, 0, 0, 18296, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 18297, 18298, 18299, 0, 0, 0, 18300, 18301, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 18302, 18303, 18304, 0, 0, 0, 0, 0, 18305, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 18306, 18307, 18308, 18309, 0, 0, 0, 0, 0, 18310, 18311, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 18312, 18313, 18314, 0, 0, 0, 0, 0, 0, 0, 18315, 18316,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18317, 18318, 18319, 32816, 32817, 32818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18320,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18321, 18322, 5, 5, 5, 18323, 18324, 18325, 0, 0, 0, 0, 0, 0, 0, 18326,
+    18327, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 18328, 18329, 0, 0, 0, 0, 0, 0, 0,
+    18330, 18331, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 18332, 18333, 18334, 0, 0, 0, 0, 0,
+    0, 18335, 18336, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18337, 18338, 18339, 0, 0, 0,
+    0, 0, 18340, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18341, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 32819, 32820, 18342, 18343,
+    18344, 18345, 18346, 32821, 18347, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18348, 18349, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18350, 18351, 1,
+    1, 1, 1, 1, 18352, 18353, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18354, 18355, 18356, 18357, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18358, 18359,
+    1, 1, 1, 1, 1, 1, 18360, 18361, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 18362, 18363, 18364, 18365, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18366, 18367,
+    1, 1, 1, 1, 1, 1, 1, 18368, 18369, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 18370, 18371, 18372, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18373,
+    18374, 1, 1, 1, 1, 1, 1, 1, 1, 18375, 18376, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 18377, 18378, 18379, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    18380, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18381, 18382, 18383, 4, 4, 4,
+    2, 2, 2, 2, 2, 18384, 18385, 18386, 5, 5, 5, 5, 5, 5, 5, 5,
+    18387, 18388, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18389, 18390, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 18391, 18392, 5, 5, 5, 5, 5, 5, 5,
+    5, 18393, 18394, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18395, 18396, 18397,
+    2, 2, 2, 2, 2, 2, 2, 2, 18398, 18399, 18400, 5, 5, 5, 5, 5,
+    5, 18401, 18402, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18403,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 18404, 18405, 18406, 5, 5, 5, 5,
+    5, 5, 18407, 18408, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18409, 18410, 18411, 5, 5, 5,
+    5, 5, 18412, 18413, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18414, 18415, 18416, 5, 5,
+    5, 5, 5, 18417, 18418, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18419, 18420, 5,
+    5, 5, 5, 18421, 18422, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18423, 18424,
+    18425, 5, 5, 5, 18426, 18427, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18428,
+    18429, 18430, 5, 5, 18431, 18432, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 18433, 18434, 5, 5, 18435, 18436, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 18437, 18438, 18439, 18440, 18441, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18442, 18443, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18444, 18445, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18446, 32822, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18447, 32823, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 18448, 18449, 32824, 18450, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 18451, 18452, 18453, 18454, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 18455, 18456, 18457, 0, 18458, 18459, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 18460, 18461, 18462, 0, 0, 0, 18463, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 18464, 18465, 18466, 18467, 0, 0, 0, 18468, 18469, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 18470, 18471, 18472, 0, 0, 0, 0, 0, 18473, 18474,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 18475, 18476, 18477, 0, 0, 0, 0, 0, 0, 0, 18478,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18479, 18480, 18481, 18482, 18483, 32825, 32826, 0, 0, 0, 0, 0, 0, 0, 0, 18484,
+    18485, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 18486, 18487, 18488, 0, 0, 0, 0, 0, 0, 0,
+    18489, 18490, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18491, 5, 5, 5, 5, 5, 5, 5, 18492, 18493, 18494, 0, 0, 0, 0, 0,
+    0, 18495, 18496, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18497, 18498, 5, 5, 5, 5, 5, 5, 5, 5, 18499, 32827, 32828, 18500, 18501, 18502,
+    18503, 18504, 32829, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18505, 18506, 18507, 5, 5, 5, 5, 5, 5, 5, 5, 18508, 32830, 32831, 18509, 18510,
+    18511, 1, 1, 18512, 18513, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18514, 18515, 18516, 18517, 5, 5, 5, 5, 5, 5, 5, 5, 18518, 18519, 1, 1,
+    1, 1, 1, 1, 18520, 18521, 18522, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 18523, 18524, 18525, 5, 5, 5, 5, 5, 5, 5, 5, 18526, 18527, 1,
+    1, 1, 1, 1, 1, 1, 18528, 18529, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 18530, 18531, 18532, 5, 5, 5, 5, 5, 5, 5, 5, 18533, 18534,
+    1, 1, 1, 1, 1, 1, 1, 18535, 18536, 18537, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 18538, 18539, 18540, 5, 5, 5, 5, 5, 5, 5, 18541, 18542,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 18543, 18544, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 18545, 18546, 18547, 5, 5, 5, 5, 5, 5, 5, 18548,
+    18549, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18550, 18551, 18552, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 18553, 18554, 5, 5, 5, 5, 5, 5, 5,
+    18555, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18556, 18557, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 18558, 18559, 5, 5, 5, 5, 5, 5,
+    18560, 18561, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18562, 18563,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 18564, 18565, 5, 5, 5, 5, 5,
+    5, 18566, 18567, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18568,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18569, 18570, 18571, 5, 5, 5,
+    5, 18572, 18573, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18574, 18575, 18576, 5, 5,
+    5, 5, 18577, 18578, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18579, 18580, 18581, 5,
+    5, 5, 18582, 18583, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18584, 18585,
+    5, 5, 5, 18586, 18587, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18588,
+    18589, 5, 5, 18590, 18591, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    18592, 18593, 18594, 5, 18595, 18596, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 18597, 18598, 18599, 18600, 18601, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 18602, 18603, 18604, 18605, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18606, 18607, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18608, 18609, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18610, 18611, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18612, 18613, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 32832, 32833, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18614, 32834, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18615, 18616, 32835, 18617, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 18618, 18619, 18620, 0, 18621, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 18622, 18623, 18624, 18625, 0, 18626, 18627, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 18628, 18629, 18630, 0, 0, 0, 18631, 18632,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 18633, 18634, 18635, 0, 0, 0, 0, 0, 18636,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 18637, 18638, 18639, 0, 0, 0, 0, 0, 0, 18640,
+    18641, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    32836, 32837, 32838, 18642, 18643, 18644, 32839, 32840, 32841, 0, 0, 0, 0, 0, 0, 0,
+    18645, 18646, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18647, 18648, 18649, 5, 5, 5, 5, 5, 18650, 18651, 0, 0, 0, 0, 0, 0,
+    0, 18652, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 18653, 18654, 18655, 5, 5, 5, 5, 5, 5, 32842, 32843, 18656, 18657, 18658, 18659,
+    18660, 18661, 32844, 18662, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 18663, 18664, 18665, 5, 5, 5, 5, 5, 5, 18666, 18667, 1, 1, 1,
+    1, 1, 1, 18668, 18669, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 18670, 18671, 18672, 5, 5, 5, 5, 5, 18673, 18674, 18675, 1, 1,
+    1, 1, 1, 1, 18676, 18677, 18678, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 18679, 18680, 18681, 5, 5, 5, 5, 5, 18682, 18683, 1, 1,
+    1, 1, 1, 1, 1, 1, 18684, 18685, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 18686, 18687, 5, 5, 5, 5, 5, 5, 18688, 18689, 1,
+    1, 1, 1, 1, 1, 1, 1, 18690, 18691, 18692, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 18693, 18694, 5, 5, 5, 5, 5, 5, 18695, 18696,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 18697, 18698, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 18699, 18700, 5, 5, 5, 5, 5, 18701, 18702,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18703, 18704, 18705, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 18706, 18707, 5, 5, 5, 5, 5, 18708,
+    18709, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18710, 18711, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 18712, 18713, 5, 5, 5, 5, 18714,
+    18715, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18716, 18717,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18718, 18719, 5, 5, 5, 5,
+    18720, 18721, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18722,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18723, 18724, 18725, 5, 5,
+    5, 18726, 18727, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18728, 18729, 18730, 5,
+    5, 18731, 18732, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18733, 18734, 18735,
+    5, 5, 18736, 18737, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18738, 18739,
+    18740, 5, 18741, 18742, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    18743, 18744, 5, 18745, 18746, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 18747, 18748, 18749, 18750, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 18751, 18752, 32845, 18753, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 18754, 32846, 32847, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18755, 18756, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18757, 18758, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18759, 18760, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18761, 18762, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18763, 18764, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18765, 18766, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 32848, 32849, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18767, 18768, 32850, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18769, 18770, 18771, 32851, 18772, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18773, 18774, 18775, 0, 18776, 18777,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 18778, 18779, 18780, 0, 0, 0, 18781,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 18782, 18783, 18784, 18785, 0, 0, 0, 18786,
+    18787, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18788, 18789, 18790, 3, 18791, 18792, 18793, 32852, 18794, 18795, 18796, 0, 0, 0, 0, 0,
+    18797, 18798, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18799, 18800, 32853, 32854, 32855, 18801, 18802, 18803, 32856, 32857, 0, 0, 0, 0, 18804, 18805,
+    18806, 32858, 18807, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 18808, 18809, 18810, 5, 5, 5, 32859, 32860, 18811, 18812, 18813, 18814, 18815,
+    18816, 18817, 32861, 18818, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 18819, 18820, 5, 5, 5, 5, 18821, 18822, 1, 1, 1, 1,
+    1, 1, 1, 18823, 18824, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 18825, 18826, 18827, 5, 5, 5, 5, 18828, 18829, 1, 1, 1,
+    1, 1, 1, 1, 1, 18830, 18831, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 18832, 18833, 18834, 5, 5, 5, 18835, 18836, 18837, 1, 1,
+    1, 1, 1, 1, 1, 1, 18838, 18839, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 18840, 18841, 18842, 5, 5, 5, 18843, 18844, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 18845, 18846, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 18847, 18848, 18849, 5, 5, 5, 18850, 18851, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 18852, 18853, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 18854, 18855, 5, 5, 5, 5, 18856, 18857,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18858, 18859, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 18860, 18861, 5, 5, 5, 18862, 18863,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18864, 18865, 18866, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18867, 18868, 5, 5, 5, 18869,
+    18870, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18871, 18872,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18873, 18874, 5, 5, 18875,
+    18876, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18877,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18878, 18879, 5, 5,
+    18880, 18881, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18882, 18883, 18884,
+    5, 18885, 18886, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18887, 18888,
+    18889, 18890, 18891, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18892,
+    18893, 18894, 18895, 18896, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    18897, 18898, 32862, 18899, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 18900, 32863, 18901, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 32864, 32865, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 32866, 18902, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18903, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18904, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18905, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18906, 18907, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18908, 18909, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18910, 18911, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18912, 18913, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 32867, 18914, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18915, 32868, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18916, 18917, 32869, 18918,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18919, 18920, 18921, 0, 18922,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18923, 18924, 18925, 18926, 0, 18927,
+    18928, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18929, 18930, 18931, 0, 0, 0,
+    18932, 18933, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18934, 18935, 18936, 18937, 32870, 18938, 18939, 18940, 18941, 32871, 32872, 32873, 18942, 18943, 18944, 18945,
+    18946, 32874, 18947, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 32875, 32876, 32877, 18948, 18949, 32878, 32879, 1, 1, 1, 1, 1,
+    1, 1, 18950, 18951, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 18952, 18953, 18954, 5, 18955, 18956, 1, 1, 1, 1, 1,
+    1, 1, 1, 18957, 18958, 18959, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 18960, 18961, 5, 5, 18962, 18963, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 18964, 18965, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 18966, 18967, 18968, 5, 5, 18969, 18970, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 18971, 18972, 18973, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 18974, 18975, 18976, 5, 18977, 18978, 18979, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 18980, 18981, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 18982, 18983, 18984, 5, 18985, 18986, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 18987, 18988, 18989, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 18990, 18991, 18992, 5, 18993, 18994, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18995, 18996, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18997, 18998, 5, 18999, 19000, 19001,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19002, 19003, 19004, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19005, 19006, 5, 19007, 19008,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19009, 19010,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19011, 19012, 5, 19013,
+    19014, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19015,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19016, 19017, 19018,
+    19019, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19020, 19021,
+    19022, 19023, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19024,
+    19025, 32880, 19026, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19027, 32881, 32882, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19028, 32883, 19029, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19030, 32884, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19031, 19032, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19033, 19034, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19035, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19036, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19037, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19038, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19039, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19040, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19041, 19042,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19043, 19044,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19045, 19046,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 32885, 32886,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19047, 19048, 32887,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19049, 19050, 19051, 32888,
+    19052, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19053, 32889, 32890, 19054,
+    32891, 32892, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    19055, 19056, 19057, 19058, 3, 3, 3, 3, 3, 3, 19059, 32893, 32894, 32895, 19060, 19061,
+    19062, 32896, 19063, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 19064, 19065, 19066, 19067, 32897, 19068, 19069, 32898, 19070, 19071, 1, 1, 1, 1,
+    1, 1, 19072, 19073, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 32899, 32900, 32901, 32902, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 19074, 19075, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 19076, 19077, 32903, 19078, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 19079, 19080, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 19081, 19082, 19083, 19084, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 19085, 19086, 19087, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 19088, 19089, 32904, 19090, 19091, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 19092, 19093, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 19094, 19095, 32905, 19096, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 19097, 19098, 19099, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19100, 19101, 32906, 19102, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19103, 19104, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19105, 19106, 19107, 19108, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19109, 19110, 19111, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19112, 32907, 19113, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19114, 19115,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19116, 32908, 19117,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19118, 32909,
+    19119, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 32910,
+    32911, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    32912, 32913, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 32914, 19120, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19121, 19122, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19123, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19124, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19125, 19126, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19127, 19128,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19129, 19130,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19131, 19132,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19133, 19134,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19135,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19136,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19137,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19138,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19139,
+    19140, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19141,
+    19142, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19143,
+    19144, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 32915,
+    32916, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 32917, 32918,
+    32919, 19145, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    19146, 19147, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19148, 19149, 19150, 19151,
+    1, 19152, 19153, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    19154, 19155, 19156, 19157, 19158, 19159, 19160, 3, 3, 3, 19161, 19162, 19163, 19164, 1, 1,
+    1, 1, 19165, 19166, 19167, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 19168, 19169, 19170, 32920, 32921, 19171, 19172, 1, 1, 1, 1,
+    1, 1, 1, 1, 19173, 19174, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 32922, 32923, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 19175, 19176, 19177, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 32924, 32925, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 19178, 19179, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 32926, 32927, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 19180, 19181, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19182, 32928, 19183, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19184, 19185, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19186, 32929, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19187, 19188, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 32930, 32931, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19189, 19190, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 32932, 32933, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19191, 19192,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 32934, 19193,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19194,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19195,
+    19196, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19197, 19198, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19199, 19200, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19201, 19202, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19203, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19204, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19205, 19206, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19207,
+    19208, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19209,
+    19210, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19211,
+    19212, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19213,
+    19214, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19215,
+    19216, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19217,
+    19218, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19219,
+    19220, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19221, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19222, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19223, 19224, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19225, 19226, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19227, 19228, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19229,
+    32935, 32936, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19230, 19231, 19232,
+    19233, 19234, 19235, 19236, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    19237, 19238, 19239, 19240, 19241, 3, 3, 3, 3, 3, 3, 19242, 19243, 19244, 19245, 1,
+    1, 1, 1, 19246, 19247, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 19248, 19249, 19250, 19251, 19252, 19253, 19254, 19255, 19256, 1, 1, 1,
+    1, 1, 1, 1, 19257, 19258, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 19259, 19260, 32937, 19261, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 19262, 19263, 19264, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 19265, 19266, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 19267, 19268, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19269, 19270, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 19271, 19272, 19273, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19274, 19275, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19276, 19277, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19278, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19279, 19280, 19281, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19282, 19283, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19284, 19285, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19286, 19287, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19288, 19289,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19290, 19291,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19292,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19293, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19294, 19295, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19296, 19297, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19298, 19299, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19300, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19301, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19302, 19303, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19304, 19305, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19306, 19307, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19308, 19309, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19310, 19311, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19312, 19313, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19314, 19315, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19316, 19317, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19318, 19319, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19320, 19321, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19322, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19323, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19324, 19325, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 32938, 32939, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19326,
+    19327, 19328, 19329, 19330, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    19331, 19332, 19333, 19334, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19335, 19336, 19337,
+    19338, 1, 1, 19339, 19340, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 19341, 19342, 19343, 19344, 19345, 19346, 3, 3, 3, 19347, 19348, 19349, 19350, 1,
+    1, 1, 1, 1, 19351, 19352, 19353, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 19354, 19355, 19356, 32940, 19357, 19358, 19359, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 19360, 19361, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 19362, 32941, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 19363, 19364, 19365, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19366, 19367, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 19368, 19369, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19370, 19371, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19372, 19373, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19374, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19375, 19376, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19377, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19378, 19379, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19380, 19381, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19382,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19383, 19384,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19385,
+    19386, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19387, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19388, 19389, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19390, 19391, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19392, 19393, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19394, 19395, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19396, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 19397, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19398, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19399, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19400, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19401, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19402, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19403, 19404, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19405, 19406, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19407, 19408, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19409, 19410, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19411, 19412, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19413, 19414, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19415, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 32942, 19416, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19417, 19418, 32943, 32944, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    19419, 19420, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19421, 19422,
+    19423, 19424, 1, 19425, 19426, 19427, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    19428, 19429, 19430, 19431, 19432, 19433, 19434, 3, 3, 3, 3, 3, 19435, 19436, 19437, 19438,
+    1, 1, 1, 1, 1, 19439, 19440, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 19441, 19442, 19443, 19444, 19445, 3, 19446, 19447, 19448, 1, 1,
+    1, 1, 1, 1, 1, 1, 19449, 19450, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 19451, 19452, 32945, 19453, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 19454, 19455, 19456, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19457, 19458, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 19459, 19460, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19461, 19462, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19463, 19464, 19465, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19466, 19467, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19468, 19469, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19470, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19471, 19472, 19473,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19474, 19475, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19476,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19477, 19478,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19479,
+    19480, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19481, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19482, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19483, 19484, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19485, 19486, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19487, 19488, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19489, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 19490, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19491, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19492, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19493, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19494, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19495, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19496, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19497, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19498, 19499, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19500, 19501, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19502, 19503, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19504, 19505, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19506, 19507, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19508, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19509, 19510, 32946, 19511, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19512, 19513, 19514, 1, 19515, 19516, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    19517, 19518, 19519, 19520, 19521, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19522, 19523,
+    19524, 19525, 1, 1, 1, 19526, 19527, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 19528, 19529, 19530, 19531, 19532, 3, 3, 3, 19533, 19534, 19535, 19536,
+    1, 1, 1, 1, 1, 1, 19537, 19538, 19539, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 19540, 19541, 19542, 32947, 19543, 19544, 19545, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 19546, 19547, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19548, 32948, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 19549, 19550, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19551, 19552, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19553, 19554, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19555, 19556, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19557, 19558, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19559, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19560, 19561, 19562,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19563, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19564,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19565, 19566,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19567,
+    19568, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19569, 19570, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19571, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19572, 19573, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19574, 19575, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19576, 19577, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19578, 19579, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 19580, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19581, 19582, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19583, 19584, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19585, 19586, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19587, 19588, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19589, 19590, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19591, 19592, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19593, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19594, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19595, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19596, 19597, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19598, 19599, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19600, 19601, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19602, 19603, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 32949, 32950, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19604, 19605, 19606, 32951, 19607, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    19608, 19609, 19610, 19611, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19612,
+    19613, 19614, 19615, 1, 1, 19616, 19617, 19618, 4, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 19619, 19620, 19621, 19622, 19623, 19624, 3, 3, 3, 3, 3, 19625, 19626, 19627,
+    19628, 1, 1, 1, 1, 1, 1, 19629, 19630, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 19631, 19632, 19633, 19634, 19635, 3, 19636, 19637, 19638, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 19639, 19640, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19641, 32952, 19642, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 19643, 19644, 19645, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19646, 19647, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19648, 19649, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19650, 19651, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19652, 19653, 19654, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19655, 19656, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19657, 19658,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19659, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19660,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19661, 19662,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19663,
+    19664, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19665, 19666, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19667, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19668, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19669, 19670, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19671, 19672, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19673, 19674, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 19675, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19676, 19677, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19678, 19679, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19680, 19681, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19682, 19683, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19684, 19685, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19686, 19687, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19688, 19689, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19690, 19691, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19692, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19693, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19694, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19695, 19696, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19697, 19698, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 32953, 19699, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19700, 19701, 19702, 32954, 19703, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    19704, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19705, 19706, 19707, 1, 1, 19708, 19709, 4, 4, 4, 4, 4, 4, 4, 4,
+    19710, 19711, 19712, 19713, 19714, 19715, 19716, 3, 3, 3, 3, 3, 3, 3, 3, 19717,
+    19718, 19719, 1, 1, 1, 1, 1, 19720, 19721, 4, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 19722, 19723, 19724, 19725, 19726, 3, 3, 3, 19727, 19728, 19729,
+    19730, 1, 1, 1, 1, 1, 1, 1, 19731, 19732, 19733, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 19734, 19735, 32955, 19736, 19737, 19738, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19739, 19740, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 32956, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19741, 19742, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19743, 19744, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19745, 19746, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19747, 19748, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19749, 19750,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19751, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19752,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19753,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19754,
+    19755, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19756, 19757, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19758, 19759, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19760, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19761, 19762, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19763, 19764, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19765, 19766, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 19767, 19768, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19769, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19770, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19771, 19772, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19773, 19774, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19775, 19776, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19777, 19778, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19779, 19780, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19781, 19782, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19783, 19784, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19785, 19786, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19787, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19788, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19789, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19790, 19791, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19792, 32957, 32958, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19793, 19794, 19795, 19796, 19797, 19798, 19799, 4, 4, 4, 4, 4, 4, 4,
+    19800, 19801, 19802, 19803, 19804, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    19805, 19806, 19807, 19808, 1, 1, 1, 19809, 19810, 19811, 4, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 19812, 19813, 19814, 19815, 19816, 3, 3, 3, 3, 3, 19817, 19818,
+    19819, 19820, 1, 1, 1, 1, 1, 1, 1, 19821, 19822, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 19823, 19824, 19825, 19826, 3, 19827, 19828, 19829,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19830, 19831, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19832, 32959, 19833, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19834, 19835, 19836, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19837, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19838, 19839, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19840, 19841, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19842, 19843,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19844, 19845,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19846,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19847,
+    19848, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19849, 19850, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19851, 19852, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19853, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19854, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19855, 19856, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19857, 19858, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 19859, 19860, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19861, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19862, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19863, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19864, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19865, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19866, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19867, 19868, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19869, 19870, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19871, 19872, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19873, 19874, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19875, 19876, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19877, 19878, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19879, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19880, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19881, 32960, 32961, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19882, 19883, 19884, 19885, 19886, 19887, 4, 4, 4, 4, 4, 4, 4,
+    19888, 19889, 19890, 19891, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 19892, 19893, 19894, 1, 1, 1, 19895, 19896, 4, 4, 4, 4, 4, 4,
+    2, 2, 19897, 19898, 19899, 19900, 19901, 19902, 3, 3, 3, 3, 3, 3, 3, 3,
+    19903, 19904, 19905, 1, 1, 1, 1, 1, 1, 19906, 19907, 4, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 19908, 19909, 19910, 19911, 19912, 3, 3, 3, 19913, 19914,
+    19915, 19916, 1, 1, 1, 1, 1, 1, 1, 1, 19917, 19918, 19919, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19920, 19921, 19922, 32962, 19923, 19924,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19925, 19926, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 32963, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19927, 19928, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19929, 19930, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19931,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19932, 19933,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19934,
+    19935, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19936, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    19937, 19938, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 19939, 19940, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 19941, 19942, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19943, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 19944, 19945, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19946, 19947, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 19948, 19949, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19950, 19951, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19952, 19953, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19954, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19955, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19956, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19957, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19958, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19959, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19960, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19961, 19962, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19963, 19964, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19965, 19966, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19967, 19968, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19969, 19970, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 19971, 32964, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 19972, 19973, 32965, 19974, 4, 4, 4, 4, 4, 4, 4,
+    19975, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 19976, 19977, 19978, 19979, 1, 19980, 19981, 19982, 4, 4, 4, 4, 4,
+    19983, 19984, 19985, 19986, 19987, 19988, 19989, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 19990, 19991, 19992, 19993, 1, 1, 1, 1, 19994, 19995, 19996, 4, 4, 4, 4,
+    2, 2, 2, 2, 2, 19997, 19998, 19999, 20000, 20001, 3, 3, 3, 3, 3, 20002,
+    20003, 20004, 20005, 1, 1, 1, 1, 1, 1, 1, 1, 20006, 20007, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 20008, 20009, 20010, 20011, 3, 20012, 20013,
+    20014, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 20015, 20016, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20017, 32966, 32967, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 20018, 20019, 20020,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20021, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 20022,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20023, 20024,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20025,
+    20026, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    20027, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    20028, 20029, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 20030, 20031, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 20032, 20033, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 20034, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 20035, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 20036, 20037, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 20038, 20039, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 20040, 20041, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 20042, 20043, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 20044, 20045, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 20046, 20047, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 20048, 20049, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 20050, 20051, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 20052, 20053, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 20054, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 20055, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 20056, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 20057, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 20058, 20059, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 20060, 20061, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 20062, 20063, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 20064, 20065, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 20066, 20067, 32968, 20068, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 20069, 20070, 20071, 20072, 1, 20073, 20074, 4, 4, 4, 4, 4,
+    20075, 20076, 20077, 20078, 20079, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 20080, 20081, 20082, 1, 1, 1, 1, 20083, 20084, 4, 4, 4, 4,
+    2, 2, 2, 2, 20085, 20086, 20087, 20088, 20089, 3, 3, 3, 3, 3, 3, 3,
+    3, 20090, 20091, 20092, 1, 1, 1, 1, 1, 1, 1, 20093, 20094, 4, 4, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 20095, 20096, 20097, 20098, 3, 3, 3, 20099,
+    20100, 20101, 20102, 1, 1, 1, 1, 1, 1, 1, 1, 1, 20103, 20104, 20105, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20106, 20107, 20108, 32969, 20109,
+    20110, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 20111, 20112,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 32970, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 20113,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20114, 20115,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20116,
+    20117, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    20118, 20119, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 20120, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 20121, 20122, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 20123, 20124, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 20125, 20126, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 20127, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 20128, 20129, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 20130, 20131, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+
+const GUI_Palette6SplitPair GUI_PALETTE_6_PAIRS[] = {
+    {{0, 4}, {0x808080c0, 0x0, 0x808080c0, 0x0, 0x808080c0, 0x0, 0x808080c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff}},
+    {{0, 4}, {0xf8f8fcfc, 0xc0e0f0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0}},
+    {{0, 4}, {0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xe0f0f8fc}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe}},
+    {{0, 5}, {0x0, 0x7000000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0xffffff1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f07, 0xffffffff, 0xffff1f07, 0xffffffff, 0xff7f1f03, 0xffffffff, 0xff7f0f03, 0xffffffff}},
+    {{0, 5}, {0xf030000, 0xffffff3f, 0xf030000, 0xffffff3f, 0x7010000, 0xffff7f3f, 0x7010000, 0xffff7f1f, 0x3000000, 0xffff7f1f, 0x3000000, 0xffff3f0f, 0x1000000, 0xffff3f0f, 0x1000000, 0xffff3f07}},
+    {{0, 5}, {0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f1f0701}},
+    {{0, 4}, {0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0}},
+    {{0, 5}, {0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff3f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f}},
+    {{0, 5}, {0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000}},
+    {{0, 4}, {0xf8f8fcfe, 0x80c0e0f0, 0xf8f8fcfe, 0x80c0e0f0, 0xf8f8fcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0}},
+    {{0, 5}, {0xffff3f1f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x1000000, 0x3f1f0f03, 0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f0f0703}},
+    {{0, 4}, {0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0x1f070300, 0xffffff3f, 0xf070300, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f}},
+    {{0, 5}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc}},
+    {{0, 5}, {0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff3f1f0f, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff}},
+    {{0, 5}, {0x0, 0x3f1f0703, 0x0, 0x3f0f0703, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x1f0f0301}},
+    {{0, 4}, {0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff3f1f, 0x7030100, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f}},
+    {{0, 5}, {0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f8, 0x80, 0xc0e0f0f8, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0x7f3f1f07, 0xffffffff, 0x7f3f1f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff}},
+    {{0, 5}, {0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f070301, 0x0, 0x1f070300}},
+    {{0, 4}, {0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0x7030000, 0xffff3f1f, 0x7030000, 0xff7f3f1f, 0x7030000, 0xff7f3f1f, 0x7030000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0}},
+    {{0, 5}, {0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff}},
+    {{0, 5}, {0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0xf070300, 0x0, 0xf070100}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc}},
+    {{0, 5}, {0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{0, 5}, {0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff}},
+    {{0, 5}, {0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100}},
+    {{0, 4}, {0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 1}, {0xffff8000, 0xffffffff, 0xffff8000, 0xffffffff, 0xffff8000, 0xffffffff, 0xffff8000, 0xffffffff, 0xffffc000, 0xffffffff, 0xffffc000, 0xffffffff, 0xffffc000, 0xffffffff, 0xffffe000, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 5}, {0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f0f, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x1010000, 0x7030301, 0x1010000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x7030301}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc}},
+    {{1, 5}, {0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{1, 4}, {0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010101, 0x0, 0x3010100}},
+    {{1, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xf070707, 0x3f1f1f0f, 0xf070707, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x1f1f1f0f, 0xf070703, 0x1f1f1f0f, 0xf070703, 0x1f1f1f0f, 0xf070703, 0x1f1f0f0f}},
+    {{1, 4}, {0x80c0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe}},
+    {{1, 5}, {0x7f7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 4}, {0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xf8ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xc0feffff}},
+    {{1, 5}, {0x7030303, 0x1f0f0f07, 0x7030303, 0x1f0f0f07, 0x7030301, 0xf0f0f07, 0x7030301, 0xf0f0f07, 0x7030301, 0xf0f0f07, 0x7030301, 0xf0f0f07, 0x7030301, 0xf0f0707, 0x7030301, 0xf0f0707}},
+    {{2, 5}, {0xe0ff, 0x0, 0xc0fe, 0x0, 0xc0fe, 0x0, 0xc0fe, 0x0, 0x80fc, 0x0, 0x80fc, 0x0, 0x80f8, 0x0, 0xf8, 0x0}},
+    {{2, 5}, {0xe0fcffff, 0x0, 0xc0fcffff, 0x0, 0xc0fcffff, 0x0, 0xc0fcffff, 0x0, 0xc0f8ffff, 0x0, 0xc0f8ffff, 0x0, 0x80f8ffff, 0x0, 0x80f8ffff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0fe, 0xffffffff, 0x80f0fe, 0xffffffff, 0x80f0fe, 0xffffffff, 0x80f0fe, 0xffffffff, 0x80f0fe, 0xffffffff, 0x80e0fc, 0xffffffff, 0x80e0fc, 0xffffffff, 0xe0fc}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f3f1f1f, 0xff7f7f3f}},
+    {{2, 5}, {0xc0f8, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0x80f0, 0x0, 0x80f0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xfcffffff, 0x80e0, 0xf8ffffff, 0x80e0, 0xf8ffffff, 0x80e0, 0xf8feffff, 0x80e0, 0xf8feffff, 0x80e0, 0xf8feffff, 0x80e0, 0xf8feffff, 0x80e0, 0xf8feffff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcffff}},
+    {{1, 5}, {0x3010100, 0x7070303, 0x3010100, 0x7070303, 0x3010100, 0x7070303, 0x1010100, 0x7070303, 0x1010100, 0x7070303, 0x1010100, 0x7070303, 0x1010100, 0x7070303, 0x1010000, 0x7070303}},
+    {{2, 5}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0x80e0, 0xf8feffff, 0x80e0, 0xf8feffff, 0x80e0, 0xf8feffff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0x1f0f0f0f, 0x7f3f3f1f, 0x1f0f0f0f, 0x3f3f3f1f, 0x1f0f0f0f, 0x3f3f3f1f, 0x1f0f0f0f, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0x1f0f0f07, 0x3f3f1f1f, 0x1f0f0f07, 0x3f3f1f1f}},
+    {{2, 5}, {0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0x80e0f8, 0xfeffffff, 0x80e0f8}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff}},
+    {{1, 5}, {0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010100}},
+    {{2, 5}, {0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0fcfe}},
+    {{1, 5}, {0x7070703, 0x1f0f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f07, 0x7070303, 0x1f0f0f07}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0x3f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xff7f7f7f, 0x3f3f3f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f7f}},
+    {{2, 5}, {0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc}},
+    {{1, 5}, {0x3010100, 0x7070303, 0x1010100, 0x7070303, 0x1010100, 0x7070303, 0x1010100, 0x7070303, 0x1010100, 0x7070303, 0x1010100, 0x7070303, 0x1010100, 0x7030303, 0x1010100, 0x7030303}},
+    {{0, 4}, {0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff}},
+    {{0, 4}, {0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf0f8fcfc, 0xc0e0e0f0, 0xf0f8fcfc, 0xc0c0e0f0}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8f8fcfe}},
+    {{0, 4}, {0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0xff3f0f01, 0xffffffff, 0xff3f0701, 0xffffffff, 0xff1f0700, 0xffffffff, 0x7f1f0300, 0xffffffff, 0x7f0f0300, 0xffffffff, 0x3f0f0100, 0xffffffff, 0x3f070100, 0xffffffff, 0x1f070000, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0xff7f1f07, 0x0, 0xff7f1f07, 0x0, 0xff7f1f03, 0x0, 0xff3f0f03, 0x0, 0xff3f0f01, 0x0, 0xff3f0701, 0x0, 0x7f1f0700, 0x0, 0x7f1f0300}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xff3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff}},
+    {{0, 5}, {0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100}},
+    {{0, 4}, {0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f}},
+    {{0, 5}, {0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfefe, 0x80c0e0f0}},
+    {{0, 5}, {0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0x7f3f1f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff}},
+    {{0, 5}, {0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f070300}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0x7030100, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xff7f3f1f, 0x7010000, 0xff7f3f0f}},
+    {{0, 5}, {0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe}},
+    {{0, 5}, {0x7f3f1f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff}},
+    {{0, 5}, {0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070300}},
+    {{0, 4}, {0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xff7f3f1f, 0x7030000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xc0e0f0f8, 0x80, 0xc0e0f0f8, 0x80, 0xc0e0f0f8, 0x80, 0xc0e0f0f8, 0x80, 0xc0e0f0f8, 0x80, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0x7f1f0f07, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x3f1f0703, 0xffffffff}},
+    {{0, 5}, {0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0xf070300, 0x0, 0xf070100, 0x0, 0xf070100}},
+    {{0, 4}, {0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0}},
+    {{0, 5}, {0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0}},
+    {{0, 5}, {0x3f1f0f03, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff}},
+    {{0, 5}, {0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{0, 5}, {0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffff7f, 0x3f0f0703, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f}},
+    {{0, 5}, {0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100}},
+    {{0, 4}, {0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 1}, {0xffffe000, 0xffffffff, 0xffffe000, 0xffffffff, 0xffffe000, 0xffffffff, 0xfffff000, 0xffffffff, 0xfffff000, 0xffffffff, 0xfffff000, 0xffffffff, 0xfffff800, 0xffffffff, 0xfffff800, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 5}, {0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x1000000, 0x3030301, 0x1000000, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc}},
+    {{1, 5}, {0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf070707, 0x3f1f1f0f}},
+    {{1, 4}, {0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010000}},
+    {{1, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xf070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f}},
+    {{1, 4}, {0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffff7f, 0x7f7f3f3f, 0xffffff7f, 0x7f7f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{1, 4}, {0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xc0feffff, 0xffffffff, 0xc0feffff, 0xffffffff, 0x80fcffff, 0xffffffff, 0x80fcffff, 0xffffffff, 0xfcffff, 0xffffffff, 0xf8ffff, 0xffffffff, 0xf8ffff, 0xffffffff, 0xf0ffff}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x7030301, 0xf0f0707, 0x3030301, 0xf0f0707, 0x3030301, 0xf0f0707, 0x3030301, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf070707}},
+    {{2, 5}, {0xf8, 0x0, 0xf0, 0x0, 0xf0, 0x0, 0xf0, 0x0, 0xe0, 0x0, 0xe0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0x80f0ffff, 0x0, 0x80f0ffff, 0x0, 0xf0ffff, 0x0, 0xf0feff, 0x0, 0xe0feff, 0x0, 0xe0feff, 0x0, 0xe0fcff, 0x0, 0xc0fcff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0fc, 0xffffffff, 0xe0fc, 0xffffffff, 0xe0f8, 0xffffffff, 0xc0f8, 0xffffffff, 0xc0f8, 0xffffffff, 0xc0f8, 0xfeffffff, 0xc0f0, 0xfeffffff, 0xc0f0}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0feffff}},
+    {{1, 5}, {0x3f1f1f1f, 0xff7f7f3f, 0x3f1f1f1f, 0xff7f7f3f, 0x3f1f1f1f, 0xff7f7f3f, 0x3f1f1f1f, 0x7f7f7f3f, 0x3f1f1f0f, 0x7f7f7f3f, 0x3f1f1f0f, 0x7f7f7f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x3f1f1f0f, 0x7f7f3f3f}},
+    {{2, 5}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0xe0, 0x0, 0xe0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xf0feffff, 0xc0, 0xf0feffff, 0xc0, 0xf0fcffff, 0xc0, 0xf0fcffff, 0xc0, 0xf0fcffff, 0xc0, 0xf0fcffff, 0xc0, 0xf0fcffff, 0xc0, 0xe0fcffff, 0x80}},
+    {{2, 5}, {0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff}},
+    {{1, 5}, {0x1010000, 0x7070303, 0x1010000, 0x7030303, 0x1010000, 0x7030303, 0x1010000, 0x7030303, 0x1010000, 0x7030303, 0x1010000, 0x7030301, 0x1010000, 0x7030301, 0x1010000, 0x7030301}},
+    {{2, 5}, {0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80c0, 0xf0fcffff, 0x80c0, 0xf0fcffff, 0xc0, 0xf0fcffff, 0xc0, 0xf0fcffff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0x1f0f0f07, 0x3f3f1f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f}},
+    {{2, 5}, {0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xff7f7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x0, 0x1010100, 0x0, 0x1010100, 0x0, 0x1010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000}},
+    {{2, 5}, {0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fe}},
+    {{1, 5}, {0x7070303, 0x1f0f0f07, 0x7070303, 0x1f0f0f07, 0x7070303, 0xf0f0f07, 0x7030303, 0xf0f0f07, 0x7030303, 0xf0f0f07, 0x7030303, 0xf0f0f07, 0x7030303, 0xf0f0f07, 0x7030301, 0xf0f0707}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0fcfeff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f3f1f1f, 0x7f7f7f3f, 0x3f1f1f1f, 0x7f7f7f3f}},
+    {{2, 5}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8}},
+    {{1, 5}, {0x1010000, 0x7030303, 0x1010000, 0x7030303, 0x1010000, 0x7030303, 0x1010000, 0x7030303, 0x1010000, 0x7030301, 0x1010000, 0x7030301, 0x1010000, 0x7030301, 0x1010000, 0x7030301}},
+    {{0, 4}, {0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfefeff}},
+    {{0, 4}, {0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8f8fc, 0xc0c0e0f0, 0xf0f8f8fc, 0xc0c0e0f0, 0xf0f8f8fc, 0x80c0e0f0, 0xf0f8f8fc, 0x80c0e0f0, 0xf0f8f8fc, 0x80c0e0e0, 0xf0f8f8fc, 0x80c0e0e0}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8f8}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe}},
+    {{0, 4}, {0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0x1f030000, 0xffffff7f, 0xf010000, 0xffffff7f, 0x7010000, 0xffffff3f, 0x7000000, 0xffffff1f, 0x3000000, 0xffff7f1f, 0x1000000, 0xffff7f0f, 0x1000000, 0xffff3f07, 0x0, 0xffff1f07}},
+    {{0, 5}, {0x0, 0x3f0f0300, 0x0, 0x3f0f0100, 0x0, 0x1f070100, 0x0, 0x1f070000, 0x0, 0xf030000, 0x0, 0xf010000, 0x0, 0x7010000, 0x0, 0x7000000}},
+    {{0, 4}, {0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0x3f0f0300, 0xffffff7f, 0x1f0f0300, 0xffffff7f, 0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf030100, 0xffffff3f, 0xf030000, 0xffff7f3f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff7f1f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000}},
+    {{0, 4}, {0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff}},
+    {{0, 5}, {0x3010000, 0xff7f3f0f, 0x3010000, 0xff7f1f0f, 0x3000000, 0xff7f1f0f, 0x3000000, 0xff3f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f03, 0x1000000, 0x7f1f0f03}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf8fcfefe, 0x80c0e0f0, 0xf8fcfefe, 0x80c0e0f0, 0xf8fcfefe, 0x80c0e0f0, 0xf8fcfefe, 0xc0c0e0f0, 0xf8fcfefe, 0xc0c0e0f0, 0xf8fcfefe, 0xc0c0e0f0, 0xf8fcfefe, 0xc0c0e0f0, 0xf8fcfefe, 0xc0c0e0f0}},
+    {{0, 5}, {0x7f1f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0x7030000}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8}},
+    {{0, 5}, {0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe}},
+    {{0, 5}, {0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x1f070300, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100}},
+    {{0, 4}, {0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff}},
+    {{0, 5}, {0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07}},
+    {{0, 4}, {0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f}},
+    {{0, 5}, {0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100}},
+    {{0, 4}, {0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0x7f3f1f07}},
+    {{0, 4}, {0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0}},
+    {{0, 5}, {0x3f1f0703, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x1f0f0301, 0xffffff7f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0x7030000, 0x0, 0x7030000}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff}},
+    {{0, 5}, {0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7030000}},
+    {{0, 4}, {0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 1}, {0xfffffc00, 0xffffffff, 0xfffffc00, 0xffffffff, 0xfffffc00, 0xffffffff, 0xfffffe00, 0xffffffff, 0xfffffe00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff}},
+    {{1, 5}, {0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070707, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010000}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc}},
+    {{1, 5}, {0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x1f1f1f0f, 0xf070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f}},
+    {{1, 4}, {0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f07, 0x7070303, 0x1f0f0f07, 0x7030303, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x7030301, 0xf0f0f07, 0x7030301, 0xf0f0707}},
+    {{1, 4}, {0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f, 0x7f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f7f}},
+    {{1, 4}, {0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xf0ffff, 0xffffffff, 0xe0ffff, 0xffffffff, 0xe0ffff, 0xffffffff, 0xc0feff, 0xffffffff, 0x80fcff, 0xffffffff, 0x80fcff, 0xffffffff, 0xf8ff, 0xffffffff, 0xf8ff}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xc0feffff}},
+    {{1, 5}, {0x3030101, 0xf070707, 0x3030101, 0xf070703, 0x3030101, 0xf070703, 0x3010101, 0xf070703, 0x3010101, 0xf070703, 0x3010100, 0x7070703, 0x3010100, 0x7070703, 0x3010100, 0x7070303}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0fcff, 0x0, 0xc0f8ff, 0x0, 0x80f8ff, 0x0, 0x80f0ff, 0x0, 0x80f0ff, 0x0, 0xf0fe, 0x0, 0xe0fe, 0x0, 0xe0fc, 0x0}},
+    {{2, 5}, {0xfeffffff, 0x80f0, 0xfeffffff, 0x80f0, 0xfcffffff, 0x80e0, 0xfcffffff, 0xe0, 0xfcffffff, 0xe0, 0xf8ffffff, 0xe0, 0xf8ffffff, 0xc0, 0xf8ffffff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xf0feffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xe0fcffff, 0xffffffff, 0xe0f8ffff, 0xffffffff, 0xe0f8ffff, 0xffffffff, 0xe0f8feff}},
+    {{1, 5}, {0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f1f}},
+    {{2, 5}, {0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xe0f8ffff, 0x80, 0xe0f8feff, 0x80, 0xe0f8feff, 0x80, 0xe0f8feff, 0x80, 0xc0f8feff, 0x0, 0xc0f0feff, 0x0, 0xc0f0fcff, 0x0, 0xc0f0fcff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xc0f0fcff, 0xffffffff, 0xc0f0fcff, 0xffffffff, 0xc0f0fcff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x1000000, 0x7030301, 0x1000000, 0x3030301, 0x1000000, 0x3030301, 0x1000000, 0x3030301, 0x1000000, 0x3030101, 0x1000000, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0fcfeff, 0xc0, 0xf0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0x80, 0xe0f8feff, 0x80, 0xe0f8feff, 0x80, 0xe0f8fcff, 0x80, 0xe0f0fcff, 0x80}},
+    {{2, 5}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff}},
+    {{1, 5}, {0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf0f0707, 0x3f1f1f0f, 0xf0f0707, 0x3f1f1f0f, 0xf070707, 0x3f1f1f0f, 0xf070707, 0x1f1f1f0f, 0xf070703, 0x1f1f1f0f}},
+    {{2, 5}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x7f7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f, 0x7f7f3f3f, 0xffffff7f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{2, 5}, {0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0fc}},
+    {{1, 5}, {0x7030301, 0xf0f0707, 0x7030301, 0xf0f0707, 0x7030301, 0xf0f0707, 0x3030301, 0xf0f0707, 0x3030301, 0xf0f0707, 0x3030301, 0xf0f0707, 0x3030101, 0xf070707, 0x3030101, 0xf070707}},
+    {{2, 5}, {0xe0f8fcff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0fcfe, 0x80}},
+    {{2, 5}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0x3f1f1f1f, 0x7f7f7f3f, 0x3f1f1f1f, 0x7f7f7f3f, 0x3f1f1f1f, 0x7f7f3f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f1f0f, 0x7f7f3f3f}},
+    {{2, 5}, {0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x1010000, 0x3030301, 0x1000000, 0x3030301, 0x1000000, 0x3030301, 0x1000000, 0x3030301, 0x1000000, 0x3030101, 0x1000000, 0x3030101, 0x1000000, 0x3030101, 0x1000000, 0x3030101}},
+    {{0, 4}, {0x8080c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfefe}},
+    {{0, 4}, {0xf0f8f8fc, 0x80c0e0e0, 0xf0f0f8fc, 0x80c0e0e0, 0xf0f0f8fc, 0x80c0c0e0, 0xf0f0f8fc, 0x80c0c0e0, 0xf0f0f8f8, 0x80c0c0e0, 0xe0f0f8f8, 0x8080c0e0, 0xe0f0f8f8, 0x8080c0e0, 0xe0f0f0f8, 0x8080c0e0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f0f8, 0xfcfefeff, 0xe0f0f0f8, 0xfcfefeff, 0xe0f0f0f8, 0xfcfefeff, 0xe0f0f0f8}},
+    {{0, 4}, {0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe}},
+    {{0, 4}, {0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0x0, 0xff7f1f03, 0x0, 0xff7f0f01, 0x0, 0xff3f0701, 0x0, 0xff1f0700, 0x0, 0x7f1f0300, 0x0, 0x7f0f0100, 0x0, 0x3f070000, 0x0, 0x1f030000}},
+    {{0, 5}, {0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f07, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff7f1f03, 0xffffffff, 0xff3f0f01, 0xffffffff, 0xff3f0701, 0xffffffff, 0x7f1f0700, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xffff3f0f, 0x3000000, 0xffff3f0f, 0x3000000, 0xff7f1f0f, 0x1000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x0, 0xff3f0f03, 0x0, 0x7f3f0f03, 0x0, 0x7f1f0701}},
+    {{0, 5}, {0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8fcfc, 0x80c0e0, 0xf0f8fcfc, 0x80c0e0, 0xf0f8fcfc, 0x8080c0e0}},
+    {{0, 5}, {0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0301, 0xffffffff}},
+    {{0, 5}, {0x0, 0x7f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100}},
+    {{0, 4}, {0xf8fcfeff, 0xc0c0e0f0, 0xf8fcfeff, 0xc0c0e0f0, 0xf8fcfeff, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0e0f0}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0x1f070300, 0xffffff7f, 0x1f070300, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf070100, 0xffff7f3f, 0xf030100, 0xffff7f3f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff3f1f}},
+    {{0, 5}, {0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc}},
+    {{0, 5}, {0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f03, 0x1000000, 0x7f1f0f03, 0x0, 0x7f1f0f03, 0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f0f0701}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe}},
+    {{0, 5}, {0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3010000}},
+    {{0, 4}, {0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0xff3f1f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x0, 0x3f1f0703}},
+    {{0, 4}, {0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0x1f070100, 0xffffff3f}},
+    {{0, 5}, {0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000}},
+    {{0, 4}, {0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0, 0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x80c0c0e0, 0xf0f8fcfc, 0x80c0c0e0, 0xf0f8fcfc, 0x80c0c0e0}},
+    {{0, 5}, {0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03}},
+    {{0, 4}, {0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8}},
+    {{0, 5}, {0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f}},
+    {{0, 5}, {0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000}},
+    {{0, 4}, {0x80, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc}},
+    {{0, 5}, {0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff}},
+    {{0, 5}, {0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff3f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f}},
+    {{0, 5}, {0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000}},
+    {{0, 4}, {0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 1}, {0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff80, 0xffffffff, 0xffffffc0, 0xffffffff, 0xffffffc0, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff}},
+    {{1, 5}, {0xf070703, 0x3f1f1f0f, 0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x7030301, 0x1f0f0f07}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc}},
+    {{1, 5}, {0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x7030301, 0xf0f0707, 0x3030101, 0xf0f0707}},
+    {{1, 4}, {0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f7f}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x3030301, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf070707, 0x3030101, 0xf070703, 0x3010101, 0xf070703, 0x3010100, 0xf070703}},
+    {{1, 4}, {0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe}},
+    {{1, 5}, {0x3f3f1f1f, 0xff7f7f3f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f7f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f}},
+    {{1, 4}, {0xe0f8feff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xf0ff, 0xffffffff, 0xe0ff, 0xffffffff, 0xc0fe, 0xffffffff, 0xc0fe, 0xffffffff, 0x80fc, 0xffffffff, 0xf8, 0xffffffff, 0xf0, 0xffffffff, 0xe0}},
+    {{2, 5}, {0xffffffff, 0xc0feffff, 0xffffffff, 0x80fcffff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xf0ffff, 0xffffffff, 0xf0ffff, 0xffffffff, 0xe0ffff, 0xffffffff, 0xc0feff, 0xffffffff, 0x80fcff}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x3010100, 0x7070303, 0x1010100, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7030303, 0x1010000, 0x7030301, 0x1010000, 0x7030301, 0x1000000, 0x7030301}},
+    {{2, 5}, {0xc0fc, 0x0, 0xc0f8, 0x0, 0x80f8, 0x0, 0x80f0, 0x0, 0x80f0, 0x0, 0xe0, 0x0, 0xe0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xf0feffff, 0xc0, 0xf0feffff, 0x80, 0xf0fcffff, 0x80, 0xe0fcffff, 0x80, 0xe0fcffff, 0x0, 0xc0f8ffff, 0x0, 0xc0f8ffff, 0x0, 0xc0f0feff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f8feff, 0xffffffff, 0xc0f0feff, 0xffffffff, 0xc0f0fcff, 0xffffffff, 0x80f0fcff, 0xffffffff, 0x80e0fcff, 0xffffffff, 0x80e0f8ff, 0xffffffff, 0xe0f8fe, 0xffffffff, 0xc0f8fe}},
+    {{1, 5}, {0x1f1f0f0f, 0x7f3f3f1f, 0x1f0f0f0f, 0x7f3f3f1f, 0x1f0f0f0f, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{2, 5}, {0xc0f0fcff, 0x0, 0x80e0fcff, 0x0, 0x80e0f8fe, 0x0, 0x80e0f8fe, 0x0, 0x80e0f8fe, 0x0, 0xc0f0fe, 0x0, 0xc0f0fc, 0x0, 0xc0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0fcff, 0xffffffff, 0x80e0f8fe, 0xffffffff, 0x80e0f8fe, 0xffffffff, 0x80e0f8fe, 0xffffffff, 0x80e0f8fe, 0xffffffff, 0x80c0f0fc, 0xffffffff, 0xc0f0fc, 0xffffffff, 0xc0f0fc}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010100}},
+    {{2, 5}, {0xc0f0fcff, 0x80, 0xc0f0fcff, 0x0, 0xc0f0fcfe, 0x0, 0xc0f0f8fe, 0x0, 0x80e0f8fe, 0x0, 0x80e0f8fe, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xc0f0fcff, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe}},
+    {{1, 5}, {0xf070703, 0x1f1f0f0f, 0xf070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f07}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8fcff, 0x80}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f, 0x7f3f3f1f, 0xffff7f7f, 0x7f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xffff7f7f}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x3030101, 0xf070707, 0x3030101, 0xf070703, 0x3030101, 0xf070703, 0x3030101, 0xf070703, 0x3010101, 0x7070703, 0x3010101, 0x7070703, 0x3010100, 0x7070303, 0x3010100, 0x7070303}},
+    {{2, 5}, {0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff}},
+    {{1, 5}, {0x1f1f1f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f1f, 0x1f1f0f0f, 0x7f3f3f1f, 0x1f1f0f0f, 0x7f3f3f1f, 0x1f0f0f0f, 0x3f3f3f1f, 0x1f0f0f0f, 0x3f3f3f1f}},
+    {{2, 5}, {0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010101, 0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010100}},
+    {{0, 4}, {0x8080c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfcfe, 0xfeffffff, 0xf8fcfcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfc, 0xfeffffff, 0xf0f8fcfc}},
+    {{0, 4}, {0xe0f0f0f8, 0x8080c0c0, 0xe0f0f0f8, 0x80c0c0, 0xe0e0f0f8, 0x80c0c0, 0xe0e0f0f8, 0x80c0c0, 0xe0e0f0f0, 0x8080c0, 0xc0e0f0f0, 0x8080c0, 0xc0e0e0f0, 0x8080c0, 0xc0e0e0f0, 0x80c0}},
+    {{0, 4}, {0xfcfcfeff, 0xe0f0f0f8, 0xfcfcfeff, 0xe0e0f0f8, 0xfcfcfeff, 0xe0e0f0f8, 0xfcfcfeff, 0xe0e0f0f8, 0xf8fcfefe, 0xe0e0f0f8, 0xf8fcfefe, 0xc0e0f0f8, 0xf8fcfefe, 0xc0e0f0f8, 0xf8fcfefe, 0xc0e0f0f0}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe}},
+    {{0, 4}, {0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0x0, 0xf010000, 0x0, 0x7010000, 0x0, 0x7000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f0f, 0xffffffff, 0xffff3f07, 0xffffffff, 0xffff1f03, 0xffffffff, 0xff7f0f03, 0xffffffff}},
+    {{0, 5}, {0x7f0f0300, 0xffffffff, 0x3f0f0100, 0xffffffff, 0x3f070000, 0xffffffff, 0x1f030000, 0xffffff7f, 0xf030000, 0xffffff7f, 0x7010000, 0xffffff3f, 0x7000000, 0xffffff1f, 0x3000000, 0xffff7f1f}},
+    {{0, 5}, {0x0, 0x3f1f0701, 0x0, 0x3f0f0300, 0x0, 0x3f0f0300, 0x0, 0x1f070100, 0x0, 0x1f070100, 0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7010000}},
+    {{0, 4}, {0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x80c0c0e0}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0x1f0f0300, 0xffffff7f, 0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf030000, 0xffff7f3f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0xf8fcfeff, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f8}},
+    {{0, 5}, {0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xffff3f0f, 0x3010000, 0xff7f3f0f, 0x3010000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x1000000, 0x7f3f0f03, 0x0, 0x7f1f0f03}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfeffffff, 0xe0f0f8fc}},
+    {{0, 5}, {0xff3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffff7f, 0x3f0f0301, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100, 0x0, 0xf030100}},
+    {{0, 4}, {0x8080c0, 0x0, 0x8080c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{0, 5}, {0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff3f1f, 0x7010000, 0xffff3f1f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x3010000, 0xff7f1f0f}},
+    {{0, 5}, {0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0xff7f1f0f, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff}},
+    {{0, 5}, {0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f070300}},
+    {{0, 4}, {0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0x7030000, 0xffff7f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f}},
+    {{0, 5}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xf0f8fcfc, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0}},
+    {{0, 5}, {0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff}},
+    {{0, 5}, {0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x1f0f0301}},
+    {{0, 4}, {0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfefeff, 0xc0e0f0f8, 0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0x7030000, 0xffff7f1f}},
+    {{0, 5}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfe}},
+    {{0, 5}, {0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff}},
+    {{0, 5}, {0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701}},
+    {{0, 4}, {0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f}},
+    {{0, 5}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 1}, {0xffffffe0, 0xffffffff, 0xfffffff0, 0xffffffff, 0xfffffff8, 0xffffffff, 0xfffffff8, 0xffffffff, 0xfffffffc, 0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe}},
+    {{1, 5}, {0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x3010100, 0xf070703, 0x3010100, 0xf070703}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc}},
+    {{1, 5}, {0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf070703, 0x3010100, 0xf070703, 0x3010100, 0xf070703, 0x3010100, 0x7070703, 0x1010000, 0x7070303, 0x1010000, 0x7070303}},
+    {{1, 4}, {0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff}},
+    {{1, 5}, {0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f7f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f}},
+    {{1, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x3010100, 0x7070703, 0x3010100, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x7030301}},
+    {{1, 4}, {0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc}},
+    {{1, 5}, {0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f1f, 0x1f0f0f0f, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{1, 4}, {0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80}},
+    {{2, 5}, {0xfeffffff, 0xc0, 0xfcffffff, 0x80, 0xf8ffffff, 0x0, 0xf0ffffff, 0x0, 0xe0ffffff, 0x0, 0xc0feffff, 0x0, 0x80fcffff, 0x0, 0xf8ffff, 0x0}},
+    {{2, 5}, {0xffffffff, 0x80f8ff, 0xffffffff, 0xf0ff, 0xffffffff, 0xe0ff, 0xffffffff, 0xe0fe, 0xffffffff, 0xc0fc, 0xffffffff, 0x80f8, 0xffffffff, 0xf0, 0xffffffff, 0xe0}},
+    {{2, 5}, {0xffffffff, 0xf8ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0xc0fcffff, 0xffffffff, 0xc0f8ffff, 0xffffffff, 0x80f0ffff, 0xffffffff, 0xf0feff}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff}},
+    {{1, 5}, {0x1000000, 0x3030301, 0x1000000, 0x3030301, 0x1000000, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x3010100}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80f0feff, 0x0, 0x80e0fcff, 0x0, 0xe0fcff, 0x0, 0xc0f8ff, 0x0, 0xc0f0fe, 0x0, 0x80f0fe, 0x0, 0x80e0fc, 0x0, 0xe0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0fe, 0xffffffff, 0xc0f0fc, 0xffffffff, 0x80e0fc, 0xffffffff, 0x80e0f8, 0xfeffffff, 0xe0f8, 0xfeffffff, 0xc0f0, 0xfcffffff, 0xc0f0, 0xfcffffff, 0x80f0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xf8feffff}},
+    {{1, 5}, {0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf070707, 0x3f1f1f0f, 0xf070703, 0x1f1f1f0f, 0xf070703, 0x1f1f0f0f, 0xf070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f}},
+    {{2, 5}, {0x80e0fc, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0f0f8, 0xfeffffff, 0x80e0f8, 0xfeffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0xc0f0, 0xfcffffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{2, 5}, {0x80c0f0fc, 0x0, 0xc0f0fc, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0e0f8fe, 0xffffffff, 0x80e0f8fe, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0x80e0f8}},
+    {{1, 5}, {0x7070303, 0x1f0f0f07, 0x7030303, 0xf0f0f07, 0x7030301, 0xf0f0f07, 0x7030301, 0xf0f0707, 0x7030301, 0xf0f0707, 0x3030301, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf070707}},
+    {{2, 5}, {0xe0f8fcff, 0x80, 0xe0f0fcff, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff}},
+    {{1, 5}, {0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f1f, 0x7f7f7f3f, 0x3f1f1f0f, 0x7f7f7f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f1f0f, 0x7f7f3f3f}},
+    {{2, 5}, {0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0x1010100, 0x7070303, 0x1010100, 0x7070303, 0x1010000, 0x7030303, 0x1010000, 0x7030303, 0x1010000, 0x7030301, 0x1010000, 0x7030301, 0x1000000, 0x3030301, 0x1000000, 0x3030301}},
+    {{2, 5}, {0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f0fc}},
+    {{1, 5}, {0x1f0f0f07, 0x3f3f1f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf0f0707, 0x3f1f1f0f}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f0fcff, 0x80}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0xff7f7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x0, 0x1010100, 0x0, 0x1010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc, 0xfcfeffff, 0xf0f8f8fc, 0xfcfefeff, 0xf0f0f8f8, 0xfcfcfeff, 0xf0f0f8f8, 0xfcfcfefe, 0xe0f0f8f8, 0xf8fcfefe, 0xe0f0f0f8, 0xf8fcfcfe, 0xe0f0f0f8}},
+    {{0, 4}, {0xc0e0e0f0, 0x80c0, 0xc0c0e0f0, 0x8080, 0xc0c0e0e0, 0x8080, 0xc0c0e0e0, 0x8080, 0xc0c0e0e0, 0x80, 0x80c0c0e0, 0x80, 0x80c0c0e0, 0x80, 0x80c0c0e0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfefeffff}},
+    {{0, 4}, {0xf8fcfcfe, 0xc0e0f0f0, 0xf8fcfcfe, 0xc0e0f0f0, 0xf8fcfcfe, 0xc0e0f0f0, 0xf8f8fcfe, 0xc0e0e0f0, 0xf8f8fcfe, 0xc0e0e0f0, 0xf8f8fcfe, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf0f8fcfc, 0xc0c0e0f0}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc}},
+    {{0, 4}, {0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff}},
+    {{0, 4}, {0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xff3f0f01, 0xffffffff, 0xff3f0700, 0xffffffff, 0xff1f0300, 0xffffffff, 0x7f0f0100, 0xffffffff, 0x3f070000, 0xffffffff, 0x1f030000, 0xffffffff, 0xf010000, 0xffffff7f, 0xf010000, 0xffffff3f}},
+    {{0, 5}, {0x1000000, 0xffff3f0f, 0x0, 0xffff3f07, 0x0, 0xff7f1f03, 0x0, 0xff7f0f03, 0x0, 0xff3f0f01, 0x0, 0xff1f0700, 0x0, 0x7f1f0300, 0x0, 0x3f0f0100}},
+    {{0, 5}, {0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0}},
+    {{0, 5}, {0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x7f1f0701, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0xff7f3f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff7f1f07, 0x1000000, 0xff3f0f07, 0x0, 0xff3f0f03, 0x0, 0x7f1f0703, 0x0, 0x7f1f0701, 0x0, 0x3f0f0301}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8}},
+    {{0, 5}, {0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0300, 0xffffffff, 0x1f0f0300, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x7f1f0703, 0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0x1f0f0300, 0xffffff7f, 0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf030100, 0xffff7f3f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff3f1f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff3f1f07, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x3000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f1f0f03, 0x0, 0x7f1f0f03, 0x0, 0x7f1f0703}},
+    {{0, 4}, {0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0e0e0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0x7f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0300, 0xffffff7f, 0x1f070300, 0xffffff3f}},
+    {{0, 5}, {0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0x7030000, 0x0, 0x7030000}},
+    {{0, 4}, {0xe0f0f8f8, 0x80c0, 0xe0f0f8f8, 0x80c0, 0xe0f0f8f8, 0x80c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8fc, 0x8080c0, 0xe0f0f8fc, 0x8080c0, 0xe0f0f8fc, 0x80c0c0}},
+    {{0, 5}, {0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xffff3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x3000000, 0xff3f1f07, 0x1000000, 0xff3f1f07}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf8f8fcfe, 0x80c0e0f0, 0xf8f8fcfe, 0x80c0e0f0, 0xf8f8fcfe, 0x80c0e0f0}},
+    {{0, 5}, {0x7f3f0f07, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100}},
+    {{0, 4}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{0, 5}, {0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe}},
+    {{0, 5}, {0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x3f1f0703, 0xffffffff}},
+    {{0, 5}, {0x0, 0x3f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070100}},
+    {{0, 4}, {0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0xf030100, 0xffff7f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7030000, 0xffff3f1f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f, 0x7010000, 0xff7f3f0f}},
+    {{0, 5}, {0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 1}, {0xffffffc0, 0xffffffff, 0xffffffe0, 0xffffffff, 0xfffffff0, 0xffffffff, 0xfffffff8, 0xffffffff, 0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x1010000, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0f8feff, 0x80c0}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{1, 5}, {0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x1010000, 0x7070303, 0x1010000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010100}},
+    {{1, 4}, {0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff}},
+    {{1, 5}, {0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x1000000, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010000}},
+    {{1, 4}, {0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc}},
+    {{1, 5}, {0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf070707, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f}},
+    {{1, 4}, {0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f0fcff, 0x80}},
+    {{2, 5}, {0xf0ffff, 0x0, 0xe0feff, 0x0, 0xc0fcff, 0x0, 0xf8ff, 0x0, 0xf0ff, 0x0, 0xe0fe, 0x0, 0x80fc, 0x0, 0xf8, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0, 0xfcffffff, 0x80, 0xf8ffffff, 0x0, 0xe0ffffff, 0x0, 0xc0feffff, 0x0, 0x80fcffff, 0x0, 0xf0ffff, 0x0, 0xe0ffff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0fcff, 0xffffffff, 0xc0fcff, 0xffffffff, 0x80f8ff, 0xffffffff, 0x80f0fe, 0xffffffff, 0xe0fc, 0xffffffff, 0xc0fc, 0xffffffff, 0x80f8, 0xfeffffff, 0x80f0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xe0fcffff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{2, 5}, {0xc0f8, 0x0, 0xc0f0, 0x0, 0x80f0, 0x0, 0x80e0, 0x0, 0xe0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xf8ffffff, 0x80e0, 0xf8feffff, 0xe0, 0xf0feffff, 0xc0, 0xf0fcffff, 0xc0, 0xe0fcffff, 0x80, 0xe0f8feff, 0x80, 0xc0f8feff, 0x0, 0xc0f0fcff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xc0f0feff, 0xffffffff, 0xc0f0fcff, 0xffffffff, 0xc0f0fcff}},
+    {{1, 5}, {0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f07, 0x7030303, 0x1f0f0f07, 0x7030301, 0xf0f0f07, 0x7030301, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707}},
+    {{2, 5}, {0x80e0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80e0, 0xf0fcffff, 0x80c0, 0xf0fcffff, 0xc0, 0xf0f8feff, 0xc0, 0xe0f8feff, 0x80, 0xe0f8feff, 0x80, 0xc0f0fcff, 0x80, 0xc0f0fcff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f7f3f}},
+    {{2, 5}, {0xc0f0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff}},
+    {{1, 5}, {0x3030101, 0xf070703, 0x3010101, 0xf070703, 0x3010101, 0x7070703, 0x3010100, 0x7070303, 0x3010100, 0x7070303, 0x1010100, 0x7070303, 0x1010000, 0x7030303, 0x1010000, 0x7030301}},
+    {{2, 5}, {0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0xc0f0f8}},
+    {{1, 5}, {0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f1f, 0x1f0f0f0f, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0fcfeff, 0x80c0, 0xf0f8feff, 0x80c0, 0xe0f8feff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x1000000, 0x3030101, 0x1000000, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010100}},
+    {{2, 5}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xf070707, 0x1f1f1f0f, 0xf070707, 0x1f1f1f0f, 0xf070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f07, 0x7070303, 0x1f0f0f07}},
+    {{2, 5}, {0xe0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f, 0x7f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f7f}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf8fcfcfe, 0xe0e0f0f0, 0xf8f8fcfc, 0xe0e0f0f0, 0xf8f8fcfc, 0xe0e0f0f0, 0xf0f8f8fc, 0xc0e0e0f0, 0xf0f8f8fc, 0xc0e0e0f0, 0xf0f0f8f8, 0xc0c0e0e0, 0xf0f0f8f8, 0xc0c0e0e0, 0xe0f0f0f8, 0xc0c0e0e0}},
+    {{0, 4}, {0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x808080, 0x0, 0x8080, 0x0, 0x8080, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfcfefe, 0xffffffff, 0xfcfcfefe}},
+    {{0, 4}, {0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8f8fc, 0xc0c0e0f0, 0xf0f8f8fc, 0xc0c0e0e0, 0xf0f8f8fc, 0x80c0e0e0, 0xf0f0f8fc, 0x80c0e0e0, 0xf0f0f8fc, 0x80c0e0e0, 0xf0f0f8f8, 0x80c0c0e0, 0xf0f0f8f8, 0x80c0c0e0}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f0f8fc, 0xfefeffff, 0xf0f0f8fc, 0xfcfeffff, 0xf0f0f8fc}},
+    {{0, 4}, {0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff}},
+    {{0, 4}, {0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0x7000000, 0xffffff3f, 0x3000000, 0xffffff1f, 0x1000000, 0xffff7f0f, 0x0, 0xffff3f07, 0x0, 0xffff1f03, 0x0, 0xff7f0f01, 0x0, 0xff3f0701, 0x0, 0xff1f0700}},
+    {{0, 5}, {0x0, 0x3f070000, 0x0, 0x1f030000, 0x0, 0xf030000, 0x0, 0xf010000, 0x0, 0x7000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{0, 4}, {0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f07, 0xffffffff}},
+    {{0, 5}, {0x3f0f0300, 0xffffffff, 0x3f0f0100, 0xffffffff, 0x1f070100, 0xffffff7f, 0xf030000, 0xffffff3f, 0xf030000, 0xffffff3f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x3000000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0x3f0f0300, 0x0, 0x1f070100, 0x0, 0x1f070100, 0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000}},
+    {{0, 4}, {0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfefeff, 0xc0e0f0f8, 0xfcfefeff, 0xc0e0f0f8, 0xfcfefeff, 0xc0e0f0f8}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff}},
+    {{0, 5}, {0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf030000, 0xffffff3f, 0xf030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f1f, 0x3000000, 0xffff3f0f, 0x3000000, 0xff7f1f0f}},
+    {{0, 5}, {0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0x8080, 0x0, 0x8080, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xffff3f0f, 0x3010000, 0xff7f3f0f, 0x3000000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x0, 0x7f3f0f03, 0x0, 0x7f1f0703}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff}},
+    {{0, 5}, {0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0301, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0xf070100, 0x0, 0xf070100}},
+    {{0, 4}, {0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f8, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{0, 5}, {0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf070100, 0xffff7f3f, 0xf030100, 0xffff7f1f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff3f1f, 0x7010000, 0xffff3f1f, 0x7010000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0}},
+    {{0, 5}, {0xffff3f1f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f1f0f03, 0x1000000, 0x7f1f0f03, 0x0, 0x7f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f1f0701, 0x0, 0x3f0f0701}},
+    {{0, 4}, {0xf8f8fcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0xc0c0e0f0, 0xf8fcfcfe, 0xc0c0e0f0, 0xf8fcfcfe, 0xc0c0e0f0, 0xf8fcfefe, 0xc0c0e0f0, 0xf8fcfefe, 0xc0e0e0f0}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0x3f0f0701, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f070300, 0xffffff7f, 0x1f070300, 0xffffff3f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf070100, 0xffff7f3f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0xff7f1f0f, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f3f0f03, 0x1000000, 0x7f1f0f03}},
+    {{0, 4}, {0x80c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe}},
+    {{0, 5}, {0x3f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x3f0f0701, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0300, 0xffffff7f}},
+    {{0, 5}, {0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7030000}},
+    {{0, 4}, {0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0xc0c0e0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff}},
+    {{0, 5}, {0x3010000, 0xff7f3f0f, 0x3010000, 0xff7f1f0f, 0x3010000, 0xff7f1f0f, 0x3000000, 0xff7f1f0f, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x3000000, 0xff3f1f07, 0x1000000, 0xff3f0f07}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000, 0x0, 0xc0000000, 0x0, 0xf0000000, 0x0, 0xf8000000, 0x0, 0xfc000000, 0x0, 0xff000000}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 4}, {0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{1, 5}, {0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 5}, {0xf070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7030303, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x7030301, 0xf0f0f07, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f1f, 0xff7f7f3f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xc0feffff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xf0ffff, 0xffffffff, 0xc0feff}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x7030303, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x7030301, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf070703, 0x3010100, 0xf070703, 0x3010100, 0x7070703}},
+    {{1, 4}, {0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80}},
+    {{2, 5}, {0xe0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0feff, 0x0, 0x80f8ff, 0x0, 0xf0ff, 0x0, 0xe0fe, 0x0, 0x80fc, 0x0, 0xf0, 0x0, 0xe0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xfcffffff, 0xe0, 0xf8ffffff, 0xc0, 0xf0ffffff, 0x80, 0xe0feffff, 0x0, 0xc0fcffff, 0x0, 0x80f8ffff, 0x0, 0x80f0feff, 0x0, 0xe0fcff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f8ffff, 0xffffffff, 0xc0f0feff, 0xffffffff, 0x80f0fcff, 0xffffffff, 0xe0fcff, 0xffffffff, 0xc0f8fe, 0xffffffff, 0x80f0fe, 0xffffffff, 0x80e0fc, 0xffffffff, 0xc0f8}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x7f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f7f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f}},
+    {{2, 5}, {0x80e0fcff, 0x0, 0x80e0f8fe, 0x0, 0xc0f0fe, 0x0, 0xc0f0fc, 0x0, 0x80e0f8, 0x0, 0xe0f8, 0x0, 0xc0f0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0x80e0f8fe, 0xffffffff, 0x80e0f8fe, 0xffffffff, 0xc0f0fc, 0xffffffff, 0xc0e0f8, 0xfeffffff, 0x80e0f8, 0xfcffffff, 0x80c0f0, 0xfcffffff, 0xc0f0, 0xf8feffff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x3030101, 0xf070703, 0x3010101, 0xf070703, 0x3010100, 0x7070703, 0x3010100, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7030301, 0x1000000, 0x7030301}},
+    {{2, 5}, {0xc0e0f8fe, 0x0, 0x80e0f8fe, 0x0, 0x80e0f0fc, 0x0, 0xc0f0fc, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0fcff, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0xc0f0fc, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8}},
+    {{1, 5}, {0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f1f, 0x1f0f0f0f, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f0fcff, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fe, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xc0f0fcfe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x1010000, 0x7030301, 0x1000000, 0x3030301, 0x1000000, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x1010100}},
+    {{2, 5}, {0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8fcffff, 0xc0e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf070707, 0x1f1f1f0f, 0xf070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f}},
+    {{2, 5}, {0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f0fc}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xffff7f7f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0xc0, 0xe0f8fcff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{1, 5}, {0x7030303, 0xf0f0f07, 0x7030301, 0xf0f0707, 0x7030301, 0xf0f0707, 0x3030301, 0xf0f0707, 0x3030101, 0xf070707, 0x3030101, 0xf070703, 0x3030101, 0xf070703, 0x3010101, 0x7070703}},
+    {{2, 5}, {0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8}},
+    {{1, 5}, {0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f1f, 0x7f7f7f3f, 0x3f1f1f1f, 0x7f7f7f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f1f}},
+    {{0, 4}, {0xe0f0f0f8, 0x80c0c0e0, 0xe0f0f0f8, 0x80c0c0e0, 0xe0e0f0f0, 0x8080c0c0, 0xe0e0f0f0, 0x8080c0c0, 0xc0e0e0f0, 0x808080c0, 0xc0e0e0f0, 0x8080c0, 0xc0c0e0e0, 0x808080, 0xc0c0e0e0, 0x8080}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfcfefe, 0xfeffffff, 0xf8fcfefe, 0xfeffffff, 0xf8fcfcfe, 0xfeffffff, 0xf8fcfcfe, 0xfefeffff, 0xf8fcfcfc, 0xfefeffff, 0xf8f8fcfc, 0xfefefeff, 0xf8f8fcfc, 0xfcfefeff, 0xf8f8fcfc}},
+    {{0, 4}, {0xe0f0f8f8, 0x80c0c0e0, 0xe0f0f0f8, 0x80c0c0e0, 0xe0f0f0f8, 0x8080c0e0, 0xe0f0f0f8, 0x8080c0c0, 0xe0e0f0f8, 0x8080c0c0, 0xe0e0f0f0, 0x80c0c0, 0xe0e0f0f0, 0x80c0c0, 0xe0e0f0f0, 0x8080c0}},
+    {{0, 4}, {0xfcfeffff, 0xf0f0f8fc, 0xfcfeffff, 0xf0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfefeff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f8f8, 0xfcfcfeff, 0xe0f0f0f8}},
+    {{0, 4}, {0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff}},
+    {{0, 4}, {0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0x0, 0xff1f0300, 0x0, 0x7f0f0100, 0x0, 0x3f070000, 0x0, 0x1f030000, 0x0, 0xf010000, 0x0, 0x7010000, 0x0, 0x7000000, 0x0, 0x3000000}},
+    {{0, 4}, {0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff1f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0xff7f1f03, 0xffffffff, 0xff7f0f03, 0xffffffff, 0xff3f0f01, 0xffffffff, 0xff1f0700, 0xffffffff, 0x7f1f0300, 0xffffffff, 0x3f0f0100, 0xffffffff, 0x3f070000, 0xffffffff, 0x1f030000, 0xffffff7f}},
+    {{0, 5}, {0x3000000, 0xffff3f0f, 0x1000000, 0xff7f1f07, 0x0, 0xff7f1f03, 0x0, 0xff3f0f03, 0x0, 0xff3f0701, 0x0, 0x7f1f0701, 0x0, 0x7f0f0300, 0x0, 0x3f0f0300}},
+    {{0, 5}, {0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8}},
+    {{0, 5}, {0xffff3f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0300, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x0, 0xff3f0f03, 0x0, 0x7f3f0f03, 0x0, 0x7f1f0701, 0x0, 0x3f1f0701, 0x0, 0x3f0f0300, 0x0, 0x3f0f0300}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0xff3f0f03, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0300, 0xffffff7f, 0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x7f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100, 0x0, 0xf030000}},
+    {{0, 4}, {0x8080c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{0, 5}, {0x1f0f0300, 0xffffff7f, 0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf030000, 0xffff7f3f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0xc0e0f0f8, 0x80, 0xc0e0f0f8, 0x80, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff}},
+    {{0, 5}, {0x3010000, 0xff7f3f0f, 0x3000000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x1000000, 0x7f3f0f03, 0x1000000, 0x7f1f0f03, 0x0, 0x7f1f0f03}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f8f8fc, 0x80c0e0, 0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0}},
+    {{0, 5}, {0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0301, 0xffffff7f, 0x1f0f0300, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x3f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030100}},
+    {{0, 4}, {0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0e0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f8}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0x7030000, 0xffff7f1f, 0x7030000, 0xffff3f1f, 0x7010000, 0xffff3f1f, 0x7010000, 0xff7f3f0f, 0x3010000, 0xff7f3f0f, 0x3010000, 0xff7f1f0f}},
+    {{0, 5}, {0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc}},
+    {{0, 5}, {0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff}},
+    {{0, 5}, {0x0, 0x7f1f0f03, 0x0, 0x3f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f0f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0300}},
+    {{0, 4}, {0x80c0c0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0x1f070300, 0xffffff3f, 0x1f070300, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf070100, 0xffff7f3f, 0xf070100, 0xffff7f3f, 0xf030100, 0xffff7f1f, 0xf030100, 0xffff7f1f, 0x7030000, 0xffff7f1f}},
+    {{0, 5}, {0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0f0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffff3f1f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff}},
+    {{0, 1}, {0x0, 0x80000000, 0x0, 0xe0000000, 0x0, 0xf8000000, 0x0, 0xfe000000, 0x0, 0xff000000, 0x0, 0xff000000, 0x0, 0xff000000, 0x0, 0xff000000}},
+    {{0, 1}, {0x0, 0xff000000, 0x0, 0xff000000, 0x0, 0xff000000, 0x0, 0xff800000, 0x0, 0xffe00000, 0x0, 0xfff00000, 0x0, 0xfffc0000, 0x0, 0xffff0000}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x3010100, 0xf070703, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3030101}},
+    {{1, 4}, {0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe}},
+    {{1, 5}, {0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f07, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{1, 4}, {0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x0, 0x3030101}},
+    {{1, 4}, {0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8}},
+    {{1, 5}, {0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{1, 4}, {0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f8fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x3010100, 0xf070703, 0x3010100, 0xf070703, 0x1010100, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x3030101, 0x0, 0x3030101}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x3f1f1f0f, 0xff7f7f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{1, 4}, {0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc}},
+    {{2, 5}, {0xffffffff, 0x80f8ff, 0xffffffff, 0xf0ff, 0xffffffff, 0xc0fc, 0xffffffff, 0xf8, 0xfeffffff, 0xe0, 0xfcffffff, 0x80, 0xf0ffffff, 0x0, 0xc0fcffff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0ffffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xf0ffff, 0xffffffff, 0xc0feff, 0xffffffff, 0x80f8ff, 0xffffffff, 0xe0ff, 0xffffffff, 0xc0fc}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xe0fcffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x1010000, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x3030101, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010100}},
+    {{1, 4}, {0xe0f0fcff, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80}},
+    {{2, 5}, {0xc0f8ff, 0x0, 0x80f0fe, 0x0, 0xe0fc, 0x0, 0x80f8, 0x0, 0xe0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0f0, 0xfcffffff, 0x80e0, 0xf8ffffff, 0xc0, 0xf0feffff, 0xc0, 0xe0fcffff, 0x80, 0xc0f8feff, 0x0, 0xc0f0fcff, 0x0, 0x80e0fcff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xc0f0feff, 0xffffffff, 0xc0f0fcff, 0xffffffff, 0x80e0f8fe, 0xffffffff, 0xc0f0fc}},
+    {{1, 5}, {0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x1f1f0f0f}},
+    {{2, 5}, {0x80e0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80e0, 0xf0fcffff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0x80, 0xc0f0fcff, 0x0, 0xc0f0fcfe, 0x0, 0x80e0f8fe, 0x0, 0xc0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xc0f0fcff, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0x80e0f8fe}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x1000000, 0x3030301, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010000, 0x0, 0x1010000}},
+    {{2, 5}, {0x80e0, 0x0, 0x80e0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcffffff, 0x80e0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf0fcfeff, 0x80c0, 0xf0f8feff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f0fcff, 0x80}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf070703, 0x1f1f1f0f, 0xf070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f07, 0x7030301, 0xf0f0f07}},
+    {{2, 5}, {0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0x80e0f8fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0xc0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0f8feff, 0x80c0, 0xe0f8feff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fe, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe}},
+    {{1, 5}, {0x7070303, 0x1f0f0f07, 0x7030303, 0xf0f0f07, 0x7030301, 0xf0f0707, 0x3030301, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf070703, 0x3010101, 0xf070703, 0x3010100, 0x7070703}},
+    {{2, 5}, {0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f1f, 0x7f7f7f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f1f0f0f, 0x7f3f3f1f}},
+    {{2, 5}, {0xe0f0fcff, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x3010100, 0x7070303, 0x1010100, 0x7070303, 0x1010000, 0x7030303, 0x1010000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x3030301, 0x1000000, 0x3030101, 0x0, 0x3030101}},
+    {{2, 5}, {0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x1f0f0f0f, 0x3f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf070707, 0x1f1f1f0f, 0xf070703, 0x1f1f0f0f}},
+    {{0, 4}, {0x80c0c0e0, 0x8080, 0x80c0c0e0, 0x80, 0x8080c0c0, 0x80, 0x8080c0c0, 0x0, 0x808080c0, 0x0, 0x8080c0, 0x0, 0x808080, 0x0, 0x8080, 0x0}},
+    {{0, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefefeff, 0xffffffff, 0xfcfefeff}},
+    {{0, 4}, {0xfcfefefe, 0xf0f8f8fc, 0xfcfcfefe, 0xf0f8f8fc, 0xfcfcfefe, 0xf0f8f8f8, 0xfcfcfcfe, 0xf0f0f8f8, 0xf8fcfcfe, 0xf0f0f8f8, 0xf8fcfcfc, 0xf0f0f8f8, 0xf8f8fcfc, 0xe0f0f0f8, 0xf8f8fcfc, 0xe0f0f0f8}},
+    {{0, 4}, {0xc0e0e0f0, 0x8080c0, 0xc0e0e0f0, 0x8080c0, 0xc0e0e0f0, 0x80c0, 0xc0e0e0e0, 0x8080, 0xc0c0e0e0, 0x8080, 0xc0c0e0e0, 0x8080, 0xc0c0e0e0, 0x8080, 0x80c0c0e0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 4}, {0xfcfcfeff, 0xe0f0f0f8, 0xfcfcfefe, 0xe0f0f0f8, 0xf8fcfefe, 0xe0f0f0f8, 0xf8fcfefe, 0xe0e0f0f8, 0xf8fcfefe, 0xe0e0f0f8, 0xf8fcfcfe, 0xe0e0f0f8, 0xf8fcfcfe, 0xe0e0f0f0, 0xf8fcfcfe, 0xe0e0f0f0}},
+    {{0, 4}, {0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{0, 4}, {0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0}},
+    {{0, 5}, {0xffff7f0f, 0xffffffff, 0xffff3f07, 0xffffffff, 0xffff1f03, 0xffffffff, 0xff7f0f01, 0xffffffff, 0xff3f0f01, 0xffffffff, 0xff3f0700, 0xffffffff, 0x7f1f0300, 0xffffffff, 0x7f0f0100, 0xffffffff}},
+    {{0, 5}, {0xf010000, 0xffffff7f, 0x7010000, 0xffffff3f, 0x7000000, 0xffffff1f, 0x3000000, 0xffff7f1f, 0x1000000, 0xffff3f0f, 0x0, 0xffff3f07, 0x0, 0xff7f1f03, 0x0, 0xff7f0f01}},
+    {{0, 5}, {0x0, 0x1f070100, 0x0, 0x1f070000, 0x0, 0xf030000, 0x0, 0xf010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f07, 0xffffffff}},
+    {{0, 5}, {0x1f0f0300, 0xffffff7f, 0x1f070100, 0xffffff7f, 0xf030000, 0xffffff3f, 0xf030000, 0xffffff3f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x3000000, 0xffff3f0f, 0x3000000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0x1f070100, 0x0, 0x1f070100, 0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff}},
+    {{0, 5}, {0xf070100, 0xffffff3f, 0xf030000, 0xffffff3f, 0xf030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f0f, 0x3000000, 0xffff3f0f, 0x3000000, 0xff7f1f0f, 0x1000000, 0xff7f1f07}},
+    {{0, 5}, {0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f0f03, 0xffffffff}},
+    {{0, 5}, {0x3010000, 0xffff3f0f, 0x3000000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x0, 0x7f3f0f03, 0x0, 0x7f1f0f03, 0x0, 0x7f1f0701}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff}},
+    {{0, 5}, {0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0301, 0xffffffff, 0x1f0f0300, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x3f1f0703, 0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100}},
+    {{0, 4}, {0xf0f8fcfc, 0x8080c0e0, 0xf0f8fcfc, 0x80c0c0e0, 0xf0f8fcfc, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0c0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf030100, 0xffff7f3f, 0xf030100, 0xffff7f1f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff3f1f, 0x7010000, 0xffff3f1f}},
+    {{0, 5}, {0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfefeff, 0xc0e0f0f8, 0xfcfefeff, 0xe0e0f0f8}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0xff7f1f0f, 0x3000000, 0xff3f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x1000000, 0x7f3f0f03, 0x1000000, 0x7f1f0f03, 0x0, 0x7f1f0f03, 0x0, 0x3f1f0703}},
+    {{0, 4}, {0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc}},
+    {{0, 5}, {0x7f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0301, 0xffffff7f, 0x1f0f0301, 0xffffff7f, 0x1f0f0300, 0xffffff7f, 0x1f070300, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff}},
+    {{0, 5}, {0x7030000, 0xffff3f1f, 0x7010000, 0xffff3f1f, 0x7010000, 0xffff3f0f, 0x7010000, 0xff7f3f0f, 0x3010000, 0xff7f3f0f, 0x3010000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x3000000, 0xff3f1f07}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f8, 0x80, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x3f1f0703, 0xffffffff}},
+    {{0, 1}, {0x0, 0xffc00000, 0x0, 0xfff00000, 0x0, 0xfffc0000, 0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xffffc000}},
+    {{0, 1}, {0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xffff8000, 0x0, 0xffffc000, 0x0, 0xfffff000, 0x0, 0xfffffc00, 0x0, 0xffffff00, 0x0, 0xffffff00}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f0f0f, 0xff7f7f3f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x3010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc}},
+    {{1, 5}, {0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7070301, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0x1f0f0707, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703}},
+    {{1, 4}, {0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xffff7f7f}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80e0f0}},
+    {{1, 5}, {0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707}},
+    {{1, 4}, {0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f}},
+    {{1, 5}, {0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf0ffffff}},
+    {{1, 5}, {0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x7030301, 0xf0f0f07, 0x3030101, 0xf0f0707, 0x3030101, 0xf070707}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc}},
+    {{2, 5}, {0xf8ffff, 0x0, 0xe0feff, 0x0, 0x80f8ff, 0x0, 0xe0fe, 0x0, 0x80fc, 0x0, 0xf0, 0x0, 0xc0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0, 0xfcffffff, 0xc0, 0xf8ffffff, 0x80, 0xe0feffff, 0x0, 0x80f8ffff, 0x0, 0xe0feff, 0x0, 0xc0f8ff, 0x0, 0xe0ff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f8ffff, 0xffffffff, 0x80f0feff, 0xffffffff, 0xc0f8ff, 0xffffffff, 0x80f0fe, 0xffffffff, 0xe0fc, 0xffffffff, 0xc0f0, 0xfcffffff, 0xe0, 0xf8ffffff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xe0fcffff, 0xffffffff, 0xc0f8feff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f}},
+    {{1, 5}, {0x0, 0x1010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x0}},
+    {{2, 5}, {0xc0f8fe, 0x0, 0x80f0fc, 0x0, 0xe0f8, 0x0, 0xc0f0, 0x0, 0x80e0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0x80e0fc, 0xfeffffff, 0x80e0f8, 0xfcffffff, 0xc0f0, 0xf8feffff, 0x80e0, 0xf0feffff, 0xc0, 0xf0fcffff, 0xc0, 0xe0f8feff, 0x80, 0xc0f0fcff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xc0f0fcff}},
+    {{1, 5}, {0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f, 0x7030301, 0x1f0f0f07, 0x7030301, 0xf0f0f07, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x3010100, 0x7070703}},
+    {{2, 5}, {0xc0f0f8, 0x0, 0x80e0f8, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0x80c0f0fc, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0x80e0f8, 0xfcffffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80c0, 0xe0f8feff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0f0f8fe, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0xc0f0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0, 0xc0f0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0x80e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0xc0f0f8, 0xfcffffff, 0x80e0f8}},
+    {{1, 5}, {0x7030301, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3030101, 0xf070707, 0x3010101, 0xf070703, 0x3010100, 0x7070703, 0x1010000, 0x7070303, 0x1010000, 0x7030303, 0x1000000, 0x7030301}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff}},
+    {{1, 5}, {0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f0f, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0xf0f0f07, 0x3f3f1f1f}},
+    {{2, 5}, {0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x1010100, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7030301, 0x1000000, 0x7030301, 0x1000000, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010100}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 5}, {0x1f0f0f0f, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf070707, 0x1f1f1f0f, 0xf070703, 0x1f1f0f0f, 0x7070703, 0x1f1f0f0f}},
+    {{2, 5}, {0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f}},
+    {{1, 5}, {0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcff, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 5}, {0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f, 0x7070303, 0x1f0f0f07, 0x7030303, 0xf0f0f07, 0x7030301, 0xf0f0707, 0x3030301, 0xf0f0707, 0x3030101, 0xf070707, 0x3030101, 0xf070703}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010307, 0x0, 0x70f1f3f, 0x1010307, 0x3f7fffff, 0x70f1f3f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfefefe, 0xfeffffff, 0xfcfcfefe, 0xfeffffff, 0xfcfcfcfe, 0xfefeffff, 0xfcfcfcfe, 0xfefefeff, 0xf8fcfcfc, 0xfefefeff, 0xf8f8fcfc, 0xfcfefefe, 0xf8f8fcfc, 0xfcfcfefe, 0xf8f8f8fc}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010307, 0x0}},
+    {{0, 4}, {0xf8f8f8fc, 0xe0f0f0f0, 0xf8f8f8fc, 0xe0e0f0f0, 0xf0f8f8f8, 0xe0e0f0f0, 0xf0f8f8f8, 0xe0e0e0f0, 0xf0f0f8f8, 0xc0e0e0f0, 0xf0f0f0f8, 0xc0e0e0e0, 0xf0f0f0f8, 0xc0e0e0e0, 0xe0f0f0f0, 0xc0c0e0e0}},
+    {{0, 4}, {0x80c0c0e0, 0x80, 0x80c0c0e0, 0x80, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x808080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff}},
+    {{0, 4}, {0xf8f8fcfe, 0xc0e0f0f0, 0xf8f8fcfe, 0xc0e0f0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf0f8fcfc, 0xc0e0e0f0, 0xf0f8f8fc, 0xc0e0e0f0, 0xf0f8f8fc, 0xc0c0e0f0, 0xf0f8f8fc, 0xc0c0e0f0}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfe}},
+    {{0, 4}, {0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 4}, {0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0}},
+    {{0, 5}, {0x3f070000, 0xffffffff, 0x1f030000, 0xffffffff, 0xf030000, 0xffffff7f, 0xf010000, 0xffffff3f, 0x7000000, 0xffffff3f, 0x3000000, 0xffffff1f, 0x1000000, 0xffff7f0f, 0x1000000, 0xffff3f07}},
+    {{0, 5}, {0x0, 0xff3f0701, 0x0, 0xff1f0700, 0x0, 0x7f1f0300, 0x0, 0x3f0f0100, 0x0, 0x3f070000, 0x0, 0x1f030000, 0x0, 0xf030000, 0x0, 0xf010000}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0xff7f1f07, 0xffffffff, 0xff7f0f03, 0xffffffff, 0xff3f0f01, 0xffffffff, 0xff1f0701, 0xffffffff, 0x7f1f0700, 0xffffffff, 0x3f0f0300, 0xffffffff, 0x3f0f0100, 0xffffffff, 0x1f070100, 0xffffff7f}},
+    {{0, 5}, {0x1000000, 0xff7f1f07, 0x1000000, 0xff7f1f07, 0x0, 0xff3f0f03, 0x0, 0xff3f0f03, 0x0, 0x7f1f0701, 0x0, 0x7f1f0701, 0x0, 0x3f0f0300, 0x0, 0x3f0f0300}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8fcfcfe}},
+    {{0, 5}, {0xff7f1f07, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f0f0300, 0xffffffff, 0x3f0f0300, 0xffffff7f}},
+    {{0, 5}, {0x1000000, 0xff3f1f07, 0x0, 0xff3f0f03, 0x0, 0x7f1f0f03, 0x0, 0x7f1f0701, 0x0, 0x3f1f0701, 0x0, 0x3f0f0300, 0x0, 0x3f0f0300, 0x0, 0x1f070100}},
+    {{0, 4}, {0x80c0e0f0, 0x0, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0xc0c0e0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0x7f3f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0301, 0xffffffff, 0x3f0f0300, 0xffffff7f, 0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff7f, 0xf070100, 0xffffff3f}},
+    {{0, 5}, {0x0, 0x3f1f0701, 0x0, 0x3f0f0301, 0x0, 0x3f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100, 0x0, 0xf030000, 0x0, 0xf030000}},
+    {{0, 4}, {0xe0f0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0, 0xe0f0f8f8, 0x80c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8fc, 0x80c0c0}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf030100, 0xffff7f3f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff3f1f, 0x7010000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf8f8fcfe, 0x80c0e0f0, 0xf8f8fcfe, 0x80c0e0f0, 0xf8f8fcfe, 0x80c0e0f0, 0xf8f8fcfe, 0x80c0e0f0}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xffff3f0f, 0x3010000, 0xff7f3f0f, 0x3000000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x1000000, 0x7f3f0f03, 0x0, 0x7f1f0f03}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8, 0xfcfeffff, 0xe0e0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8}},
+    {{0, 5}, {0xff3f0f07, 0xffffffff, 0x7f3f0f07, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0301, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0xf070100, 0x0, 0xf070100}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x8080c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf8f8fcfe}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{0, 5}, {0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf070100, 0xffff7f3f, 0xf030100, 0xffff7f1f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff3f1f, 0x7010000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000}},
+    {{0, 4}, {0x80c0c0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x1000000, 0x7f3f0f07, 0x1000000, 0x7f1f0f03, 0x0, 0x7f1f0f03, 0x0, 0x7f1f0703, 0x0, 0x3f1f0703, 0x0, 0x3f0f0701}},
+    {{0, 4}, {0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0x0, 0xfffff000, 0x0, 0xfffffe00, 0x0, 0xffffff00, 0x0, 0xffffff00, 0x0, 0xffffff00, 0x0, 0xffffffc0, 0x0, 0xfffffff0, 0x0, 0xfffffffe}},
+    {{0, 1}, {0x0, 0xffffff00, 0x0, 0xffffff80, 0x0, 0xffffffe0, 0x0, 0xfffffff8, 0x0, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffffff, 0xc0000000, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x7f3f3f1f, 0xf0f0703, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07}},
+    {{1, 4}, {0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 5}, {0x1010000, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010000}},
+    {{1, 4}, {0xe0f8fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f07, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0703, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f}},
+    {{1, 4}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x3010100, 0xf070703, 0x1010000, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010100}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe}},
+    {{1, 5}, {0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{2, 5}, {0xffffffff, 0xc0fcffff, 0xffffffff, 0xf0ffff, 0xffffffff, 0xc0fcff, 0xffffffff, 0xf0fe, 0xffffffff, 0x80f8, 0xfeffffff, 0xe0, 0xf8ffffff, 0x80, 0xe0fcffff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xc0f8ffff, 0xffffffff, 0xe0feff, 0xffffffff, 0x80f8ff, 0xffffffff, 0xe0fe}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8ffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010100}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8}},
+    {{2, 5}, {0xc0fc, 0x0, 0xf0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xe0fcffff, 0x80, 0xc0f8ffff, 0x0, 0x80e0fcff, 0x0, 0xc0f8ff, 0x0, 0x80e0fc, 0x0, 0xc0f8, 0x0, 0x80e0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xffffffff, 0x80f0fcff, 0xffffffff, 0xe0f8fe, 0xffffffff, 0xc0f0fc, 0xffffffff, 0x80e0f8, 0xfcffffff, 0xc0f0, 0xf8ffffff, 0x80e0, 0xf0fcffff, 0xc0, 0xe0f8feff, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xe0f8feff}},
+    {{1, 5}, {0x3f1f1f0f, 0x7f7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x1f1f1f0f}},
+    {{1, 4}, {0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0}},
+    {{2, 5}, {0x80e0f8fe, 0x0, 0xc0f0fc, 0x0, 0x80e0f8, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0x80e0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0e0f8fe, 0xffffffff, 0x80e0f8fc, 0xfeffffff, 0xc0f0fc, 0xfeffffff, 0x80e0f8, 0xfcffffff, 0xc0f0, 0xf8feffff, 0x80e0, 0xf0fcffff, 0x80c0, 0xe0f8feff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x1010000, 0x7070303, 0x1010000, 0x7030303, 0x1000000, 0x7030301, 0x1000000, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010000}},
+    {{2, 5}, {0xe0f0fcff, 0x80, 0xc0f0f8fe, 0x0, 0x80e0f8fc, 0x0, 0x80c0f0fc, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0xc0f0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f0}},
+    {{1, 5}, {0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f}},
+    {{2, 5}, {0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0x80c0f0, 0xf8feffff, 0xc0e0, 0xf0fcffff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f}},
+    {{1, 5}, {0x1000000, 0x3030301, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{2, 5}, {0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8, 0xf8feffff, 0x80e0f0}},
+    {{1, 5}, {0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf070703, 0x1f1f1f0f, 0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f07, 0x7030301, 0xf0f0f07, 0x3030301, 0xf0f0707}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f3f}},
+    {{1, 5}, {0x0, 0x1010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0}},
+    {{1, 5}, {0x7070303, 0x1f0f0f0f, 0x7030303, 0x1f0f0f07, 0x7030301, 0xf0f0f07, 0x3030301, 0xf0f0707, 0x3030101, 0xf070707, 0x3030101, 0xf070703, 0x3010100, 0x7070703, 0x1010100, 0x7070303}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xe0f0f8fe, 0x80, 0xc0f0f8fc, 0x80}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f1f, 0x7f7f7f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f0f, 0x7f3f3f1f}},
+    {{2, 5}, {0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x3010101, 0x7070703, 0x3010100, 0x7070303, 0x1010100, 0x7070303, 0x1010000, 0x7030303, 0x1010000, 0x7030301, 0x1000000, 0x3030301, 0x0, 0x3030101, 0x0, 0x3010101}},
+    {{0, 3}, {0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x1030707, 0x0, 0xf0f1f3f, 0x1030307, 0x3f7f7fff, 0xf0f1f3f, 0xffffffff, 0x3f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x10103, 0xf0f1f1f, 0x3070707, 0x1f3f3f7f, 0xf0f1f1f, 0x7f7fffff, 0x3f3f3f7f}},
+    {{0, 4}, {0xfcfcfefe, 0xf8f8f8fc, 0xfcfcfcfe, 0xf0f8f8f8, 0xf8fcfcfc, 0xf0f0f8f8, 0xf8f8fcfc, 0xf0f0f8f8, 0xf8f8fcfc, 0xf0f0f0f8, 0xf8f8f8fc, 0xe0f0f0f0, 0xf0f8f8f8, 0xe0f0f0f0, 0xf0f8f8f8, 0xe0e0f0f0}},
+    {{0, 3}, {0x70f1f3f, 0x10307, 0x3f7fffff, 0x70f1f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x1030307, 0x0, 0xf0f1f3f, 0x1030707, 0x3f7f7fff, 0xf0f1f3f, 0xffffffff, 0x3f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x10103, 0xf0f1f1f, 0x307070f}},
+    {{0, 4}, {0xe0f0f0f0, 0xc0c0e0e0, 0xe0e0f0f0, 0xc0c0c0e0, 0xe0e0e0f0, 0x80c0c0e0, 0xe0e0e0f0, 0x80c0c0c0, 0xc0e0e0e0, 0x8080c0c0, 0xc0e0e0e0, 0x8080c0c0, 0xc0c0e0e0, 0x808080c0, 0xc0c0c0e0, 0x808080c0}},
+    {{0, 3}, {0x0, 0x0, 0x10303, 0x0, 0x70f1f1f, 0x103, 0x3f7f7fff, 0x3070f1f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10307, 0x0, 0x70f1f3f, 0x10103, 0x3f3f7fff, 0x3070f1f, 0xffffffff, 0x1f3f7f7f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0}},
+    {{0, 4}, {0x808080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfcfefe, 0xffffffff, 0xfcfcfefe, 0xffffffff, 0xfcfcfefe, 0xfeffffff, 0xfcfcfefe, 0xfeffffff, 0xf8fcfcfe, 0xfeffffff, 0xf8fcfcfe, 0xfefeffff, 0xf8fcfcfe}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x103070f, 0x0, 0x71f3f7f, 0x103, 0x3f7fffff, 0x3070f1f, 0xffffffff, 0x1f3f7fff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x103070f, 0x0}},
+    {{0, 4}, {0xf0f8f8fc, 0xc0c0e0e0, 0xf0f0f8f8, 0xc0c0e0e0, 0xf0f0f8f8, 0x80c0e0e0, 0xf0f0f8f8, 0x80c0e0e0, 0xf0f0f8f8, 0x80c0c0e0, 0xe0f0f0f8, 0x80c0c0e0, 0xe0f0f0f8, 0x80c0c0e0, 0xe0f0f0f8, 0x80c0c0e0}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3070f, 0x0}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfefeffff, 0xf0f8fcfc, 0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc}},
+    {{0, 4}, {0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0e0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfefeffff}},
+    {{0, 4}, {0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8f8fc, 0x80c0e0e0, 0xf0f8f8fc, 0x80c0e0e0, 0xf0f8f8fc, 0x80c0e0e0, 0xf0f8f8fc, 0x80c0e0e0}},
+    {{0, 5}, {0x0, 0xffff1f07, 0x0, 0xff7f1f03, 0x0, 0xff3f0f01, 0x0, 0xff3f0700, 0x0, 0xff1f0300, 0x0, 0x7f0f0300, 0x0, 0x3f070100, 0x0, 0x1f070000}},
+    {{0, 5}, {0x0, 0x7000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8}},
+    {{0, 5}, {0xffffff1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f0f, 0xffffffff, 0xffff3f07, 0xffffffff, 0xffff1f03, 0xffffffff, 0xff7f0f03, 0xffffffff, 0xff3f0f01, 0xffffffff, 0xff3f0700, 0xffffffff}},
+    {{0, 5}, {0x1f030000, 0xffffff7f, 0xf030000, 0xffffff3f, 0x7010000, 0xffffff3f, 0x7000000, 0xffff7f1f, 0x3000000, 0xffff7f1f, 0x3000000, 0xffff3f0f, 0x1000000, 0xffff3f07, 0x0, 0xff7f1f07}},
+    {{0, 5}, {0x0, 0x1f070100, 0x0, 0x1f070000, 0x0, 0xf030000, 0x0, 0xf010000, 0x0, 0x7010000, 0x0, 0x7000000, 0x0, 0x3000000, 0x0, 0x1000000}},
+    {{0, 4}, {0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff}},
+    {{0, 5}, {0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff7f, 0xf030000, 0xffffff3f, 0xf030000, 0xffffff3f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x3000000, 0xffff3f0f, 0x3000000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0x1f070100, 0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f1f07, 0xffffffff}},
+    {{0, 5}, {0xf030000, 0xffffff3f, 0xf030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f1f, 0x3000000, 0xffff3f0f, 0x3000000, 0xff7f3f0f, 0x1000000, 0xff7f1f07, 0x1000000, 0xff3f1f07}},
+    {{0, 5}, {0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{0, 4}, {0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0xff7f3f0f, 0x3000000, 0xff7f1f0f, 0x1000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f03, 0x0, 0x7f3f0f03, 0x0, 0x7f1f0703, 0x0, 0x3f1f0701}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf8fcfcfe, 0x80c0e0f0, 0xf8fcfcfe, 0xc0c0e0f0, 0xf8fcfcfe, 0xc0c0e0f0, 0xf8fcfcfe, 0xc0c0e0f0, 0xf8fcfefe, 0xc0c0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0, 0xf8fcfefe, 0xc0e0e0f0}},
+    {{0, 5}, {0xff3f1f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0301, 0xffffff7f, 0x1f0f0300, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x7f1f0703, 0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0x1f0f0300, 0xffffff7f, 0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf030100, 0xffff7f3f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff3f1f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0x8080c0, 0x0, 0x8080c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff}},
+    {{0, 5}, {0x3010000, 0xff7f3f0f, 0x3010000, 0xff7f1f0f, 0x3000000, 0xff7f1f0f, 0x3000000, 0xff3f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x1000000, 0x7f3f0f03, 0x0, 0x7f1f0f03}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfefeffff}},
+    {{0, 5}, {0x7f3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0701, 0xffffff7f, 0x3f0f0301, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f070300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100, 0x0, 0xf030100}},
+    {{0, 4}, {0xe0f0f8f8, 0x80c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0e0}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{0, 1}, {0x0, 0xffffffc0, 0x0, 0xfffffff0, 0x0, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffffff, 0x80000000, 0xffffffff, 0xf0000000, 0xffffffff, 0xfe000000, 0xffffffff}},
+    {{0, 1}, {0x0, 0xffffffff, 0x0, 0xffffffff, 0x80000000, 0xffffffff, 0xe0000000, 0xffffffff, 0xfc000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff000000, 0xffffffff}},
+    {{0, 1}, {0xf0000000, 0xffffffff, 0xfc000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff800000, 0xffffffff, 0xffe00000, 0xffffffff, 0xfffc0000, 0xffffffff, 0xffff0000, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x3030101, 0x1f0f0707, 0x3010100, 0xf0f0703, 0x3010000, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x7030101, 0x0, 0x3030100, 0x0, 0x3010100}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xffff7f7f, 0x3f1f0f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f1f}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x7030301, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf0f0703, 0x3010000, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x7030101}},
+    {{1, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x7f3f1f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0xff7f3f3f, 0x1f1f0f07, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80c0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fe}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xe0fcff}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf0f8feff, 0x80c0, 0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{2, 5}, {0xf0ffff, 0x0, 0xc0fcff, 0x0, 0xe0fe, 0x0, 0x80f8, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0x80f0, 0xfcffffff, 0xc0, 0xf0ffffff, 0x0, 0xc0f8ffff, 0x0, 0xe0feff, 0x0, 0x80f0ff, 0x0, 0xc0fc, 0x0, 0xe0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0fcffff, 0xffffffff, 0xc0f0feff, 0xffffffff, 0xe0fcff, 0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8, 0xfcffffff, 0x80e0, 0xf0feffff, 0xc0, 0xe0f8ffff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xc0f0fcff}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0f0fcff, 0x0, 0x80e0f8fe, 0x0, 0xc0f0fc, 0x0, 0xe0f8, 0x0, 0x80e0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0fcff, 0xffffffff, 0x80e0f8fe, 0xffffffff, 0xc0f0fc, 0xfcffffff, 0x80e0f0, 0xf8feffff, 0xc0e0, 0xf0fcffff, 0x80c0, 0xe0f8feff, 0x80, 0xc0f0fcff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xe0f8feff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010101, 0xf070703, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301}},
+    {{1, 4}, {0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0}},
+    {{2, 5}, {0xe0f0fcff, 0x80, 0xc0e0f8fe, 0x0, 0x80e0f0fc, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80c0f0fc, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80c0f0, 0xf8fcffff, 0xc0e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80c0f0, 0xf8fcffff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0xc0e0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xc0f0f8fe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x7030301, 0x1f0f0f07, 0x7030301, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3010101, 0xf070703, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1010000, 0x7030303, 0x1000000, 0x7030301}},
+    {{2, 5}, {0x80c0f0fc, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfcffffff, 0x80c0e0f8, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8fcfeff, 0xc0e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x7f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0f07, 0x3f3f1f1f}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xc0f0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80c0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x3030101, 0xf070707, 0x3010101, 0xf070703, 0x3010100, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7030301, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3030101}},
+    {{2, 5}, {0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f8, 0xf8feffff, 0x80e0f0}},
+    {{1, 5}, {0x3f1f1f0f, 0x7f7f7f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f0f, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80c0f0, 0xf8fcffff, 0x80c0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0x80c0, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x1010000, 0x7030303, 0x1000000, 0x7030301, 0x1000000, 0x3030301, 0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1010000}},
+    {{2, 5}, {0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8}},
+    {{1, 5}, {0x1f0f0f07, 0x3f3f1f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf070707, 0x3f1f1f0f, 0xf070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f07, 0x7030301, 0xf0f0f07}},
+    {{2, 5}, {0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f7f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 3}, {0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x10103, 0x0, 0x3030707, 0x1010103, 0x70f0f0f, 0x3030707, 0x1f1f3f3f, 0xf0f0f1f, 0x3f7f7f7f, 0x1f1f3f3f, 0xffffffff, 0x7f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x0, 0x1030303, 0x101, 0x7070f0f, 0x3030307}},
+    {{0, 4}, {0xf0f0f8f8, 0xe0e0e0f0, 0xf0f0f0f8, 0xe0e0e0f0, 0xf0f0f0f0, 0xc0e0e0e0, 0xe0f0f0f0, 0xc0c0e0e0, 0xe0e0f0f0, 0xc0c0e0e0, 0xe0e0e0f0, 0xc0c0c0e0, 0xe0e0e0f0, 0xc0c0c0c0, 0xc0e0e0e0, 0x80c0c0c0}},
+    {{0, 3}, {0x3f3f3f7f, 0xf0f1f1f, 0x7f7fffff, 0x3f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x1010103, 0x0, 0x3070707, 0x1010103, 0xf0f0f1f, 0x3070707, 0x1f3f3f3f, 0xf0f1f1f, 0x7f7f7fff, 0x1f3f3f3f, 0xffffffff, 0x7f7fffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10101, 0x0}},
+    {{0, 4}, {0xc0c0c0e0, 0x808080, 0x80c0c0c0, 0x808080, 0x80c0c0c0, 0x8080, 0x8080c0c0, 0x80, 0x808080c0, 0x80, 0x808080c0, 0x0, 0x808080, 0x0, 0x808080, 0x0}},
+    {{0, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfefeffff}},
+    {{0, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x3030707, 0x101, 0xf0f1f1f, 0x1030707, 0x1f3f3f7f, 0x70f0f1f, 0x7f7fffff, 0x1f1f3f3f, 0xffffffff, 0x3f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x3070707, 0x10103, 0xf0f1f1f, 0x3030707, 0x1f3f3f7f, 0x70f0f1f}},
+    {{0, 4}, {0xfefeffff, 0xf8f8fcfc, 0xfefefeff, 0xf8f8fcfc, 0xfcfefeff, 0xf8f8fcfc, 0xfcfefefe, 0xf8f8f8fc, 0xfcfefefe, 0xf0f8f8fc, 0xfcfcfefe, 0xf0f8f8fc, 0xfcfcfefe, 0xf0f8f8f8, 0xfcfcfcfe, 0xf0f0f8f8}},
+    {{0, 3}, {0xf1f3f3f, 0x10307, 0x3f7fffff, 0x30f1f1f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x1, 0x0, 0x10303, 0x0, 0x3070f0f, 0x103, 0xf1f1f3f, 0x1030707, 0x3f3f7fff, 0x70f0f1f, 0x7fffffff, 0x1f3f3f7f, 0xffffffff, 0x7f7fffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x0, 0x1030307, 0x1}},
+    {{0, 4}, {0xe0f0f0f8, 0x8080c0e0, 0xe0e0f0f0, 0x8080c0c0, 0xe0e0f0f0, 0x8080c0c0, 0xe0e0f0f0, 0x8080c0c0, 0xe0e0e0f0, 0x8080c0, 0xc0e0e0f0, 0x8080c0, 0xc0e0e0f0, 0x8080c0, 0xc0e0e0f0, 0x8080c0}},
+    {{0, 3}, {0x70f1f7f, 0x103, 0x3f7fffff, 0x1070f1f, 0xffffffff, 0xf1f3fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x1, 0x0, 0x103070f, 0x0, 0xf1f3f3f, 0x103, 0x3f7fffff, 0x3070f1f, 0xffffffff, 0xf1f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10303, 0x0, 0x307070f, 0x1, 0xf1f1f3f, 0x1030307}},
+    {{0, 4}, {0xfefeffff, 0xf0f8f8fc, 0xfcfeffff, 0xf0f8f8fc, 0xfcfeffff, 0xf0f8f8fc, 0xfcfefeff, 0xf0f0f8fc, 0xfcfefeff, 0xf0f0f8fc, 0xfcfefeff, 0xf0f0f8f8, 0xfcfefeff, 0xf0f0f8f8, 0xfcfcfeff, 0xf0f0f8f8}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x10307, 0x0, 0x3071f3f, 0x1, 0x1f3f7fff, 0x1030f, 0xffffffff, 0x70f1f3f, 0xffffffff, 0x1f7fffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10307, 0x0, 0x30f1f3f, 0x1, 0x1f3f7fff, 0x1070f}},
+    {{0, 4}, {0x80c0e0e0, 0x80, 0x80c0e0e0, 0x80, 0x80c0e0e0, 0x80, 0x80c0e0e0, 0x80, 0x80c0e0e0, 0x80, 0x80c0c0e0, 0x80, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3070f, 0x0, 0x70f3f7f, 0x103}},
+    {{0, 4}, {0xf0f8f8fc, 0x80c0e0e0, 0xf0f8f8fc, 0x80c0c0e0, 0xf0f8f8fc, 0x80c0c0e0, 0xf0f8f8fc, 0x80c0c0e0, 0xf0f8f8fc, 0x80c0c0e0, 0xf0f0f8fc, 0x80c0c0e0, 0xf0f0f8fc, 0x80c0c0e0, 0xf0f0f8fc, 0x80c0c0e0}},
+    {{0, 5}, {0x0, 0x1f030000, 0x0, 0xf010000, 0x0, 0x7010000, 0x0, 0x7000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f8f8}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff1f, 0xffffffff, 0xffff7f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f07, 0xffffffff, 0xffff1f03, 0xffffffff}},
+    {{0, 5}, {0xff1f0300, 0xffffffff, 0x7f0f0100, 0xffffffff, 0x3f070100, 0xffffffff, 0x3f070000, 0xffffffff, 0x1f030000, 0xffffff7f, 0xf010000, 0xffffff7f, 0x7000000, 0xffffff3f, 0x7000000, 0xffffff1f}},
+    {{0, 5}, {0x0, 0xff7f0f03, 0x0, 0xff3f0f01, 0x0, 0xff3f0701, 0x0, 0x7f1f0700, 0x0, 0x7f0f0300, 0x0, 0x3f0f0100, 0x0, 0x1f070100, 0x0, 0x1f030000}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0xff7f1f07, 0xffffffff, 0xff7f1f03, 0xffffffff, 0xff3f0f03, 0xffffffff, 0xff3f0f01, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x7f1f0300, 0xffffffff, 0x3f0f0300, 0xffffffff, 0x3f0f0100, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0xff7f1f07, 0x1000000, 0xff7f1f07, 0x0, 0xff3f0f03, 0x0, 0xff3f0f03, 0x0, 0x7f1f0701, 0x0, 0x7f1f0701, 0x0, 0x3f0f0300, 0x0, 0x3f0f0300}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xff7f1f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0300, 0xffffffff, 0x1f0f0300, 0xffffff7f}},
+    {{0, 5}, {0x1000000, 0xff3f0f03, 0x0, 0x7f3f0f03, 0x0, 0x7f1f0703, 0x0, 0x7f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0300, 0x0, 0x1f0f0300, 0x0, 0x1f070100}},
+    {{0, 4}, {0xe0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0x7f1f0703, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0300, 0xffffffff, 0x1f0f0300, 0xffffff7f, 0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf030100, 0xffffff3f}},
+    {{0, 5}, {0x0, 0x3f0f0701, 0x0, 0x3f0f0300, 0x0, 0x1f0f0300, 0x0, 0x1f070100, 0x0, 0x1f070100, 0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000}},
+    {{0, 4}, {0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f0, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0f8}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf030000, 0xffff7f3f, 0xf030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f1f, 0x3010000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0}},
+    {{0, 4}, {0xfefeffff, 0xe0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f0f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xffff3f0f, 0x3010000, 0xff7f3f0f, 0x3000000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x1000000, 0x7f3f0f03, 0x0, 0x7f1f0f03}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff}},
+    {{0, 5}, {0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff}},
+    {{0, 5}, {0x0, 0x7f1f0703, 0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0301, 0x0, 0x1f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100}},
+    {{0, 4}, {0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0x1f0f0300, 0xffffff7f, 0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf030100, 0xffff7f3f, 0xf030100, 0xffff7f1f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff7f1f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0x7030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0}},
+    {{0, 1}, {0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff800000, 0xffffffff, 0xfff00000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffe000, 0xffffffff}},
+    {{0, 1}, {0xffe00000, 0xffffffff, 0xfffc0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff8000, 0xffffffff, 0xfffff000, 0xffffffff, 0xfffffe00, 0xffffffff, 0xffffff00, 0xffffffff}},
+    {{0, 1}, {0xffff0000, 0xffffffff, 0xffff8000, 0xffffffff, 0xfffff000, 0xffffffff, 0xfffffc00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffffc0, 0xffffffff, 0xfffffff8, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f3f1f0f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0xff7f3f3f, 0x1f0f0f07, 0x7f7f3f1f, 0xf0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f1f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0xf070303, 0x3f1f1f0f, 0x7070301, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0x1f0f0707, 0x3010100, 0xf0f0703, 0x1010000, 0xf070703, 0x1000000, 0x7070303, 0x1000000, 0x7030301}},
+    {{1, 4}, {0xc0f0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f8fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xffff7f7f, 0x3f1f0f0f, 0xff7f7f3f, 0x1f1f0f07, 0x7f7f3f3f}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f3f1f0f, 0xf070303, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf0f0703, 0x3010000, 0xf070703}},
+    {{1, 4}, {0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f8fc}},
+    {{2, 5}, {0xffffffff, 0xf0fe, 0xffffffff, 0x80f8, 0xfcffffff, 0xc0, 0xe0fcffff, 0x0, 0x80f0feff, 0x0, 0x80f8ff, 0x0, 0xc0f8, 0x0, 0xe0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0ffffff, 0xffffffff, 0xc0fcffff, 0xffffffff, 0xe0feff, 0xffffffff, 0x80f0ff, 0xffffffff, 0xc0f8, 0xfcffffff, 0xe0, 0xe0feffff, 0x0, 0x80f0feff, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xe0f8ffff, 0xffffffff, 0x80e0fcff, 0xffffffff, 0xc0f0fc}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f}},
+    {{1, 5}, {0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xe0f8feff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80f0fcff, 0x0, 0xc0f8fe, 0x0, 0x80e0f8, 0x0, 0x80f0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0x80e0f8fe, 0xffffffff, 0x80e0fc, 0xfcffffff, 0xc0f0, 0xf8feffff, 0x80e0, 0xf0fcffff, 0xc0, 0xc0f0fcff, 0x0, 0x80e0f8fe, 0x0, 0xc0e0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0x80c0f0fc}},
+    {{1, 5}, {0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf0f0707}},
+    {{1, 4}, {0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80e0f0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0x80e0f8fe, 0x0, 0xc0f0fc, 0x0, 0x80e0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0fcfe, 0xffffffff, 0x80e0f8fc, 0xfeffffff, 0x80c0f0fc, 0xfcffffff, 0x80e0f8, 0xf8feffff, 0xc0f0, 0xf0fcffff, 0x80e0, 0xe0f8fcff, 0xc0, 0xc0f0f8fe, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f}},
+    {{1, 5}, {0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0fcfeff, 0x80c0, 0xe0f8fcff, 0xc0, 0xc0f0f8fe, 0x80, 0x80e0f8fc, 0x0, 0x80c0f0f8, 0x0, 0x80e0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0f8, 0xfcffffff, 0xc0e0f8}},
+    {{1, 5}, {0x1f0f0f07, 0x3f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x1f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707}},
+    {{2, 5}, {0x80e0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xf8fcffff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xe0f8fcff, 0xc0, 0xe0f0f8fe, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f3f}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0x80e0f0fc, 0x0, 0x80c0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xfeffffff, 0xc0e0f0fc}},
+    {{1, 5}, {0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x7030301, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703}},
+    {{2, 5}, {0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f0, 0xf8feffff, 0x80c0f0, 0xf8fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f7f3f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8fcffff, 0x80c0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcfe, 0xc0, 0xe0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe}},
+    {{1, 5}, {0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f, 0x7030301, 0x1f0f0f07, 0x7030301, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3010101, 0xf070703, 0x3010100, 0x7070303, 0x1010000, 0x7070303}},
+    {{2, 5}, {0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f0f, 0x7f3f3f1f}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xc0f0f8fc, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x3030301, 0xf0f0707, 0x3030101, 0xf070707, 0x3010101, 0xf070703, 0x3010100, 0x7070303, 0x1010000, 0x7070303, 0x1010000, 0x7030301, 0x1000000, 0x3030301, 0x0, 0x3030101}},
+    {{2, 5}, {0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8}},
+    {{1, 5}, {0x3f1f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf070707, 0x3f1f1f0f}},
+    {{0, 3}, {0xf1f1f1f, 0x7070f0f, 0x3f3f7f7f, 0x1f1f1f3f, 0xffffffff, 0x3f7f7f7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010303, 0x1, 0x707070f, 0x1030303, 0xf1f1f1f, 0x7070f0f, 0x3f3f3f7f, 0x1f1f1f3f, 0x7fffffff, 0x3f7f7f7f}},
+    {{0, 4}, {0xc0e0e0e0, 0x8080c0c0, 0xc0c0e0e0, 0x808080c0, 0xc0c0c0e0, 0x808080c0, 0xc0c0c0c0, 0x80808080, 0x80c0c0c0, 0x808080, 0x8080c0c0, 0x8080, 0x808080c0, 0x80, 0x80808080, 0x0}},
+    {{0, 3}, {0x3030707, 0x1010103, 0x70f0f0f, 0x3030707, 0x1f1f3f3f, 0xf0f0f1f, 0x7f7f7fff, 0x1f3f3f3f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10101, 0x0, 0x3030307, 0x1010103, 0x70f0f0f, 0x3030707, 0x1f1f3f3f, 0xf0f0f1f}},
+    {{0, 4}, {0x8080, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefefeff, 0xffffffff, 0xfcfefefe, 0xfeffffff, 0xfcfefefe, 0xfeffffff, 0xfcfcfefe, 0xfefeffff, 0xfcfcfefe, 0xfefefeff, 0xfcfcfcfe, 0xfefefefe, 0xfcfcfcfc}},
+    {{0, 3}, {0x7f7fffff, 0x1f1f3f3f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x10103, 0x0, 0x3030707, 0x10103, 0xf0f1f1f, 0x3030707, 0x1f3f3f7f, 0x70f0f1f, 0x7f7fffff, 0x1f3f3f3f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010103, 0x0, 0x3070707, 0x10103}},
+    {{0, 4}, {0xf8fcfcfe, 0xf0f0f8f8, 0xf8fcfcfc, 0xf0f0f0f8, 0xf8f8fcfc, 0xe0f0f0f8, 0xf8f8fcfc, 0xe0f0f0f8, 0xf8f8f8fc, 0xe0f0f0f0, 0xf8f8f8fc, 0xe0e0f0f0, 0xf0f8f8f8, 0xe0e0f0f0, 0xf0f8f8f8, 0xe0e0e0f0}},
+    {{0, 3}, {0x7070f0f, 0x10303, 0xf1f3f3f, 0x307070f, 0x3f7f7fff, 0xf0f1f3f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x0, 0x1030307, 0x1, 0x70f0f1f, 0x1010307, 0x1f1f3f3f, 0x7070f0f, 0x3f7f7fff, 0xf1f1f3f}},
+    {{0, 4}, {0xc0c0e0e0, 0x8080, 0xc0c0e0e0, 0x8080, 0xc0c0e0e0, 0x8080, 0xc0c0c0e0, 0x8080, 0x80c0c0e0, 0x80, 0x80c0c0e0, 0x80, 0x80c0c0c0, 0x80, 0x8080c0c0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 3}, {0x3f3f7fff, 0x7070f1f, 0x7fffffff, 0xf1f3f7f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x101, 0x0, 0x1030707, 0x0, 0x70f0f1f, 0x10303, 0x1f1f3f7f, 0x307070f, 0x3f7fffff, 0xf0f1f3f, 0xffffffff, 0x3f3f7f7f, 0xffffffff, 0x7fffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x303070f, 0x101}},
+    {{0, 4}, {0xfcfcfefe, 0xe0f0f8f8, 0xfcfcfefe, 0xe0f0f8f8, 0xfcfcfefe, 0xe0f0f0f8, 0xf8fcfefe, 0xe0f0f0f8, 0xf8fcfcfe, 0xe0f0f0f8, 0xf8fcfcfe, 0xe0f0f0f8, 0xf8fcfcfe, 0xe0e0f0f8, 0xf8fcfcfe, 0xe0e0f0f0}},
+    {{0, 3}, {0x7fffffff, 0x70f1f3f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x103, 0x0, 0x103070f, 0x0, 0x70f1f3f, 0x103, 0x1f3f7f7f, 0x307070f, 0x7fffffff, 0xf0f1f3f, 0xffffffff, 0x3f3f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1030307, 0x0, 0x7070f1f, 0x103, 0xf1f3f7f, 0x103070f}},
+    {{0, 4}, {0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x80c0c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff}},
+    {{0, 3}, {0x3f7fffff, 0x103071f, 0xffffffff, 0x71f3f7f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x3, 0x0, 0x103070f, 0x0, 0x70f1f3f, 0x103, 0x3f7fffff, 0x103070f, 0xffffffff, 0x71f3f7f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10307, 0x0, 0x3070f1f, 0x1, 0xf1f3f7f, 0x10307, 0x3f7fffff, 0x3070f1f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0}},
+    {{0, 4}, {0xf0f0f8fc, 0x80c0c0e0, 0xf0f0f8fc, 0x80c0c0e0, 0xf0f0f8fc, 0x80c0c0e0, 0xf0f0f8fc, 0x8080c0e0, 0xe0f0f8f8, 0x8080c0e0, 0xe0f0f8f8, 0x8080c0e0, 0xe0f0f8f8, 0x8080c0e0, 0xe0f0f8f8, 0x8080c0e0}},
+    {{0, 3}, {0x0, 0x0, 0x103, 0x0, 0x103071f, 0x0, 0xf1f3f7f, 0x103, 0x3f7fffff, 0x1030f1f, 0xffffffff, 0x71f3f7f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0, 0x103071f, 0x0, 0xf1f3f7f, 0x103, 0x3f7fffff, 0x1030f1f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0}},
+    {{0, 4}, {0xfcfefeff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f8f8, 0xfcfefeff, 0xe0f0f0f8, 0xfcfefeff, 0xe0f0f0f8}},
+    {{0, 5}, {0x3000000, 0xffff7f1f, 0x1000000, 0xffff7f0f, 0x0, 0xffff3f07, 0x0, 0xffff1f03, 0x0, 0xff7f1f03, 0x0, 0xff7f0f01, 0x0, 0xff3f0700, 0x0, 0xff1f0300}},
+    {{0, 5}, {0x0, 0xf030000, 0x0, 0xf010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{0, 4}, {0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff1f07, 0xffffffff, 0xff7f1f03, 0xffffffff}},
+    {{0, 5}, {0x1f070100, 0xffffff7f, 0x1f030000, 0xffffff7f, 0xf030000, 0xffffff3f, 0xf010000, 0xffffff3f, 0x7010000, 0xffff7f1f, 0x3000000, 0xffff7f1f, 0x3000000, 0xffff3f0f, 0x1000000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0x1f070100, 0x0, 0x1f070100, 0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff}},
+    {{0, 5}, {0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf030000, 0xffffff3f, 0xf030000, 0xffff7f3f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x3000000, 0xffff3f0f, 0x3000000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0x1f070100, 0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x80c0c0e0, 0xf0f8f8fc, 0x80c0c0e0, 0xf0f8f8fc, 0x80c0c0e0, 0xf0f8fcfc, 0x80c0c0e0, 0xf0f8fcfc, 0x80c0c0e0, 0xf0f8fcfc, 0x80c0c0e0}},
+    {{0, 5}, {0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f1f07, 0xffffffff}},
+    {{0, 5}, {0xf030000, 0xffff7f3f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f0f, 0x3000000, 0xffff3f0f, 0x3000000, 0xff7f1f0f, 0x1000000, 0xff7f1f07, 0x1000000, 0xff3f1f07}},
+    {{0, 5}, {0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{0, 4}, {0xf8fcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xc0e0f0f8, 0xfcfcfeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0e0f0f8}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f3f0f03, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0xff7f3f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff7f1f07, 0x1000000, 0xff3f0f07, 0x1000000, 0xff3f0f03, 0x0, 0x7f1f0f03, 0x0, 0x7f1f0703, 0x0, 0x3f1f0701}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe, 0xfeffffff, 0xf0f8fcfe}},
+    {{0, 5}, {0xff3f1f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0301, 0xffffffff, 0x1f0f0300, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x7f1f0703, 0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0301, 0x0, 0x1f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100}},
+    {{0, 4}, {0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0f0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 5}, {0x3f0f0300, 0xffffff7f, 0x1f0f0300, 0xffffff7f, 0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf030100, 0xffff7f3f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff7f1f}},
+    {{0, 5}, {0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000}},
+    {{0, 4}, {0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 5}, {0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xffff3f1f, 0x7010000, 0xffff3f0f, 0x3010000, 0xff7f3f0f, 0x3000000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x1000000, 0x7f3f0f03}},
+    {{0, 5}, {0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0000000}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe0000000, 0x0, 0xfc000000, 0x0, 0xff000000}},
+    {{0, 1}, {0xfffffc00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffffc0, 0xffffffff, 0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xffffff00, 0xffffffff, 0xffffffe0, 0xffffffff, 0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 4}, {0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x7070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f0f, 0x7030101, 0x1f0f0f07, 0x3010100, 0xf0f0707, 0x3010000, 0xf070703, 0x1000000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101}},
+    {{1, 4}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0x80c0f0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffff7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xffff7f3f, 0x1f1f0f0f, 0xff7f3f3f, 0x1f0f0f07, 0x7f7f3f1f}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe}},
+    {{1, 5}, {0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x3f1f0f0f, 0x7030301, 0x1f1f0f07, 0x3030101, 0x1f0f0f07, 0x3010100, 0xf0f0707, 0x1010000, 0xf070703}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 5}, {0xffffffff, 0xe0fcffff, 0xffffffff, 0x80f0feff, 0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8, 0xf8ffffff, 0xc0, 0xc0f8ffff, 0x0, 0xe0f8ff, 0x0, 0xe0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xe0fcffff, 0xffffffff, 0x80f0feff, 0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f0, 0xf8ffffff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xe0f8feff}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f}},
+    {{1, 5}, {0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{1, 4}, {0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc}},
+    {{2, 5}, {0xc0f8ff, 0x0, 0xc0f8, 0x0, 0xe0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0f8, 0xf8ffffff, 0x80e0, 0xe0fcffff, 0x80, 0xc0f0fcff, 0x0, 0xc0f0fe, 0x0, 0xc0f8, 0x0, 0x80e0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xc0f0fcff, 0xffffffff, 0xc0f0fc, 0xfcffffff, 0x80e0f0, 0xf8feffff, 0x80e0, 0xe0f8feff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0x1f1f0f0f, 0xff7f3f3f, 0x1f0f0f07, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0x1f0f0707}},
+    {{1, 4}, {0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff}},
+    {{2, 5}, {0xc0f0, 0x0, 0x80e0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcffffff, 0x80e0f8, 0xf8feffff, 0xc0f0, 0xf0fcffff, 0x80c0, 0xe0f8fcff, 0x80, 0xc0e0f8fe, 0x0, 0x80c0f0f8, 0x0, 0x80e0f0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xc0f0f8fe, 0xfeffffff, 0x80e0f0fc, 0xfcffffff, 0xc0e0f8}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f}},
+    {{1, 5}, {0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000}},
+    {{1, 4}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0x80e0f0fc, 0x0, 0xc0e0f8, 0x0, 0x80c0f0, 0x0, 0x80e0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xc0f0f8fe, 0xfeffffff, 0x80e0f0fc, 0xfcffffff, 0x80c0e0f8, 0xf8feffff, 0x80e0f0, 0xf0fcfeff, 0xc0e0, 0xf0f8fcff, 0x80c0, 0xe0f0f8fe, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0f0f8, 0x0}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80c0f0, 0xf0fcfeff, 0xc0e0, 0xf0f8feff, 0x80c0, 0xe0f0fcfe, 0x80, 0xc0e0f8fc, 0x80, 0x80e0f0f8, 0x0, 0xc0e0f0, 0x0, 0x80c0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0e0f8fc}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff}},
+    {{1, 5}, {0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1010000}},
+    {{2, 5}, {0xc0e0f8fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xf8feffff, 0x80e0f0, 0xf8fcfeff, 0xc0e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f0f}},
+    {{2, 5}, {0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f0, 0xf8feffff, 0x80c0f0, 0xf0fcfeff, 0xc0e0, 0xf0f8feff, 0x80c0, 0xe0f0fcfe, 0xc0, 0xc0f0f8fc, 0x80, 0xc0e0f0fc, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f}},
+    {{1, 5}, {0x1010100, 0x7070303, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000}},
+    {{2, 5}, {0xe0f8fcff, 0x80c0, 0xe0f0fcfe, 0x80, 0xc0f0f8fc, 0x80, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0f8}},
+    {{1, 5}, {0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f0f, 0x7f3f3f1f, 0x1f0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07}},
+    {{2, 5}, {0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f0, 0xf8feffff, 0x80c0f0, 0xf8fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f}},
+    {{1, 5}, {0x1000000, 0x7030301, 0x1000000, 0x3030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8fcffff, 0x80c0f0, 0xf0fcfeff, 0xc0e0, 0xf0f8feff, 0x80c0, 0xe0f8fcfe, 0xc0, 0xe0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe}},
+    {{1, 5}, {0x1f0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070707, 0x3f1f1f0f, 0xf070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7030303, 0x1f0f0f07, 0x7030301, 0xf0f0707, 0x3030101, 0xf0f0707}},
+    {{2, 5}, {0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0f8, 0xfcffffff, 0x80c0e0f8, 0xfcfeffff, 0x80e0f0}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f7f, 0x3f1f1f0f, 0xff7f7f3f}},
+    {{1, 5}, {0x0, 0x3010101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xf0f8fcff, 0x80c0, 0xe0f0fcfe, 0xc0, 0xc0f0f8fe, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 5}, {0xf070703, 0x1f1f0f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f07, 0x7030301, 0xf0f0f07, 0x3030101, 0xf0f0707, 0x3030101, 0xf070703, 0x3010100, 0x7070703, 0x1010000, 0x7070303}},
+    {{0, 3}, {0x1010303, 0x1, 0x707070f, 0x1030303, 0xf1f1f1f, 0x7070f0f, 0x3f3f7f7f, 0x1f1f1f3f, 0xffffffff, 0x3f7f7f7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1030303, 0x101, 0x7070f0f, 0x3030307, 0x1f1f1f3f, 0xf0f0f0f}},
+    {{0, 4}, {0x808080, 0x0, 0x8080, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefefeff, 0xffffffff, 0xfefefefe, 0xfeffffff, 0xfcfefefe, 0xfefeffff, 0xfcfcfefe, 0xfefefeff, 0xfcfcfcfe}},
+    {{0, 3}, {0x7f7f7fff, 0x1f3f3f3f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x10101, 0x0, 0x3030707, 0x1010103, 0xf0f0f1f, 0x3070707, 0x1f3f3f3f, 0xf0f1f1f, 0x7f7fffff, 0x3f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010103, 0x0, 0x3070707, 0x1030303}},
+    {{0, 4}, {0xfcfefefe, 0xf8fcfcfc, 0xfcfefefe, 0xf8f8fcfc, 0xfcfcfefe, 0xf8f8fcfc, 0xfcfcfcfe, 0xf8f8f8fc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8fcfcfc, 0xf0f8f8f8, 0xf8f8fcfc, 0xf0f0f8f8, 0xf8f8fcfc, 0xf0f0f8f8}},
+    {{0, 3}, {0xf0f1f1f, 0x3070707, 0x3f3f3f7f, 0xf0f1f1f, 0x7fffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010303, 0x0, 0x707070f, 0x1010303, 0xf1f1f1f, 0x707070f, 0x3f3f7f7f, 0xf1f1f3f, 0xffffffff, 0x3f3f7f7f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0}},
+    {{0, 4}, {0xf0f0f8f8, 0xe0e0e0f0, 0xf0f0f8f8, 0xc0e0e0f0, 0xf0f0f0f8, 0xc0e0e0e0, 0xf0f0f0f0, 0xc0c0e0e0, 0xe0f0f0f0, 0xc0c0e0e0, 0xe0e0f0f0, 0xc0c0c0e0, 0xe0e0f0f0, 0xc0c0c0e0, 0xe0e0e0f0, 0x80c0c0c0}},
+    {{0, 3}, {0xffffffff, 0x3f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x10103, 0x0, 0x3030707, 0x101, 0xf0f1f1f, 0x1030307, 0x1f3f3f7f, 0x70f0f1f, 0x7f7fffff, 0x1f1f3f3f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010303, 0x0, 0x307070f, 0x10103, 0xf1f1f3f, 0x307070f}},
+    {{0, 4}, {0x8080c0c0, 0x0, 0x8080c0c0, 0x0, 0x808080c0, 0x0, 0x8080c0, 0x0, 0x808080, 0x0, 0x808080, 0x0, 0x8080, 0x0, 0x8080, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefefe, 0xffffffff, 0xfcfcfefe}},
+    {{0, 3}, {0xf0f1f1f, 0x1030307, 0x1f3f7f7f, 0x7070f1f, 0x7fffffff, 0x1f1f3f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1010307, 0x0, 0x7070f0f, 0x10103, 0xf1f1f3f, 0x303070f, 0x3f7f7fff, 0xf0f1f1f, 0xffffffff, 0x1f3f7f7f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x0}},
+    {{0, 4}, {0xf8f8fcfc, 0xe0e0f0f0, 0xf8f8fcfc, 0xe0e0f0f0, 0xf8f8fcfc, 0xc0e0f0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf0f8f8fc, 0xc0e0e0f0, 0xf0f8f8fc, 0xc0e0e0f0, 0xf0f8f8fc, 0xc0e0e0f0, 0xf0f8f8fc, 0xc0e0e0f0}},
+    {{0, 3}, {0x3f7fffff, 0x70f1f3f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x101, 0xf0f1f3f, 0x1030307, 0x1f3f7f7f, 0x7070f1f, 0x7fffffff, 0x1f1f3f7f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x0, 0x1030307, 0x0, 0x70f0f1f, 0x10303}},
+    {{0, 4}, {0x80c0c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x8080, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfefe, 0xffffffff, 0xfcfcfefe, 0xffffffff, 0xfcfcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{0, 3}, {0xffffffff, 0x1f1f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x10307, 0x0, 0x3070f0f, 0x1, 0xf1f3f3f, 0x1030307, 0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f1f3f7f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x303070f, 0x1, 0xf0f1f3f, 0x10307, 0x1f3f7f7f, 0x3070f1f}},
+    {{0, 4}, {0xe0f0f8f8, 0x8080c0e0, 0xe0f0f8f8, 0x8080c0e0, 0xe0f0f0f8, 0x8080c0e0, 0xe0f0f0f8, 0x80c0c0, 0xe0f0f0f8, 0x80c0c0, 0xe0f0f0f8, 0x80c0c0, 0xe0f0f0f8, 0x80c0c0, 0xe0f0f0f8, 0x80c0c0}},
+    {{0, 3}, {0xffffffff, 0xf1f3f7f, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x103070f, 0x0, 0x70f1f3f, 0x103, 0x1f3f7fff, 0x103070f, 0x7fffffff, 0x70f1f3f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0, 0x103070f, 0x0, 0x70f1f3f, 0x10303, 0x1f3f7fff, 0x3070f0f, 0x7fffffff, 0xf1f3f3f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0}},
+    {{0, 4}, {0xfcfefeff, 0xe0f0f0f8, 0xfcfefeff, 0xe0f0f0f8, 0xfcfcfeff, 0xe0f0f0f8, 0xfcfcfeff, 0xe0f0f0f8, 0xfcfcfeff, 0xe0f0f0f8, 0xfcfcfeff, 0xe0f0f0f8, 0xfcfcfeff, 0xe0f0f0f8, 0xfcfcfeff, 0xe0f0f0f8}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0, 0x103070f, 0x0, 0xf1f3f7f, 0x107, 0x3f7fffff, 0x3070f1f, 0xffffffff, 0xf1f3f7f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10307, 0x0}},
+    {{0, 4}, {0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x8080c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffc0, 0xffffffff, 0xfffff800, 0xffffffff, 0xffff0000, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0xff7f1f07, 0x0, 0xff7f1f07, 0x0, 0xff3f0f03, 0x0, 0xff3f0f01, 0x0, 0x7f1f0701, 0x0, 0x7f1f0700, 0x0, 0x3f0f0300, 0x0, 0x3f0f0300}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xff7f1f07, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff7f1f03, 0xffffffff, 0xff3f0f03, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f0f0300, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0xff7f1f07, 0x1000000, 0xff7f1f07, 0x0, 0xff3f0f03, 0x0, 0xff3f0f03, 0x0, 0x7f1f0703, 0x0, 0x7f1f0701, 0x0, 0x3f1f0701, 0x0, 0x3f0f0300}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0}},
+    {{0, 5}, {0xff7f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0300, 0xffffffff, 0x3f0f0300, 0xffffff7f}},
+    {{0, 5}, {0x1000000, 0xff3f0f03, 0x0, 0x7f3f0f03, 0x0, 0x7f1f0703, 0x0, 0x7f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0300, 0x0, 0x1f0f0300, 0x0, 0x1f070100}},
+    {{0, 4}, {0xfcfefeff, 0xe0e0f0f8, 0xfcfefeff, 0xe0f0f0f8, 0xfcfefeff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f0f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0x7f1f0703, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0300, 0xffffffff, 0x1f0f0300, 0xffffff7f, 0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf030100, 0xffffff3f}},
+    {{0, 5}, {0x0, 0x3f0f0701, 0x0, 0x3f0f0300, 0x0, 0x1f0f0300, 0x0, 0x1f070100, 0x0, 0x1f070100, 0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8f8fcfe, 0xffffffff, 0xf8fcfcfe}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0x1f070300, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf070100, 0xffffff3f, 0xf030100, 0xffffff3f, 0xf030000, 0xffff7f1f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff3f1f, 0x7010000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0xf030100, 0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0x80c0e0f0, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0x80c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{0, 5}, {0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff}},
+    {{0, 5}, {0x7010000, 0xffff3f1f, 0x7010000, 0xffff3f0f, 0x3010000, 0xff7f3f0f, 0x3000000, 0xff7f1f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f07, 0x0, 0x7f3f0f03}},
+    {{0, 5}, {0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xe0f0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0c0, 0xe0f0f8fc, 0x80c0c0}},
+    {{0, 5}, {0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8000000, 0x0, 0xff000000, 0x0, 0xff000000, 0x0, 0xff800000, 0x0, 0xfffe0000}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0xc0000000, 0x0, 0xfe000000, 0x0, 0xff000000, 0x0, 0xff000000, 0x0, 0xfff00000, 0x0, 0xffff0000, 0x0, 0xffff0000}},
+    {{0, 1}, {0x0, 0xfc000000, 0x0, 0xff000000, 0x0, 0xff000000, 0x0, 0xffe00000, 0x0, 0xfffe0000, 0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xfffff000}},
+    {{0, 1}, {0x0, 0xff000000, 0x0, 0xffe00000, 0x0, 0xfffe0000, 0x0, 0xffff0000, 0x0, 0xffff8000, 0x0, 0xfffff000, 0x0, 0xffffff00, 0x0, 0xffffff00}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f}},
+    {{1, 5}, {0x7030101, 0x1f0f0f07, 0x3010100, 0x1f0f0707, 0x3010000, 0xf070703, 0x1000000, 0x7070303, 0x0, 0x7030301, 0x0, 0x3030100, 0x0, 0x3010100, 0x0, 0x1010000}},
+    {{1, 4}, {0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff}},
+    {{1, 5}, {0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x3f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f1f, 0xf0f0703, 0x7f3f3f1f, 0xf070703, 0x3f3f1f0f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0xf0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f0f, 0x7070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f07, 0x3030100, 0x1f0f0707, 0x3010100, 0xf0f0703, 0x1010000, 0xf070303, 0x1000000, 0x7070301}},
+    {{1, 4}, {0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xe0f8ffff, 0xffffffff, 0xe0f8ff, 0xffffffff, 0xe0f8, 0xf8ffffff, 0xc0, 0xc0f8feff, 0x0, 0xc0f0fe, 0x0, 0xc0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xc0f8ffff, 0xffffffff, 0xc0f8ff, 0xfeffffff, 0xc0f8, 0xf0feffff, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf0fcffff}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f0f, 0xff7f7f3f}},
+    {{1, 5}, {0x1000000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf0fcfeff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8fcff, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{2, 5}, {0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0f8ffff, 0x0, 0xc0f8ff, 0x0, 0xc0f8, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0x80e0f8ff, 0xffffffff, 0x80e0fc, 0xfcffffff, 0xc0f0, 0xf0fcffff, 0xc0, 0xc0f0fcff, 0x0, 0xc0f0fc, 0x0, 0xc0f0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0x80e0f8fc, 0xfcffffff, 0x80e0f8, 0xf8fcffff, 0xc0e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x3f1f0f0f, 0xff7f7f3f, 0x1f1f0f07, 0x7f7f3f3f, 0x1f0f0707, 0x7f3f3f1f, 0xf0f0703, 0x3f3f1f1f, 0xf070303, 0x3f1f1f0f, 0x7070301, 0x1f1f0f0f, 0x7030101, 0x1f0f0f07, 0x3030100, 0xf0f0707}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8, 0xfeffffff, 0xc0e0f8}},
+    {{2, 5}, {0xc0f0f8fe, 0x0, 0xc0f0fc, 0x0, 0x80c0f0, 0x0, 0x80e0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8feff, 0xffffffff, 0xc0f0f8fe, 0xfeffffff, 0x80c0f0fc, 0xfcfeffff, 0x80e0f0, 0xf0fcffff, 0x80e0, 0xe0f8fcff, 0xc0, 0xc0e0f8fc, 0x0, 0x80c0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f0fcfe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f}},
+    {{1, 5}, {0x3010100, 0xf0f0707, 0x3010000, 0xf070703, 0x1000000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000}},
+    {{1, 4}, {0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80c0f0, 0xf0fcfeff, 0x80e0, 0xe0f0fcfe, 0xc0, 0xc0e0f8fc, 0x0, 0x80c0f0f8, 0x0, 0x80e0f0, 0x0, 0x80e0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0x80e0f0f8, 0xfcfeffff, 0xc0e0f0}},
+    {{1, 5}, {0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0xff7f3f3f, 0x1f0f0f07, 0x7f7f3f1f, 0xf0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f1f, 0xf070303, 0x3f1f1f0f, 0x7070301, 0x1f1f0f0f}},
+    {{1, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0xc0e0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{2, 5}, {0xc0e0f0fc, 0x0, 0x80c0e0f8, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0x80e0f0f8, 0xfcfeffff, 0xc0e0f0, 0xf8fcffff, 0x80c0f0, 0xf0f8feff, 0x80e0, 0xe0f0fcfe, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x3030101, 0x1f0f0f07, 0x3030100, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010000}},
+    {{1, 4}, {0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0}},
+    {{2, 5}, {0x80e0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f0, 0xf8fcffff, 0x80c0f0, 0xf0f8feff, 0x80e0, 0xe0f0fcfe, 0x80c0, 0xc0f0f8fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f8fcfe}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x7f3f3f1f, 0xf0f0703, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf0f8fcff, 0x80c0, 0xe0f0fcfe, 0xc0, 0xc0f0f8fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f8, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f0fc, 0xfcffffff, 0x80c0f0f8}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100}},
+    {{2, 5}, {0x80c0f0f8, 0x0, 0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xf8feffff, 0x80e0f0, 0xf8fcfeff, 0x80c0e0, 0xf0f8fcff, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f}},
+    {{2, 5}, {0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcffffff, 0x80c0e0f8, 0xf8feffff, 0x80e0f0, 0xf8fcfeff, 0x80c0e0, 0xf0f8feff, 0x80e0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0x80e0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x3030101, 0xf0f0707, 0x3030101, 0xf070703, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3030101, 0x0, 0x3010100}},
+    {{2, 5}, {0xe0f8fcfe, 0x80c0, 0xe0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0f8}},
+    {{1, 5}, {0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0xf070703, 0x1f1f0f0f}},
+    {{2, 5}, {0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f0, 0xf8feffff, 0x80c0f0, 0xf8fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x3010100, 0xf070703, 0x1010100, 0x7070303, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x1010000}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80c0f0, 0xf8fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xe0f8fcff, 0x80c0, 0xe0f0fcfe, 0x80, 0xc0f0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80c0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 5}, {0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7070303, 0x1f0f0f07}},
+    {{2, 5}, {0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffff7f7f}},
+    {{1, 5}, {0x1010000, 0x7030301, 0x1000000, 0x3030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{0, 3}, {0x3f7f7f7f, 0x1f3f3f3f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x101, 0x0, 0x3030307, 0x1010103, 0xf0f0f0f, 0x3070707, 0x1f3f3f3f, 0xf1f1f1f, 0x7f7fffff, 0x3f3f7f7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010103, 0x1, 0x707070f, 0x3030303}},
+    {{0, 4}, {0xfefefefe, 0xfcfcfcfc, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfefe, 0xf8fcfcfc, 0xfcfcfcfe, 0xf8f8fcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8fcfcfc, 0xf0f8f8f8, 0xf8f8fcfc, 0xf0f0f8f8}},
+    {{0, 3}, {0xf0f1f1f, 0x7070f0f, 0x3f3f3f7f, 0x1f1f1f3f, 0xffffffff, 0x3f7f7f7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1030303, 0x101, 0x7070f0f, 0x3030707, 0x1f1f3f3f, 0xf0f0f1f, 0x7f7f7fff, 0x3f3f3f3f, 0xffffffff, 0x7fffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010101, 0x0}},
+    {{0, 4}, {0xf8f8f8fc, 0xf0f0f0f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f8f8f8, 0xe0f0f0f0, 0xf0f0f8f8, 0xe0f0f0f0, 0xf0f0f0f8, 0xe0e0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0f0f0f0, 0xc0e0e0e0}},
+    {{0, 3}, {0x1030307, 0x101, 0x70f0f0f, 0x1030307, 0x1f1f3f3f, 0x70f0f1f, 0x7f7f7fff, 0x1f1f3f3f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x3070707, 0x1010103, 0xf0f1f1f, 0x307070f, 0x3f3f7f7f, 0xf1f1f1f}},
+    {{0, 4}, {0xe0e0e0f0, 0x80c0c0c0, 0xc0e0e0e0, 0x8080c0c0, 0xc0e0e0e0, 0x8080c0c0, 0xc0c0e0e0, 0x808080c0, 0xc0c0c0e0, 0x808080c0, 0xc0c0c0e0, 0x808080, 0xc0c0c0c0, 0x808080, 0x80c0c0c0, 0x8080}},
+    {{0, 3}, {0x3f3f7f7f, 0xf0f1f1f, 0xffffffff, 0x3f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x101, 0x0, 0x1030307, 0x1, 0x70f0f1f, 0x1030307, 0x1f1f3f3f, 0x7070f0f, 0x7f7fffff, 0x1f1f3f3f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1010303, 0x0, 0x307070f, 0x10103}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfcfefe, 0xfeffffff, 0xfcfcfefe, 0xfeffffff, 0xfcfcfcfe, 0xfeffffff, 0xf8fcfcfe, 0xfefeffff, 0xf8fcfcfe, 0xfefeffff, 0xf8fcfcfc, 0xfefefeff, 0xf8f8fcfc, 0xfefefeff, 0xf8f8fcfc}},
+    {{0, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x3030707, 0x1, 0x70f0f1f, 0x1030307, 0x1f3f3f7f, 0x7070f1f, 0x7f7fffff, 0x1f1f3f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1010303, 0x0, 0x7070f0f, 0x10103, 0xf1f1f3f, 0x307070f, 0x3f7f7fff, 0xf0f1f3f}},
+    {{0, 4}, {0xf0f0f8f8, 0xc0c0e0e0, 0xf0f0f8f8, 0xc0c0e0e0, 0xf0f0f8f8, 0xc0c0e0e0, 0xf0f0f8f8, 0xc0c0e0e0, 0xe0f0f0f8, 0x80c0c0e0, 0xe0f0f0f8, 0x80c0c0e0, 0xe0f0f0f8, 0x80c0c0e0, 0xe0f0f0f0, 0x80c0c0e0}},
+    {{0, 3}, {0x1f1f3f7f, 0x307070f, 0x3f7fffff, 0xf0f1f3f, 0xffffffff, 0x3f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x10303, 0x0, 0x307070f, 0x101, 0xf1f1f3f, 0x1030707, 0x3f3f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7f7fffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x0, 0x1030707, 0x1}},
+    {{0, 4}, {0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xfeffffff, 0xf8fcfcfe, 0xfeffffff, 0xf8fcfcfe, 0xfeffffff, 0xf8fcfcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfc}},
+    {{0, 3}, {0x7fffffff, 0xf1f3f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x101, 0x0, 0x1030307, 0x0, 0x70f0f1f, 0x10103, 0x1f1f3f7f, 0x307070f, 0x7f7fffff, 0xf0f1f3f, 0xffffffff, 0x3f3f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10303, 0x0, 0x3070f0f, 0x103, 0xf1f1f3f, 0x1030707}},
+    {{0, 4}, {0xe0e0f0f8, 0x80c0c0, 0xe0e0f0f8, 0x80c0c0, 0xe0e0f0f8, 0x8080c0, 0xe0e0f0f0, 0x8080c0, 0xe0e0f0f0, 0x8080c0, 0xe0e0f0f0, 0x8080c0, 0xc0e0f0f0, 0x8080c0, 0xc0e0f0f0, 0x8080c0}},
+    {{0, 3}, {0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x103070f, 0x0, 0x70f1f1f, 0x10303, 0x1f3f7f7f, 0x307070f, 0x7fffffff, 0xf1f1f3f, 0xffffffff, 0x3f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1030307, 0x0, 0x7070f1f, 0x10103, 0x1f1f3f7f, 0x303070f, 0x7f7fffff, 0xf0f1f3f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0}},
+    {{0, 4}, {0xfcfcfeff, 0xe0f0f0f8, 0xfcfcfeff, 0xe0f0f0f8, 0xfcfcfeff, 0xe0f0f0f8, 0xf8fcfefe, 0xe0e0f0f8, 0xf8fcfefe, 0xe0e0f0f8, 0xf8fcfefe, 0xe0e0f0f8, 0xf8fcfefe, 0xe0e0f0f8, 0xf8fcfefe, 0xe0e0f0f8}},
+    {{0, 3}, {0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x3070f1f, 0x1, 0xf1f3f7f, 0x103070f, 0x7f7fffff, 0x70f1f3f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1010307, 0x0, 0x7070f1f, 0x103, 0x1f1f3f7f, 0x103070f, 0x7f7fffff, 0x70f1f3f, 0xffffffff, 0x1f3f7fff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1010307, 0x0}},
+    {{0, 4}, {0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{3, 5}, {0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 5}, {0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0xc0000000, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10307, 0x0, 0x3070f1f, 0x1}},
+    {{0, 4}, {0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff, 0xffff8000, 0xffffffff}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffffc, 0xffffffff, 0xffffff00, 0xffffffff}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff}},
+    {{0, 5}, {0x3f0f0300, 0xffffffff, 0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff7f, 0xf030000, 0xffffff3f, 0xf030000, 0xffffff3f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x3000000, 0xffff7f1f}},
+    {{0, 5}, {0x0, 0x3f0f0300, 0x0, 0x1f070100, 0x0, 0x1f070100, 0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000}},
+    {{0, 4}, {0xf0f8fcfe, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff}},
+    {{0, 5}, {0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff7f, 0xf030100, 0xffffff3f, 0xf030000, 0xffffff3f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f1f, 0x3000000, 0xffff3f0f}},
+    {{0, 5}, {0x0, 0x1f070100, 0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8f8, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc}},
+    {{0, 5}, {0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff}},
+    {{0, 5}, {0xf030000, 0xffff7f3f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f1f, 0x3000000, 0xffff3f0f, 0x3000000, 0xff7f3f0f, 0x3000000, 0xff7f1f07, 0x1000000, 0xff7f1f07}},
+    {{0, 5}, {0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{0, 4}, {0x8080c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0c0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0xff3f0f03, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0xff7f3f0f, 0x3000000, 0xff7f1f0f, 0x1000000, 0xff7f1f07, 0x1000000, 0xff3f1f07, 0x1000000, 0xff3f0f03, 0x0, 0x7f3f0f03, 0x0, 0x7f1f0703, 0x0, 0x7f1f0701}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0e0f0, 0x80, 0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0x7f3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0701, 0xffffffff, 0x3f0f0300, 0xffffff7f}},
+    {{0, 5}, {0x0, 0x7f1f0f03, 0x0, 0x7f1f0703, 0x0, 0x3f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0300, 0x0, 0x1f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100}},
+    {{0, 4}, {0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xe0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x80c0e0, 0xf0f0f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff}},
+    {{0, 1}, {0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xfffff000, 0x0, 0xffffff00, 0x0, 0xffffff00, 0x0, 0xffffffc0, 0x0, 0xffffffff, 0x0, 0xffffffff}},
+    {{0, 1}, {0x0, 0xffff8000, 0x0, 0xfffffc00, 0x0, 0xffffff00, 0x0, 0xffffff00, 0x0, 0xfffffff0, 0x0, 0xffffffff, 0x0, 0xffffffff, 0xe0000000, 0xffffffff}},
+    {{0, 1}, {0x0, 0xffffff00, 0x0, 0xffffff00, 0x0, 0xffffffe0, 0x0, 0xfffffffe, 0x0, 0xffffffff, 0x80000000, 0xffffffff, 0xfc000000, 0xffffffff, 0xff000000, 0xffffffff}},
+    {{0, 1}, {0x0, 0xffffffc0, 0x0, 0xfffffffc, 0x0, 0xffffffff, 0x80000000, 0xffffffff, 0xf8000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xfff00000, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x3f1f1f0f, 0xffff7f7f, 0x3f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0xff7f3f3f, 0xf0f0703, 0x7f3f3f1f, 0xf070303, 0x3f3f1f0f, 0x7070301, 0x3f1f0f0f, 0x7030101, 0x1f1f0f07, 0x3010100, 0x1f0f0707}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0x80e0f8fe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 5}, {0x7070301, 0x3f1f0f0f, 0x7030101, 0x1f1f0f07, 0x3010100, 0x1f0f0707, 0x3010000, 0xf070703, 0x1000000, 0x7070303, 0x0, 0x7030301, 0x0, 0x3030100, 0x0, 0x3010000}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{2, 5}, {0xffffffff, 0xf0fcffff, 0xffffffff, 0x80e0f8ff, 0xfeffffff, 0xe0f8, 0xf0fcffff, 0xc0, 0x80f0fcff, 0x0, 0x80e0f8, 0x0, 0xc0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xe0f8ffff, 0xffffffff, 0x80e0f8fe, 0xfcffffff, 0xc0f0, 0xf0fcffff, 0xc0, 0x80e0f8fe, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xc0f0f8fe}},
+    {{1, 5}, {0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f1f, 0xf0f0703, 0x7f3f1f1f}},
+    {{1, 5}, {0x0, 0x7030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0f0feff, 0x0, 0xc0f0fc, 0x0, 0x80e0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xc0f0fcff, 0xfeffffff, 0xc0f0f8, 0xf8feffff, 0xc0e0, 0xe0f8feff, 0xc0, 0x80e0f8fe, 0x0, 0x80e0f0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xc0e0f0fc, 0xfcfeffff, 0x80e0f0, 0xf0fcfeff, 0x80e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x1f0f0f07, 0x7f7f3f3f, 0xf0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f0f, 0x7070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f07, 0x3030100, 0x1f0f0707, 0x3010000, 0xf0f0703, 0x1010000, 0xf070303}},
+    {{1, 4}, {0xe0f8fcff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff}},
+    {{2, 5}, {0xe0f8fcff, 0xc0, 0xc0e0f8fc, 0x0, 0xc0e0f8, 0x0, 0xc0e0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xc0f0f8fe, 0xfeffffff, 0x80e0f0f8, 0xf8feffff, 0x80e0f0, 0xf0f8feff, 0x80e0, 0xe0f0f8fe, 0x80, 0x80e0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0f8feff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x3f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f}},
+    {{1, 5}, {0x3010000, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{1, 4}, {0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f0, 0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0x80c0f0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0e0f8fc, 0xfcffffff, 0x80c0e0f8, 0xf8fcffff, 0x80c0f0, 0xf0f8fcff, 0x80c0, 0xe0f0f8fe, 0x80, 0x80e0f0f8, 0x0, 0xc0e0f0, 0x0, 0xc0e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f8fcfe, 0xfeffffff, 0xc0e0f8fc}},
+    {{1, 5}, {0x3f3f1f0f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f07, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0703, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070301, 0x1f1f0f0f, 0x7030101, 0x1f0f0f07}},
+    {{1, 4}, {0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8fcfeff, 0x80c0e0, 0xe0f8fcfe, 0x80c0, 0xc0f0f8fc, 0x80, 0x80e0f0f8, 0x0, 0xc0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f8fcfe, 0xfeffffff, 0xc0f0f8fc, 0xfcffffff, 0x80e0f0f8, 0xf8fcffff, 0xc0e0f0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 5}, {0x7030301, 0x1f0f0f07, 0x3030100, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 5}, {0xc0e0f8fc, 0x80, 0x80c0f0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0e0f8fc, 0xfcffffff, 0x80e0f0f8, 0xf8feffff, 0xc0e0f0, 0xf0fcfeff, 0x80c0e0, 0xe0f8fcfe, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x3f1f0f0f, 0xff7f7f3f, 0x1f1f0f07, 0x7f7f3f3f, 0x1f0f0707, 0x7f3f3f1f, 0xf0f0703, 0x3f3f1f1f, 0xf070303, 0x3f1f1f0f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{2, 5}, {0x80c0f0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfcfeffff, 0x80c0e0f8, 0xf8fcffff, 0x80e0f0, 0xf0fcfeff, 0x80c0e0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fc, 0x80, 0xc0e0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0xc0e0f0, 0xf8fcfeff, 0x80c0e0, 0xf0f8fcff, 0x80e0, 0xe0f0fcfe, 0xc0, 0xc0e0f8fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f0f8fc}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x3f1f0f0f, 0xff7f7f3f, 0x1f1f0f07, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xe0f0fcfe, 0xc0, 0xc0f0f8fc, 0x80, 0xc0e0f0f8, 0x0, 0x80c0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f8fc, 0xfcffffff, 0x80e0f0f8, 0xfcfeffff, 0x80c0e0f0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101}},
+    {{2, 5}, {0x80c0e0f8, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f8fc, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f0, 0xf8fcffff, 0x80c0f0, 0xf0fcfeff, 0xc0e0, 0xe0f8fcfe, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0x80c0e0f8, 0xf8feffff, 0x80e0f0, 0xf8fcfeff, 0x80c0e0, 0xf0f8feff, 0x80e0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80c0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010100, 0x7070303, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101}},
+    {{2, 5}, {0xe0f8fcfe, 0x80c0, 0xe0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0f8}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0f07, 0x3f3f1f1f, 0xf0f0707, 0x3f1f1f1f}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f0, 0xf8fcffff, 0x80c0f0, 0xf0fcfeff, 0xc0e0, 0xf0f8fcff, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 5}, {0x7030301, 0xf0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010100, 0x7070303, 0x1010000, 0x7030303, 0x1000000, 0x3030301, 0x0, 0x3030101, 0x0, 0x3010100}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0x80c0f0, 0xf8fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xe0f8fcff, 0x80c0, 0xe0f0fcfe, 0x80, 0xc0f0f8fc, 0x80, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe}},
+    {{1, 5}, {0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f1f0f, 0x7f7f3f3f, 0x1f1f0f0f, 0x7f3f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070707, 0x3f1f1f0f, 0xf070703, 0x1f1f0f0f}},
+    {{0, 3}, {0x1f1f1f1f, 0x70f0f0f, 0x3f7f7f7f, 0x1f3f3f3f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x3070707, 0x1010303, 0xf0f1f1f, 0x7070f0f, 0x3f3f7f7f, 0x1f1f1f3f, 0xffffffff, 0x7f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0xffffffff, 0x3f7f7f7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x1, 0x0, 0x3030307, 0x101, 0x70f0f1f, 0x3030707, 0x1f3f3f3f, 0xf0f0f1f, 0x7fffffff, 0x3f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefefeff, 0xffffffff, 0xfefefeff}},
+    {{0, 3}, {0xf1f1f3f, 0x307070f, 0x3f7f7f7f, 0xf1f1f3f, 0xffffffff, 0x3f3f7f7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x101, 0x0, 0x3030707, 0x101, 0xf0f1f1f, 0x3030707, 0x3f3f7f7f, 0xf0f1f1f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1030307, 0x1}},
+    {{0, 4}, {0xfcfefeff, 0xf8f8fcfc, 0xfcfefefe, 0xf8f8f8fc, 0xfcfcfefe, 0xf0f8f8fc, 0xfcfcfefe, 0xf0f8f8fc, 0xfcfcfcfe, 0xf0f8f8f8, 0xfcfcfcfe, 0xf0f0f8f8, 0xf8fcfcfc, 0xf0f0f8f8, 0xf8fcfcfc, 0xf0f0f0f8}},
+    {{0, 3}, {0xffffffff, 0x3f3f7f7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x10103, 0x0, 0x303070f, 0x101, 0xf0f1f1f, 0x1030707, 0x3f3f7f7f, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x0, 0x1030707, 0x1, 0x70f0f1f, 0x1030307, 0x1f3f3f7f, 0x70f0f1f}},
+    {{0, 4}, {0xe0e0f0f0, 0x8080c0c0, 0xe0e0f0f0, 0x8080c0c0, 0xe0e0f0f0, 0x8080c0c0, 0xe0e0e0f0, 0x8080c0c0, 0xc0e0e0f0, 0x8080c0, 0xc0e0e0f0, 0x8080c0, 0xc0e0e0e0, 0x8080c0, 0xc0c0e0e0, 0x8080c0}},
+    {{0, 3}, {0x70f0f1f, 0x1010307, 0x1f3f3f7f, 0x7070f0f, 0x7fffffff, 0xf1f3f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1010307, 0x0, 0x7070f1f, 0x10103, 0x1f1f3f3f, 0x307070f, 0x7f7fffff, 0xf1f1f3f, 0xffffffff, 0x3f7f7fff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10303, 0x0}},
+    {{0, 4}, {0xfefeffff, 0xf8f8fcfc, 0xfefeffff, 0xf8f8fcfc, 0xfefeffff, 0xf0f8fcfc, 0xfefeffff, 0xf0f8f8fc, 0xfcfefeff, 0xf0f8f8fc, 0xfcfefeff, 0xf0f8f8fc, 0xfcfefeff, 0xf0f8f8fc, 0xfcfefeff, 0xf0f8f8fc}},
+    {{0, 3}, {0x3f7f7fff, 0x70f1f1f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x10103, 0x0, 0x303070f, 0x1, 0xf0f1f3f, 0x1030307, 0x3f3f7fff, 0x70f0f1f, 0x7fffffff, 0x1f1f3f7f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x0, 0x1030707, 0x1, 0x70f1f1f, 0x1010307}},
+    {{0, 4}, {0xc0e0e0f0, 0x80c0, 0xc0e0e0f0, 0x80c0, 0xc0e0e0f0, 0x80c0, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0c0e0f0, 0x8080, 0xc0c0e0f0, 0x8080, 0xc0c0e0e0, 0x8080}},
+    {{0, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 3}, {0xffffffff, 0x3f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x10307, 0x0, 0x3070f0f, 0x103, 0xf1f3f3f, 0x103070f, 0x3f7fffff, 0x70f1f1f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x101, 0xf1f1f3f, 0x1030307, 0x3f3f7fff, 0x70f0f1f}},
+    {{0, 4}, {0xf8fcfefe, 0xe0e0f0f8, 0xf8fcfefe, 0xe0e0f0f8, 0xf8fcfcfe, 0xe0e0f0f8, 0xf8fcfcfe, 0xe0e0f0f0, 0xf8fcfcfe, 0xc0e0f0f0, 0xf8fcfcfe, 0xc0e0f0f0, 0xf8fcfcfe, 0xc0e0f0f0, 0xf8fcfcfe, 0xc0e0f0f0}},
+    {{0, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x3070f1f, 0x103, 0xf1f3f7f, 0x103070f, 0x3f7fffff, 0x70f1f3f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10307, 0x0, 0x3070f0f, 0x101, 0xf1f3f3f, 0x1030707, 0x3f7fffff, 0x70f1f1f, 0xffffffff, 0x1f3f7f7f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0}},
+    {{0, 4}, {0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x8080c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe}},
+    {{0, 3}, {0xf1f3f7f, 0x1030307, 0x3f7fffff, 0x70f0f1f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x1, 0x0, 0x10307, 0x0, 0x3070f1f, 0x101, 0xf1f3f3f, 0x1030707, 0x3f7fffff, 0x70f1f1f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10303, 0x0, 0x3070f0f, 0x101}},
+    {{0, 4}, {0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{3, 5}, {0xfff80000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 5}, {0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 5}, {0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0xf0000000, 0x0, 0x0}},
+    {{0, 4}, {0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0f0, 0xf0f8fcfe, 0xc0c0e0f0, 0xf0f8fcfe, 0xc0c0e0f0, 0xf0f8fcfe, 0xc0c0e0f0, 0xf0f8fcfe, 0xc0c0e0f0}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff}},
+    {{0, 5}, {0xffff3f0f, 0xffffffff, 0xff7f3f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x7f1f0701, 0xffffffff}},
+    {{0, 5}, {0x3000000, 0xff7f3f0f, 0x1000000, 0xff7f1f07, 0x1000000, 0xff7f1f07, 0x1000000, 0xff3f0f03, 0x0, 0xff3f0f03, 0x0, 0x7f1f0f03, 0x0, 0x7f1f0701, 0x0, 0x7f1f0701}},
+    {{0, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfcfeffff, 0xe0f0f8fc, 0xfefeffff, 0xe0f0f8fc, 0xfefeffff, 0xf0f0f8fc, 0xfefeffff, 0xf0f0f8fc, 0xfefeffff, 0xf0f0f8fc}},
+    {{0, 5}, {0xff7f1f07, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f1f0703, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0300, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0xff3f0f07, 0x0, 0xff3f0f03, 0x0, 0x7f1f0f03, 0x0, 0x7f1f0701, 0x0, 0x3f1f0701, 0x0, 0x3f0f0301, 0x0, 0x3f0f0300, 0x0, 0x1f070300}},
+    {{0, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfefe, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 5}, {0x7f1f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x3f1f0701, 0xffffffff, 0x3f0f0301, 0xffffffff, 0x3f0f0300, 0xffffff7f, 0x1f0f0300, 0xffffff7f, 0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff3f}},
+    {{0, 5}, {0x0, 0x3f1f0701, 0x0, 0x3f0f0301, 0x0, 0x3f0f0300, 0x0, 0x1f070300, 0x0, 0x1f070100, 0x0, 0xf070100, 0x0, 0xf030100, 0x0, 0xf030000}},
+    {{0, 4}, {0xc0e0f0f0, 0x80, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x8080, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0x1f0f0300, 0xffffff7f, 0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff3f, 0xf030100, 0xffffff3f, 0xf030000, 0xffff7f3f, 0xf030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f1f}},
+    {{0, 5}, {0x0, 0xf070100, 0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000}},
+    {{0, 4}, {0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x8080c0e0, 0xf0f8f8fc, 0x80c0c0e0, 0xf0f8fcfc, 0x80c0c0e0, 0xf0f8fcfc, 0x80c0c0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfc, 0x80c0e0e0, 0xf0f8fcfe, 0x80c0e0e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff}},
+    {{0, 1}, {0x0, 0xffffffff, 0x0, 0xffffffff, 0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff8000, 0xffffffff}},
+    {{0, 1}, {0x80000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff800000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffc000, 0xffffffff, 0xffffff00, 0xffffffff}},
+    {{0, 1}, {0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xffe00000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffe000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff}},
+    {{0, 1}, {0xff800000, 0xffffffff, 0xfffc0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff8000, 0xffffffff, 0xfffffc00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff80, 0xffffffff, 0xfffffffc, 0xffffffff}},
+    {{0, 1}, {0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xfffff000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xfffffff0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xc0f0f8fe, 0xfcfeffff, 0x80e0f0, 0xe0f8fcff, 0x80, 0xc0e0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0x80e0f8fc}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f07, 0xff7f7f3f, 0x1f0f0707, 0x7f7f3f1f}},
+    {{1, 5}, {0x1010000, 0xf070703, 0x1000000, 0x7070301, 0x0, 0x7030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8}},
+    {{2, 5}, {0xfcffffff, 0xc0f0, 0xe0f8feff, 0x80, 0xc0f0fc, 0x0, 0x80e0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0x80e0f8fe, 0xfcfeffff, 0xc0f0, 0xe0f0fcff, 0x80, 0xc0e0f8, 0x0, 0x80c0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xc0f0f8fe, 0xfcfeffff, 0xc0e0f0, 0xf0f8feff, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f07, 0xff7f7f3f, 0x1f0f0707, 0x7f7f3f1f, 0xf070703, 0x7f3f1f1f, 0x7070301, 0x3f1f1f0f, 0x7030101, 0x1f1f0f07, 0x3010100, 0x1f0f0707}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xe0f8feff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff}},
+    {{2, 5}, {0xc0f0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0e0f8, 0xf0fcffff, 0x80e0, 0xc0f0f8fe, 0x80, 0x80c0e0f8, 0x0, 0x80e0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0x80e0f0f8, 0xf8fcffff, 0x80c0f0, 0xe0f8fcfe, 0x80c0, 0xc0e0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8fcfeff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 5}, {0xf070303, 0x3f3f1f0f, 0x7030301, 0x3f1f0f0f, 0x3030101, 0x1f0f0f07, 0x3010100, 0xf0f0703, 0x1010000, 0xf070703, 0x1000000, 0x7070301, 0x0, 0x7030101, 0x0, 0x3010100}},
+    {{1, 4}, {0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8}},
+    {{2, 5}, {0xc0f0f8fe, 0x80, 0x80c0f0f8, 0x0, 0x80c0e0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0f8fcff, 0xfeffffff, 0xc0f0f8fc, 0xfcfeffff, 0x80c0e0f8, 0xf0fcfeff, 0x80c0e0, 0xe0f0f8fe, 0x80c0, 0xc0e0f0f8, 0x0, 0x80e0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f0f, 0xffff7f7f, 0x3f1f0f0f, 0xffff7f3f, 0x1f0f0f07, 0xff7f3f3f, 0xf0f0707, 0x7f3f3f1f}},
+    {{1, 5}, {0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff}},
+    {{2, 5}, {0x80e0f0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f0f8, 0xf8feffff, 0x80c0e0f0, 0xf0f8feff, 0x80c0e0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x0, 0xc0e0f0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc}},
+    {{1, 5}, {0x1f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f1f, 0xf0f0703, 0x7f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070301, 0x3f1f0f0f, 0x7030101, 0x1f0f0f07, 0x3010100, 0xf0f0707, 0x1010000, 0xf070703}},
+    {{1, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xfcfeffff, 0x80c0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0xc0e0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0x80c0f0f8, 0xf8fcfeff, 0x80c0f0, 0xf0f8fcfe, 0x80e0, 0xe0f0f8fc, 0x80, 0xc0e0f0f8, 0x0, 0xc0e0f0, 0x0, 0xc0e0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f0f, 0xffff7f7f}},
+    {{1, 5}, {0x3010100, 0xf0f0707, 0x3010000, 0xf070703, 0x1000000, 0x7070303, 0x0, 0x7030301, 0x0, 0x3030100, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fe}},
+    {{2, 5}, {0xf0f8feff, 0x80c0e0, 0xe0f0fcfe, 0x80c0, 0xc0e0f8fc, 0x80, 0x80c0f0f8, 0x0, 0x80c0f0, 0x0, 0x80e0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f8fcfe, 0xfeffffff, 0xc0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x3f3f1f0f, 0xffff7f7f, 0x3f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f3f, 0x1f0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f1f, 0x7070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f07}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0fcfeff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0xc0, 0xf0f8feff, 0xc0, 0xe0f8feff, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{2, 5}, {0xe0f0f8fc, 0x80, 0xc0e0f0f8, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f0fc, 0xfcfeffff, 0x80c0e0f8, 0xf8fcfeff, 0x80e0f0, 0xf0f8fcfe, 0xc0e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x7070301, 0x1f1f0f0f, 0x7030101, 0x1f0f0f07, 0x3030100, 0xf0f0707, 0x3010000, 0xf070703, 0x1000000, 0x7070303, 0x0, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0}},
+    {{2, 5}, {0x80c0e0f0, 0x0, 0x80c0f0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f8fc, 0xfcfeffff, 0x80c0f0f8, 0xf8fcffff, 0xc0e0f0, 0xf0fcfeff, 0x80c0e0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fc, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f3f, 0x1f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f1f, 0xf0f0707, 0x7f3f1f1f, 0xf070703, 0x3f3f1f0f}},
+    {{1, 5}, {0x0, 0x3010000, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0e0f0fc, 0xfcfeffff, 0x80c0f0f8, 0xf8fcffff, 0xc0e0f0, 0xf0fcfeff, 0x80c0e0, 0xf0f8fcfe, 0x80c0, 0xe0f0f8fc, 0x80, 0xc0e0f0f8, 0x80, 0x80c0e0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8fcfeff, 0x80c0f0, 0xf0f8feff, 0xc0e0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fc, 0x80, 0xc0e0f0f8, 0x0, 0x80c0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0f0f8fc}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x7f3f1f1f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xe0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0x80c0f0f8, 0x0, 0xc0e0f0, 0x0, 0x80c0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfcfeffff, 0x80c0f0f8, 0xf8feffff, 0xc0e0f0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf0f0703, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301}},
+    {{2, 5}, {0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfcfeffff, 0x80c0f0f8, 0xf8feffff, 0xc0e0f0, 0xf8fcfeff, 0x80c0e0, 0xf0f8feff, 0x80e0, 0xe0f8fcfe, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0x80c0e0f8, 0xf8fcffff, 0x80c0f0, 0xf0fcfeff, 0xc0e0, 0xf0f8fcff, 0x80c0, 0xe0f0fcfe, 0xc0, 0xc0f0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80c0e0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1010000, 0x7030303, 0x1000000, 0x7030301}},
+    {{2, 5}, {0xe0f0fcfe, 0xc0, 0xc0f0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfcffffff, 0x80c0f0f8}},
+    {{1, 5}, {0x7f7f3f3f, 0xffffffff, 0x7f7f3f3f, 0xffffff7f, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0x80e0f0, 0xf8fcffff, 0x80c0f0, 0xf0fcfeff, 0xc0e0, 0xf0f8fcff, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010101, 0xf070703, 0x3010100, 0x7070303, 0x1010000, 0x7030303, 0x1000000, 0x7030301, 0x0, 0x3030101}},
+    {{3, 4}, {0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0}},
+    {{3, 4}, {0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0}},
+    {{0, 3}, {0x7f7fffff, 0x1f3f3f3f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x70f0f1f, 0x1030307, 0x1f3f3f7f, 0x70f0f1f, 0x7fffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x7fffffff, 0x1f1f3f7f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x1, 0x0, 0x1030307, 0x1, 0x70f0f1f, 0x1010307, 0x1f3f3f7f, 0x7070f0f, 0x7fffffff, 0x1f1f3f3f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 3}, {0x3070f0f, 0x103, 0xf1f3f3f, 0x303070f, 0x3f7fffff, 0xf0f1f3f, 0xffffffff, 0x3f3f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10303, 0x0, 0x3070f0f, 0x103, 0xf1f3f3f, 0x303070f, 0x3f7fffff, 0xf0f1f3f, 0xffffffff, 0x3f3f7fff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10303, 0x0}},
+    {{0, 4}, {0xfcfefeff, 0xf0f0f8fc, 0xfcfcfefe, 0xf0f0f8f8, 0xfcfcfefe, 0xf0f0f8f8, 0xfcfcfefe, 0xf0f0f8f8, 0xfcfcfefe, 0xf0f0f8f8, 0xf8fcfcfe, 0xe0f0f0f8, 0xf8fcfcfe, 0xe0f0f0f8, 0xf8fcfcfe, 0xe0f0f0f8}},
+    {{0, 3}, {0x1f3f7f7f, 0x3070f1f, 0x7fffffff, 0xf1f3f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x1, 0x0, 0x1030307, 0x0, 0x70f0f1f, 0x10303, 0x1f3f3f7f, 0x3070f0f, 0x7fffffff, 0xf1f3f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1030307, 0x0, 0x70f0f1f, 0x10303}},
+    {{0, 4}, {0xc0c0e0e0, 0x8080, 0xc0c0e0e0, 0x80, 0x80c0e0e0, 0x80, 0x80c0e0e0, 0x80, 0x80c0c0e0, 0x80, 0x80c0c0e0, 0x80, 0x80c0c0e0, 0x80, 0x80c0c0e0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff}},
+    {{0, 3}, {0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x103, 0x0, 0x303070f, 0x1, 0xf0f1f3f, 0x1010307, 0x3f3f7fff, 0x7070f1f, 0xffffffff, 0x1f1f3f7f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0, 0x103070f, 0x1, 0x70f1f3f, 0x1010307, 0x1f3f7fff, 0x7070f1f}},
+    {{0, 4}, {0xf8f8fcfe, 0xc0e0f0f0, 0xf8f8fcfe, 0xc0e0f0f0, 0xf8f8fcfe, 0xc0e0e0f0, 0xf8f8fcfe, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf8f8fcfc, 0xc0e0e0f0, 0xf0f8fcfc, 0xc0e0e0f0, 0xf0f8fcfc, 0xc0e0e0f0}},
+    {{0, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x307070f, 0x101, 0xf1f1f3f, 0x1030307, 0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x1, 0xf0f1f3f, 0x1030307, 0x3f3f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0}},
+    {{0, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0}},
+    {{0, 4}, {0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xffffffff, 0xf8fcfcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfe}},
+    {{0, 3}, {0xf1f3f3f, 0x1030707, 0x3f7fffff, 0x70f1f1f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x1, 0xf1f1f3f, 0x1030307, 0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x1}},
+    {{0, 4}, {0xc0e0f0f0, 0x80c0, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0f0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 3}, {0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x1, 0xf1f1f3f, 0x1030307, 0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x1, 0xf1f1f3f, 0x1030307}},
+    {{0, 4}, {0xf0f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0}},
+    {{3, 5}, {0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0xe0000000, 0xffffffff, 0x0, 0xfffffffe, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0x0}},
+    {{3, 5}, {0xffffe000, 0xffffffff, 0xfffe0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0x0}},
+    {{3, 5}, {0xffffff00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0x0}},
+    {{3, 5}, {0xffffff00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0xf0000000}},
+    {{3, 5}, {0xffffff00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffffc000, 0x0, 0xffff0000, 0x0, 0xff000000}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfefeffff, 0xf0f0f8fc, 0xfefeffff, 0xf0f0f8fc, 0xfefeffff, 0xf0f0f8fc, 0xfefeffff, 0xf0f0f8fc, 0xfefeffff, 0xf0f0f8fc, 0xfefeffff, 0xf0f0f8fc, 0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc}},
+    {{0, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff}},
+    {{0, 5}, {0x3f0f0300, 0xffffff7f, 0x1f070100, 0xffffff7f, 0x1f070100, 0xffffff7f, 0xf070100, 0xffffff3f, 0xf030000, 0xffffff3f, 0xf030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff7f1f}},
+    {{0, 5}, {0x0, 0x1f070100, 0x0, 0x1f070100, 0x0, 0xf030000, 0x0, 0xf030000, 0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000}},
+    {{0, 4}, {0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x8080c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xfeffffff, 0xf0f8fcfc}},
+    {{0, 5}, {0xffffff7f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff}},
+    {{0, 5}, {0xf030100, 0xffffff3f, 0xf030000, 0xffff7f3f, 0x7030000, 0xffff7f1f, 0x7010000, 0xffff7f1f, 0x7010000, 0xffff3f0f, 0x3000000, 0xffff3f0f, 0x3000000, 0xff7f3f0f, 0x3000000, 0xff7f1f07}},
+    {{0, 5}, {0x0, 0x7030000, 0x0, 0x7010000, 0x0, 0x7010000, 0x0, 0x3000000, 0x0, 0x3000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{0, 4}, {0xc0e0f0f8, 0x80c0, 0xc0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0e0f0f8, 0x80c0, 0xe0f0f0f8, 0x80c0}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xe0f0f8fc, 0xf8fcfeff, 0x80e0f0, 0xc0e0f0f8, 0x80, 0xc0e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xf8feffff, 0xfeffffff, 0xe0f0f8fc}},
+    {{0, 5}, {0xffff7f1f, 0xffffffff, 0xffff7f1f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xffff3f0f, 0xffffffff, 0xff7f1f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff000000, 0x0, 0xff000000}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe000000, 0x0, 0xff000000, 0x0, 0xff800000}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8000000, 0x0, 0xff000000, 0x0, 0xff800000, 0x0, 0xffff0000}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc000000, 0x0, 0xff000000, 0x0, 0xffc00000, 0x0, 0xffff0000, 0x0, 0xffff0000}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0xc0000000, 0x0, 0xff000000, 0x0, 0xff000000, 0x0, 0xfff00000, 0x0, 0xffff0000, 0x0, 0xffff8000, 0x0, 0xfffffc00}},
+    {{2, 5}, {0xffffffff, 0xe0f8fcff, 0xfcfeffff, 0x80c0e0f8, 0xe0f8fcfe, 0x80c0, 0x80c0e0f0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xe0f0fcfe, 0xfcfeffff, 0xc0e0f0, 0xe0f0f8fe, 0xc0, 0xc0e0f0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf0f8fcfe, 0xfcfeffff, 0xc0e0f0f8}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{0, 1}, {0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffffe0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xffffff00, 0xffffffff, 0xffffffe0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xfffffff0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 4}, {0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff}},
+    {{2, 5}, {0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xf8feffff, 0xc0e0, 0xc0f0f8fe, 0x80, 0x80e0f0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xe0f0f8fe, 0xfcfeffff, 0x80c0e0f0, 0xe0f8fcfe, 0x80c0, 0xc0e0f0f8, 0x0, 0x80c0e0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xe0f8fcfe, 0xfcfeffff, 0xc0e0f0f8}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 5}, {0xf070703, 0x7f3f1f1f, 0x7070301, 0x3f1f1f0f, 0x7030101, 0x1f1f0f07, 0x3010100, 0x1f0f0707, 0x1010000, 0xf070703, 0x1000000, 0x7070301, 0x0, 0x7030101, 0x0, 0x3010100}},
+    {{1, 4}, {0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0xc0e0f0fc, 0x0, 0x80c0f0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xe0f0f8fe, 0xfcfeffff, 0x80e0f0f8, 0xf0f8feff, 0x80c0e0, 0xe0f0f8fc, 0xc0, 0x80c0e0f0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x3f1f1f0f, 0xffffff7f, 0x1f1f0f07, 0xff7f7f3f, 0x1f0f0707, 0x7f7f3f1f}},
+    {{1, 5}, {0x1010000, 0xf070703, 0x1000000, 0x7070303, 0x0, 0x7030301, 0x0, 0x3030100, 0x0, 0x3010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff}},
+    {{2, 5}, {0x80c0f0, 0x0, 0x80c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8fcfe, 0xfeffffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8}},
+    {{1, 5}, {0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f07, 0xff7f7f3f, 0x1f0f0707, 0x7f7f3f1f, 0xf070703, 0x7f3f1f1f, 0x7070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f07, 0x3010100, 0x1f0f0707}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xc0f0f8fc, 0xfcfeffff, 0x80c0e0f8, 0xf0f8fcff, 0x80c0e0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0xc0e0f0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 5}, {0xf070703, 0x3f3f1f0f, 0x7070301, 0x3f1f0f0f, 0x7030101, 0x1f0f0f07, 0x3010100, 0xf0f0707, 0x1010000, 0xf070703, 0x1000000, 0x7070301, 0x0, 0x7030101, 0x0, 0x3010100}},
+    {{1, 4}, {0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0xc0e0f0, 0xf0f8fcfe, 0x80e0, 0xc0f0f8fc, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x3f3f1f0f, 0xffffff7f, 0x3f1f0f0f, 0xffff7f3f, 0x1f0f0f07, 0xff7f3f3f, 0xf0f0707, 0x7f3f3f1f}},
+    {{1, 5}, {0x1000000, 0x7070301, 0x0, 0x7030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80c0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 5}, {0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0e0f0fc, 0xfcfeffff, 0x80c0e0f0}},
+    {{1, 5}, {0x3f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f3f, 0xf0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f0f, 0x7070301, 0x3f1f0f0f, 0x7030101, 0x1f0f0f07, 0x3010100, 0xf0f0707, 0x1010000, 0xf070703}},
+    {{1, 4}, {0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f0fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc}},
+    {{2, 5}, {0xf0f8fcfe, 0x80c0e0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f0f, 0xffff7f7f}},
+    {{1, 5}, {0x3030101, 0x1f0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000}},
+    {{1, 4}, {0xe0f8feff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f8fcff, 0x80, 0xe0f0fcff, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff}},
+    {{2, 5}, {0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcff, 0x80c0e0}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0703, 0x3f3f1f1f, 0xf070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f0f}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xc0e0f0f8, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0e0f8fc, 0xfcfeffff, 0x80e0f0f8, 0xf8fcfeff, 0xc0e0f0, 0xf0f8fcff, 0x80c0e0, 0xe0f0fcfe, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x7070303, 0x3f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100}},
+    {{2, 5}, {0x80e0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f8fcfe, 0xfeffffff, 0xc0f0f8fc, 0xfcffffff, 0xc0e0f0f8, 0xfcfeffff, 0x80c0e0f0, 0xf8fcfeff, 0x80c0f0, 0xf0f8fcfe, 0x80e0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0fc, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f0f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f07, 0x7f7f3f3f, 0x1f0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f1f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcffffff, 0xc0e0f0f8, 0xfcfeffff, 0x80c0e0f0, 0xf8fcfeff, 0x80c0f0, 0xf0f8fcff, 0xc0e0, 0xe0f0fcfe, 0x80c0, 0xc0f0f8fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0xf070703, 0x3f3f1f0f, 0x7070303, 0x3f1f0f0f, 0x7030301, 0x1f1f0f07, 0x3030101, 0x1f0f0707, 0x3010100, 0xf070703, 0x1010000, 0xf070303, 0x1000000, 0x7030301, 0x0, 0x3030101}},
+    {{2, 5}, {0xf8fcfeff, 0x80c0e0, 0xf0f8fcff, 0x80e0, 0xe0f0f8fe, 0x80c0, 0xc0e0f8fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f8fc}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0f0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80c0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xf8fcffff, 0x80e0f0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301}},
+    {{2, 5}, {0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0f0f8fc, 0xfeffffff, 0x80e0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xf8fcffff, 0x80e0f0, 0xf0fcfeff, 0x80c0e0, 0xf0f8fcff, 0x80c0, 0xe0f0f8fe, 0xc0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0xc0e0f0, 0xf8fcffff, 0x80c0f0, 0xf0fcfeff, 0xc0e0, 0xf0f8fcfe, 0x80c0, 0xe0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0xf0f0707, 0x3f1f1f0f, 0xf070703, 0x1f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301}},
+    {{2, 5}, {0xe0f0fcfe, 0xc0, 0xc0f0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0f8, 0xfcfeffff, 0x80c0e0f8}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f3f1f, 0xffff7f7f, 0x3f3f1f1f, 0xff7f7f3f, 0x3f1f1f0f, 0x7f7f7f3f, 0x1f1f0f0f, 0x7f7f3f3f, 0x1f0f0f07, 0x7f3f3f1f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0}},
+    {{3, 4}, {0x80c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0}},
+    {{0, 3}, {0x3070f0f, 0x103, 0xf1f3f3f, 0x303070f, 0x3f7fffff, 0xf0f1f3f, 0xffffffff, 0x3f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x1f3f3f7f, 0x3070f0f, 0x7fffffff, 0xf1f3f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x1, 0x0, 0x1030307, 0x0, 0x70f1f1f, 0x10307, 0x1f3f7f7f, 0x3070f1f, 0x7fffffff, 0x1f1f3f7f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff}},
+    {{0, 4}, {0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff}},
+    {{0, 3}, {0x7fffffff, 0x1f1f3f7f, 0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x103, 0x0, 0x103070f, 0x1, 0xf0f1f3f, 0x1010307, 0x3f3f7fff, 0x7070f1f, 0xffffffff, 0x1f1f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0, 0x303070f, 0x1, 0xf0f1f3f, 0x1030307, 0x3f7f7fff, 0x70f0f1f}},
+    {{0, 4}, {0xf0f8fcfc, 0xc0e0e0f0, 0xf0f8f8fc, 0xc0c0e0f0, 0xf0f8f8fc, 0xc0c0e0f0, 0xf0f8f8fc, 0xc0c0e0f0, 0xf0f8f8fc, 0xc0c0e0f0, 0xf0f8f8fc, 0xc0c0e0e0, 0xf0f8f8fc, 0xc0c0e0e0, 0xf0f0f8fc, 0xc0c0e0e0}},
+    {{0, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x303070f, 0x1, 0xf0f1f3f, 0x1030307, 0x3f3f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0, 0x307070f, 0x1, 0xf1f1f3f, 0x1030307, 0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0}},
+    {{0, 4}, {0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x8080, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfe, 0xfeffffff, 0xf8f8fcfc, 0xfeffffff, 0xf8f8fcfc}},
+    {{0, 3}, {0xf1f1f3f, 0x1030307, 0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x1, 0xf1f1f3f, 0x1030307, 0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x3070f0f, 0x101}},
+    {{0, 4}, {0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 3}, {0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x1, 0xf1f1f3f, 0x1030307, 0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10103, 0x0, 0x307070f, 0x101, 0xf1f3f3f, 0x1030707}},
+    {{0, 4}, {0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf8f8fcfe, 0xc0c0e0f0, 0xf0f8fcfe, 0xc0c0e0f0, 0xf0f8fcfe, 0xc0c0e0f0}},
+    {{0, 3}, {0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x10103, 0x0, 0x307070f, 0x1, 0xf1f1f3f, 0x1030307, 0x3f7f7fff, 0x70f0f1f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10303, 0x0, 0x3070f0f, 0x101, 0xf1f3f3f, 0x1030707, 0x3f7fffff, 0x70f1f1f}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfefeffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000, 0x0, 0xff000000}},
+    {{0, 4}, {0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0, 0x80c0c0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 5}, {0xf8fcfcfe, 0x80c0e0f0, 0xc0e0f0f8, 0x80, 0x80c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xfeffffff, 0xe0f0f8fc, 0xf8fcfefe, 0x80c0e0f0, 0xc0e0f0f8, 0x80, 0x8080c0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf8f8fcfe, 0xfcfcfeff, 0xe0e0f0f8, 0xf0f0f8fc, 0x8080c0e0}},
+    {{0, 5}, {0xff7f3f0f, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff7f1f07, 0xffffffff, 0xff3f0f07, 0xffffffff, 0xff3f0f03, 0xffffffff, 0x7f1f0f03, 0xffffffff, 0x7f1f0701, 0xffffffff, 0x7f1f0701, 0xffffffff}},
+    {{0, 5}, {0x1000000, 0xff7f1f07, 0x1000000, 0xff3f0f07, 0x0, 0xff3f0f03, 0x0, 0x7f1f0f03, 0x0, 0x7f1f0701, 0x0, 0x7f1f0701, 0x0, 0x3f0f0701, 0x0, 0x3f0f0300}},
+    {{0, 4}, {0xe0f0f0f8, 0x8080c0, 0xe0f0f0f8, 0x8080c0, 0xe0f0f0f8, 0x8080c0, 0xe0f0f0f8, 0x8080c0, 0xe0f0f0f8, 0x8080c0, 0xe0f0f8f8, 0x8080c0, 0xe0f0f8f8, 0x80c0c0, 0xe0f0f8f8, 0x80c0c0}},
+    {{2, 5}, {0xf0fcfeff, 0x80c0e0, 0xc0e0f0f8, 0x80, 0x80c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xfeffffff, 0xf0f8fcfe, 0xf8fcfeff, 0xc0e0f0f0, 0xe0f0f8fc, 0x80c0c0, 0x80c0e0f0, 0x80, 0x80c0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf0f8fcfe, 0xfcfcfeff, 0xe0e0f0f8}},
+    {{0, 1}, {0x0, 0xff000000, 0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xfffff000, 0x0, 0xffffff00, 0x0, 0xffffff00, 0x0, 0xffffffff, 0x0, 0xffffffff}},
+    {{0, 1}, {0x0, 0xfff00000, 0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xffffff00, 0x0, 0xffffff00, 0x0, 0xfffffffc, 0x0, 0xffffffff, 0x80000000, 0xffffffff}},
+    {{0, 1}, {0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xfffffc00, 0x0, 0xffffff00, 0x0, 0xffffffc0, 0x0, 0xffffffff, 0x0, 0xffffffff, 0xff000000, 0xffffffff}},
+    {{0, 1}, {0x0, 0xffff0000, 0x0, 0xfffff000, 0x0, 0xffffff00, 0x0, 0xffffff80, 0x0, 0xffffffff, 0x0, 0xffffffff, 0xfc000000, 0xffffffff, 0xff000000, 0xffffffff}},
+    {{0, 1}, {0x0, 0xfffff800, 0x0, 0xffffff00, 0x0, 0xffffffc0, 0x0, 0xffffffff, 0x0, 0xffffffff, 0xfc000000, 0xffffffff, 0xff000000, 0xffffffff, 0xfff00000, 0xffffffff}},
+    {{0, 1}, {0x0, 0xffffff00, 0x0, 0xffffffe0, 0x0, 0xffffffff, 0x80000000, 0xffffffff, 0xfe000000, 0xffffffff, 0xff000000, 0xffffffff, 0xfff80000, 0xffffffff, 0xffff0000, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 5}, {0xf0f8fcfe, 0x80c0e0, 0xc0e0f0f8, 0x80, 0x80c0e0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf0f8fcfe, 0xfcfeffff, 0xe0f0f8f8, 0xf8f8fcfe, 0x80c0e0f0, 0xe0f0f0f8, 0x80c0, 0x80c0e0f0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf0f8fcfe}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f1f0f, 0xffffff7f, 0x3f1f0f0f, 0xffff7f7f, 0x1f0f0f07, 0xff7f7f3f, 0xf0f0703, 0x7f3f3f1f, 0x7070301, 0x3f3f1f0f}},
+    {{1, 5}, {0x1000000, 0xf070303, 0x0, 0x7030301, 0x0, 0x3030100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe}},
+    {{2, 5}, {0xf0f8fcfe, 0x80c0e0, 0xc0e0f0f8, 0x8080, 0x80c0e0f0, 0x0, 0x80c0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xf8fcfeff, 0xfeffffff, 0xf0f8f8fc, 0xfcfefeff, 0xc0e0f0f8, 0xf0f8fcfe, 0x80c0c0e0, 0xe0f0f0f8, 0x80c0, 0x80c0e0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x7f3f1f0f, 0xffffff7f, 0x3f1f0f0f, 0xffff7f7f, 0x1f0f0f07, 0xff7f3f3f, 0xf0f0703, 0x7f3f3f1f, 0xf070301, 0x3f3f1f0f, 0x7030101, 0x3f1f0f0f, 0x3010100, 0x1f0f0f07, 0x1010000, 0xf070703}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff}},
+    {{2, 5}, {0xf0f8fcfe, 0x80c0e0, 0xe0f0f8fc, 0x80c0, 0x80c0e0f0, 0x80, 0x80c0e0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xf8fcfeff, 0xc0e0e0f0, 0xf0f8fcfc, 0x80c0e0, 0xe0e0f0f8, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff}},
+    {{1, 5}, {0xf070703, 0x7f3f1f1f, 0x7070301, 0x3f1f1f0f, 0x7030101, 0x1f1f0f07, 0x3010100, 0x1f0f0707, 0x1010000, 0xf070703, 0x1000000, 0x7070301, 0x0, 0x7030100, 0x0, 0x3010000}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc}},
+    {{2, 5}, {0xf8fcfeff, 0x80c0e0f0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xfeffffff, 0xf0f8fcfc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0, 0xf0f0f8fc, 0x80c0e0}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f07, 0xff7f7f3f, 0x1f0f0707, 0x7f7f3f1f}},
+    {{1, 5}, {0x1010000, 0xf070703, 0x1000000, 0x7070301, 0x0, 0x7030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 5}, {0xf8fcfeff, 0x80c0e0f0, 0xf0f0f8fc, 0x80c0e0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xf8fcfeff, 0xc0e0f0f8, 0xf0f8fcfe, 0x80c0c0e0}},
+    {{1, 5}, {0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f07, 0xff7f7f3f, 0x1f0f0707, 0x7f7f3f1f, 0xf070703, 0x7f3f1f1f, 0x7070301, 0x3f1f1f0f, 0x7030101, 0x1f1f0f07, 0x3010100, 0x1f0f0707}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc}},
+    {{2, 5}, {0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 5}, {0xf070703, 0x3f3f1f0f, 0x7070301, 0x3f1f0f0f, 0x7030101, 0x1f0f0f07, 0x3010100, 0xf0f0707, 0x1010000, 0xf070703, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010000}},
+    {{1, 4}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0xc0, 0xe0f8feff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f0fcff, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff}},
+    {{2, 5}, {0xf0f8feff, 0x80c0e0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x3f3f1f0f, 0xffffff7f, 0x3f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f3f, 0xf0f0703, 0x7f3f3f1f}},
+    {{1, 5}, {0x1000000, 0x7070301, 0x0, 0x7030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8}},
+    {{2, 5}, {0xf0f8fcfe, 0x80c0e0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x3f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f3f, 0xf0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f0f, 0x7070301, 0x3f1f0f0f, 0x7030101, 0x1f0f0f07, 0x3010100, 0xf0f0707, 0x1010000, 0xf070703}},
+    {{1, 4}, {0xc0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x0, 0xc0f0f8fe, 0x0, 0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8feff}},
+    {{2, 5}, {0xe0f0f8fe, 0x80c0, 0xc0e0f0fc, 0x80, 0x80c0f0f8, 0x0, 0x80e0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8feffff, 0x80c0e0f0, 0xf0fcfeff, 0x80c0e0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f0f, 0xffff7f7f}},
+    {{1, 5}, {0x3030101, 0x1f0f0f07, 0x3010100, 0xf0f0703, 0x1010000, 0xf070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x0}},
+    {{1, 4}, {0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{2, 5}, {0xc0e0f8fc, 0x80, 0x80e0f0f8, 0x0, 0xc0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfcfeffff, 0x80c0e0f8, 0xf8fcfeff, 0x80e0f0, 0xf0f8fcfe, 0x80c0e0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffffff, 0x3f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f3f, 0x1f1f0f07, 0x7f7f3f3f, 0x1f0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f1f, 0x7070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f07}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80c0e0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xc0e0f0f8, 0xfcfeffff, 0x80c0e0f0, 0xf8fcfeff, 0x80c0f0, 0xf0f8fcfe, 0xc0e0, 0xe0f0f8fc, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff}},
+    {{1, 5}, {0x7070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f07, 0x3030101, 0x1f0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100}},
+    {{2, 5}, {0x80c0e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f8fc, 0xfcfeffff, 0x80e0f0f8, 0xf8fcffff, 0xc0e0f0, 0xf0fcfeff, 0x80c0e0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fc, 0x80, 0xc0e0f0f8, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f3f, 0xf0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f0f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0x80c0f0f8, 0xf8feffff, 0xc0e0f0, 0xf0fcfeff, 0x80c0e0, 0xf0f8fcfe, 0x80c0, 0xe0f0f8fc, 0xc0, 0xc0e0f0fc, 0x80, 0x80c0f0f8, 0x0, 0x80e0f0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xe0f8fcfe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0xf0f0703, 0x3f3f1f1f, 0xf070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f0f, 0x3030101, 0x1f0f0f07, 0x3010100, 0xf0f0703, 0x1010000, 0xf070303, 0x1000000, 0x7030301, 0x0, 0x3030101}},
+    {{2, 5}, {0xf0fcfeff, 0x80c0e0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fc, 0x80, 0xc0e0f0fc, 0x80, 0x80c0f0f8, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcfe, 0xfeffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f0f8}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f1f0f, 0xff7f7f3f, 0x1f1f0f07, 0x7f7f3f3f, 0x1f0f0707, 0x7f3f3f1f}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0e0f8fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f8fc, 0xfcffffff, 0x80c0f0f8, 0xf8feffff, 0xc0e0f0, 0xf8fcfeff, 0x80c0e0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f, 0x7070303, 0x1f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301}},
+    {{2, 5}, {0x80c0f0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f0fc, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f0, 0xf8fcfeff, 0x80c0f0, 0xf0f8feff, 0x80e0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fc, 0x80}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfefefefe, 0xfcfcfefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0}},
+    {{0, 3}, {0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x10103, 0x0, 0x3070f0f, 0x101, 0xf1f3f3f, 0x1030707, 0x3f7fffff, 0x70f1f3f, 0xffffffff, 0x3f3f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x3070f0f, 0x101, 0xf1f3f3f, 0x1030707, 0x3f7fffff, 0x70f1f3f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10307, 0x0, 0x7070f1f, 0x103, 0x1f1f3f7f, 0x303070f, 0x7fffffff, 0xf1f1f3f, 0xffffffff, 0x3f7f7fff}},
+    {{0, 4}, {0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfeffffff, 0xf0f8fcfc, 0xfefeffff, 0xf0f8fcfc, 0xfefeffff, 0xf0f8fcfc, 0xfefeffff, 0xf0f8fcfc, 0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc}},
+    {{0, 3}, {0xf1f3f3f, 0x1030707, 0x3f7fffff, 0x70f1f1f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x10303, 0x0, 0x3070f1f, 0x103, 0xf1f3f7f, 0x103070f, 0x7f7fffff, 0x70f1f3f, 0xffffffff, 0x3f3f7fff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1010307, 0x0, 0x70f0f1f, 0x103}},
+    {{0, 4}, {0xc0e0e0f0, 0x8080, 0xc0e0e0f0, 0x8080, 0xc0c0e0f0, 0x8080, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80, 0xc0c0e0f0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{0, 3}, {0x3f7fffff, 0x70f1f1f, 0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x10303, 0x0, 0x3070f0f, 0x101, 0xf1f3f7f, 0x103070f, 0x3f7fffff, 0x70f1f3f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10307, 0x0, 0x7070f1f, 0x103, 0x1f1f3f7f, 0x303070f}},
+    {{0, 4}, {0xf0f8fcfe, 0xc0c0e0f0, 0xf0f8fcfe, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0}},
+    {{0, 3}, {0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x10303, 0x0, 0x3070f0f, 0x101, 0xf1f3f3f, 0x1030707, 0x3f7fffff, 0x70f1f3f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10307, 0x0, 0x3070f1f, 0x103, 0xf1f3f7f, 0x103070f, 0x7f7fffff, 0xf0f1f3f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc}},
+    {{2, 3}, {0xffffffff, 0xf0ff, 0xffffffff, 0xfcff, 0xffffffff, 0xc0ffff, 0xffffffff, 0xf8ffff, 0xffffffff, 0xfeffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xf0ffff, 0xffffffff, 0xfeffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{3, 5}, {0x0, 0xc0000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 5}, {0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 5}, {0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 3}, {0x3070f0f, 0x101, 0xf1f3f3f, 0x1030707, 0x3f7fffff, 0x70f1f3f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10307, 0x0, 0x3070f1f, 0x103, 0xf1f3f7f, 0x103070f, 0x3f7fffff, 0xf0f1f3f, 0xffffffff, 0x3f3f7fff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1010307, 0x0}},
+    {{0, 4}, {0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xe0, 0x0, 0xfc, 0x0, 0xc0ff, 0x0}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffff3f, 0xffffffff, 0xffffff00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00, 0x0, 0xffff0000}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80000000}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff000000}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe000000, 0x0, 0xff000000}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0xf0f8f8fc, 0x80c0e0e0, 0xc0e0f0f0, 0x80c0, 0x8080c0e0, 0x0, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfefeff, 0xfeffffff, 0xf0f8fcfe, 0xfcfcfeff, 0xe0f0f0f8, 0xf0f8f8fc, 0xc0c0e0f0, 0xe0e0f0f8, 0x8080c0, 0x80c0e0e0, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff}},
+    {{0, 1}, {0xf0000000, 0xffffffff, 0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xfffc0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffc000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xff000000, 0xffffffff, 0xff000000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xff000000, 0xffffffff, 0xfffc0000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffe000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffffc0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xfff00000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffc000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xffff0000, 0xffffffff, 0xffffc000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff80, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xffffe000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffffc0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff}},
+    {{2, 5}, {0xfcfeffff, 0xe0f0f8f8, 0xf8f8fcfe, 0xc0c0e0f0, 0xe0f0f8f8, 0x80c0c0, 0xc0c0e0f0, 0x80, 0x80c0c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xf8fcfefe, 0xfefeffff, 0xf0f8f8fc, 0xf8fcfefe, 0xe0e0f0f8, 0xf0f8f8fc, 0x80c0e0e0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0x7f3f1f0f, 0xffffff7f, 0x3f1f0f0f, 0xffff7f7f, 0x1f0f0f07, 0xff7f7f3f}},
+    {{1, 5}, {0x7030100, 0x3f1f0f07, 0x3010000, 0x1f0f0707, 0x1000000, 0xf070703, 0x0, 0x7070301, 0x0, 0x3030100, 0x0, 0x3010000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8}},
+    {{2, 5}, {0x8080c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8f8fcfe, 0xfcfeffff, 0xe0f0f8fc, 0xf8fcfefe, 0xc0e0e0f0, 0xf0f0f8fc, 0x8080c0e0, 0xc0e0f0f8, 0x80c0, 0x80c0c0e0, 0x0, 0x80c0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xf8f8fcfe, 0xfcfeffff, 0xe0f0f8fc}},
+    {{1, 5}, {0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x3f1f1f0f, 0xffffff7f, 0x1f1f0f07, 0xffff7f3f, 0x1f0f0703, 0xff7f3f1f, 0xf070303, 0x7f3f1f1f, 0x7030301, 0x3f1f1f0f}},
+    {{1, 5}, {0x1000000, 0x7070301, 0x0, 0x7030101, 0x0, 0x3010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8fcff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff}},
+    {{2, 5}, {0x80c0e0f0, 0x0, 0x80c0c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8f8fcfe, 0xfefeffff, 0xe0f0f8fc, 0xf8fcfeff, 0xc0e0f0f0, 0xf0f8fcfc, 0x80c0c0e0, 0xe0f0f0f8, 0x80c0, 0x80c0e0f0, 0x80, 0x80c0e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfefe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x3f3f1f0f, 0xffffff7f, 0x3f1f0f07, 0xffff7f3f, 0x1f0f0707, 0xff7f3f1f, 0xf070703, 0x7f3f1f1f, 0x7070301, 0x3f1f1f0f, 0x3030100, 0x1f1f0f07, 0x3010000, 0x1f0f0703, 0x1000000, 0xf070303}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8}},
+    {{2, 5}, {0xc0e0f0f8, 0x8080, 0x80c0e0f0, 0x0, 0x80c0c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfcfeff, 0xffffffff, 0xf0f8fcfe, 0xfefeffff, 0xe0f0f8fc, 0xf8fcfeff, 0xc0e0f0f8, 0xf0f8fcfe, 0x80c0c0e0, 0xe0f0f8f8, 0x80c0, 0xc0e0e0f0, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f1f0f, 0xffffff7f}},
+    {{1, 5}, {0xf070303, 0x7f3f1f1f, 0x7030301, 0x3f1f0f0f, 0x3030100, 0x1f0f0f07, 0x3010000, 0xf0f0703, 0x1000000, 0xf070303, 0x0, 0x7030301, 0x0, 0x3010100, 0x0, 0x1010000}},
+    {{1, 4}, {0xf0f8feff, 0x80c0, 0xe0f8feff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f0fcff, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff}},
+    {{2, 5}, {0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0e0, 0x0, 0x8080c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfcfeffff, 0xe0f0f8fc, 0xf8fcfeff, 0xc0e0f0f0, 0xf0f8fcfe, 0x8080c0e0, 0xe0f0f8fc, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x3f3f1f0f, 0xffffff7f, 0x3f1f0f0f, 0xffff7f3f, 0x1f0f0f07, 0xff7f3f3f, 0xf070703, 0x7f3f3f1f}},
+    {{1, 5}, {0x1010000, 0xf070703, 0x1000000, 0x7070301, 0x0, 0x7030101, 0x0, 0x3010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8}},
+    {{2, 5}, {0xf0f8fcfc, 0x80c0e0, 0xe0e0f0f8, 0x80c0, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0}},
+    {{1, 5}, {0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f3f, 0x1f0f0f07, 0xff7f3f3f, 0xf0f0703, 0x7f3f3f1f, 0xf070303, 0x3f3f1f0f, 0x7030301, 0x3f1f0f0f, 0x3030100, 0x1f0f0f07, 0x3010000, 0xf0f0703}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff}},
+    {{2, 5}, {0xf0f8fcfe, 0x80c0e0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xf8fcfeff, 0xc0e0f0f8, 0xf0f8fcfe, 0x80c0c0e0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffff7f}},
+    {{1, 5}, {0xf070303, 0x3f3f1f0f, 0x7030301, 0x1f1f0f0f, 0x3030100, 0x1f0f0f07, 0x3010000, 0xf0f0703, 0x1000000, 0x7070303, 0x0, 0x7030301, 0x0, 0x3010100, 0x0, 0x1010000}},
+    {{1, 4}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f8, 0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0xf0f8fcfe, 0x80c0e0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f07, 0xff7f7f3f, 0x1f0f0707, 0x7f7f3f1f, 0xf070703, 0x3f3f1f1f}},
+    {{1, 5}, {0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0fcfe}},
+    {{2, 5}, {0xe0f8fcfe, 0x80c0, 0xe0f0f8fc, 0x80, 0xc0e0f0f8, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0e0f0fc, 0xfcfeffff, 0x80c0e0f8, 0xf8fcfeff, 0x80c0f0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x1f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f1f, 0xf0f0703, 0x7f3f1f1f, 0xf070303, 0x3f1f1f0f, 0x7030301, 0x1f1f0f0f, 0x3030100, 0x1f0f0707, 0x3010000, 0xf070703, 0x1000000, 0x7070303}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x3f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f3f}},
+    {{1, 5}, {0x3030100, 0x1f0f0707, 0x3010000, 0xf070703, 0x1000000, 0x7070303, 0x0, 0x7030301, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{2, 5}, {0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0f0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcffff, 0x80c0e0f0, 0xf0fcfeff, 0x80c0e0, 0xf0f8fcfe, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0x7f3f3f1f, 0xffffff7f, 0x3f3f1f1f, 0xffff7f7f, 0x3f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f3f, 0xf0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f0f, 0x7070301, 0x1f1f0f0f, 0x7030101, 0x1f0f0f07}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80e0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcffff, 0x80c0e0f0, 0xf0fcfeff, 0x80c0e0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fc, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 5}, {0x7070303, 0x3f1f0f0f, 0x7030301, 0x1f0f0f07, 0x3030100, 0xf0f0707, 0x3010000, 0xf070703, 0x1000000, 0x7070303, 0x0, 0x7030101, 0x0, 0x3010100, 0x0, 0x1010000}},
+    {{2, 5}, {0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xe0f0f8fc, 0xfeffffff, 0xc0e0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xf8fcfeff, 0x80e0f0, 0xf0f8fcff, 0xc0e0, 0xe0f0f8fe, 0x80c0, 0xc0e0f8fc, 0x80, 0x80e0f0f8, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f3f3f1f, 0xf0f0707, 0x3f3f1f1f, 0xf070703, 0x3f1f1f0f}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfcfeffff, 0x80c0e0f8, 0xf8fcfeff, 0x80e0f0, 0xf0f8feff, 0xc0e0, 0xe0f8fcfe, 0x80c0, 0xc0f0f8fc, 0x80, 0xc0e0f0f8, 0x0, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0}},
+    {{1, 5}, {0xf070703, 0x3f3f1f1f, 0x7070303, 0x3f1f1f0f, 0x7030301, 0x1f0f0f07, 0x3030101, 0xf0f0707, 0x3010100, 0xf070703, 0x1010000, 0x7070303, 0x1000000, 0x7030301, 0x0, 0x3030101}},
+    {{2, 5}, {0xf0f8fcff, 0x80e0, 0xe0f0fcfe, 0x80c0, 0xc0f0f8fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f0, 0x0, 0x80c0f0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{1, 5}, {0x0, 0x3030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 2}, {0x0, 0xf070301, 0x0, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303}},
+    {{3, 4}, {0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x80808080, 0x8080}},
+    {{3, 4}, {0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0}},
+    {{3, 4}, {0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080, 0x0, 0x0}},
+    {{3, 4}, {0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff}},
+    {{3, 4}, {0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0}},
+    {{0, 3}, {0x70f1f3f, 0x10303, 0x1f3f7fff, 0x3070f1f, 0xffffffff, 0xf1f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x1f3f7f7f, 0x307070f, 0x7fffffff, 0xf1f3f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x103, 0x0, 0x103070f, 0x1, 0xf0f1f3f, 0x10307, 0x3f7f7fff, 0x7070f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{0, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xfefeffff}},
+    {{0, 3}, {0x7fffffff, 0xf0f1f3f, 0xffffffff, 0x3f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x1, 0x0, 0x1030307, 0x0, 0x70f1f1f, 0x10303, 0x1f3f7fff, 0x3070f0f, 0x7fffffff, 0xf1f3f7f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0, 0x303070f, 0x1, 0xf1f1f3f, 0x1010307, 0x3f7fffff, 0x70f0f1f}},
+    {{0, 4}, {0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0, 0xf0f8fcfc, 0xc0c0e0f0}},
+    {{0, 3}, {0xffffffff, 0x3f3f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x1010307, 0x0, 0x70f0f1f, 0x103, 0x1f3f3f7f, 0x307070f, 0x7fffffff, 0xf1f1f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x101, 0x0, 0x1030707, 0x0, 0x70f1f3f, 0x10307, 0x1f3f7fff, 0x3070f1f, 0xffffffff, 0xf1f3f7f}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0}},
+    {{0, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{0, 4}, {0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc}},
+    {{0, 3}, {0x7070f1f, 0x103, 0x1f1f3f7f, 0x303070f, 0x7fffffff, 0xf1f1f3f, 0xffffffff, 0x3f7f7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1030307, 0x0, 0x70f1f1f, 0x10303, 0x1f3f7f7f, 0x3070f0f, 0x7fffffff, 0xf1f3f7f, 0xffffffff, 0x3f7fffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x103, 0x0, 0x103070f, 0x1}},
+    {{0, 4}, {0x80c0e0e0, 0x0, 0x80c0e0e0, 0x0, 0x80c0e0e0, 0x80, 0x80c0e0e0, 0x80, 0x80c0e0e0, 0x80, 0x80c0e0e0, 0x80, 0x80c0e0e0, 0x80, 0x80c0e0e0, 0x80}},
+    {{0, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 3}, {0xf0, 0x0, 0xfc, 0x0, 0xc0ff, 0x0, 0xf0ff, 0x0, 0xfeff, 0x0, 0xe0ffff, 0x0, 0xf8ffff, 0x0, 0x80ffffff, 0x0}},
+    {{2, 3}, {0xf0ff, 0x0, 0xfeff, 0x0, 0xc0ffff, 0x0, 0xf8ffff, 0x0, 0x80ffffff, 0x0, 0xe0ffffff, 0x0, 0xfcffffff, 0x0, 0xffffffff, 0x80}},
+    {{2, 3}, {0x80fcffff, 0x0, 0xc0ffffff, 0x0, 0xf0ffffff, 0x0, 0xfcffffff, 0x80, 0xffffffff, 0xe0, 0xffffffff, 0xf8, 0xffffffff, 0x80fe, 0xffffffff, 0xe0ff}},
+    {{2, 3}, {0xffffffff, 0xf0, 0xffffffff, 0x80fc, 0xffffffff, 0xe0fe, 0xffffffff, 0xf0ff, 0xffffffff, 0x80fcff, 0xffffffff, 0xe0ffff, 0xffffffff, 0xf8ffff, 0xffffffff, 0xc0fcffff}},
+    {{3, 5}, {0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 5}, {0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 5}, {0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 5}, {0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0xff000000, 0x0, 0xff000000, 0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xffffff00, 0x0, 0xffffff80, 0x0, 0xffffffff}},
+    {{0, 1}, {0x0, 0xfc000000, 0x0, 0xff000000, 0x0, 0xfffc0000, 0x0, 0xffff0000, 0x0, 0xfffffe00, 0x0, 0xffffff00, 0x0, 0xffffffff, 0x0, 0xffffffff}},
+    {{0, 1}, {0x0, 0xff000000, 0x0, 0xff000000, 0x0, 0xffff0000, 0x0, 0xffff8000, 0x0, 0xffffff00, 0x0, 0xffffffc0, 0x0, 0xffffffff, 0xe0000000, 0xffffffff}},
+    {{0, 1}, {0x0, 0xff000000, 0x0, 0xffff0000, 0x0, 0xffff0000, 0x0, 0xffffff00, 0x0, 0xffffff00, 0x0, 0xffffffff, 0x0, 0xffffffff, 0xff000000, 0xffffffff}},
+    {{0, 1}, {0x0, 0xfffe0000, 0x0, 0xffff0000, 0x0, 0xfffffe00, 0x0, 0xffffff00, 0x0, 0xfffffffe, 0x0, 0xffffffff, 0xff000000, 0xffffffff, 0xff800000, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff, 0xffff7f00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00}},
+    {{3, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff00, 0xffffffff, 0xffff0000, 0xffffffff, 0xff070000, 0xffffffff, 0x3f000000, 0xffffffff, 0x0, 0xffffffff, 0x0, 0xffffff00}},
+    {{1, 4}, {0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc}},
+    {{2, 5}, {0xe0e0f0f8, 0x8080c0, 0x80c0e0e0, 0x80, 0x8080c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xf8fcfefe, 0xfefeffff, 0xf0f8f8fc, 0xf8fcfefe, 0xe0e0f0f8, 0xf0f8f8fc, 0x80c0e0e0, 0xe0e0f0f8, 0x8080c0, 0x80c0e0e0, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x3f1f1f0f, 0xffffff7f}},
+    {{1, 5}, {0xf070703, 0x7f3f3f1f, 0x7070301, 0x3f3f1f0f, 0x3030100, 0x3f1f0f07, 0x3010000, 0x1f0f0703, 0x1000000, 0xf070303, 0x0, 0x7030101, 0x0, 0x3010100, 0x0, 0x1000000}},
+    {{1, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xfcfeffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0, 0xf8fcfeff, 0xc0e0, 0xf0fcfeff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0xf8fcfcfe, 0xc0e0f0f0, 0xf0f0f8fc, 0x8080c0e0, 0xc0e0f0f8, 0x80c0, 0x80c0e0e0, 0x0, 0x8080c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfcfe, 0xfefeffff, 0xf0f0f8fc, 0xf8fcfefe, 0xc0e0f0f8, 0xf0f8f8fc, 0x80c0e0e0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x3f1f1f0f, 0xffffff7f, 0x1f0f0f07, 0xff7f7f3f, 0xf0f0703, 0x7f7f3f1f}},
+    {{1, 5}, {0x3010100, 0x1f0f0f07, 0x1010000, 0xf0f0703, 0x1000000, 0xf070301, 0x0, 0x7030100, 0x0, 0x3010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0f0f8fe, 0x80, 0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe}},
+    {{2, 5}, {0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xf0f8f8fc, 0xfcfcfeff, 0xe0e0f0f8, 0xf0f8fcfe, 0x80c0e0f0, 0xe0f0f8f8, 0x80c0c0, 0xc0e0f0f0, 0x8080, 0x80c0c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfefeff, 0xffffffff, 0xf8f8fcfe, 0xfcfeffff, 0xe0f0f8fc}},
+    {{1, 5}, {0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x3f3f1f0f, 0xffffff7f, 0x3f1f0f07, 0xffff7f3f, 0x1f0f0707, 0xff7f3f3f, 0xf070703, 0x7f3f1f1f, 0x7030301, 0x3f1f1f0f, 0x3030100, 0x1f1f0f07}},
+    {{1, 5}, {0x0, 0x7030301, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0x8080c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8fcfeff, 0xfeffffff, 0xf0f8fcfe, 0xfcfeffff, 0xe0f0f8f8, 0xf8fcfefe, 0xc0e0e0f0, 0xf0f8f8fc, 0x8080c0e0, 0xe0e0f0f8, 0x80c0, 0x80c0e0f0, 0x80, 0x80c0e0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfefe}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 5}, {0x3f1f0f0f, 0xffff7f7f, 0x1f0f0f07, 0xff7f3f3f, 0xf0f0703, 0x7f3f3f1f, 0x7070301, 0x3f3f1f0f, 0x7030101, 0x3f1f0f07, 0x3010000, 0x1f0f0707, 0x1000000, 0xf070303, 0x0, 0x7030301}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe}},
+    {{2, 5}, {0xc0e0f0f0, 0x80, 0x80c0c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfcfeffff, 0xe0f0f8fc, 0xf8fcfeff, 0xc0e0f0f0, 0xf0f8fcfe, 0x80c0c0e0, 0xe0f0f8f8, 0x80c0, 0xc0e0e0f0, 0x80}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f}},
+    {{1, 5}, {0x7070301, 0x3f1f1f0f, 0x7030101, 0x1f1f0f07, 0x3010000, 0x1f0f0707, 0x1000000, 0xf070303, 0x0, 0x7030301, 0x0, 0x3030100, 0x0, 0x3010000, 0x0, 0x1000000}},
+    {{1, 4}, {0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 5}, {0xe0f0f8f8, 0x80c0, 0xc0e0e0f0, 0x80, 0x8080c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xfeffffff, 0xf0f8fcfe, 0xfcfeffff, 0xe0f0f8f8, 0xf8fcfeff, 0xc0e0e0f0, 0xf0f8fcfe, 0x8080c0e0, 0xe0f0f8fc, 0x80c0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 5}, {0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f1f0f0f, 0xffff7f7f, 0x1f0f0f07, 0xff7f3f3f, 0xf0f0703, 0x7f3f3f1f, 0xf070301, 0x3f3f1f0f}},
+    {{1, 5}, {0x1000000, 0x7070303, 0x0, 0x7030101, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0e0f8fc, 0x0, 0x80e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0fcfe, 0xffffffff, 0xc0f0f8fe}},
+    {{2, 5}, {0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 5}, {0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f07, 0xff7f7f3f, 0x1f0f0707, 0x7f7f3f1f, 0xf070703, 0x7f3f1f1f, 0x7070301, 0x3f1f1f0f, 0x3030100, 0x1f0f0f07, 0x3010000, 0xf0f0703, 0x1000000, 0xf070303}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf8feffff, 0xc0f0, 0xf8feffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf0fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 5}, {0xf0f8fcfe, 0x80c0e0, 0xe0f0f8f8, 0x80c0, 0xc0e0e0f0, 0x80, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xfeffffff, 0xf0f8fcfc, 0xfcfeffff, 0xe0e0f0f8, 0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x3f3f1f0f, 0xffffff7f}},
+    {{1, 5}, {0x7070301, 0x3f1f1f0f, 0x7030101, 0x1f0f0f07, 0x3010100, 0xf0f0707, 0x1010000, 0xf070303, 0x0, 0x7030301, 0x0, 0x3030100, 0x0, 0x3010000, 0x0, 0x1000000}},
+    {{1, 4}, {0x80c0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xffffffff, 0x80e0f0fc}},
+    {{2, 5}, {0xf0f8fcfe, 0xc0e0, 0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0e0f8fc, 0xfcfeffff, 0x80c0e0f8, 0xf0f8fcfe, 0x80c0e0}},
+    {{1, 5}, {0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x3f3f1f0f, 0xffff7f7f, 0x3f1f0f0f, 0xff7f7f3f, 0x1f0f0f07, 0x7f7f3f1f, 0xf070703, 0x7f3f1f1f, 0x7070301, 0x3f1f1f0f}},
+    {{1, 5}, {0x0, 0x7030301, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfeffffff, 0xe0f0f8fc, 0xfcfeffff, 0xc0e0f0f8, 0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 5}, {0x1f1f0f07, 0xff7f3f3f, 0xf0f0707, 0x7f3f3f1f, 0xf070703, 0x3f3f1f0f, 0x7070301, 0x3f1f0f0f, 0x3030101, 0x1f0f0f07, 0x3010100, 0xf0f0703, 0x1000000, 0xf070303, 0x0, 0x7030301}},
+    {{2, 5}, {0xe0f0f8fc, 0x80, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0f0f8fc, 0xfcfeffff, 0x80e0f0f8, 0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0}},
+    {{1, 5}, {0xffffffff, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0x7f7f3f3f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f1f0f07, 0xff7f7f3f}},
+    {{1, 5}, {0x3010100, 0xf0f0703, 0x1010000, 0xf070303, 0x1000000, 0x7030301, 0x0, 0x3030101, 0x0, 0x3010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xfeffffff, 0xc0f0f8fc, 0xfcfeffff, 0x80e0f0f8, 0xf8fcfeff, 0x80c0e0f0, 0xf0f8fcfe, 0x80c0e0, 0xe0f0f8fe, 0x80c0}},
+    {{1, 5}, {0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xc0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 5}, {0x0, 0x3010100, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x3010000, 0x1f1f0f07, 0x3010000, 0x1f1f0f07, 0x3010000, 0x1f1f0f07, 0x3010000, 0x3f1f0f07, 0x3010100, 0x3f1f0f07, 0x3010100, 0x3f1f0f07, 0x3010100, 0x3f1f0f07, 0x3030100, 0x3f1f0f07}},
+    {{1, 2}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070303, 0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf0f0703, 0x1000000, 0xf0f0703, 0x1000000, 0xf0f0703}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0}},
+    {{3, 4}, {0xffffffff, 0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfefefefe, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0}},
+    {{3, 4}, {0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefeff, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x808080c0, 0x808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfe, 0xf8fcfcfc, 0xf8f8fcfc, 0xf8f8f8f8}},
+    {{0, 3}, {0xffffffff, 0x1f3f7f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x10307, 0x0, 0x3070f1f, 0x103, 0x1f3f3f7f, 0x103070f, 0x7fffffff, 0xf1f1f3f, 0xffffffff, 0x3f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0xffffffff, 0x7f7fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x307070f, 0x1, 0xf1f3f3f, 0x1030307, 0x3f7fffff, 0x70f1f1f, 0xffffffff, 0x1f3f7fff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x10307, 0x0, 0x70f0f1f, 0x103, 0x1f3f7f7f, 0x307070f, 0x7fffffff, 0xf1f3f3f, 0xffffffff, 0x3f7fffff}},
+    {{0, 4}, {0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfeffffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc, 0xfefeffff, 0xf0f8f8fc}},
+    {{0, 3}, {0xf0f1f3f, 0x10307, 0x3f3f7fff, 0x7070f1f, 0xffffffff, 0x1f3f3f7f, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff000000, 0x0, 0xffe00000}},
+    {{2, 3}, {0xe0ffffff, 0x0, 0xfcffffff, 0x0, 0xffffffff, 0x80, 0xffffffff, 0xf0, 0xffffffff, 0xfe, 0xffffffff, 0xc0ff, 0xffffffff, 0xf8ff, 0xffffffff, 0xffff}},
+    {{2, 3}, {0xffffffff, 0xf0, 0xffffffff, 0xfc, 0xffffffff, 0xc0ff, 0xffffffff, 0xf0ff, 0xffffffff, 0xfeff, 0xffffffff, 0xc0ffff, 0xffffffff, 0xf8ffff, 0xffffffff, 0xffffff}},
+    {{2, 3}, {0xffffffff, 0xf8ff, 0xffffffff, 0xc0feff, 0xffffffff, 0xf0ffff, 0xffffffff, 0xfcffff, 0xffffffff, 0xc0ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xe0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xff000000, 0xffffffff, 0xfff80000, 0xffffffff, 0xffff0000, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffff00, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xffc00000, 0xffffffff, 0xffff0000, 0xffffffff, 0xfffff000, 0xffffffff, 0xffffff00, 0xffffffff, 0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{0, 1}, {0xffff0000, 0xffffffff, 0xffffe000, 0xffffffff, 0xffffff00, 0xffffffff, 0xfffffff8, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xf0, 0x0, 0x80f8, 0x0, 0xc0fe, 0x0, 0xf0ff, 0x0, 0x80f8ff, 0x0}},
+    {{2, 3}, {0xe0fe, 0x0, 0x80f0ff, 0x0, 0xc0fcff, 0x0, 0xe0feff, 0x0, 0x80f8ffff, 0x0, 0xc0fcffff, 0x0, 0xe0feffff, 0x0, 0xf8ffffff, 0x80}},
+    {{2, 3}, {0xf0feffff, 0x0, 0xf8ffffff, 0x80, 0xfcffffff, 0xe0, 0xfeffffff, 0xf0, 0xffffffff, 0xc0f8, 0xffffffff, 0xe0fc, 0xffffffff, 0xf0ff, 0xffffffff, 0xc0f8ff}},
+    {{3, 5}, {0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 5}, {0x0, 0xffff0000, 0x0, 0xff000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 3}, {0x30f, 0x0, 0x30f3f, 0x0, 0x1071f7f, 0x0, 0x71f7fff, 0x1, 0xf3fffff, 0x107, 0x3fffffff, 0x30f, 0x7fffffff, 0x30f1f, 0xffffffff, 0x1071f7f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x30f, 0x0, 0x1071f, 0x0, 0x1071f3f, 0x0}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f8, 0xfcfeffff, 0xc0e0f0, 0xf8feffff, 0x80e0f0}},
+    {{1, 4}, {0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8fcff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0xc0, 0xe0f0fcfe, 0x80, 0xe0f0f8fe, 0x80, 0xc0f0f8fc, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff}},
+    {{2, 5}, {0xe0f0f0f8, 0x8080c0, 0xc0c0e0f0, 0x80, 0x80c0c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfcfeff, 0xfeffffff, 0xf0f8fcfc, 0xfcfefeff, 0xe0f0f8f8, 0xf8f8fcfe, 0xc0e0e0f0, 0xe0f0f8f8, 0x8080c0e0, 0xc0e0e0f0, 0x80c0}},
+    {{1, 5}, {0x7070301, 0x3f3f1f0f, 0x7030100, 0x3f1f0f07, 0x3010000, 0x1f0f0703, 0x1000000, 0xf070303, 0x0, 0x7030101, 0x0, 0x3010100, 0x0, 0x1000000, 0x0, 0x0}},
+    {{1, 4}, {0x80c0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0f8}},
+    {{2, 5}, {0xf8fcfefe, 0xc0e0f0f0, 0xf0f8f8fc, 0x80c0c0e0, 0xe0e0f0f8, 0x8080c0, 0xc0c0e0f0, 0x80, 0x80c0c0, 0x0, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xffffffff, 0xf8fcfeff, 0xfeffffff, 0xf0f8fcfc, 0xfcfefeff, 0xe0f0f0f8, 0xf8f8fcfe, 0xc0e0e0f0}},
+    {{1, 5}, {0xffffff7f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x3f1f1f0f, 0xffffff7f, 0x1f0f0f07, 0xff7f7f3f, 0xf070703, 0x7f7f3f1f, 0x7070301, 0x3f3f1f0f}},
+    {{1, 5}, {0x1010000, 0xf0f0703, 0x1000000, 0xf070301, 0x0, 0x7030101, 0x0, 0x3010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0xc0e0, 0xf8fcfeff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff}},
+    {{2, 5}, {0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xfeffffff, 0xf0f8fcfc, 0xfcfefeff, 0xe0f0f0f8, 0xf8fcfcfe, 0xc0c0e0f0, 0xf0f0f8fc, 0x80c0e0, 0xc0e0f0f8, 0x80c0, 0x80c0e0e0, 0x0, 0x80c0c0, 0x0, 0x80, 0x0}},
+    {{1, 5}, {0x7f7f3f1f, 0xffffffff, 0x7f3f1f0f, 0xffffff7f, 0x3f1f0f0f, 0xffff7f3f, 0x1f0f0707, 0xff7f3f3f, 0xf070703, 0x7f3f3f1f, 0x7030301, 0x3f1f1f0f, 0x3030100, 0x1f1f0f07, 0x1010000, 0xf0f0703}},
+    {{1, 5}, {0x0, 0x3030100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc}},
+    {{2, 5}, {0x8080c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfcfeffff, 0xe0f0f8fc, 0xf8fcfeff, 0xc0e0f0f0, 0xf0f8fcfc, 0x80c0c0e0, 0xe0f0f8f8, 0x80c0, 0xc0e0e0f0, 0x80, 0x8080c0e0, 0x0}},
+    {{1, 5}, {0x1f0f0f07, 0xff7f7f3f, 0xf0f0703, 0x7f3f3f1f, 0xf070301, 0x3f3f1f0f, 0x7030101, 0x3f1f0f07, 0x3010000, 0x1f0f0707, 0x1000000, 0xf070303, 0x0, 0x7030301, 0x0, 0x3030100}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xe0f8feff, 0xc0, 0xe0f8fcff, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff}},
+    {{2, 5}, {0xc0e0f0f0, 0x80, 0x80c0c0e0, 0x0, 0x8080c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8fcfe, 0xfefeffff, 0xe0f0f8fc, 0xf8fcfeff, 0xc0e0f0f8, 0xf0f8fcfe, 0x80c0e0e0, 0xe0f0f8fc, 0x8080c0, 0xc0e0f0f8, 0x80}},
+    {{1, 5}, {0x7030101, 0x3f1f0f07, 0x3010100, 0x1f0f0707, 0x1000000, 0xf070703, 0x0, 0x7030301, 0x0, 0x3030100, 0x0, 0x3010000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{1, 4}, {0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc}},
+    {{2, 5}, {0xe0f0f8f8, 0x80c0, 0xc0e0e0f0, 0x80, 0x8080c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{2, 5}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcfeff, 0xfeffffff, 0xf0f8fcfe, 0xfcfeffff, 0xe0f0f8f8, 0xf8fcfeff, 0xc0e0f0f0, 0xf0f8fcfe, 0x80c0c0e0, 0xe0f0f8fc, 0x80c0}},
+    {{1, 5}, {0xffff7f3f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f3f1f1f, 0xffffff7f, 0x3f1f1f0f, 0xffff7f7f, 0x1f0f0f07, 0xff7f3f3f, 0xf0f0703, 0x7f3f3f1f, 0xf070301, 0x3f3f1f0f, 0x7030101, 0x1f1f0f07}},
+    {{1, 5}, {0x0, 0x7030301, 0x0, 0x3010100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xe0f8feff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0x80, 0xe0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff}},
+    {{2, 5}, {0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 5}, {0x3f1f0f0f, 0xff7f7f3f, 0x1f0f0707, 0x7f7f3f1f, 0xf070703, 0x7f3f1f1f, 0x7070301, 0x3f1f1f0f, 0x7030101, 0x1f0f0f07, 0x3010000, 0xf0f0703, 0x1000000, 0xf070303, 0x0, 0x7030301}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8}},
+    {{2, 5}, {0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 5}, {0x7030101, 0x1f1f0f07, 0x3010100, 0x1f0f0707, 0x1010000, 0xf070703, 0x1000000, 0x7030301, 0x0, 0x3030100, 0x0, 0x3010000, 0x0, 0x1000000, 0x0, 0x0}},
+    {{2, 5}, {0xe0f0f8fc, 0x80c0, 0xc0e0f0f8, 0x80, 0x80c0e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 5}, {0x0, 0x3030100, 0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000}},
+    {{1, 2}, {0x1f0f0707, 0xffff7f3f, 0x1f0f0707, 0xffff7f3f, 0x1f0f0707, 0xffff7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 2}, {0xf070301, 0x7f3f1f1f, 0xf070301, 0x7f3f1f1f, 0xf070301, 0x7f3f1f1f, 0xf070301, 0x7f3f3f1f, 0xf070301, 0x7f3f3f1f, 0xf070301, 0x7f3f3f1f, 0xf070303, 0x7f7f3f1f, 0xf070303, 0x7f7f3f1f}},
+    {{1, 2}, {0x3030100, 0x3f1f0f07, 0x3030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f0f, 0x7030100, 0x3f1f0f0f, 0x7030100, 0x3f1f0f0f}},
+    {{1, 2}, {0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0x1f0f0703, 0x1000000, 0x1f0f0703, 0x1000000, 0x1f0f0703, 0x1000000, 0x1f0f0703, 0x1000000, 0x1f0f0703, 0x1010000, 0x1f0f0703, 0x1010000, 0x1f0f0703, 0x1010000, 0x1f0f0703}},
+    {{3, 4}, {0xc0c0c0c0, 0x80808080, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0}},
+    {{3, 4}, {0x80808080, 0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0}},
+    {{3, 4}, {0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0}},
+    {{3, 4}, {0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0}},
+    {{3, 4}, {0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x8080, 0x0}},
+    {{3, 4}, {0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefeffff, 0xfefefefe}},
+    {{3, 4}, {0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x808080c0, 0x808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfe, 0xf8fcfcfc}},
+    {{3, 4}, {0xc0c0c0c0, 0x8080c0c0, 0x8080c0c0, 0x808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefeff, 0xfcfcfefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fe}},
+    {{2, 3}, {0xffffffff, 0xe0ffff, 0xffffffff, 0xfcffff, 0xffffffff, 0x80ffffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xe0ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x30f1f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f7f, 0x0, 0x71f3fff, 0x1, 0xf3fffff, 0x3, 0x3f7fffff, 0x30f, 0x7fffffff, 0x1071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x30f3fff, 0xffffffff, 0xf3fffff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1071f, 0x0, 0x30f3f, 0x0, 0x30f3fff, 0x0, 0x71f7fff, 0x1}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xf0, 0x0, 0xfe, 0x0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xe0, 0x0, 0xfc, 0x0, 0x80ff, 0x0, 0xf0ff, 0x0, 0xfeff, 0x0}},
+    {{2, 3}, {0xf0, 0x0, 0x80fe, 0x0, 0xe0ff, 0x0, 0xf8ff, 0x0, 0x80feff, 0x0, 0xe0ffff, 0x0, 0xf8ffff, 0x0, 0x80feffff, 0x0}},
+    {{2, 3}, {0xc0feff, 0x0, 0xf0ffff, 0x0, 0x80fcffff, 0x0, 0xe0feffff, 0x0, 0xf0ffffff, 0x0, 0xfcffffff, 0x80, 0xffffffff, 0xe0, 0xffffffff, 0xf0}},
+    {{2, 3}, {0xfcffffff, 0xc0, 0xffffffff, 0xe0, 0xffffffff, 0x80f8, 0xffffffff, 0xc0fc, 0xffffffff, 0xf0ff, 0xffffffff, 0x80f8ff, 0xffffffff, 0xc0fcff, 0xffffffff, 0xf0ffff}},
+    {{2, 3}, {0xffffffff, 0xe0fcff, 0xffffffff, 0xf0ffff, 0xffffffff, 0xc0f8ffff, 0xffffffff, 0xe0fcffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x30f3fff, 0x0, 0xf3f7fff, 0x3, 0x1f7fffff, 0x107, 0x7fffffff, 0x1071f, 0xffffffff, 0x1030f3f, 0xffffffff, 0x30f3fff, 0xffffffff, 0xf1f7fff, 0xffffffff, 0x1f7fffff}},
+    {{1, 3}, {0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x1030f, 0x0, 0x30f3f, 0x0, 0x3071f7f, 0x0, 0x71f7fff, 0x1, 0xf3fffff, 0x107}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0x80c0f0, 0xf8fcffff, 0x80c0e0, 0xf8fcfeff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80e0, 0xf0f8fcff, 0x80c0, 0xe0f8fcfe, 0x80c0, 0xe0f0fcfe, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0}},
+    {{2, 3}, {0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0x80f0fe, 0x0, 0xc0f8ff, 0x0, 0xe0fcff, 0x0, 0x80f0feff, 0x0, 0xc0f8ffff, 0x0}},
+    {{2, 3}, {0xc0fcffff, 0x0, 0xe0feffff, 0x0, 0xf0ffffff, 0x80, 0xf8ffffff, 0xc0, 0xfeffffff, 0xe0, 0xffffffff, 0x80f0, 0xffffffff, 0xc0f8, 0xffffffff, 0xe0fe}},
+    {{1, 3}, {0x1, 0x0, 0x3, 0x0, 0x30f, 0x0, 0x1071f, 0x0, 0x1071f7f, 0x0, 0x70f3fff, 0x1, 0xf3fffff, 0x3, 0x1f7fffff, 0x30f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x107, 0x0}},
+    {{1, 4}, {0xc0e0f8fc, 0x80, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe}},
+    {{1, 4}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0xc0e0f0, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0x80c0f0, 0xf8fcffff, 0x80c0e0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 4}, {0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f8fc, 0x0, 0xc0e0f0fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 4}, {0x80c0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0}},
+    {{2, 5}, {0x80c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 5}, {0x0, 0x1010000, 0x0, 0x1000000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff}},
+    {{2, 5}, {0x80c0e0e0, 0x0, 0x8080c0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xc0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0}},
+    {{1, 4}, {0xe0f0fcfe, 0x80, 0xc0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8feff, 0xffffffff, 0xe0f8fcff}},
+    {{1, 4}, {0x80e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xfcffffff, 0xc0e0f8, 0xfcffffff, 0x80e0f8, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 2}, {0x7030301, 0x3f3f1f0f, 0x7030301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f1f, 0xf070301, 0x7f3f1f1f}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0f07, 0x3010000, 0x1f0f0f07, 0x3010000, 0x1f0f0f07, 0x3010100, 0x1f1f0f07, 0x3010100, 0x1f1f0f07, 0x3010100, 0x3f1f0f07}},
+    {{1, 2}, {0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0xf070301, 0x0, 0xf070301, 0x0, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303}},
+    {{1, 2}, {0x7f3f1f0f, 0xffffffff, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100}},
+    {{1, 2}, {0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f07, 0xffffff7f, 0x3f1f0f07, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 2}, {0xf070303, 0x7f7f3f1f, 0xf070703, 0xff7f3f1f, 0xf070703, 0xff7f3f1f, 0xf070703, 0xff7f3f1f, 0xf0f0703, 0xff7f3f1f, 0xf0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f}},
+    {{1, 2}, {0x7030100, 0x3f1f1f0f, 0x7030100, 0x3f1f1f0f, 0x7030100, 0x3f1f1f0f, 0x7030100, 0x3f3f1f0f, 0x7030101, 0x3f3f1f0f, 0x7030101, 0x3f3f1f0f, 0x7030301, 0x7f3f1f0f, 0x7030301, 0x7f3f1f0f}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0f07, 0x3010000, 0x1f0f0f07}},
+    {{3, 4}, {0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8}},
+    {{3, 4}, {0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0}},
+    {{3, 4}, {0x80808080, 0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0}},
+    {{3, 4}, {0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x808080c0, 0x80808080}},
+    {{3, 4}, {0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0f0, 0xc0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x80, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{3, 4}, {0xf0f0f0f8, 0xe0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x808080c0, 0x808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe}},
+    {{3, 4}, {0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x808080c0, 0x808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfefe, 0xf8fcfcfc, 0xf8fcfcfc, 0xf8f8f8f8}},
+    {{1, 3}, {0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1f7fffff, 0x107, 0x3fffffff, 0x1030f, 0xffffffff, 0x30f3f, 0xffffffff, 0x3071f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff}},
+    {{1, 3}, {0x103, 0x0, 0x30f, 0x0, 0x1071f, 0x0, 0x1071f7f, 0x0, 0x30f3fff, 0x1, 0xf3fffff, 0x3, 0x1f7fffff, 0x307, 0x7fffffff, 0x1071f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1030f, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80e0f0, 0xf8fcfeff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0, 0xf0f8feff, 0xc0e0, 0xf0f8fcff, 0x80e0, 0xe0f8fcfe, 0x80c0, 0xe0f0fcfe, 0x80c0, 0xe0f0f8fe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 3}, {0xc0ff, 0x0, 0xf8ff, 0x0, 0xffff, 0x0, 0xe0ffff, 0x0, 0xf8ffff, 0x0, 0xffffff, 0x0, 0xe0ffffff, 0x0, 0xfcffffff, 0x0}},
+    {{2, 3}, {0xc0ffff, 0x0, 0xf8ffff, 0x0, 0xffffff, 0x0, 0xc0ffffff, 0x0, 0xf8ffffff, 0x0, 0xffffffff, 0x0, 0xffffffff, 0xe0, 0xffffffff, 0xfc}},
+    {{2, 3}, {0xe0ffffff, 0x0, 0xfcffffff, 0x0, 0xffffffff, 0xc0, 0xffffffff, 0xf0, 0xffffffff, 0xfc, 0xffffffff, 0xc0ff, 0xffffffff, 0xf0ff, 0xffffffff, 0xfcff}},
+    {{2, 3}, {0xffffffff, 0x80fc, 0xffffffff, 0xe0ff, 0xffffffff, 0xf8ff, 0xffffffff, 0xc0fcff, 0xffffffff, 0xe0ffff, 0xffffffff, 0xf8ffff, 0xffffffff, 0xc0feffff, 0xffffffff, 0xe0ffffff}},
+    {{2, 3}, {0xffffffff, 0x80f8ffff, 0xffffffff, 0xc0feffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x3fffffff, 0x30f, 0x7fffffff, 0x30f1f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x71f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x307, 0x0, 0x1071f, 0x0, 0x1070f3f, 0x0, 0x30f3fff, 0x0, 0xf1f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1071f, 0xffffffff, 0x1030f3f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f1f, 0x0}},
+    {{1, 4}, {0xe0f0f8fe, 0x80, 0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xe0, 0x0, 0xf0, 0x0, 0x80f8, 0x0, 0xe0fe, 0x0}},
+    {{2, 3}, {0xc0f8, 0x0, 0xe0fe, 0x0, 0x80f0ff, 0x0, 0xc0f8ff, 0x0, 0xe0feff, 0x0, 0x80f0ffff, 0x0, 0xc0f8ffff, 0x0, 0xe0feffff, 0x0}},
+    {{2, 3}, {0xe0fcffff, 0x0, 0xf0feffff, 0x80, 0xf8ffffff, 0xc0, 0xfcffffff, 0xe0, 0xfeffffff, 0x80f0, 0xffffffff, 0xc0f8, 0xffffffff, 0xe0fc, 0xffffffff, 0x80f0fe}},
+    {{2, 3}, {0xffffffff, 0x80f0ff, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0x80f0ffff, 0xffffffff, 0xc0f8ffff, 0xffffffff, 0xe0fcffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf8ffffff}},
+    {{2, 3}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x7fffffff, 0x1071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x30f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f, 0x0, 0x30f3f, 0x0, 0x30f3f7f, 0x0, 0x71f7fff, 0x1, 0x1f7fffff, 0x107, 0x3fffffff, 0x1030f, 0xffffffff, 0x30f3f, 0xffffffff, 0x30f1f7f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x103, 0x0, 0x30f, 0x0, 0x3071f, 0x0, 0x1071f7f, 0x0}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0xc0e0f8, 0xfcfeffff, 0xc0e0f0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0}},
+    {{2, 3}, {0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0x80f0fe, 0x0, 0xc0f8ff, 0x0, 0xe0fcff, 0x0, 0x80f0feff, 0x0}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1071f, 0x0, 0x1070f3f, 0x0, 0x30f3fff, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcfeff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0x80c0, 0xe0f8fcfe, 0xc0, 0xe0f0fcfe, 0x80, 0xe0f0f8fe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 2}, {0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1010000, 0xf070703, 0x1010000, 0xf0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707}},
+    {{1, 4}, {0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc}},
+    {{1, 2}, {0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 2}, {0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0707, 0xff7f3f3f, 0x1f0f0707, 0xff7f3f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc}},
+    {{1, 2}, {0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f0f, 0x7030101, 0x3f1f0f0f, 0x7030301, 0x3f1f1f0f, 0x7030301, 0x3f1f1f0f, 0x7070301, 0x3f3f1f0f, 0x7070301, 0x3f3f1f0f, 0xf070301, 0x7f3f1f0f}},
+    {{1, 4}, {0xc0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0xc0f0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff}},
+    {{1, 2}, {0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf0f0703, 0x1010000, 0xf0f0703, 0x1010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc}},
+    {{1, 2}, {0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101}},
+    {{1, 4}, {0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0}},
+    {{1, 2}, {0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f0f, 0xffff7f7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000}},
+    {{1, 2}, {0xf070303, 0x7f3f3f1f, 0xf070303, 0x7f3f3f1f, 0xf070303, 0x7f7f3f1f, 0xf070703, 0x7f7f3f1f, 0xf070703, 0x7f7f3f1f, 0xf0f0703, 0xff7f3f1f, 0xf0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f}},
+    {{1, 2}, {0x3030100, 0x3f1f0f07, 0x3030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f0f, 0x7030100, 0x3f1f0f0f, 0x7030100, 0x3f1f1f0f, 0x7030101, 0x3f1f1f0f}},
+    {{1, 2}, {0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf0f0703, 0x1000000, 0xf0f0703, 0x1000000, 0x1f0f0703, 0x1010000, 0x1f0f0703, 0x1010000, 0x1f0f0703}},
+    {{1, 2}, {0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7030301}},
+    {{1, 2}, {0x3f1f0f0f, 0xffffff7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000}},
+    {{1, 2}, {0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f3f, 0x1f0f0703, 0xff7f3f3f, 0x1f0f0703, 0xff7f3f3f, 0x1f0f0703, 0xff7f7f3f, 0x1f0f0703, 0xff7f7f3f, 0x1f0f0707, 0xffff7f3f, 0x1f0f0707, 0xffff7f3f}},
+    {{1, 2}, {0x7030301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f1f, 0xf070301, 0x7f3f1f1f}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x3010000, 0x1f0f0f07, 0x3010000, 0x1f1f0f07, 0x3010000, 0x1f1f0f07, 0x3010000, 0x1f1f0f07, 0x3010100, 0x3f1f0f07, 0x3010100, 0x3f1f0f07, 0x3010100, 0x3f1f0f07, 0x3030100, 0x3f1f0f07}},
+    {{3, 4}, {0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe}},
+    {{3, 4}, {0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc}},
+    {{3, 4}, {0xc0c0c0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0x80c0c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0}},
+    {{3, 4}, {0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0}},
+    {{3, 4}, {0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0e0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfcfcfcfe, 0xf8fcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0f0, 0xc0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080}},
+    {{3, 4}, {0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f8, 0xe0e0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x808080c0, 0x8080, 0x8080, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe}},
+    {{1, 3}, {0xffffffff, 0x1070f3f, 0xffffffff, 0x30f3fff, 0xffffffff, 0xf1f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x30f3f, 0x0, 0x3071f7f, 0x0, 0x71f7fff, 0x1, 0xf3fffff, 0x107, 0x3fffffff, 0x30f, 0x7fffffff, 0x30f1f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x71f3fff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x307, 0x0, 0x1071f, 0x0, 0x1070f3f, 0x0, 0x30f3fff, 0x0}},
+    {{1, 4}, {0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0f8, 0x0, 0x80e0f0f8, 0x0, 0x80c0e0f8, 0x0, 0x80c0e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fe}},
+    {{2, 3}, {0xffffffff, 0x80, 0xffffffff, 0xf0, 0xffffffff, 0xfe, 0xffffffff, 0x80ff, 0xffffffff, 0xf0ff, 0xffffffff, 0xfeff, 0xffffffff, 0xc0ffff, 0xffffffff, 0xf8ffff}},
+    {{2, 3}, {0xffffffff, 0x80ff, 0xffffffff, 0xe0ff, 0xffffffff, 0xfcff, 0xffffffff, 0x80ffff, 0xffffffff, 0xf0ffff, 0xffffffff, 0xfeffff, 0xffffffff, 0x80ffffff, 0xffffffff, 0xf0ffffff}},
+    {{2, 3}, {0xffffffff, 0xc0ffff, 0xffffffff, 0xf0ffff, 0xffffffff, 0x80feffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xf8ffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x30f3fff, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f7f, 0x0, 0x71f3fff, 0x1, 0xf3fffff, 0x103, 0x3f7fffff, 0x30f, 0x7fffffff, 0x3071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x70f3fff, 0xffffffff, 0xf3fffff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1071f, 0x0, 0x30f3f, 0x0, 0x30f3f7f, 0x0, 0x71f7fff, 0x1}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xe0, 0x0, 0xf8, 0x0}},
+    {{2, 3}, {0x0, 0x0, 0xc0, 0x0, 0xf0, 0x0, 0xf8, 0x0, 0xc0fe, 0x0, 0xf0ff, 0x0, 0x80f8ff, 0x0, 0xc0feff, 0x0}},
+    {{2, 3}, {0xf0ff, 0x0, 0x80f8ff, 0x0, 0xe0feff, 0x0, 0xf0ffff, 0x0, 0x80fcffff, 0x0, 0xe0feffff, 0x0, 0xf0ffffff, 0x0, 0xfcffffff, 0x80}},
+    {{2, 3}, {0xf0ffffff, 0x80, 0xf8ffffff, 0xc0, 0xfeffffff, 0xe0, 0xffffffff, 0x80f0, 0xffffffff, 0xc0fc, 0xffffffff, 0xe0fe, 0xffffffff, 0x80f0ff, 0xffffffff, 0xc0fcff}},
+    {{2, 3}, {0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0x80f0feff, 0xffffffff, 0xc0f8ffff, 0xffffffff, 0xe0fcffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff}},
+    {{2, 3}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x71f7fff, 0xffffffff, 0x1f3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x70f3fff, 0x1, 0xf3fffff, 0x3, 0x1f7fffff, 0x30f, 0x7fffffff, 0x1071f, 0xffffffff, 0x1071f3f, 0xffffffff, 0x30f3fff, 0xffffffff, 0xf3f7fff, 0xffffffff, 0x1f7fffff}},
+    {{1, 3}, {0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1070f, 0x0, 0x30f3f, 0x0, 0x30f1f7f, 0x0, 0x71f7fff, 0x1, 0x1f3fffff, 0x107}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80e0f0, 0xf8fcffff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0, 0xf0fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xf0f8fcff, 0x80c0, 0xe0f8fcfe, 0x80c0, 0xe0f0fcfe, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0}},
+    {{2, 3}, {0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0x80f0fe, 0x0, 0xc0f8ff, 0x0, 0xe0fcff, 0x0, 0x80f0feff, 0x0}},
+    {{2, 3}, {0xc0f8ffff, 0x0, 0xe0fcffff, 0x0, 0xf0feffff, 0x80, 0xf8ffffff, 0xc0, 0xfcffffff, 0xe0, 0xfeffffff, 0x80f0, 0xffffffff, 0xc0f8, 0xffffffff, 0xe0fc}},
+    {{1, 3}, {0xf1f7fff, 0x3, 0x1f7fffff, 0x107, 0x7fffffff, 0x1071f, 0xffffffff, 0x30f3f, 0xffffffff, 0x30f3fff, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff}},
+    {{1, 3}, {0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f3f, 0x0, 0x1071f7f, 0x0, 0x71f7fff, 0x1, 0xf3fffff, 0x103, 0x3fffffff, 0x30f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x307, 0x0}},
+    {{1, 4}, {0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fe}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80e0f0, 0xf8feffff, 0x80c0f0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 2}, {0xff7f3f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7030301, 0x0, 0x7070301, 0x1000000, 0x7070301, 0x1000000, 0xf070301, 0x1000000, 0xf070303}},
+    {{1, 4}, {0xe0f8fcff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0xc0, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f8fc, 0x0}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff}},
+    {{1, 2}, {0x3f1f0f07, 0xffff7f3f, 0x3f1f0f0f, 0xffff7f7f, 0x3f1f0f0f, 0xffff7f7f, 0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000, 0x0, 0x3010000, 0x0, 0x3010000}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8}},
+    {{1, 2}, {0xf070301, 0x7f3f1f0f, 0xf070303, 0x7f3f1f1f, 0xf070303, 0x7f3f1f1f, 0xf070703, 0x7f3f3f1f, 0xf070703, 0x7f7f3f1f, 0xf0f0703, 0x7f7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f}},
+    {{1, 4}, {0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0f8fe, 0x80, 0xc0f0f8fe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 2}, {0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010100, 0x1f0f0f07, 0x3010100, 0x1f1f0f07, 0x3030100, 0x1f1f0f07, 0x3030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0e0f8fc, 0xffffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfeffffff, 0xc0e0f8, 0xfcffffff, 0xc0e0f8}},
+    {{1, 2}, {0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030301, 0x0, 0x7030301, 0x0, 0x7070301, 0x0, 0x7070301, 0x0, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303}},
+    {{1, 4}, {0xf0f8feff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f0fcff, 0x80, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80}},
+    {{1, 2}, {0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x1010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3010100}},
+    {{1, 2}, {0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f3f, 0x1f0f0703, 0xff7f3f3f, 0x1f0f0707, 0xff7f7f3f, 0x1f0f0707, 0xff7f7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000}},
+    {{1, 2}, {0x7030101, 0x3f1f1f0f, 0x7030301, 0x3f3f1f0f, 0x7030301, 0x3f3f1f0f, 0x7070301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f1f}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0f07, 0x3010000, 0x1f0f0f07, 0x3010000, 0x1f0f0f07, 0x3010100, 0x1f1f0f07}},
+    {{1, 2}, {0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7070301, 0x0, 0x7070301, 0x0, 0x7070301, 0x0, 0xf070301, 0x0, 0xf070301, 0x0, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070301}},
+    {{1, 2}, {0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100}},
+    {{1, 2}, {0x1f0f0f07, 0xffff7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f7f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 2}, {0xf070301, 0x7f3f1f1f, 0xf070301, 0x7f3f3f1f, 0xf070301, 0x7f3f3f1f, 0xf070303, 0x7f3f3f1f, 0xf070303, 0x7f7f3f1f, 0xf070303, 0x7f7f3f1f, 0xf070703, 0xff7f3f1f, 0xf070703, 0xff7f3f1f}},
+    {{1, 2}, {0x3030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f0f, 0x7030100, 0x3f1f0f0f, 0x7030100, 0x3f1f1f0f, 0x7030100, 0x3f1f1f0f}},
+    {{3, 4}, {0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0}},
+    {{3, 4}, {0xf8f8f8fc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0}},
+    {{3, 4}, {0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe}},
+    {{3, 4}, {0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc}},
+    {{3, 4}, {0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfcfefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xe0f0f0f0}},
+    {{3, 4}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xfeffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0}},
+    {{3, 4}, {0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfe, 0xf8fcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0f0, 0xc0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 3}, {0xffffffff, 0xf3fffff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x71f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1070f, 0xffffffff, 0x30f3f, 0xffffffff, 0x30f1f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff}},
+    {{2, 3}, {0xffffffff, 0xffffff, 0xffffffff, 0xc0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1f7fffff, 0x107, 0x3fffffff, 0x1030f, 0xffffffff, 0x30f3f, 0xffffffff, 0x3071f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff}},
+    {{1, 3}, {0x3, 0x0, 0x30f, 0x0, 0x1071f, 0x0, 0x1071f3f, 0x0, 0x30f3fff, 0x1, 0xf3f7fff, 0x3, 0x1f7fffff, 0x107, 0x7fffffff, 0x1071f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80e0f0, 0xf8fcfeff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0, 0xf0f8feff, 0xc0e0, 0xf0f8fcff, 0x80e0, 0xe0f8fcfe, 0x80c0, 0xe0f0fcfe, 0x80c0, 0xe0f0f8fe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0xfc, 0x0, 0xff, 0x0, 0xe0ff, 0x0}},
+    {{2, 3}, {0x0, 0x0, 0xc0, 0x0, 0xf0, 0x0, 0xff, 0x0, 0xc0ff, 0x0, 0xf8ff, 0x0, 0xffff, 0x0, 0xc0ffff, 0x0}},
+    {{2, 3}, {0x80fe, 0x0, 0xe0ff, 0x0, 0xf8ff, 0x0, 0x80feff, 0x0, 0xe0ffff, 0x0, 0xf8ffff, 0x0, 0x80ffffff, 0x0, 0xe0ffffff, 0x0}},
+    {{2, 3}, {0xf0ffff, 0x0, 0x80f8ffff, 0x0, 0xc0feffff, 0x0, 0xf0ffffff, 0x0, 0xfcffffff, 0x80, 0xfeffffff, 0xc0, 0xffffffff, 0xf0, 0xffffffff, 0x80fc}},
+    {{2, 3}, {0xfeffffff, 0xe0, 0xffffffff, 0xf0, 0xffffffff, 0x80fc, 0xffffffff, 0xe0fe, 0xffffffff, 0xf0ff, 0xffffffff, 0x80fcff, 0xffffffff, 0xe0feff, 0xffffffff, 0xf0ffff}},
+    {{2, 3}, {0xffffffff, 0xe0feff, 0xffffffff, 0x80f0ffff, 0xffffffff, 0xc0fcffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x3fffffff, 0x1030f, 0x7fffffff, 0x30f3f, 0xffffffff, 0x3071f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x30f, 0x0, 0x1071f, 0x0, 0x1071f3f, 0x0, 0x30f3fff, 0x0, 0xf3f7fff, 0x3, 0x1f7fffff, 0x107, 0x7fffffff, 0x1071f, 0xffffffff, 0x1030f3f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f1f, 0x0}},
+    {{1, 4}, {0xe0f0f8fe, 0x80, 0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0xf0, 0x0}},
+    {{2, 3}, {0xf0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0xf0fe, 0x0, 0x80f8ff, 0x0, 0xe0fcff, 0x0, 0xf0feff, 0x0, 0x80f8ffff, 0x0}},
+    {{2, 3}, {0xc0f8ffff, 0x0, 0xe0fcffff, 0x0, 0xf0feffff, 0x80, 0xf8ffffff, 0xc0, 0xfcffffff, 0xe0, 0xfeffffff, 0x80f0, 0xffffffff, 0xc0f8, 0xffffffff, 0xe0fc}},
+    {{2, 3}, {0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0xf0feff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xc0fcffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0xf0ffffff}},
+    {{2, 3}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x7fffffff, 0x30f1f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x71f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f, 0x0, 0x1070f3f, 0x0, 0x30f3fff, 0x0, 0xf1f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1071f, 0xffffffff, 0x1030f3f, 0xffffffff, 0x30f3f7f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f1f, 0x0, 0x1071f7f, 0x0}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0}},
+    {{2, 3}, {0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0f8, 0x0, 0x80e0fc, 0x0, 0x80f0fe, 0x0, 0xc0f8ff, 0x0, 0xe0fcff, 0x0}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x30f, 0x0, 0x1071f, 0x0, 0x1071f7f, 0x0, 0x30f3fff, 0x1}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0x80c0e0, 0xf8fcfeff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80e0, 0xf0f8fcff, 0x80c0, 0xe0f8fcff, 0x80c0, 0xe0f0fcfe, 0xc0, 0xe0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1010000, 0xf0f0703, 0x3010000, 0xf0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010100, 0x1f0f0707, 0x3030100, 0x1f0f0f07}},
+    {{1, 4}, {0x80e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0, 0xc0e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xffffffff, 0xc0e0f8fc}},
+    {{1, 2}, {0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101}},
+    {{1, 4}, {0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff}},
+    {{1, 2}, {0x1f0f0707, 0xff7f3f3f, 0x1f0f0707, 0xff7f3f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f0f, 0xffff7f7f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 4}, {0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0, 0xc0e0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fe}},
+    {{1, 2}, {0x7030101, 0x3f1f0f0f, 0x7030101, 0x3f1f0f0f, 0x7030301, 0x3f1f1f0f, 0x7030301, 0x3f3f1f0f, 0x7070301, 0x3f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070303, 0x7f3f1f1f}},
+    {{1, 4}, {0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0xc0e0, 0xf8fcffff, 0xc0e0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 2}, {0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf0f0703, 0x1010000, 0xf0f0703, 0x1010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707}},
+    {{1, 4}, {0xc0f0f8fe, 0x0, 0xc0e0f8fc, 0x0, 0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0}},
+    {{1, 2}, {0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101, 0x0, 0x7030301}},
+    {{1, 2}, {0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f0f, 0xffff7f7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000}},
+    {{1, 2}, {0xf070301, 0x7f3f1f1f, 0xf070303, 0x7f3f3f1f, 0xf070303, 0x7f3f3f1f, 0xf070703, 0x7f7f3f1f, 0xf070703, 0x7f7f3f1f, 0xf0f0703, 0xff7f3f1f, 0xf0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f}},
+    {{1, 2}, {0x3010100, 0x1f1f0f07, 0x3030100, 0x3f1f0f07, 0x3030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f0f, 0x7030100, 0x3f1f0f0f, 0x7030101, 0x3f1f1f0f}},
+    {{1, 2}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070303, 0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf0f0703, 0x1000000, 0xf0f0703, 0x1010000, 0x1f0f0703}},
+    {{1, 2}, {0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101}},
+    {{1, 2}, {0x3f1f0f07, 0xffff7f7f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f07, 0xffffff7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x3010000, 0x0, 0x3010000}},
+    {{1, 2}, {0xf0f0703, 0xff7f3f1f, 0xf0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f3f, 0x1f0f0703, 0xff7f3f3f, 0x1f0f0703, 0xff7f7f3f}},
+    {{1, 2}, {0x7030100, 0x3f1f1f0f, 0x7030101, 0x3f3f1f0f, 0x7030101, 0x3f3f1f0f, 0x7030301, 0x3f3f1f0f, 0x7030301, 0x7f3f1f0f, 0x7030301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0}},
+    {{3, 4}, {0xffffffff, 0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0}},
+    {{3, 4}, {0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080, 0x0}},
+    {{3, 4}, {0xf8f8f8f8, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff}},
+    {{3, 4}, {0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfcfefefe}},
+    {{3, 4}, {0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8fcfcfc}},
+    {{3, 4}, {0xc0c0c0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefeff, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8}},
+    {{3, 4}, {0x80808080, 0x8080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8fc, 0xf0f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0}},
+    {{3, 4}, {0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfe, 0xf8f8fcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0f0, 0xc0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0}},
+    {{1, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x7fffffff, 0x1071f, 0xffffffff, 0x1070f3f, 0xffffffff, 0x30f3fff, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff}},
+    {{1, 3}, {0xffffffff, 0x1030f3f, 0xffffffff, 0x30f3fff, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x30f1f, 0x0, 0x1071f7f, 0x0, 0x71f3fff, 0x1, 0xf3fffff, 0x103, 0x3f7fffff, 0x30f, 0x7fffffff, 0x1071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x30f3fff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1070f, 0x0, 0x30f3f, 0x0, 0x30f1f7f, 0x0}},
+    {{1, 4}, {0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fc}},
+    {{2, 3}, {0xfcff, 0x0, 0x80ffff, 0x0, 0xf0ffff, 0x0, 0xfeffff, 0x0, 0x80ffffff, 0x0, 0xf0ffffff, 0x0, 0xfeffffff, 0x0, 0xffffffff, 0x80}},
+    {{2, 3}, {0xf8ffff, 0x0, 0xffffff, 0x0, 0xe0ffffff, 0x0, 0xfcffffff, 0x0, 0xffffffff, 0x0, 0xffffffff, 0xe0, 0xffffffff, 0xfc, 0xffffffff, 0xff}},
+    {{2, 3}, {0xfcffffff, 0x0, 0xffffffff, 0x80, 0xffffffff, 0xf0, 0xffffffff, 0xfc, 0xffffffff, 0xc0ff, 0xffffffff, 0xf0ff, 0xffffffff, 0xfcff, 0xffffffff, 0xc0ffff}},
+    {{2, 3}, {0xffffffff, 0xc0ff, 0xffffffff, 0xf0ff, 0xffffffff, 0x80fcff, 0xffffffff, 0xc0ffff, 0xffffffff, 0xf0ffff, 0xffffffff, 0x80fcffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xf0ffffff}},
+    {{2, 3}, {0xffffffff, 0xc0fcffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x30f3fff, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f7f, 0x0, 0x71f3fff, 0x1, 0xf3fffff, 0x103, 0x3f7fffff, 0x30f, 0x7fffffff, 0x3071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x70f3fff, 0xffffffff, 0xf3fffff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1070f, 0x0, 0x30f3f, 0x0, 0x30f1f7f, 0x0, 0x71f7fff, 0x1}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xe0, 0x0, 0xf0, 0x0, 0x80fc, 0x0, 0xe0fe, 0x0}},
+    {{2, 3}, {0xc0f8, 0x0, 0xe0fe, 0x0, 0xf0ff, 0x0, 0xc0f8ff, 0x0, 0xe0feff, 0x0, 0xf0ffff, 0x0, 0xc0f8ffff, 0x0, 0xe0feffff, 0x0}},
+    {{2, 3}, {0xe0fcffff, 0x0, 0xf0feffff, 0x0, 0xf8ffffff, 0x80, 0xfcffffff, 0xc0, 0xfeffffff, 0xf0, 0xffffffff, 0x80f8, 0xffffffff, 0xc0fc, 0xffffffff, 0xe0fe}},
+    {{2, 3}, {0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0xf0feff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xe0fcffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xf8ffffff}},
+    {{2, 3}, {0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x71f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x71f3fff, 0x1, 0xf3fffff, 0x103, 0x3f7fffff, 0x30f, 0x7fffffff, 0x3071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x70f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x1f7fffff}},
+    {{1, 3}, {0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1070f, 0x0, 0x30f3f, 0x0, 0x30f3f7f, 0x0, 0x71f7fff, 0x1, 0x1f7fffff, 0x107}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80e0f0, 0xf8fcffff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0, 0xf0fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xf0f8fcff, 0x80c0, 0xe0f8fcfe, 0x80c0, 0xe0f0fcfe, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0}},
+    {{2, 3}, {0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0x80f0fe, 0x0, 0xc0f8ff, 0x0, 0xe0fcff, 0x0}},
+    {{2, 3}, {0x80f0feff, 0x0, 0xc0f8ffff, 0x0, 0xe0fcffff, 0x0, 0xf0feffff, 0x80, 0xf8ffffff, 0xc0, 0xfcffffff, 0xe0, 0xfeffffff, 0x80f0, 0xffffffff, 0xc0f8}},
+    {{1, 3}, {0xf3fffff, 0x3, 0x1f7fffff, 0x307, 0x7fffffff, 0x1071f, 0xffffffff, 0x1071f3f, 0xffffffff, 0x30f3fff, 0xffffffff, 0xf3f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff}},
+    {{1, 3}, {0x3, 0x0, 0x107, 0x0, 0x1070f, 0x0, 0x30f3f, 0x0, 0x30f1f7f, 0x0, 0x71f7fff, 0x1, 0x1f3fffff, 0x107, 0x3fffffff, 0x30f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x30f, 0x0}},
+    {{1, 4}, {0xe0f0f8fe, 0x80, 0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0x80c0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f0, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0}},
+    {{1, 2}, {0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030301, 0x0, 0x7030301, 0x0, 0x7070301, 0x1000000, 0x7070301, 0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1010000, 0xf070703}},
+    {{1, 4}, {0xf0f8feff, 0x80c0, 0xf0f8fcff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0xc0, 0xe0f0fcfe, 0x80, 0xe0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 2}, {0x3f1f0f0f, 0xffff7f7f, 0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f1f, 0xffffff7f, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100}},
+    {{1, 4}, {0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0f0f8}},
+    {{1, 2}, {0xf070303, 0x7f3f1f1f, 0xf070703, 0x7f3f3f1f, 0xf070703, 0x7f3f3f1f, 0xf0f0703, 0x7f7f3f1f, 0xf0f0703, 0x7f7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0707, 0xff7f3f3f, 0x1f0f0707, 0xff7f3f3f}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf0fcfeff, 0x80e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0x80, 0xe0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 2}, {0x3010000, 0x1f0f0f07, 0x3010100, 0x1f0f0f07, 0x3010100, 0x1f1f0f07, 0x3030100, 0x1f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030101, 0x3f1f0f0f, 0x7030101, 0x3f1f0f0f}},
+    {{1, 4}, {0xc0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0}},
+    {{1, 2}, {0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030301, 0x0, 0x7070301, 0x0, 0x7070301, 0x1000000, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303, 0x1000000, 0xf070703}},
+    {{1, 2}, {0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3030100}},
+    {{1, 2}, {0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f3f, 0x1f0f0707, 0xff7f3f3f, 0x1f0f0707, 0xff7f7f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000}},
+    {{1, 2}, {0x7030101, 0x3f1f1f0f, 0x7030301, 0x3f3f1f0f, 0x7030301, 0x3f3f1f0f, 0x7070301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f1f}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0f07, 0x3010000, 0x1f0f0f07, 0x3010100, 0x1f1f0f07}},
+    {{1, 2}, {0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030301, 0x0, 0x7030301, 0x0, 0x7070301, 0x0, 0x7070301, 0x0, 0x7070301, 0x0, 0xf070301, 0x0, 0xf070301, 0x1000000, 0xf070301}},
+    {{1, 2}, {0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3010100}},
+    {{1, 2}, {0x1f0f0703, 0xff7f7f3f, 0x1f0f0707, 0xff7f7f3f, 0x1f0f0707, 0xffff7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 2}, {0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f1f, 0xf070301, 0x7f3f1f1f, 0xf070301, 0x7f3f1f1f, 0xf070301, 0x7f3f3f1f, 0xf070303, 0x7f3f3f1f, 0xf070303, 0x7f7f3f1f}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0}},
+    {{3, 4}, {0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0}},
+    {{3, 4}, {0x80808080, 0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xf0f0f0f0}},
+    {{3, 4}, {0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0}},
+    {{3, 4}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0}},
+    {{3, 4}, {0xfcfcfcfc, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080}},
+    {{3, 4}, {0xf8f8f8fc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff}},
+    {{3, 4}, {0xf0f0f0f8, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe}},
+    {{3, 4}, {0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0e0, 0x80c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefeff, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0x80808080, 0x80808080, 0x80, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8fc, 0xf0f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0}},
+    {{1, 3}, {0xffffffff, 0xf3f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x71f7fff, 0x1, 0xf3fffff, 0x107, 0x3fffffff, 0x30f, 0x7fffffff, 0x30f1f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x71f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3f7fffff}},
+    {{1, 3}, {0x1, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1071f, 0x0, 0x1030f3f, 0x0, 0x30f3f7f, 0x0, 0x71f7fff, 0x3, 0x1f7fffff, 0x107}},
+    {{1, 4}, {0xfeffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0xc0e0f0f8, 0xfcfeffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xf8feffff, 0xc0e0f0, 0xf8fcfeff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0}},
+    {{2, 3}, {0xffffffff, 0xf0, 0xffffffff, 0xff, 0xffffffff, 0xc0ff, 0xffffffff, 0xf8ff, 0xffffffff, 0xffff, 0xffffffff, 0xc0ffff, 0xffffffff, 0xf8ffff, 0xffffffff, 0xffffff}},
+    {{2, 3}, {0xffffffff, 0xe0ff, 0xffffffff, 0xfcff, 0xffffffff, 0x80ffff, 0xffffffff, 0xe0ffff, 0xffffffff, 0xfeffff, 0xffffffff, 0x80ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 3}, {0xffffffff, 0xf0ffff, 0xffffffff, 0xfcffff, 0xffffffff, 0xc0ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1f3fffff, 0x107, 0x3fffffff, 0x1030f, 0x7fffffff, 0x30f3f, 0xffffffff, 0x3071f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff}},
+    {{1, 3}, {0x3, 0x0, 0x307, 0x0, 0x1071f, 0x0, 0x1070f3f, 0x0, 0x30f3fff, 0x0, 0xf1f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1071f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x103, 0x0, 0x30f, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80e0f0, 0xf8fcfeff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0, 0xf0f8feff, 0xc0e0, 0xf0f8fcff, 0x80c0, 0xe0f8fcfe, 0x80c0, 0xe0f0fcfe, 0xc0, 0xe0f0f8fc, 0x80}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xf0, 0x0, 0xfc, 0x0}},
+    {{2, 3}, {0x80, 0x0, 0xe0, 0x0, 0xf0, 0x0, 0x80fc, 0x0, 0xe0ff, 0x0, 0xf0ff, 0x0, 0x80fcff, 0x0, 0xe0ffff, 0x0}},
+    {{2, 3}, {0xf0ff, 0x0, 0x80fcff, 0x0, 0xe0feff, 0x0, 0xf0ffff, 0x0, 0x80fcffff, 0x0, 0xe0feffff, 0x0, 0xf0ffffff, 0x0, 0xfcffffff, 0x80}},
+    {{2, 3}, {0xf0ffffff, 0x0, 0xf8ffffff, 0xc0, 0xfeffffff, 0xe0, 0xffffffff, 0xf0, 0xffffffff, 0x80f8, 0xffffffff, 0xe0fe, 0xffffffff, 0xf0ff, 0xffffffff, 0x80f8ff}},
+    {{2, 3}, {0xffffffff, 0x80f8ff, 0xffffffff, 0xc0fcff, 0xffffffff, 0xe0feff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xc0fcffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xfcffffff}},
+    {{2, 3}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x3fffffff, 0x1030f, 0xffffffff, 0x30f3f, 0xffffffff, 0x3071f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x30f, 0x0, 0x1071f, 0x0, 0x1071f3f, 0x0, 0x30f3fff, 0x1, 0xf3f7fff, 0x3, 0x1f7fffff, 0x307, 0x7fffffff, 0x1071f, 0xffffffff, 0x1070f3f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f1f, 0x0}},
+    {{1, 4}, {0xe0f0f8fe, 0x80, 0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0}},
+    {{2, 3}, {0xc0, 0x0, 0xe0, 0x0, 0x80f8, 0x0, 0xc0fc, 0x0, 0xe0fe, 0x0, 0x80f0ff, 0x0, 0xc0f8ff, 0x0, 0xe0feff, 0x0}},
+    {{2, 3}, {0x80f0feff, 0x0, 0xc0f8ffff, 0x0, 0xe0fcffff, 0x0, 0xf0feffff, 0x80, 0xf8ffffff, 0xc0, 0xfcffffff, 0xe0, 0xfeffffff, 0x80f0, 0xffffffff, 0xc0f8}},
+    {{2, 3}, {0xffffffff, 0xe0fc, 0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0x80f0feff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xc0f8ffff, 0xffffffff, 0xe0fcffff}},
+    {{2, 3}, {0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x7fffffff, 0x30f3f, 0xffffffff, 0x3071f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f, 0x0, 0x1071f3f, 0x0, 0x30f3fff, 0x1, 0xf3f7fff, 0x3, 0x1f7fffff, 0x307, 0x7fffffff, 0x1071f, 0xffffffff, 0x1070f3f, 0xffffffff, 0x30f3fff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f1f, 0x0, 0x1071f7f, 0x0}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f0}},
+    {{2, 3}, {0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0x80f0fe, 0x0, 0xc0f0fe, 0x0, 0xc0f8ff, 0x0}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f1f, 0x0, 0x1071f7f, 0x0, 0x71f3fff, 0x1}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0, 0xf0fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xf0f8feff, 0x80c0, 0xe0f8fcff, 0x80c0, 0xe0f8fcfe, 0xc0, 0xe0f0fcfe, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1010000, 0xf0f0703, 0x3010000, 0xf0f0703, 0x3010000, 0x1f0f0707, 0x3010100, 0x1f0f0707, 0x3010100, 0x1f0f0f07, 0x3030100, 0x1f0f0f07, 0x7030100, 0x1f1f0f07, 0x7030101, 0x3f1f0f07}},
+    {{1, 4}, {0xc0e0f8fc, 0x0, 0x80e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc}},
+    {{1, 2}, {0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7070301}},
+    {{1, 4}, {0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0xc0e0f0, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0x80c0e0, 0xf8fcfeff, 0xc0e0, 0xf0fcfeff, 0x80e0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff}},
+    {{1, 2}, {0x1f0f0f07, 0xff7f7f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f0f, 0xffff7f7f, 0x3f1f1f0f, 0xffff7f7f, 0x3f1f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 4}, {0xc0f0f8fe, 0x80, 0xc0f0f8fe, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f8fc, 0x0, 0xc0e0f0fc, 0x0, 0x80e0f0fc, 0x0, 0x80c0f0f8, 0x0, 0x80c0f0f8, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe}},
+    {{1, 2}, {0x7030301, 0x3f1f1f0f, 0x7030301, 0x3f1f1f0f, 0x7070301, 0x3f3f1f0f, 0x7070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070303, 0x7f3f1f1f, 0xf070303, 0x7f3f1f1f, 0xf070703, 0x7f3f3f1f}},
+    {{1, 4}, {0xc0e0, 0x0, 0x80e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070703, 0x1010000, 0xf0f0703, 0x1010000, 0xf0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010100, 0x1f0f0f07}},
+    {{1, 2}, {0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7030301}},
+    {{1, 2}, {0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f0f, 0xffff7f7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000, 0x0, 0x1010000}},
+    {{1, 2}, {0xf070301, 0x7f3f1f1f, 0xf070303, 0x7f3f3f1f, 0xf070303, 0x7f3f3f1f, 0xf070703, 0x7f7f3f1f, 0xf070703, 0x7f7f3f1f, 0xf0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f}},
+    {{1, 2}, {0x3010100, 0x1f1f0f07, 0x3030100, 0x3f1f0f07, 0x3030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f0f, 0x7030100, 0x3f1f0f0f, 0x7030101, 0x3f1f1f0f}},
+    {{1, 2}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf0f0703, 0x1000000, 0xf0f0703, 0x1010000, 0x1f0f0703}},
+    {{1, 2}, {0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030101}},
+    {{1, 2}, {0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000, 0x0, 0x1010000}},
+    {{1, 2}, {0xf070703, 0x7f7f3f1f, 0xf070703, 0xff7f3f1f, 0xf070703, 0xff7f3f1f, 0xf0f0703, 0xff7f3f1f, 0xf0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f3f}},
+    {{3, 4}, {0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8}},
+    {{3, 4}, {0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0}},
+    {{3, 4}, {0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0}},
+    {{3, 4}, {0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0}},
+    {{3, 4}, {0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x80}},
+    {{3, 4}, {0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x808080c0, 0x80808080, 0x808080, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0e0, 0x80c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefeff, 0xfcfefefe, 0xfcfefefe, 0xfcfcfcfc}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8fc, 0xf0f8f8f8}},
+    {{1, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x3fffffff, 0x1070f, 0x7fffffff, 0x30f3f, 0xffffffff, 0x3071f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x30f, 0x0, 0x1071f, 0x0, 0x1070f3f, 0x0, 0x30f3fff, 0x0, 0xf1f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1071f, 0xffffffff, 0x30f3f}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff}},
+    {{2, 3}, {0xffffffff, 0xc0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x1030f3f, 0xffffffff, 0x30f1f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x3071f, 0x0, 0x1071f3f, 0x0, 0x30f3fff, 0x1, 0xf3f7fff, 0x3, 0x1f7fffff, 0x307, 0x7fffffff, 0x1071f, 0xffffffff, 0x1070f3f, 0xffffffff, 0x30f3fff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f1f, 0x0, 0x1071f7f, 0x0}},
+    {{1, 4}, {0xc0f0f8fc, 0x80, 0xc0e0f0fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f0, 0x0, 0xc0e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xe0f0f8fc}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xfc, 0x0, 0xff, 0x0, 0xe0ff, 0x0, 0xfcff, 0x0}},
+    {{2, 3}, {0x80, 0x0, 0xf0, 0x0, 0xfe, 0x0, 0x80ff, 0x0, 0xf0ff, 0x0, 0xfeff, 0x0, 0x80ffff, 0x0, 0xf0ffff, 0x0}},
+    {{2, 3}, {0xc0ff, 0x0, 0xf0ff, 0x0, 0xfcff, 0x0, 0xc0ffff, 0x0, 0xf0ffff, 0x0, 0xfeffff, 0x0, 0xc0ffffff, 0x0, 0xf0ffffff, 0x0}},
+    {{2, 3}, {0xf0ffff, 0x0, 0x80fcffff, 0x0, 0xe0ffffff, 0x0, 0xf0ffffff, 0x0, 0xfcffffff, 0x80, 0xffffffff, 0xe0, 0xffffffff, 0xf0, 0xffffffff, 0x80fc}},
+    {{2, 3}, {0xfeffffff, 0xe0, 0xffffffff, 0xf0, 0xffffffff, 0x80fc, 0xffffffff, 0xe0fe, 0xffffffff, 0xf0ff, 0xffffffff, 0x80fcff, 0xffffffff, 0xe0feff, 0xffffffff, 0xf0ffff}},
+    {{2, 3}, {0xffffffff, 0xe0feff, 0xffffffff, 0xf0ffff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xc0fcffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x30f3fff, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f7f, 0x0, 0x70f3fff, 0x1, 0xf3fffff, 0x3, 0x1f7fffff, 0x30f, 0x7fffffff, 0x1071f, 0xffffffff, 0x1071f3f, 0xffffffff, 0x30f3fff, 0xffffffff, 0xf3f7fff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x1030f, 0x0, 0x30f3f, 0x0, 0x3071f7f, 0x0, 0x71f7fff, 0x1}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfcfeffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xf8feffff, 0xc0e0f0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xf0, 0x0}},
+    {{2, 3}, {0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fe, 0x0, 0x80f0ff, 0x0, 0xc0f8ff, 0x0, 0xe0feff, 0x0, 0xf0ffff, 0x0}},
+    {{2, 3}, {0x80f0ffff, 0x0, 0xc0f8ffff, 0x0, 0xe0fcffff, 0x0, 0xf0ffffff, 0x80, 0xf8ffffff, 0xc0, 0xfcffffff, 0xe0, 0xfeffffff, 0x80f0, 0xffffffff, 0xc0f8}},
+    {{2, 3}, {0xffffffff, 0xe0fc, 0xffffffff, 0xf0fe, 0xffffffff, 0x80f8ff, 0xffffffff, 0xc0fcff, 0xffffffff, 0xe0feff, 0xffffffff, 0x80f0ffff, 0xffffffff, 0xc0f8ffff, 0xffffffff, 0xe0fcffff}},
+    {{2, 3}, {0xffffffff, 0xf0feffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0xf1f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x71f3fff, 0x1, 0xf3fffff, 0x103, 0x3f7fffff, 0x30f, 0x7fffffff, 0x3071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x70f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x1f7fffff}},
+    {{1, 3}, {0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1070f, 0x0, 0x30f3f, 0x0, 0x30f1f7f, 0x0, 0x71f7fff, 0x1, 0x1f3fffff, 0x107}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80e0f0, 0xf8fcffff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0, 0xf0fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xf0f8fcff, 0x80c0, 0xe0f8fcfe, 0x80c0, 0xe0f0fcfe, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 3}, {0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0x80f0fe, 0x0, 0xc0f8ff, 0x0}},
+    {{2, 3}, {0xe0fcff, 0x0, 0x80f0feff, 0x0, 0xc0f8ffff, 0x0, 0xe0fcffff, 0x0, 0xf0feffff, 0x80, 0xf8ffffff, 0xc0, 0xfcffffff, 0xe0, 0xfeffffff, 0x80f0}},
+    {{1, 3}, {0xf3fffff, 0x3, 0x3f7fffff, 0x30f, 0x7fffffff, 0x1071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x30f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff}},
+    {{1, 3}, {0x3, 0x0, 0x107, 0x0, 0x1071f, 0x0, 0x30f3f, 0x0, 0x30f3f7f, 0x0, 0x71f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1070f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x30f, 0x0}},
+    {{1, 4}, {0xe0f0f8fe, 0x80, 0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80e0f0}},
+    {{1, 2}, {0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0x7070301, 0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303, 0x1010000, 0xf070703, 0x1010000, 0xf0f0703, 0x3010000, 0xf0f0703, 0x3010000, 0x1f0f0703}},
+    {{1, 4}, {0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8fcff, 0x80c0, 0xe0f8fcff, 0xc0, 0xe0f0fcfe, 0xc0, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fc, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf0fcfeff}},
+    {{1, 2}, {0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3030100}},
+    {{1, 4}, {0x80c0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0f0, 0x0, 0xc0e0, 0x0, 0xc0e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0x80e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfeffffff, 0x80c0f0f8}},
+    {{1, 2}, {0xf070703, 0x7f3f3f1f, 0xf0f0703, 0x7f7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0707, 0xff7f3f3f, 0x1f0f0f07, 0xff7f3f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f1f0f07, 0xffff7f3f}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 2}, {0x3010100, 0x1f0f0f07, 0x3030100, 0x1f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030101, 0x3f1f0f0f, 0x7030101, 0x3f1f0f0f, 0x7030301, 0x3f1f1f0f, 0x7030301, 0x3f1f1f0f}},
+    {{1, 2}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7070301, 0x0, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf0f0703}},
+    {{1, 2}, {0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100}},
+    {{1, 2}, {0x1f0f0703, 0xff7f3f3f, 0x1f0f0707, 0xff7f3f3f, 0x1f0f0707, 0xff7f7f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 2}, {0x7030101, 0x3f1f1f0f, 0x7030301, 0x3f3f1f0f, 0x7030301, 0x3f3f1f0f, 0x7070301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f1f}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0f07, 0x3010000, 0x1f0f0f07, 0x3010100, 0x1f1f0f07}},
+    {{1, 2}, {0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7030301, 0x0, 0x7070301, 0x0, 0x7070301, 0x0, 0xf070301, 0x0, 0xf070301, 0x1000000, 0xf070301}},
+    {{1, 2}, {0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100}},
+    {{1, 2}, {0x1f0f0703, 0xff7f3f3f, 0x1f0f0703, 0xff7f7f3f, 0x1f0f0707, 0xff7f7f3f, 0x1f0f0707, 0xffff7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{3, 4}, {0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x0, 0x0}},
+    {{3, 4}, {0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe}},
+    {{3, 4}, {0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0}},
+    {{3, 4}, {0x80808080, 0x808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xfeffffff, 0xfefefeff, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0}},
+    {{3, 4}, {0xfefefefe, 0xfcfcfefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f8, 0xe0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x808080c0, 0x80808080, 0x808080, 0x0}},
+    {{3, 4}, {0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0e0, 0x80c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefeff, 0xfcfefefe}},
+    {{1, 3}, {0xffffffff, 0x30f1f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0xf1f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x70f3fff, 0x1, 0xf3fffff, 0x103, 0x1f7fffff, 0x30f, 0x7fffffff, 0x1071f, 0xffffffff, 0x1071f3f, 0xffffffff, 0x30f3fff, 0xffffffff, 0xf3f7fff, 0xffffffff, 0x1f7fffff}},
+    {{1, 3}, {0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x1030f, 0x0, 0x30f3f, 0x0, 0x3071f7f, 0x0, 0x71f3fff, 0x1, 0xf3fffff, 0x103}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0}},
+    {{1, 4}, {0xc0e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0f8, 0xfcffffff, 0x80e0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xfcfeffff, 0x80c0e0f0, 0xf8fcffff, 0x80e0f0, 0xf8fcfeff, 0x80c0e0, 0xf0f8feff, 0x80c0e0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 3}, {0xffff, 0x0, 0xe0ffff, 0x0, 0xfcffff, 0x0, 0xffffff, 0x0, 0xe0ffffff, 0x0, 0xfcffffff, 0x0, 0xffffffff, 0x0, 0xffffffff, 0xe0}},
+    {{2, 3}, {0xfeffff, 0x0, 0x80ffffff, 0x0, 0xf0ffffff, 0x0, 0xffffffff, 0x0, 0xffffffff, 0x80, 0xffffffff, 0xf0, 0xffffffff, 0xff, 0xffffffff, 0x80ff}},
+    {{2, 3}, {0xfeffffff, 0x0, 0xffffffff, 0xc0, 0xffffffff, 0xf0, 0xffffffff, 0xfe, 0xffffffff, 0xc0ff, 0xffffffff, 0xf0ff, 0xffffffff, 0xfeff, 0xffffffff, 0xc0ffff}},
+    {{2, 3}, {0xffffffff, 0xc0ff, 0xffffffff, 0xf0ff, 0xffffffff, 0x80fcff, 0xffffffff, 0xc0ffff, 0xffffffff, 0xf0ffff, 0xffffffff, 0x80fcffff, 0xffffffff, 0xc0ffffff, 0xffffffff, 0xf0ffffff}},
+    {{2, 3}, {0xffffffff, 0x80fcffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xf3fffff, 0x107, 0x3fffffff, 0x30f, 0x7fffffff, 0x30f1f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x71f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3f7fffff, 0xffffffff, 0x7fffffff}},
+    {{1, 3}, {0x3, 0x0, 0x107, 0x0, 0x1071f, 0x0, 0x1030f3f, 0x0, 0x30f1f7f, 0x0, 0x71f7fff, 0x3, 0x1f3fffff, 0x107, 0x3fffffff, 0x1030f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x307, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0x80e0f0, 0xf8fcfeff, 0x80c0e0, 0xf0fcfeff, 0x80c0e0, 0xf0f8fcff, 0x80e0, 0xf0f8fcfe, 0x80c0, 0xe0f0fcfe, 0x80c0, 0xe0f0f8fe, 0xc0, 0xc0f0f8fc, 0x80}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xf0, 0x0, 0x80f8, 0x0, 0xc0fe, 0x0}},
+    {{2, 3}, {0x80f8, 0x0, 0xc0fc, 0x0, 0xf0ff, 0x0, 0x80f8ff, 0x0, 0xc0fcff, 0x0, 0xe0feff, 0x0, 0x80f8ffff, 0x0, 0xc0fcffff, 0x0}},
+    {{2, 3}, {0xc0f8ffff, 0x0, 0xe0fcffff, 0x0, 0xf0ffffff, 0x0, 0xf8ffffff, 0x80, 0xfcffffff, 0xe0, 0xfeffffff, 0xf0, 0xffffffff, 0x80f8, 0xffffffff, 0xc0fc}},
+    {{2, 3}, {0xffffffff, 0xe0fc, 0xffffffff, 0xf0fe, 0xffffffff, 0x80f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0xf0feff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xc0fcffff, 0xffffffff, 0xe0feffff}},
+    {{2, 3}, {0xffffffff, 0xf0feffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x3fffffff, 0x1030f, 0x7fffffff, 0x30f3f, 0xffffffff, 0x3071f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x307, 0x0, 0x1071f, 0x0, 0x1070f3f, 0x0, 0x30f3fff, 0x0, 0xf1f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1071f, 0xffffffff, 0x1030f3f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x103, 0x0, 0x30f, 0x0, 0x3071f, 0x0}},
+    {{1, 4}, {0xe0f0f8fe, 0x80, 0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f0, 0x0, 0xc0e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe}},
+    {{2, 3}, {0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0x80f0fe, 0x0, 0xc0f8ff, 0x0}},
+    {{2, 3}, {0xe0fcff, 0x0, 0x80f0feff, 0x0, 0xc0f8ffff, 0x0, 0xe0fcffff, 0x0, 0xe0feffff, 0x0, 0xf0ffffff, 0x80, 0xf8ffffff, 0xc0, 0xfcffffff, 0xe0}},
+    {{2, 3}, {0xffffffff, 0xc0f8, 0xffffffff, 0xe0fc, 0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0x80f0feff, 0xffffffff, 0xc0f8ffff}},
+    {{2, 3}, {0xffffffff, 0xf0feffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x30f3f, 0xffffffff, 0x30f1f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f, 0x0, 0x1071f3f, 0x0, 0x30f3fff, 0x1, 0xf3f7fff, 0x3, 0x1f7fffff, 0x307, 0x7fffffff, 0x1071f, 0xffffffff, 0x1070f3f, 0xffffffff, 0x30f3fff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f1f, 0x0, 0x1071f7f, 0x0}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f0}},
+    {{2, 3}, {0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0x80e0fc, 0x0, 0x80f0fe, 0x0}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f3f, 0x0, 0x1071f7f, 0x0, 0x71f7fff, 0x1}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0x80c0f0, 0xf8fcffff, 0x80c0e0, 0xf0fcfeff, 0xc0e0, 0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8fcff, 0x80c0, 0xe0f8fcfe, 0xc0, 0xe0f0fcfe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff}},
+    {{1, 2}, {0x3010100, 0x1f0f0707, 0x3010100, 0x1f0f0f07, 0x3030100, 0x1f0f0f07, 0x3030100, 0x1f1f0f07, 0x7030101, 0x1f1f0f07, 0x7030101, 0x3f1f0f0f, 0x7030301, 0x3f1f0f0f, 0x7070301, 0x3f1f1f0f}},
+    {{1, 4}, {0xc0e0f8fc, 0x0, 0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fc}},
+    {{1, 2}, {0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7030301, 0x0, 0x7070301, 0x1000000, 0xf070301, 0x1000000, 0xf070303}},
+    {{1, 4}, {0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xfcffffff, 0x80c0f0f8, 0xfcffffff, 0xc0e0f8, 0xfcfeffff, 0xc0e0f0, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80c0f0, 0xf8fcffff, 0x80c0f0, 0xf8fcffff, 0xc0e0, 0xf0fcfeff, 0xc0e0}},
+    {{1, 2}, {0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f0f, 0xffff7f3f, 0x3f1f0f0f, 0xffff7f7f, 0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000, 0x0, 0x1010000}},
+    {{1, 2}, {0x7070301, 0x3f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070303, 0x7f3f1f1f, 0xf070303, 0x7f3f1f1f, 0xf070703, 0x7f3f3f1f, 0xf0f0703, 0x7f3f3f1f, 0xf0f0703, 0x7f7f3f1f}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1010000, 0xf0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010100, 0x1f0f0f07, 0x3010100, 0x1f0f0f07, 0x3030100, 0x1f1f0f07}},
+    {{1, 2}, {0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7030301, 0x0, 0x7070301, 0x0, 0x7070301}},
+    {{1, 2}, {0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f0f, 0xffff7f7f, 0x3f1f1f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000, 0x0, 0x3010000, 0x0, 0x3010000}},
+    {{1, 2}, {0xf070303, 0x7f3f3f1f, 0xf070303, 0x7f3f3f1f, 0xf070703, 0x7f7f3f1f, 0xf070703, 0x7f7f3f1f, 0xf0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f3f}},
+    {{1, 2}, {0x3010100, 0x1f1f0f07, 0x3030100, 0x3f1f0f07, 0x3030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f0f, 0x7030101, 0x3f1f0f0f, 0x7030101, 0x3f1f1f0f}},
+    {{1, 2}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf0f0703, 0x1000000, 0xf0f0703, 0x1010000, 0x1f0f0703}},
+    {{1, 2}, {0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030101}},
+    {{1, 2}, {0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000}},
+    {{3, 4}, {0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080}},
+    {{3, 4}, {0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080}},
+    {{3, 4}, {0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x80808080, 0x0}},
+    {{3, 4}, {0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0}},
+    {{3, 4}, {0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff}},
+    {{3, 4}, {0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0}},
+    {{3, 4}, {0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f8, 0xe0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x808080c0, 0x808080}},
+    {{1, 3}, {0xffffffff, 0x1f3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x3f7fffff, 0x30f, 0x7fffffff, 0x3071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x70f3fff, 0xffffffff, 0xf3f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x107, 0x0, 0x1030f, 0x0, 0x30f3f, 0x0, 0x3071f7f, 0x0, 0x71f7fff, 0x1, 0xf3fffff, 0x107, 0x3f7fffff, 0x30f, 0x7fffffff, 0x30f1f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1070f, 0x0}},
+    {{1, 4}, {0xf0f8fcfe, 0x80e0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fe, 0x80c0, 0xe0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0f8, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff}},
+    {{2, 3}, {0xffffffff, 0xfc, 0xffffffff, 0xff, 0xffffffff, 0xe0ff, 0xffffffff, 0xfeff, 0xffffffff, 0xffff, 0xffffffff, 0xe0ffff, 0xffffffff, 0xfeffff, 0xffffffff, 0xffffff}},
+    {{2, 3}, {0xffffffff, 0xf0ff, 0xffffffff, 0xffff, 0xffffffff, 0x80ffff, 0xffffffff, 0xf0ffff, 0xffffffff, 0xffffff, 0xffffffff, 0x80ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xf0ffff, 0xffffffff, 0xfeffff, 0xffffffff, 0xc0ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{2, 3}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x7fffffff, 0x30f3f, 0xffffffff, 0x3071f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f, 0x0, 0x1070f3f, 0x0, 0x30f3f7f, 0x0, 0x71f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1070f, 0xffffffff, 0x1030f3f, 0xffffffff, 0x30f1f7f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x30f, 0x0, 0x1071f, 0x0, 0x1070f3f, 0x0}},
+    {{1, 4}, {0xc0e0f8fc, 0x80, 0xc0e0f0f8, 0x0, 0x80e0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fc, 0xfeffffff, 0xc0f0f8fc}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0xf0, 0x0, 0xfe, 0x0}},
+    {{2, 3}, {0x80, 0x0, 0xc0, 0x0, 0xf0, 0x0, 0xfc, 0x0, 0xc0ff, 0x0, 0xf0ff, 0x0, 0xfcff, 0x0, 0xc0ffff, 0x0}},
+    {{2, 3}, {0xf0ff, 0x0, 0x80f8ff, 0x0, 0xc0feff, 0x0, 0xf0ffff, 0x0, 0x80f8ffff, 0x0, 0xc0feffff, 0x0, 0xf0ffffff, 0x0, 0xf8ffffff, 0x0}},
+    {{2, 3}, {0xe0feffff, 0x0, 0xf8ffffff, 0x80, 0xfcffffff, 0xc0, 0xfeffffff, 0xe0, 0xffffffff, 0xf0, 0xffffffff, 0xc0fc, 0xffffffff, 0xe0fe, 0xffffffff, 0xf0ff}},
+    {{2, 3}, {0xffffffff, 0xf0fe, 0xffffffff, 0x80f8ff, 0xffffffff, 0xc0fcff, 0xffffffff, 0xe0feff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xc0fcffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0xf0ffffff}},
+    {{2, 3}, {0xffffffff, 0xf0ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x30f3f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f7f, 0x0, 0x70f3fff, 0x1, 0xf3f7fff, 0x3, 0x1f7fffff, 0x30f, 0x7fffffff, 0x1071f, 0xffffffff, 0x1071f3f, 0xffffffff, 0x30f3fff, 0xffffffff, 0xf1f7fff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f1f, 0x0, 0x1071f7f, 0x0, 0x71f3fff, 0x1}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0f8, 0xfcffffff, 0x80e0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f0, 0xf8feffff, 0x80e0f0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0}},
+    {{2, 3}, {0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0x80f0ff, 0x0, 0xc0f8ff, 0x0}},
+    {{2, 3}, {0xe0fcff, 0x0, 0xf0feff, 0x0, 0x80f8ffff, 0x0, 0xc0fcffff, 0x0, 0xe0feffff, 0x0, 0xf0ffffff, 0x80, 0xf8ffffff, 0xc0, 0xfcffffff, 0xe0}},
+    {{2, 3}, {0xfeffffff, 0x80f0, 0xffffffff, 0xc0f8, 0xffffffff, 0xe0fc, 0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0x80f0feff, 0xffffffff, 0xc0f8ffff}},
+    {{2, 3}, {0xffffffff, 0xe0fcffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0xf1f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x71f3fff, 0x1, 0xf3fffff, 0x103, 0x3f7fffff, 0x30f, 0x7fffffff, 0x3071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x70f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x1f7fffff}},
+    {{1, 3}, {0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1070f, 0x0, 0x30f3f, 0x0, 0x30f1f7f, 0x0, 0x71f7fff, 0x1, 0x1f3fffff, 0x107}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8feffff, 0x80e0f0, 0xf8fcffff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0, 0xf0fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xf0f8fcff, 0x80c0, 0xe0f8fcfe, 0x80c0, 0xe0f0fcfe, 0xc0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff}},
+    {{2, 3}, {0x0, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0, 0x80f0fe, 0x0}},
+    {{2, 3}, {0xc0f8ff, 0x0, 0xe0fcff, 0x0, 0x80f0feff, 0x0, 0xc0f8ffff, 0x0, 0xe0fcffff, 0x0, 0xf0feffff, 0x80, 0xf8ffffff, 0xc0, 0xfcffffff, 0xe0}},
+    {{2, 3}, {0xfeffffff, 0xc0f8, 0xffffffff, 0xe0fc, 0xffffffff, 0x80f0fc, 0xffffffff, 0xc0f0fe, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0x80f0feff, 0xffffffff, 0xc0f8ffff}},
+    {{1, 3}, {0x3, 0x0, 0x107, 0x0, 0x1071f, 0x0, 0x1030f3f, 0x0, 0x30f3f7f, 0x0, 0x71f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1070f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x30f, 0x0}},
+    {{1, 4}, {0xe0f0f8fe, 0x80, 0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xe0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfeffffff, 0x80c0f0f8, 0xfcffffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f8, 0xfcfeffff, 0x80e0f0, 0xf8feffff, 0x80e0f0}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1010000, 0xf070703, 0x3010000, 0xf0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010100, 0x1f0f0707, 0x3030100, 0x1f0f0f07}},
+    {{1, 4}, {0xf0fcfeff, 0x80e0, 0xf0f8feff, 0x80c0, 0xf0f8fcff, 0x80c0, 0xe0f8fcff, 0x80c0, 0xe0f0fcfe, 0xc0, 0xe0f0fcfe, 0x80, 0xc0f0f8fe, 0x80, 0xc0f0f8fc, 0x80}},
+    {{1, 2}, {0x7f3f1f1f, 0xffffff7f, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030101}},
+    {{1, 2}, {0x1f0f0703, 0xff7f3f1f, 0x1f0f0707, 0xff7f3f1f, 0x1f0f0707, 0xff7f3f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f0f, 0xffff7f3f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000}},
+    {{1, 2}, {0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030101, 0x3f1f0f0f, 0x7030101, 0x3f1f0f0f, 0x7030301, 0x3f1f1f0f, 0x7070301, 0x3f3f1f0f, 0x7070301, 0x3f3f1f0f, 0xf070301, 0x7f3f1f0f}},
+    {{1, 2}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1010000, 0xf0f0703, 0x1010000, 0xf0f0703, 0x3010000, 0x1f0f0703}},
+    {{1, 2}, {0x7f3f1f0f, 0xffffff7f, 0x7f3f1f1f, 0xffffffff, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030100}},
+    {{1, 2}, {0x1f0f0707, 0xff7f3f3f, 0x1f0f0707, 0xff7f7f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f7f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 2}, {0x7030301, 0x3f1f1f0f, 0x7030301, 0x3f3f1f0f, 0x7070301, 0x7f3f1f0f, 0x7070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f1f, 0xf070301, 0x7f3f1f1f, 0xf070303, 0x7f3f3f1f}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0f07, 0x3010100, 0x1f0f0f07, 0x3010100, 0x1f1f0f07}},
+    {{1, 2}, {0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7030301, 0x0, 0x7070301, 0x0, 0x7070301, 0x0, 0xf070301, 0x0, 0xf070301, 0x1000000, 0xf070301}},
+    {{1, 2}, {0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f0f, 0xffffffff, 0x7f3f1f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x1010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010100}},
+    {{3, 4}, {0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0}},
+    {{3, 4}, {0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x808080}},
+    {{3, 4}, {0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x808080c0, 0x80808080, 0x808080, 0x0, 0x0}},
+    {{3, 4}, {0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xc0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefeff, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc}},
+    {{3, 4}, {0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x808080c0, 0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfe, 0xfcfcfcfc, 0xf8fcfcfc, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefeffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0}},
+    {{3, 4}, {0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfe, 0xf8fcfcfc, 0xf8fcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0f0, 0xc0e0e0e0}},
+    {{1, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x1071f7f, 0xffffffff, 0x70f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x30f3f, 0x0, 0x3071f7f, 0x0, 0x71f7fff, 0x1, 0xf3fffff, 0x107, 0x3f7fffff, 0x30f, 0x7fffffff, 0x30f1f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x70f3fff}},
+    {{1, 4}, {0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0f8fc, 0xfeffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfcfeffff, 0xc0e0f0f8, 0xfcfeffff, 0x80c0f0f8, 0xf8feffff, 0x80c0e0f0}},
+    {{2, 3}, {0xffffffff, 0xe0ffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x71f7fff, 0xffffffff, 0x1f3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x30f3fff, 0x1, 0xf1f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1071f, 0xffffffff, 0x1030f3f, 0xffffffff, 0x30f3f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f3fffff}},
+    {{1, 3}, {0x0, 0x0, 0x1, 0x0, 0x103, 0x0, 0x30f, 0x0, 0x1071f, 0x0, 0x1071f3f, 0x0, 0x30f3fff, 0x1, 0xf1f7fff, 0x3}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0}},
+    {{1, 4}, {0x80e0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xfeffffff, 0xc0e0f0fc, 0xfcffffff, 0xc0e0f0f8, 0xfcfeffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f0, 0xf8fcffff, 0xc0e0f0, 0xf8fcfeff, 0x80c0f0, 0xf0fcfeff, 0x80c0e0, 0xf0f8fcff, 0xc0e0}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0xfe, 0x0, 0xff, 0x0, 0xe0ff, 0x0, 0xfeff, 0x0}},
+    {{2, 3}, {0x80, 0x0, 0xf0, 0x0, 0xff, 0x0, 0x80ff, 0x0, 0xf0ff, 0x0, 0xffff, 0x0, 0x80ffff, 0x0, 0xf0ffff, 0x0}},
+    {{2, 3}, {0xc0ff, 0x0, 0xf0ff, 0x0, 0xfcff, 0x0, 0xc0ffff, 0x0, 0xf0ffff, 0x0, 0xfcffff, 0x0, 0xc0ffffff, 0x0, 0xf0ffffff, 0x0}},
+    {{2, 3}, {0xf0ffff, 0x0, 0xfcffff, 0x0, 0xc0ffffff, 0x0, 0xf0ffffff, 0x0, 0xfcffffff, 0x0, 0xfeffffff, 0xc0, 0xffffffff, 0xf0, 0xffffffff, 0xf8}},
+    {{2, 3}, {0xfeffffff, 0xc0, 0xffffffff, 0xe0, 0xffffffff, 0xf8, 0xffffffff, 0xc0fc, 0xffffffff, 0xe0ff, 0xffffffff, 0xf8ff, 0xffffffff, 0xc0fcff, 0xffffffff, 0xe0ffff}},
+    {{2, 3}, {0xffffffff, 0x80fcff, 0xffffffff, 0xe0feff, 0xffffffff, 0xf0ffff, 0xffffffff, 0x80f8ffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfeffffff}},
+    {{2, 3}, {0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xf3fffff, 0x103, 0x3f7fffff, 0x30f, 0x7fffffff, 0x3071f, 0xffffffff, 0x1071f3f, 0xffffffff, 0x70f3fff, 0xffffffff, 0xf3f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff}},
+    {{1, 3}, {0x1, 0x0, 0x107, 0x0, 0x1030f, 0x0, 0x30f3f, 0x0, 0x3071f7f, 0x0, 0x71f3fff, 0x1, 0xf3fffff, 0x107, 0x3f7fffff, 0x30f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x107, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcfeff, 0x80c0f0, 0xf0fcfeff, 0x80c0e0, 0xf0f8feff, 0xc0e0, 0xf0f8fcfe, 0x80c0, 0xe0f8fcfe, 0x80c0, 0xe0f0f8fe, 0xc0, 0xe0f0f8fc, 0x80, 0xc0e0f8fc, 0x80}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0}},
+    {{2, 3}, {0xc0, 0x0, 0xe0, 0x0, 0xf0, 0x0, 0xc0f8, 0x0, 0xe0fe, 0x0, 0xf0ff, 0x0, 0x80f8ff, 0x0, 0xe0fcff, 0x0}},
+    {{2, 3}, {0xe0fcff, 0x0, 0xf0feff, 0x0, 0x80f8ffff, 0x0, 0xe0fcffff, 0x0, 0xf0feffff, 0x0, 0xf8ffffff, 0x80, 0xfcffffff, 0xc0, 0xfeffffff, 0xe0}},
+    {{2, 3}, {0xfeffffff, 0x80f0, 0xffffffff, 0xc0f8, 0xffffffff, 0xe0fc, 0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0xf0feff, 0xffffffff, 0x80f8ffff}},
+    {{2, 3}, {0xffffffff, 0xe0fcffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x3fffffff, 0x1030f, 0x7fffffff, 0x30f3f, 0xffffffff, 0x3071f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x307, 0x0, 0x1071f, 0x0, 0x1070f3f, 0x0, 0x30f3f7f, 0x0, 0xf1f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1070f, 0xffffffff, 0x1030f3f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x30f, 0x0, 0x1071f, 0x0}},
+    {{1, 4}, {0xe0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0fc, 0x80, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fe}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0}},
+    {{2, 3}, {0x80f0fe, 0x0, 0xc0f8ff, 0x0, 0xe0fcff, 0x0, 0x80f0feff, 0x0, 0xc0f8ffff, 0x0, 0xe0fcffff, 0x0, 0xf0feffff, 0x80, 0xf8ffffff, 0xc0}},
+    {{2, 3}, {0xfcffffff, 0x80f0, 0xfeffffff, 0xc0f0, 0xffffffff, 0xc0f8, 0xffffffff, 0xe0fc, 0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0x80f0feff}},
+    {{2, 3}, {0xffffffff, 0xe0fcffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x30f3f, 0xffffffff, 0x30f1f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f, 0x0, 0x1071f3f, 0x0, 0x30f3fff, 0x1, 0xf3f7fff, 0x3, 0x1f7fffff, 0x307, 0x7fffffff, 0x1071f, 0xffffffff, 0x1070f3f, 0xffffffff, 0x30f3fff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x107, 0x0, 0x30f, 0x0, 0x30f1f, 0x0, 0x1071f7f, 0x0}},
+    {{1, 4}, {0x80e0f0, 0x0, 0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fe, 0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfeffffff, 0x80e0f0f8, 0xfcffffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f8, 0xfcfeffff, 0xc0e0f0}},
+    {{2, 3}, {0x0, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0, 0xf0fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xf0f8fcff, 0x80c0, 0xe0f8fcfe, 0x80c0, 0xe0f0fcfe, 0xc0, 0xe0f0f8fe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff}},
+    {{1, 2}, {0x3030100, 0x1f1f0f07, 0x7030101, 0x1f1f0f07, 0x7030101, 0x3f1f0f0f, 0x7030301, 0x3f1f0f0f, 0x7030301, 0x3f1f1f0f, 0x7070301, 0x3f1f1f0f, 0xf070303, 0x3f3f1f0f, 0xf070303, 0x7f3f1f0f}},
+    {{1, 4}, {0xc0e0f8fc, 0x0, 0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f8, 0x0, 0x80e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 2}, {0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030301, 0x0, 0x7030301, 0x0, 0x7070301, 0x1000000, 0x7070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1010000, 0xf070703}},
+    {{1, 2}, {0x3f1f0f0f, 0xffff7f7f, 0x3f1f1f0f, 0xffff7f7f, 0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f1f, 0xffffff7f, 0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000}},
+    {{1, 2}, {0xf070303, 0x7f3f1f0f, 0xf070303, 0x7f3f1f1f, 0xf070703, 0x7f3f3f1f, 0xf070703, 0x7f3f3f1f, 0xf0f0703, 0x7f7f3f1f, 0x1f0f0703, 0x7f7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0707, 0xff7f3f3f}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010100, 0x1f0f0f07, 0x3030100, 0x1f1f0f07, 0x3030100, 0x1f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030101, 0x3f1f0f07}},
+    {{1, 2}, {0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030101, 0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7030301, 0x0, 0x7070301, 0x0, 0x7070301, 0x1000000, 0xf070301, 0x1000000, 0xf070301}},
+    {{1, 2}, {0x3f1f0f0f, 0xffff7f7f, 0x3f1f0f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f1f1f0f, 0xffffff7f, 0x3f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f0f, 0xffffff7f, 0x7f3f1f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1010000, 0x0, 0x1010000, 0x0, 0x3010000, 0x0, 0x3010000, 0x0, 0x3010000}},
+    {{1, 2}, {0xf070703, 0x7f3f3f1f, 0xf070703, 0x7f7f3f1f, 0xf0f0703, 0x7f7f3f1f, 0xf0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0703, 0xff7f3f1f, 0x1f0f0707, 0xff7f3f3f, 0x1f0f0707, 0xff7f7f3f}},
+    {{1, 2}, {0x3030100, 0x3f1f0f07, 0x3030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f07, 0x7030100, 0x3f1f0f0f, 0x7030101, 0x3f1f0f0f, 0x7030101, 0x3f1f1f0f, 0x7030301, 0x3f3f1f0f}},
+    {{1, 2}, {0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070301, 0x1000000, 0xf070303, 0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1000000, 0xf0f0703, 0x1010000, 0x1f0f0703, 0x1010000, 0x1f0f0703}},
+    {{1, 2}, {0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030101}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0}},
+    {{3, 4}, {0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0}},
+    {{3, 4}, {0x80c0c0c0, 0x80808080, 0x80808080, 0x808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0}},
+    {{3, 4}, {0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0}},
+    {{3, 4}, {0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0e0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0}},
+    {{3, 4}, {0xfefefeff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0x80c0c0c0}},
+    {{3, 4}, {0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x80808080, 0x80808080}},
+    {{3, 4}, {0xfcfcfcfc, 0xf8f8f8fc, 0xf8f8f8f8, 0xf0f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x80, 0x0}},
+    {{3, 4}, {0xf8f8f8f8, 0xf0f0f0f8, 0xf0f0f0f0, 0xe0e0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefeffff, 0xfefefefe}},
+    {{3, 4}, {0xf0f0f0f0, 0xe0e0e0e0, 0xe0e0e0e0, 0xc0c0e0e0, 0xc0c0c0c0, 0x80c0c0c0, 0x8080c0c0, 0x80808080, 0x80808080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefeff, 0xfefefefe, 0xfcfefefe, 0xfcfcfefe, 0xfcfcfcfc}},
+    {{3, 4}, {0xc0e0e0e0, 0xc0c0c0c0, 0xc0c0c0c0, 0x80808080, 0x80808080, 0x8080, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xfeffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfc, 0xfcfcfcfc, 0xf8f8fcfc, 0xf8f8f8fc, 0xf0f8f8f8}},
+    {{3, 4}, {0x808080c0, 0x808080, 0x8080, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{3, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfefefefe, 0xfefefefe, 0xfcfcfcfe, 0xfcfcfcfe, 0xf8fcfcfc, 0xf8f8fcfc, 0xf8f8f8f8, 0xf8f8f8f8, 0xf0f0f0f0, 0xf0f0f0f0, 0xe0e0f0f0}},
+    {{1, 3}, {0xffffffff, 0xf3fffff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x71f7fff, 0x1, 0xf3fffff, 0x107, 0x3f7fffff, 0x30f, 0x7fffffff, 0x30f1f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x70f3fff, 0xffffffff, 0xf3f7fff, 0xffffffff, 0x1f7fffff}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8fcffff}},
+    {{1, 3}, {0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1f7fffff, 0x307, 0x3fffffff, 0x1071f, 0xffffffff, 0x1070f3f, 0xffffffff, 0x30f3f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff}},
+    {{1, 3}, {0x103, 0x0, 0x30f, 0x0, 0x1071f, 0x0, 0x1071f3f, 0x0, 0x30f3fff, 0x1, 0xf1f7fff, 0x3, 0x1f7fffff, 0x307, 0x3fffffff, 0x1071f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x103, 0x0, 0x30f, 0x0}},
+    {{1, 4}, {0xf0f8fcfe, 0x80c0, 0xe0f0fcfe, 0x80c0, 0xe0f0f8fc, 0xc0, 0xc0e0f8fc, 0x80, 0xc0e0f0f8, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f8, 0x0, 0x80c0e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcfe}},
+    {{2, 3}, {0xffff, 0x0, 0xe0ffff, 0x0, 0xfeffff, 0x0, 0xffffff, 0x0, 0xe0ffffff, 0x0, 0xfeffffff, 0x0, 0xffffffff, 0x0, 0xffffffff, 0xe0}},
+    {{2, 3}, {0xffffff, 0x0, 0x80ffffff, 0x0, 0xf0ffffff, 0x0, 0xffffffff, 0x0, 0xffffffff, 0x80, 0xffffffff, 0xf0, 0xffffffff, 0xfe, 0xffffffff, 0x80ff}},
+    {{2, 3}, {0xfcffffff, 0x0, 0xffffffff, 0x80, 0xffffffff, 0xf0, 0xffffffff, 0xfc, 0xffffffff, 0x80ff, 0xffffffff, 0xe0ff, 0xffffffff, 0xfcff, 0xffffffff, 0x80ffff}},
+    {{2, 3}, {0xffffffff, 0xc0fe, 0xffffffff, 0xe0ff, 0xffffffff, 0xf8ff, 0xffffffff, 0x80feff, 0xffffffff, 0xe0ffff, 0xffffffff, 0xf8ffff, 0xffffffff, 0x80feffff, 0xffffffff, 0xe0ffffff}},
+    {{2, 3}, {0xffffffff, 0xf8ffff, 0xffffffff, 0x80fcffff, 0xffffffff, 0xe0ffffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x7fffffff, 0x30f1f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x71f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1070f, 0x0, 0x30f3f, 0x0, 0x30f1f7f, 0x0, 0x71f7fff, 0x1, 0xf3fffff, 0x107, 0x3fffffff, 0x1030f, 0x7fffffff, 0x30f1f, 0xffffffff, 0x3071f7f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1070f, 0x0, 0x30f3f, 0x0}},
+    {{1, 4}, {0xc0e0f0f8, 0x80, 0x80e0f0f8, 0x0, 0x80c0e0f8, 0x0, 0x80c0e0f0, 0x0, 0x80e0f0, 0x0, 0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80e0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xf0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fe, 0xfeffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f0fc}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xe0, 0x0, 0xf0, 0x0, 0x80fc, 0x0}},
+    {{2, 3}, {0xf0, 0x0, 0x80f8, 0x0, 0xc0fc, 0x0, 0xe0ff, 0x0, 0x80f8ff, 0x0, 0xc0fcff, 0x0, 0xe0feff, 0x0, 0xf0ffff, 0x0}},
+    {{2, 3}, {0xf0ffff, 0x0, 0x80f8ffff, 0x0, 0xc0fcffff, 0x0, 0xe0feffff, 0x0, 0xf8ffffff, 0x80, 0xfcffffff, 0xc0, 0xfeffffff, 0xe0, 0xffffffff, 0x80f0}},
+    {{2, 3}, {0xffffffff, 0x80f0, 0xffffffff, 0xc0fc, 0xffffffff, 0xe0fe, 0xffffffff, 0x80f0ff, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0xf0ffff, 0xffffffff, 0xc0f8ffff}},
+    {{2, 3}, {0xffffffff, 0xc0fcffff, 0xffffffff, 0xe0feffff, 0xffffffff, 0xf0ffffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0x30f1f7f, 0xffffffff, 0x71f7fff, 0xffffffff, 0x1f3fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0x7fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x1071f3f, 0x0, 0x30f3fff, 0x1, 0xf1f7fff, 0x3, 0x1f7fffff, 0x307, 0x3fffffff, 0x1071f, 0xffffffff, 0x1070f3f, 0xffffffff, 0x30f3f7f, 0xffffffff, 0xf1f7fff}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x103, 0x0, 0x30f, 0x0, 0x3071f, 0x0, 0x1071f3f, 0x0, 0x70f3fff, 0x1}},
+    {{1, 4}, {0x80c0e0, 0x0, 0x80c0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0}},
+    {{1, 4}, {0xffffffff, 0xc0f0f8fc, 0xfeffffff, 0xc0e0f8fc, 0xfeffffff, 0xc0e0f0fc, 0xfcffffff, 0x80e0f0f8, 0xfcfeffff, 0x80c0f0f8, 0xfcfeffff, 0x80c0e0f0, 0xf8feffff, 0xc0e0f0, 0xf8fcfeff, 0x80c0f0}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0, 0xe0fc, 0x0}},
+    {{2, 3}, {0x80f0fe, 0x0, 0xc0f8ff, 0x0, 0xe0fcff, 0x0, 0x80f0feff, 0x0, 0x80f8ffff, 0x0, 0xc0fcffff, 0x0, 0xe0feffff, 0x0, 0xf0ffffff, 0x80}},
+    {{2, 3}, {0xfcffffff, 0xe0, 0xfeffffff, 0x80f0, 0xffffffff, 0xc0f8, 0xffffffff, 0xc0f8, 0xffffffff, 0xe0fc, 0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff}},
+    {{2, 3}, {0xffffffff, 0xc0f8ffff, 0xffffffff, 0xe0fcffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xf0feffff, 0xffffffff, 0xf8ffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0xffffffff, 0xf1f7fff, 0xffffffff, 0x1f7fffff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 3}, {0x71f3fff, 0x1, 0xf3fffff, 0x103, 0x3f7fffff, 0x30f, 0x7fffffff, 0x3071f, 0xffffffff, 0x1071f7f, 0xffffffff, 0x70f3fff, 0xffffffff, 0xf3fffff, 0xffffffff, 0x1f7fffff}},
+    {{1, 3}, {0x0, 0x0, 0x3, 0x0, 0x107, 0x0, 0x1070f, 0x0, 0x30f3f, 0x0, 0x3071f7f, 0x0, 0x71f7fff, 0x1, 0xf3fffff, 0x107}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0}},
+    {{1, 4}, {0x80, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {{1, 4}, {0xf8fcffff, 0x80c0f0, 0xf8fcfeff, 0x80c0e0, 0xf0fcfeff, 0xc0e0, 0xf0f8feff, 0x80e0, 0xf0f8fcff, 0x80c0, 0xe0f8fcfe, 0x80c0, 0xe0f0fcfe, 0xc0, 0xe0f0f8fe, 0x80}},
+    {{1, 4}, {0xffffffff, 0xffffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfeffffff, 0xffffffff, 0xfcffffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xfcfeffff, 0xffffffff, 0xf8feffff}},
+    {{2, 3}, {0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0x80f0, 0x0, 0xc0f8, 0x0}},
+    {{2, 3}, {0x80f0fe, 0x0, 0xc0f8ff, 0x0, 0xe0fcff, 0x0, 0x80f0feff, 0x0, 0xc0f8feff, 0x0, 0xe0f8ffff, 0x0, 0xe0fcffff, 0x80, 0xf0feffff, 0x80}},
+    {{2, 3}, {0xfcffffff, 0x80f0, 0xfeffffff, 0xc0f0, 0xffffffff, 0xc0f8, 0xffffffff, 0x80e0fc, 0xffffffff, 0x80f0fe, 0xffffffff, 0xc0f8ff, 0xffffffff, 0xe0fcff, 0xffffffff, 0x80f0feff}},
+    {{1, 3}, {0x3, 0x0, 0x107, 0x0, 0x1071f, 0x0, 0x1030f3f, 0x0, 0x30f3f7f, 0x0, 0x71f7fff, 0x3, 0x1f7fffff, 0x107, 0x3fffffff, 0x1070f}},
+    {{1, 3}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x30f, 0x0}},
+    {{1, 4}, {0xc0f0f8fc, 0x80, 0xc0e0f8fc, 0x80, 0xc0e0f0fc, 0x0, 0x80e0f0f8, 0x0, 0x80c0f0f8, 0x0, 0x80c0e0f8, 0x0, 0xc0e0f0, 0x0, 0x80e0f0, 0x0}},
+    {{1, 4}, {0xffffffff, 0xf8fcffff, 0xffffffff, 0xf8fcfeff, 0xffffffff, 0xf0fcfeff, 0xffffffff, 0xf0f8feff, 0xffffffff, 0xf0f8fcff, 0xffffffff, 0xe0f8fcfe, 0xffffffff, 0xe0f0fcfe, 0xffffffff, 0xe0f0f8fe}},
+    {{1, 4}, {0x80c0f0, 0x0, 0x80c0e0, 0x0, 0xc0e0, 0x0, 0x80e0, 0x0, 0x80c0, 0x0, 0x80c0, 0x0, 0xc0, 0x0, 0x80, 0x0}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x3010000, 0xf0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010100, 0x1f0f0707, 0x3030100, 0x1f0f0f07, 0x3030100, 0x1f1f0f07, 0x7030101, 0x1f1f0f07, 0x7030101, 0x3f1f0f0f}},
+    {{1, 2}, {0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7070301}},
+    {{1, 2}, {0x1f0f0f07, 0xff7f3f3f, 0x1f0f0f07, 0xff7f7f3f, 0x1f1f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f0f, 0xffff7f7f, 0x3f1f1f0f, 0xffff7f7f, 0x3f1f1f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 2}, {0x7030101, 0x3f1f0f0f, 0x7030301, 0x3f1f1f0f, 0x7030301, 0x3f1f1f0f, 0x7070301, 0x3f3f1f0f, 0x7070301, 0x3f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070303, 0x7f3f1f1f, 0xf070703, 0x7f3f1f1f}},
+    {{1, 2}, {0xffff7f7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x1000000, 0xf070303, 0x1000000, 0xf070703, 0x1000000, 0xf070703, 0x1010000, 0xf0f0703, 0x1010000, 0xf0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707}},
+    {{1, 2}, {0x7f3f1f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f3f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0x7f7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f1f, 0xffffffff, 0xff7f3f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x3010000, 0x0, 0x3010100, 0x0, 0x3010100, 0x0, 0x3030100, 0x0, 0x7030100, 0x0, 0x7030100, 0x0, 0x7030101, 0x0, 0x7030101}},
+    {{1, 2}, {0x1f0f0f07, 0xff7f7f3f, 0x1f0f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x1f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f3f, 0x3f1f0f07, 0xffff7f7f, 0x3f1f0f0f, 0xffff7f7f, 0x3f1f0f0f, 0xffffff7f}},
+    {{1, 2}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000, 0x0, 0x1000000}},
+    {{1, 2}, {0x7070301, 0x3f3f1f0f, 0x7070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f0f, 0xf070301, 0x7f3f1f1f, 0xf070303, 0x7f3f1f1f, 0xf070303, 0x7f3f3f1f, 0xf070703, 0x7f3f3f1f}},
+    {{1, 2}, {0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffff7f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+    {{1, 2}, {0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0703, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0707, 0x3010000, 0x1f0f0f07, 0x3010100, 0x1f1f0f07, 0x3010100, 0x1f1f0f07, 0x3030100, 0x3f1f0f07}},
+    {{1, 2}, {0xff7f3f3f, 0xffffffff, 0xff7f3f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xff7f7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff, 0xffff7f3f, 0xffffffff}},
+    {{1, 2}, {0x0, 0x7030101, 0x0, 0x7030301, 0x0, 0x7070301, 0x0, 0x7070301, 0x0, 0xf070301, 0x0, 0xf070301, 0x1000000, 0xf070301, 0x1000000, 0xf070301}},
+};
+
+const GUI_Palette6SplitQuad GUI_PALETTE_6_QUADS[] = {
+    {{0, 1, 5, 0}, {0x0, 0x55565502, 0x555a555a, 0x556a556a, 0x0, 0x55565542, 0x555a555a, 0x556a556a, 0x0, 0x55565542, 0x555a555a, 0x556a556a, 0x0, 0x55565542, 0x555a555a, 0x556a556a, 0x0, 0x55565552, 0x555a555a, 0x556a556a, 0x0, 0x55565552, 0x555a555a, 0x556a556a, 0x0, 0x55565554, 0x555a555a, 0x556a556a, 0x0, 0x55565554, 0x555a5556, 0x556a555a}},
+    {{0, 1, 4, 0}, {0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555}},
+    {{0, 1, 5, 0}, {0x0, 0x55565554, 0x555a5556, 0x556a555a, 0x0, 0x55565555, 0x555a5556, 0x556a555a, 0x0, 0x55565555, 0x555a5556, 0x556a555a, 0x0, 0x55565555, 0x555a5556, 0x556a555a, 0x0, 0x55565555, 0x555a5556, 0x556a555a, 0x0, 0x55565555, 0x555a5556, 0x556a555a, 0x0, 0x55565555, 0x555a5556, 0x556a555a, 0x0, 0x55555555, 0x55565556, 0x555a555a}},
+    {{0, 1, 4, 0}, {0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555}},
+    {{0, 1, 5, 0}, {0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa}},
+    {{0, 1, 5, 0}, {0x0, 0x55555555, 0x55565556, 0x555a555a, 0x0, 0x55555555, 0x55565556, 0x555a555a, 0x0, 0x55555555, 0x55565556, 0x555a555a, 0x0, 0x55555555, 0x55565556, 0x555a555a, 0x0, 0x55555555, 0x55565556, 0x555a555a, 0x0, 0x55555555, 0x55565555, 0x555a5556, 0x0, 0x55555555, 0x55565555, 0x555a5556, 0x40000000, 0x55555555, 0x55565555, 0x555a5556}},
+    {{0, 1, 4, 0}, {0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa95aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa55aaa0, 0x9555a955, 0x55555555, 0x55555555}},
+    {{0, 1, 5, 0}, {0xaaa02aa, 0xaaaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa00aa, 0x6aaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa00aa, 0x6aaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa00aa, 0x6aaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa00aa, 0x6aaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa00aa, 0x6aaa5aaa, 0xaaaa6aaa, 0xaaaaaaaa, 0xaaa00aa, 0x6aaa5aaa, 0xaaaa6aaa, 0xaaaaaaaa}},
+    {{0, 1, 5, 0}, {0x50000000, 0x55555555, 0x55565555, 0x555a5556, 0x50000000, 0x55555555, 0x55565555, 0x555a5556, 0x54000000, 0x55555555, 0x55555555, 0x55565556, 0x55000000, 0x55555555, 0x55555555, 0x55565556, 0x55000000, 0x55555555, 0x55555555, 0x55565556, 0x55400000, 0x55555555, 0x55555555, 0x55565556, 0x55500000, 0x55555555, 0x55555555, 0x55565555, 0x55540000, 0x55555555, 0x55555555, 0x55565555}},
+    {{0, 1, 4, 0}, {0xaa55aaa0, 0x9555a955, 0x55555555, 0x55555555, 0xaa55aaa4, 0x9555a955, 0x55555555, 0x55555555, 0xaa55aaa4, 0x9555a955, 0x55555555, 0x55555555, 0xaa55aaa5, 0x9555a955, 0x55555555, 0x55555555, 0xaa55aaa5, 0x9555a955, 0x55555555, 0x55555555, 0xaa55aaa5, 0x9555a955, 0x55555555, 0x55555555, 0xaa55aaa5, 0x9555a955, 0x55555555, 0x55555555, 0xaa55aaa5, 0x9555a955, 0x55555555, 0x55555555}},
+    {{0, 1, 5, 0}, {0x2aa00aa, 0x6aaa5aaa, 0xaaaa6aaa, 0xaaaaaaaa, 0x2aa00aa, 0x6aaa5aaa, 0xaaaa6aaa, 0xaaaaaaaa, 0x42aa00aa, 0x5aaa5aaa, 0x6aaa6aaa, 0xaaaaaaaa, 0x52aa00aa, 0x5aaa5aaa, 0x6aaa6aaa, 0xaaaaaaaa, 0x56aa00aa, 0x5aaa5aaa, 0x6aaa6aaa, 0xaaaaaaaa, 0x56aa002a, 0x5aaa56aa, 0x6aaa5aaa, 0xaaaa6aaa, 0x56aa002a, 0x5aaa56aa, 0x6aaa5aaa, 0xaaaa6aaa, 0x56aa002a, 0x5aaa56aa, 0x6aaa5aaa, 0xaaaa6aaa}},
+    {{0, 1, 5, 0}, {0x55540000, 0x55555555, 0x55555555, 0x55565555, 0x55550000, 0x55555555, 0x55555555, 0x55565555, 0x55550000, 0x55555555, 0x55555555, 0x55555555, 0x55550000, 0x55555555, 0x55555555, 0x55555555, 0x55550000, 0x55555555, 0x55555555, 0x55555555, 0x55550000, 0x55555555, 0x55555555, 0x55555555, 0x55550000, 0x55555555, 0x55555555, 0x55555555, 0x55554000, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 1, 4, 0}, {0xaa00aa80, 0xa800a800, 0x8000a000, 0x0, 0xaa00aa80, 0xa800a800, 0x8000a000, 0x0, 0xaa00aa80, 0xa800a800, 0x8000a000, 0x0, 0xaa00aa80, 0xa800a800, 0x8000a000, 0x40000000, 0xaa00aa80, 0xa800a800, 0x8000a000, 0x50000000, 0xaa00aa80, 0xa800aa00, 0x8000a000, 0x54000000, 0xaa00aa80, 0xa800aa00, 0x8000a000, 0x55000000, 0xaa00aa80, 0xa800aa00, 0x8000a000, 0x55400000}},
+    {{0, 1, 4, 0}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa}},
+    {{0, 1, 5, 0}, {0x55aa002a, 0x56aa56aa, 0x5aaa5aaa, 0x6aaa6aaa, 0x55aa002a, 0x56aa56aa, 0x5aaa5aaa, 0x6aaa6aaa, 0x55aa002a, 0x56aa55aa, 0x5aaa5aaa, 0x6aaa6aaa, 0x55aa002a, 0x56aa55aa, 0x5aaa56aa, 0x6aaa5aaa, 0x55aa002a, 0x56aa55aa, 0x5aaa56aa, 0x6aaa5aaa, 0x556a000a, 0x55aa55aa, 0x56aa56aa, 0x5aaa5aaa, 0x556a400a, 0x55aa55aa, 0x56aa56aa, 0x5aaa5aaa, 0x556a500a, 0x55aa556a, 0x56aa56aa, 0x5aaa5aaa}},
+    {{0, 1, 4, 0}, {0xaa00aa80, 0xa800aa00, 0x8000a000, 0x55540000, 0xaa00aa80, 0xa800aa00, 0x8000a000, 0x55550000, 0xaa80aa80, 0xa800aa00, 0x8000a000, 0x55558000, 0xaa80aa80, 0xa800aa00, 0x8000a000, 0x55558000, 0xaa80aa80, 0xa800aa00, 0x8000a000, 0x55558000, 0xaa80aa80, 0xa800aa00, 0x8000a000, 0x55558000, 0xaa80aa80, 0xa800aa00, 0x8000a000, 0x55559000, 0xaa80aaa0, 0xa800aa00, 0xa000a000, 0x55559500}},
+    {{0, 1, 5, 0}, {0x556a540a, 0x55aa556a, 0x56aa55aa, 0x5aaa56aa, 0x556a554a, 0x55aa556a, 0x56aa55aa, 0x5aaa56aa, 0x555a555a, 0x556a556a, 0x55aa55aa, 0x56aa56aa, 0x555a555a, 0x556a556a, 0x55aa55aa, 0x56aa56aa, 0x555a5556, 0x556a555a, 0x55aa556a, 0x56aa55aa, 0x555a5556, 0x556a555a, 0x55aa556a, 0x56aa55aa, 0x55565556, 0x555a555a, 0x556a556a, 0x55aa55aa, 0x55565556, 0x555a555a, 0x556a556a, 0x55aa55aa}},
+    {{0, 1, 5, 0}, {0x0, 0x20000, 0xaa002a, 0x2aaa0aaa, 0x0, 0x20000, 0xaa002a, 0x2aaa0aaa, 0x0, 0x20000, 0xaa000a, 0x2aaa02aa, 0x0, 0x20000, 0xaa000a, 0x2aaa02aa, 0x0, 0x0, 0xaa000a, 0x6aaa02aa, 0x0, 0x0, 0x2a000a, 0x5aaa02aa, 0x0, 0x0, 0x2a000a, 0x5aaa02aa, 0x0, 0x0, 0x2a0002, 0x5aaa02aa}},
+    {{0, 1, 4, 0}, {0xaa80aaa0, 0xa800aa00, 0xa000a000, 0x55559540, 0xaa80aaa0, 0xa800aa00, 0xa000a000, 0x55555550, 0xaa80aaa0, 0xa800aa00, 0xa000a000, 0x55555555, 0xaa80aaa0, 0xa800aa00, 0xa000a800, 0x55555555, 0xaa80aaa0, 0xa800aa00, 0xa000a800, 0x55555555, 0xaa80aaa0, 0xa800aa00, 0xa000a800, 0x55555555, 0xaa80aaa0, 0xa800aa00, 0xa000a800, 0x55555555, 0xaa80aaa0, 0xaa00aa00, 0xa500a800, 0x55555555}},
+    {{0, 1, 5, 0}, {0x0, 0x0, 0x2a0002, 0x5aaa00aa, 0x0, 0x0, 0x2a0002, 0x56aa00aa, 0x0, 0x0, 0xa0002, 0x56aa00aa, 0x0, 0x0, 0xa0002, 0x56aa00aa, 0x0, 0x0, 0xa0000, 0x55aa50aa, 0x0, 0x0, 0xa0000, 0x55aa552a, 0x0, 0x0, 0xa0000, 0x55aa556a, 0x0, 0x0, 0x20000, 0x556a556a}},
+    {{0, 1, 4, 0}, {0xaa80aaa0, 0xaa00aa00, 0xa540a800, 0x55555555, 0xaa80aaa0, 0xaa00aa00, 0xa554a800, 0x55555555, 0xaa80aaa0, 0xaa00aa00, 0xa555a800, 0x55555555, 0xaa80aaa0, 0xaa00aa80, 0xa555a800, 0x55555555, 0xaa80aaa0, 0xaa00aa80, 0xa555a800, 0x55555555, 0xaa80aaa0, 0xaa00aa80, 0xa555a800, 0x55555555, 0xaaa0aaa0, 0xaa00aa80, 0x9555a900, 0x55555555, 0xaaa0aaa0, 0xaa00aa80, 0x9555a950, 0x55555555}},
+    {{0, 1, 5, 0}, {0x2a0002, 0xaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2a0002, 0xaaa00aa, 0xaaaa2aaa, 0xaaaaaaaa, 0xa0002, 0xaaa00aa, 0xaaaa2aaa, 0xaaaaaaaa, 0xa0002, 0x2aa00aa, 0xaaaa2aaa, 0xaaaaaaaa, 0xa0000, 0x2aa00aa, 0xaaaa2aaa, 0xaaaaaaaa, 0xa0000, 0x2aa002a, 0xaaaa2aaa, 0xaaaaaaaa, 0xa0000, 0x2aa002a, 0xaaaa0aaa, 0xaaaaaaaa, 0x20000, 0xaa002a, 0x6aaa0aaa, 0xaaaaaaaa}},
+    {{0, 1, 5, 0}, {0x0, 0x0, 0x20000, 0x556a555a, 0x0, 0x0, 0x20000, 0x556a555a, 0x0, 0x0, 0x40020000, 0x555a555a, 0x0, 0x0, 0x55020000, 0x555a5556, 0x0, 0x0, 0x55500000, 0x555a5556, 0x0, 0x0, 0x55550000, 0x55565556, 0x0, 0x0, 0x55550000, 0x55565555, 0x0, 0x0, 0x55550000, 0x55555555}},
+    {{0, 1, 4, 0}, {0xaaa0aaa0, 0xaa00aa80, 0x9555a954, 0x55555555, 0xaaa0aaa0, 0xaa00aa80, 0x9555a955, 0x55555555, 0xaaa0aaa8, 0xaa00aa80, 0x9555a955, 0x55555555, 0xaaa0aaa8, 0xaa00aa80, 0x9555a955, 0x55555555, 0xaaa0aaa8, 0xaa00aa80, 0x9555a955, 0x55555555, 0xaaa0aaa8, 0xaa50aa80, 0x9555a955, 0x55555555, 0xaaa0aaa8, 0xaa55aa80, 0x9555a955, 0x55555555, 0xaaa0aaa8, 0xaa55aa80, 0x9555a955, 0x55555555}},
+    {{0, 1, 5, 0}, {0x20000, 0xaa002a, 0x6aaa0aaa, 0xaaaa6aaa, 0x20000, 0xaa000a, 0x5aaa0aaa, 0xaaaa6aaa, 0x20000, 0xaa000a, 0x5aaa02aa, 0x6aaa6aaa, 0x0, 0xaa000a, 0x5aaa56aa, 0x6aaa5aaa, 0x0, 0x2a000a, 0x56aa56aa, 0x5aaa5aaa, 0x0, 0x2a0002, 0x56aa55aa, 0x5aaa56aa, 0x0, 0x2a0002, 0x55aa55aa, 0x5aaa56aa, 0x0, 0x2a0002, 0x55aa556a, 0x56aa56aa}},
+    {{0, 1, 4, 0}, {0xaaa0aaa8, 0xaa55aa80, 0x9555a555, 0x55555555, 0xaaa0aaa8, 0xaa55aa80, 0x9555a555, 0x55555555, 0xaaa0aaa8, 0xaa55aa80, 0x9555a555, 0x55555555, 0xaaa0aaa8, 0xaa55aa94, 0x9555a555, 0x55555555, 0xaaa0aaa8, 0xaa55aa95, 0x9555a555, 0x55555555, 0xaaa0aaa8, 0xaa55aa95, 0x5555a555, 0x55555555, 0xaaa0aaa8, 0xaa55aa95, 0x5555a555, 0x55555555, 0xaaa8aaa8, 0xaa55aa95, 0x5555a555, 0x55555555}},
+    {{0, 1, 5, 0}, {0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa00aa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aa00aa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aa002a, 0x6aaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa}},
+    {{0, 1, 5, 0}, {0x0, 0x540a0002, 0x55aa556a, 0x56aa55aa, 0x0, 0x555a0000, 0x556a556a, 0x55aa55aa, 0x0, 0x555a0000, 0x556a555a, 0x55aa556a, 0x0, 0x55560000, 0x555a555a, 0x556a556a, 0x0, 0x55560000, 0x555a5556, 0x556a555a, 0x0, 0x55555500, 0x55565556, 0x556a555a, 0x0, 0x55555555, 0x55565555, 0x555a5556, 0x0, 0x55555555, 0x55555555, 0x555a5556}},
+    {{0, 1, 4, 0}, {0xaaa8aaa8, 0xa955aa95, 0x5555a555, 0x55555555, 0xaaa9aaa8, 0xa955aa95, 0x5555a555, 0x55555555, 0xaaa5aaaa, 0xa955aa95, 0x5555a555, 0x55555555, 0xaaa5aaaa, 0xa955aa95, 0x5555a555, 0x55555555, 0xaaa5aaaa, 0xa955aa95, 0x5555a555, 0x55555555, 0xaaa5aaaa, 0xa955aa95, 0x55559555, 0x55555555, 0xaaa5aaaa, 0xa955aa55, 0x55559555, 0x55555555, 0xaaa5aaaa, 0xa955aa55, 0x55559555, 0x55555555}},
+    {{0, 3, 5, 0}, {0xaa000a, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa0002, 0xaaaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2a0000, 0xaaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa0000, 0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x20000, 0x2aaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x10005, 0xaaa002a, 0xaaaaaaaa, 0xaaaaaaaa, 0x150155, 0x2aa002a, 0xaaaaaaaa, 0xaaaaaaaa, 0x5551555, 0x2aa0155, 0xaaaa2aaa, 0xaaaaaaaa}},
+    {{0, 1, 4, 0}, {0xaaa0aaa0, 0xaa00aa80, 0xa000a800, 0x8000a000, 0xaaa0aaa0, 0xaa00aa80, 0xa000a800, 0x8000a000, 0xaaa0aaa0, 0xaa00aa80, 0xa000a800, 0x8000a000, 0xaaa0aaa8, 0xaa00aa80, 0xa800a800, 0x9500a000, 0xaaa0aaa8, 0xaa00aa80, 0xa800a800, 0x9554a000, 0xaaa0aaa8, 0xaa00aa80, 0xa800a800, 0x5555a000, 0xaaa0aaa8, 0xaa00aa80, 0xa800aa00, 0x5555a000, 0xaaa0aaa8, 0xaa00aa80, 0xa800aa00, 0x5555a500}},
+    {{0, 1, 5, 0}, {0x2aa002a, 0x6aaa5aaa, 0xaaaa6aaa, 0xaaaaaaaa, 0x2aa002a, 0x5aaa5aaa, 0x6aaa6aaa, 0xaaaaaaaa, 0xaa002a, 0x5aaa56aa, 0x6aaa5aaa, 0xaaaaaaaa, 0x55aa000a, 0x56aa56aa, 0x5aaa5aaa, 0xaaaa6aaa, 0x556a000a, 0x56aa55aa, 0x5aaa56aa, 0x6aaa6aaa, 0x556a000a, 0x55aa55aa, 0x56aa56aa, 0x6aaa5aaa, 0x555a0002, 0x55aa556a, 0x56aa55aa, 0x5aaa5aaa, 0x555a5502, 0x556a556a, 0x55aa55aa, 0x5aaa56aa}},
+    {{0, 1, 5, 0}, {0x0, 0x55555555, 0x55555555, 0x55565555, 0x50000000, 0x55555555, 0x55555555, 0x55565555, 0x55540000, 0x55555555, 0x55555555, 0x55555555, 0x55550000, 0x55555555, 0x55555555, 0x55555555, 0x55550000, 0x55555555, 0x55555555, 0x55555555, 0x55555000, 0x55555555, 0x55555555, 0x55555555, 0x55555550, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 5, 0}, {0x55555555, 0x5551555, 0xaaaa2aaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaa1555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaa5555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 5, 0}, {0x10005, 0x0, 0x20000, 0x2aaa00aa, 0x550155, 0x10005, 0x20000, 0x2aaa00aa, 0x15555555, 0x550155, 0x10005, 0xaaa002a, 0x55555555, 0x15555555, 0x550155, 0x2aa0015, 0x55555555, 0x55555555, 0x15555555, 0xa90555, 0x55555555, 0x55555555, 0x55555555, 0x15555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 5, 0}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa}},
+    {{0, 3, 5, 0}, {0xaa000a, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa0002, 0xaaaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2a0002, 0xaaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa0000, 0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa0000, 0x2aaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x20000, 0xaaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x20000, 0xaaa002a, 0xaaaaaaaa, 0xaaaaaaaa, 0x50015, 0x2aa002a, 0xaaaa2aaa, 0xaaaaaaaa}},
+    {{0, 1, 5, 0}, {0x0, 0x0, 0xaa000a, 0x2aaa02aa, 0x0, 0x0, 0x2a000a, 0x2aaa02aa, 0x0, 0x0, 0x2a0002, 0x2aaa02aa, 0x0, 0x0, 0x2a0002, 0xaaa02aa, 0x0, 0x0, 0x2a0002, 0x5aaa00aa, 0x0, 0x0, 0xa0002, 0x56aa00aa, 0x0, 0x0, 0xa0000, 0x56aa00aa, 0x0, 0x0, 0xa0000, 0x55aa002a}},
+    {{0, 1, 4, 0}, {0xaaa0aaa8, 0xaa00aa80, 0xa800aa00, 0x5555a555, 0xaaa0aaa8, 0xaa80aa80, 0xa800aa00, 0x5555a555, 0xaaa0aaa8, 0xaa80aa80, 0xa800aa00, 0x55559555, 0xaaa0aaa8, 0xaa80aa80, 0xa940aa00, 0x55559555, 0xaaa0aaa8, 0xaa80aa80, 0xa955aa00, 0x55559555, 0xaaa0aaa8, 0xaa80aaa0, 0xa955aa00, 0x55559555, 0xaaa0aaa8, 0xaa80aaa0, 0xa955aa00, 0x55559555, 0xaaa0aaa8, 0xaa80aaa0, 0xa555aa54, 0x55559555}},
+    {{0, 3, 5, 0}, {0x550155, 0xaa0015, 0xaaaa2aaa, 0xaaaaaaaa, 0x15555555, 0x1550555, 0xaaaa0aaa, 0xaaaaaaaa, 0x55555555, 0x15555555, 0xaaaa0555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x29555555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaaaaa5, 0x55555555, 0x55555555, 0x55555555, 0xaaaa5555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 5, 0}, {0x0, 0x0, 0x20000, 0x2aa002a, 0x0, 0x0, 0x20000, 0x2aa002a, 0x10005, 0x0, 0x0, 0xaa000a, 0x150055, 0x10005, 0x0, 0xaa000a, 0x1550555, 0x550155, 0x50015, 0x2a0002, 0x55555555, 0x5551555, 0x550155, 0x2a0015, 0x55555555, 0x55555555, 0x5551555, 0x550155, 0x55555555, 0x55555555, 0x55555555, 0x5551555}},
+    {{0, 3, 5, 0}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa}},
+    {{0, 1, 5, 0}, {0xa0002, 0xaaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa0000, 0xaaa00aa, 0xaaaa2aaa, 0xaaaaaaaa, 0xa0000, 0x2aa002a, 0xaaaa2aaa, 0xaaaaaaaa, 0x20000, 0x2aa002a, 0xaaaa2aaa, 0xaaaaaaaa, 0x20000, 0x2aa002a, 0xaaaa0aaa, 0xaaaaaaaa, 0x20000, 0xaa000a, 0x6aaa0aaa, 0xaaaaaaaa, 0x0, 0xaa000a, 0x6aaa0aaa, 0xaaaa6aaa, 0x0, 0xaa000a, 0x5aaa52aa, 0x6aaa6aaa}},
+    {{0, 1, 5, 0}, {0x0, 0x0, 0x20000, 0x55aa556a, 0x0, 0x0, 0x20000, 0x556a555a, 0x0, 0x0, 0x20000, 0x555a555a, 0x0, 0x0, 0x54000000, 0x555a5556, 0x0, 0x0, 0x55550000, 0x55565555, 0x0, 0x0, 0x55550000, 0x55565555, 0x0, 0x0, 0x55554000, 0x55555555, 0x0, 0x0, 0x55555555, 0x55555555}},
+    {{0, 1, 4, 0}, {0xaaa8aaa8, 0xaa80aaa0, 0xa555aa55, 0x55559555, 0xaaa8aaa8, 0xaa80aaa0, 0xa555aa55, 0x55559555, 0xaaa8aaa8, 0xaa80aaa0, 0xa555aa55, 0x55555555, 0xaaa8aaaa, 0xaa95aaa0, 0xa555a955, 0x55555555, 0xaaa8aaaa, 0xaa95aaa0, 0xa555a955, 0x55555555, 0xaaa8aaaa, 0xaa95aaa0, 0xa555a955, 0x55555555, 0xaaa8aaaa, 0xaa55aaa5, 0x9555a955, 0x55555555, 0xaaa8aaaa, 0xaa55aaa5, 0x9555a955, 0x55555555}},
+    {{0, 3, 4, 0}, {0xaa80aaa0, 0xaa80aa80, 0xaa00aa80, 0xaa00aa00, 0xaa80aa80, 0xaa80aa80, 0xaa00aa00, 0xaa00aa00, 0xaa81aa81, 0xaa00aa81, 0xaa00aa00, 0xaa00aa00, 0xaa95aa95, 0xaa05aa05, 0xaa05aa05, 0xa801aa01, 0xaa55aa55, 0xaa55aa55, 0xaa15aa55, 0xa815a815, 0xa955a955, 0xa955a955, 0xa955a955, 0xa955a955, 0xa955a955, 0xa555a555, 0xa555a555, 0xa555a555, 0xa555a555, 0xa555a555, 0xa555a555, 0xa555a555}},
+    {{0, 3, 4, 0}, {0xaa00aa00, 0xa800a800, 0xa800a800, 0xa000a800, 0xa800aa00, 0xa800a800, 0xa800a800, 0xa000a000, 0xa800a800, 0xa800a800, 0xa000a800, 0xa000a000, 0xa800a801, 0xa800a800, 0xa000a000, 0xa000a000, 0xa805a815, 0xa005a805, 0xa001a005, 0xa001a001, 0xa855a955, 0xa055a055, 0xa015a015, 0x8015a015, 0xa555a555, 0xa555a555, 0xa155a155, 0x80558155, 0x95559555, 0x95559555, 0x95559555, 0x85559555}},
+    {{0, 3, 4, 0}, {0xa000a000, 0x80008000, 0x80008000, 0x0, 0xa000a000, 0x80008000, 0x8000, 0x0, 0x8000a000, 0x80008000, 0x0, 0x0, 0x80008000, 0x80008000, 0x0, 0x0, 0x80008000, 0x8000, 0x0, 0x0, 0x80058005, 0x18001, 0x1, 0x0, 0x80558055, 0x150015, 0x50015, 0x10005, 0x5558555, 0x1550155, 0x550155, 0x150055}},
+    {{0, 3, 5, 0}, {0x15555555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaa555555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaa5555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 5, 0}, {0x0, 0xa0000, 0xaaa00aa, 0xaaaaaaaa, 0x10005, 0xa0000, 0xaaa00aa, 0xaaaaaaaa, 0x150055, 0x10005, 0x2aa002a, 0xaaaa2aaa, 0x1550555, 0x550055, 0x2aa0029, 0xaaaa2aaa, 0x15555555, 0x5550555, 0xaa0155, 0xaaaa0aaa, 0x55555555, 0x55555555, 0x5551555, 0xaaaa0aaa, 0x55555555, 0x55555555, 0x55555555, 0x2aaa1555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 5, 0}, {0x0, 0x0, 0x0, 0xa0000, 0x0, 0x0, 0x0, 0xa0000, 0x0, 0x0, 0x0, 0x20000, 0x0, 0x0, 0x0, 0x20000, 0x0, 0x0, 0x0, 0x0, 0x10005, 0x1, 0x0, 0x0, 0x150055, 0x50015, 0x1, 0x0, 0x1550555, 0x550155, 0x50015, 0x10001}},
+    {{0, 1, 5, 0}, {0xaaaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa00aa, 0xaaaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aa00aa, 0x6aaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa}},
+    {{0, 1, 5, 0}, {0x0, 0x2a0002, 0x56aa56aa, 0x6aaa5aaa, 0x0, 0x2a0002, 0x56aa55aa, 0x5aaa56aa, 0x0, 0x402a0002, 0x55aa556a, 0x56aa56aa, 0x0, 0x555a0000, 0x556a556a, 0x56aa55aa, 0x0, 0x55560000, 0x556a555a, 0x55aa556a, 0x0, 0x55565000, 0x555a5556, 0x556a556a, 0x0, 0x55555555, 0x55565556, 0x556a555a, 0x0, 0x55555555, 0x55565555, 0x555a5556}},
+    {{0, 1, 4, 0}, {0xaaa8aaaa, 0xaa55aaa5, 0x9555a955, 0x55555555, 0xaaa9aaaa, 0xaa55aaa5, 0x9555a955, 0x55555555, 0xaaa9aaaa, 0xaa55aa95, 0x9555a555, 0x55555555, 0xaaa9aaaa, 0xaa55aa95, 0x9555a555, 0x55555555, 0xaaa9aaaa, 0xaa55aa95, 0x9555a555, 0x55555555, 0xaaa5aaaa, 0xa955aa95, 0x5555a555, 0x55555555, 0xaaa5aaaa, 0xa955aa95, 0x5555a555, 0x55555555, 0xaaa5aaaa, 0xa955aa95, 0x5555a555, 0x55555555}},
+    {{0, 3, 4, 0}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaa8, 0xaaa0aaa8, 0xaaaaaaaa, 0xaaa9aaa9, 0xaaa8aaa8, 0xaaa0aaa8, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa1aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xa955a955, 0xa955a955, 0xa955a955, 0xa955a955, 0xa955a955, 0xa555a955}},
+    {{0, 3, 4, 0}, {0xaaa0aaa0, 0xaa80aa80, 0xaa00aa80, 0xaa00aa00, 0xaaa0aaa0, 0xaa80aa80, 0xaa00aa80, 0xa800aa00, 0xaa80aaa1, 0xaa80aa80, 0xaa00aa00, 0xa800aa00, 0xaa85aaa5, 0xaa81aa85, 0xaa00aa01, 0xa800a800, 0xaa95aa95, 0xaa15aa95, 0xaa05aa15, 0xa801a805, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xa815a855, 0xa955a955, 0xa955a955, 0xa955a955, 0xa955a955, 0xa555a555, 0xa555a555, 0xa555a555, 0xa555a555}},
+    {{0, 3, 4, 0}, {0xa800a800, 0xa000a000, 0x80008000, 0x0, 0xa800a800, 0xa000a000, 0x80008000, 0x0, 0xa000a800, 0xa000a000, 0x80008000, 0x0, 0xa000a800, 0x8000a000, 0x80008000, 0x0, 0xa000a801, 0x8000a000, 0x8000, 0x0, 0xa005a015, 0x8001a005, 0x8000, 0x0, 0xa055a155, 0x80158055, 0x58015, 0x10001, 0xa555a555, 0x81558555, 0x550155, 0x150015}},
+    {{0, 3, 5, 0}, {0x2a0005, 0xaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x150055, 0xaaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x1550555, 0xaaa0055, 0xaaaaaaaa, 0xaaaaaaaa, 0x15555555, 0x5550555, 0xaaaa2aaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaa1555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaa5555}},
+    {{0, 3, 5, 0}, {0x0, 0x0, 0xa0000, 0xaaa00aa, 0x0, 0x0, 0xa0000, 0xaaa00aa, 0x0, 0x0, 0x20000, 0x2aa002a, 0x0, 0x0, 0x20000, 0x2aa002a, 0x10005, 0x1, 0x20000, 0xaa002a, 0x150055, 0x50015, 0x1, 0xaa000a, 0x1550555, 0x550155, 0x50015, 0xaa000a, 0x15555555, 0x5551555, 0x550155, 0x2a0055}},
+    {{0, 1, 5, 0}, {0x0, 0xa0002, 0xaaa00aa, 0xaaaaaaaa, 0x0, 0xa0000, 0xaaa00aa, 0xaaaa2aaa, 0x0, 0xa0000, 0x2aa002a, 0xaaaa2aaa, 0x0, 0x20000, 0x2aa002a, 0xaaaa2aaa, 0x0, 0x20000, 0x2aa002a, 0xaaaa0aaa, 0x0, 0x20000, 0xaa000a, 0xaaaa0aaa, 0x0, 0x0, 0xaa000a, 0x2aaa0aaa, 0x0, 0x0, 0x2a000a, 0x6aaa02aa}},
+    {{0, 1, 5, 0}, {0x0, 0x0, 0x0, 0x20000, 0x0, 0x0, 0x0, 0x20000, 0x0, 0x0, 0x0, 0x20000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55400000, 0x0, 0x0, 0x0, 0x55550000}},
+    {{0, 1, 4, 0}, {0xaaa0aaa8, 0xaa00aa80, 0xa800a800, 0x9540a000, 0xaaa0aaa8, 0xaa00aa80, 0xa800aa00, 0x9555a000, 0xaaa0aaa8, 0xaa00aa80, 0xa800aa00, 0x9555a000, 0xaaa0aaa8, 0xaa00aa80, 0xa800aa00, 0x5555a554, 0xaaa0aaa8, 0xaa00aa80, 0xa800aa00, 0x5555a555, 0xaaa0aaa8, 0xaa80aa80, 0xa900aa00, 0x55559555, 0xaaa0aaa8, 0xaa80aa80, 0xa955aa00, 0x55559555, 0xaaa0aaa8, 0xaa80aa80, 0xa955aa00, 0x55559555}},
+    {{0, 1, 5, 0}, {0x2aa002a, 0x6aaa5aaa, 0xaaaa6aaa, 0xaaaaaaaa, 0x55aa002a, 0x5aaa56aa, 0x6aaa6aaa, 0xaaaaaaaa, 0x55aa002a, 0x56aa55aa, 0x6aaa5aaa, 0xaaaa6aaa, 0x556a000a, 0x55aa55aa, 0x5aaa56aa, 0x6aaa6aaa, 0x555a555a, 0x55aa556a, 0x56aa55aa, 0x6aaa5aaa, 0x555a5556, 0x556a555a, 0x55aa55aa, 0x5aaa56aa, 0x55565555, 0x555a555a, 0x55aa556a, 0x56aa55aa, 0x55555555, 0x555a5556, 0x556a555a, 0x55aa55aa}},
+    {{0, 1, 5, 0}, {0x54000000, 0x55555555, 0x55555555, 0x55565556, 0x55550000, 0x55555555, 0x55555555, 0x55565555, 0x55550000, 0x55555555, 0x55555555, 0x55555555, 0x55555554, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 4, 0}, {0x95559555, 0x95559555, 0x5551555, 0x1550155, 0x55555555, 0x55555555, 0x55555555, 0x15551555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 4, 0}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaa8, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa5aaa9, 0xaaa5aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xa955a955, 0xa955a955, 0xa955a955}},
+    {{0, 3, 4, 0}, {0xaaa0aaa8, 0xaa80aaa0, 0xaa00aa80, 0xa800aa00, 0xaaa0aaa0, 0xaa80aa80, 0xaa00aa80, 0xa800aa00, 0xaaa0aaa0, 0xaa80aa80, 0xaa00aa00, 0xa800a800, 0xaaa5aaa5, 0xaa81aa81, 0xaa00aa00, 0xa800a800, 0xaa95aa95, 0xaa95aa95, 0xaa01aa05, 0xa800a801, 0xaa55aa55, 0xaa55aa55, 0xaa15aa55, 0xa805a815, 0xaa55aa55, 0xa955a955, 0xa955a955, 0xa055a955, 0xa955a955, 0xa955a955, 0xa555a555, 0xa555a555}},
+    {{0, 3, 4, 0}, {0xa000a800, 0x8000a000, 0x0, 0x0, 0xa000a000, 0x80008000, 0x0, 0x0, 0xa000a000, 0x80008000, 0x0, 0x0, 0xa000a000, 0x80008000, 0x0, 0x0, 0xa000a000, 0x80008000, 0x0, 0x0, 0xa001a001, 0x8000, 0x0, 0x0, 0x8015a055, 0x18005, 0x1, 0x0, 0x8155a555, 0x558055, 0x50015, 0x10001}},
+    {{2, 3, 5, 2}, {0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaa0aaa0, 0x55555555, 0xaaa05555, 0xaa80aa80, 0xa800aa00, 0x55555555, 0x55005555, 0xa000a800, 0x8000, 0x55555555, 0x55545555, 0x0, 0x0, 0x55555555, 0x55555555, 0x5400, 0x0, 0x55555555, 0x55555555, 0x5540, 0x0, 0x55555555, 0x55555555, 0x40005555, 0x0}},
+    {{2, 3, 5, 2}, {0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaa555555, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaa8aaaa, 0xaaa0aaa0, 0x55555555, 0x55555555, 0xaa805555, 0xa800aa00, 0x55555555, 0x55555555, 0x55505555, 0x80008000, 0x55555555, 0x55555555, 0x55555555, 0x5000}},
+    {{2, 3, 5, 2}, {0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa555555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaa05555}},
+    {{0, 3, 5, 0}, {0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x15555555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaa5555}},
+    {{0, 3, 5, 0}, {0x0, 0xa0002, 0xaaa00aa, 0xaaaaaaaa, 0x0, 0xa0000, 0xaaa00aa, 0xaaaaaaaa, 0x0, 0xa0000, 0x2aa00aa, 0xaaaa2aaa, 0x10005, 0x20001, 0x2aa002a, 0xaaaa2aaa, 0x550055, 0x50015, 0x2aa002a, 0xaaaa0aaa, 0x5550555, 0x550155, 0xaa0015, 0xaaaa0aaa, 0x55555555, 0x5551555, 0x1550155, 0xaaaa0aaa, 0x55555555, 0x55555555, 0x15551555, 0x2aaa0555}},
+    {{0, 3, 5, 0}, {0x0, 0x0, 0x0, 0xa0000, 0x0, 0x0, 0x0, 0x20000, 0x0, 0x0, 0x0, 0x20000, 0x0, 0x0, 0x0, 0x20000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x50005, 0x1, 0x0, 0x0}},
+    {{0, 1, 5, 0}, {0xaa000a, 0xaaaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa000a, 0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2a0002, 0x2aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2a0002, 0xaaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2a0002, 0xaaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa0000, 0xaaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa0000, 0x2aa00aa, 0xaaaa6aaa, 0xaaaaaaaa, 0x20000, 0x2aa002a, 0x6aaa5aaa, 0xaaaaaaaa}},
+    {{0, 1, 5, 0}, {0x0, 0x0, 0x2a0002, 0x5aaa02aa, 0x0, 0x0, 0x2a0002, 0x56aa55aa, 0x0, 0x0, 0xa0002, 0x55aa55aa, 0x0, 0x0, 0xa0000, 0x55aa556a, 0x0, 0x0, 0x55560000, 0x556a555a, 0x0, 0x0, 0x55560000, 0x555a5556, 0x0, 0x0, 0x55555555, 0x55565556, 0x0, 0x0, 0x55555555, 0x55565555}},
+    {{0, 1, 4, 0}, {0xaaa0aaa8, 0xaa80aa80, 0xa555aa50, 0x55559555, 0xaaa0aaa8, 0xaa80aa80, 0xa555aa55, 0x55559555, 0xaaa0aaa8, 0xaa80aaa0, 0xa555a955, 0x55555555, 0xaaa0aaa8, 0xaa95aaa0, 0xa555a955, 0x55555555, 0xaaa0aaa8, 0xaa55aaa0, 0x9555a955, 0x55555555, 0xaaa0aaa8, 0xaa55aaa4, 0x9555a955, 0x55555555, 0xaaa0aaa8, 0xaa55aa95, 0x9555a555, 0x55555555, 0xaaa8aaa8, 0xaa55aa95, 0x9555a555, 0x55555555}},
+    {{1, 2, 5, 1}, {0x2aaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa0aaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa, 0x2aaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0x2aaa0aaa, 0xaaaa2aaa, 0xaaaaaaaa, 0x2aa02aa, 0xaaa0aaa, 0x2aaa2aaa, 0xaaaaaaaa, 0x2aa00aa, 0xaaa02aa, 0x2aaa0aaa, 0xaaa92aaa, 0xaa00aa, 0x2aa02aa, 0xaaa0aaa, 0x2aa52aa9, 0xaa002a, 0x2aa00aa, 0xaaa02aa, 0x2a950aa9}},
+    {{1, 2, 5, 1}, {0xaaaaaaaa, 0xaa95aaa9, 0xa955aa55, 0x55559555, 0xaaa9aaaa, 0xaa95aaa5, 0xa555a955, 0x55559555, 0xaaa5aaaa, 0xaa55aa95, 0x9555a955, 0x55555555, 0xaaa5aaa9, 0xa955aa55, 0x5555a555, 0x55555555, 0xaa95aaa5, 0xa555aa55, 0x55559555, 0x55555555, 0xaa55aaa5, 0xa555a955, 0x55555555, 0x55555555, 0xa955aa95, 0x9555a555, 0x55555555, 0x55555555, 0xa9552a55, 0x55559555, 0x55555555, 0x55555555}},
+    {{1, 2, 5, 1}, {0x2a002a, 0xaa00aa, 0x2aa02aa, 0xaaa0aaa, 0x2a000a, 0xaa002a, 0x2aa00aa, 0xaa902aa, 0xa000a, 0x2a002a, 0xaa00aa, 0x2a502aa, 0xa0002, 0x2a000a, 0xaa002a, 0x2a500a9, 0x20002, 0xa000a, 0x2a002a, 0x9500a5, 0x20000, 0xa0002, 0x29000a, 0x550025, 0x0, 0x20002, 0x5000a, 0x550015, 0x0, 0x20000, 0x50001, 0x550015}},
+    {{0, 3, 4, 0}, {0x95559555, 0x5558555, 0x550155, 0x150055, 0x55555555, 0x55555555, 0x5551555, 0x1550555, 0x55555555, 0x55555555, 0x55555555, 0x15555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 4, 0}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaa0aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaa0aaa8, 0xaaaaaaaa, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa0aaa0, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa5aaa5, 0xaaa1aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xa955a955, 0xa955a955}},
+    {{0, 3, 4, 0}, {0xaa80aaa0, 0xaa00aa00, 0xa800a800, 0x8000a000, 0xaa80aa80, 0xaa00aa00, 0xa800a800, 0x8000a000, 0xaa80aa80, 0xaa00aa00, 0xa000a800, 0x8000a000, 0xaa80aa81, 0xaa00aa00, 0xa000a800, 0x8000a000, 0xaa85aa95, 0xa801aa01, 0xa000a800, 0x8000a000, 0xaa55aa55, 0xa815aa15, 0xa001a805, 0x8000a000, 0xaa55aa55, 0xa955a955, 0xa015a855, 0x8005a015, 0xa955a955, 0xa555a955, 0xa555a555, 0x8055a155}},
+    {{0, 3, 4, 0}, {0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x150015, 0x10005, 0x0, 0x0}},
+    {{0, 3, 5, 0}, {0x55555555, 0x55555555, 0x55555555, 0x15565555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{2, 3, 5, 2}, {0xa800aa00, 0xa000a000, 0x8000, 0x0, 0x80005400, 0x8000, 0x0, 0x0, 0x5540, 0x0, 0x0, 0x0, 0x50005554, 0x0, 0x0, 0x0, 0x54005555, 0x0, 0x0, 0x0, 0x55405555, 0x0, 0x0, 0x0, 0x55545555, 0x5000, 0x0, 0x0, 0x55555555, 0x5500, 0x0, 0x0}},
+    {{2, 3, 5, 2}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaaa5555, 0xaaaaaaaa, 0xaaa8aaa8, 0xaa80aaa0, 0xaa555555, 0xaaa0aaa8, 0xaa80aa80, 0xaa00aa00, 0x55555555, 0xaa00aa80, 0xa800aa00, 0xa000a800, 0x55555555, 0xa8005550, 0xa000a000, 0x8000, 0x55555555, 0x55005555, 0x8000, 0x0, 0x55555555, 0x55405555, 0x4000, 0x0, 0x55555555, 0x55545555, 0x5000, 0x0}},
+    {{2, 3, 5, 2}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaa9, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaaaaaa, 0xaaa8aaa8, 0x55555555, 0x55555555, 0xaaa05555, 0xaa80aaa0, 0x55555555, 0x55555555, 0x55505555, 0xaa00aa00}},
+    {{0, 3, 5, 0}, {0x2a0002, 0xaaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa0001, 0xaaa00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x60015, 0x2aa00aa, 0xaaaa2aaa, 0xaaaaaaaa, 0x550155, 0x2aa002a, 0xaaaa2aaa, 0xaaaaaaaa, 0x5551555, 0x2aa0155, 0xaaaa2aaa, 0xaaaaaaaa, 0x55555555, 0x15551555, 0xaaaa0aaa, 0xaaaaaaaa, 0x55555555, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0x55555555, 0x55555555, 0x55555555, 0xaaaaaaaa}},
+    {{0, 3, 5, 0}, {0x0, 0x0, 0xa0000, 0x2aa00aa, 0x0, 0x0, 0x20000, 0x2aa002a, 0x0, 0x0, 0x20000, 0x2aa002a, 0x0, 0x0, 0x20000, 0xaa002a, 0x0, 0x0, 0x0, 0xaa000a, 0x1, 0x0, 0x0, 0xaa000a, 0x50015, 0x10001, 0x0, 0x2a0002, 0x550155, 0x150015, 0x10005, 0x2a0002}},
+    {{0, 1, 4, 0}, {0xaa80aa80, 0xa800aa00, 0xa000a000, 0x8000, 0xaa80aa80, 0xa800aa00, 0xa000a000, 0x8000, 0xaa80aa80, 0xa800aa00, 0xa000a000, 0x8000, 0xaa80aa80, 0xa800aa00, 0xa000a000, 0x8000, 0xaa80aa80, 0xa800aa00, 0xa000a000, 0x40008000, 0xaa80aa80, 0xa800aa00, 0xa000a800, 0x55558000, 0xaa80aaa0, 0xa800aa00, 0xa000a800, 0x55558000, 0xaa80aaa0, 0xa800aa00, 0xa000a800, 0x55559554}},
+    {{0, 1, 5, 0}, {0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x6aaa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x5aaa02aa, 0xaaaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x56aa56aa, 0x6aaa5aaa, 0xaaaaaaaa, 0xaaaaaaaa}},
+    {{0, 1, 5, 0}, {0x20000, 0x2aa002a, 0x5aaa56aa, 0xaaaa6aaa, 0x20000, 0x55aa000a, 0x56aa56aa, 0x6aaa5aaa, 0x0, 0x556a000a, 0x56aa55aa, 0x5aaa56aa, 0x0, 0x555a5556, 0x55aa556a, 0x56aa56aa, 0x0, 0x55565556, 0x556a555a, 0x55aa55aa, 0x55550000, 0x55565555, 0x555a5556, 0x55aa556a, 0x55550000, 0x55555555, 0x55565556, 0x556a555a, 0x55555555, 0x55555555, 0x55555555, 0x555a5556}},
+    {{0, 1, 4, 0}, {0xaaa5aaa8, 0xa955aa95, 0x9555a555, 0x55555555, 0xaaa5aaa8, 0xa955aa95, 0x5555a555, 0x55555555, 0xaaa5aaa9, 0xa955aa55, 0x5555a555, 0x55555555, 0xaaa5aaa9, 0xa955aa55, 0x55559555, 0x55555555, 0xaa95aaa9, 0xa955aa55, 0x55559555, 0x55555555, 0xaa95aaa9, 0xa555aa55, 0x55559555, 0x55555555, 0xaa95aaa5, 0xa555a955, 0x55559555, 0x55555555, 0xaa95aaa5, 0xa555a955, 0x55555555, 0x55555555}},
+    {{1, 2, 5, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaa9, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaa95aaa5, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaa5aaaa, 0xaa55aa95, 0x2aaa0aaa, 0xaaaa2aaa, 0xaa95aaa9, 0xa955aa55}},
+    {{1, 2, 5, 1}, {0x2aaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0x2aaa0aaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaa5aaa9, 0xaaa0aaa, 0x2aaa2aaa, 0xaaaaaaaa, 0xaa95aaa9, 0xaaa02aa, 0x2aaa0aaa, 0xaaa92aaa, 0xaa55aaa5, 0x2aa00aa, 0xaaa02aa, 0x2aa52aa9, 0xaa55aa95, 0xaa00aa, 0x2aa02aa, 0xa950aa9, 0xa9552a55, 0xaa002a, 0x2a900aa, 0xa9502a5, 0x25550955, 0x2a002a, 0xa500a9, 0x2550295, 0x15550555}},
+    {{1, 2, 5, 1}, {0xaa55aaa5, 0xa555a955, 0x55555555, 0x55555555, 0xaa55aa95, 0x9555a555, 0x55555555, 0x55555555, 0xa955aa55, 0x55559555, 0x55555555, 0x55555555, 0xa555a955, 0x55559555, 0x55555555, 0x55555555, 0x9555a555, 0x55555555, 0x55555555, 0x55555555, 0x5555a555, 0x55555555, 0x55555555, 0x55555555, 0x55559555, 0x55555555, 0x55555555, 0x55555555, 0x55551555, 0x55555555, 0x55555555, 0x55555555}},
+    {{1, 2, 5, 1}, {0x2a002a, 0xaa00aa, 0x2a902aa, 0xa950aa5, 0x2a000a, 0xaa002a, 0x2a500aa, 0xa550295, 0xa000a, 0x2a002a, 0xa500a9, 0x1550255, 0xa0002, 0x29000a, 0x950025, 0x1550055, 0x20002, 0x9000a, 0x550015, 0x1550055, 0x20000, 0x50001, 0x550015, 0x1550055, 0x0, 0x50001, 0x550015, 0x1550055, 0x0, 0x50001, 0x550015, 0x1550055}},
+    {{1, 2, 5, 1}, {0x25552955, 0x55559555, 0x55555555, 0x55555555, 0x15550955, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 4, 0}, {0xa555a555, 0xa555a555, 0x9555a555, 0x85559555, 0x95559555, 0x95559555, 0x95559555, 0x55559555, 0x95559555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 4, 0}, {0xaaaaaaaa, 0xaaa8aaa8, 0xaa80aaa0, 0xaa00aa80, 0xaaaaaaaa, 0xaaa8aaa8, 0xaa80aaa0, 0xaa00aa80, 0xaaa9aaaa, 0xaaa0aaa8, 0xaa80aaa0, 0xaa00aa80, 0xaaa9aaa9, 0xaaa5aaa5, 0xaa80aaa1, 0xaa00aa80, 0xaaa5aaa5, 0xaaa5aaa5, 0xaa95aa95, 0xaa01aa85, 0xaa95aa95, 0xaa95aa95, 0xaa55aa95, 0xaa15aa55, 0xaa55aa95, 0xaa55aa55, 0xaa55aa55, 0xa955aa55, 0xaa55aa55, 0xa955a955, 0xa955a955, 0xa955a955}},
+    {{0, 3, 4, 0}, {0xa800aa00, 0xa000a000, 0x8000, 0x0, 0xa800a800, 0xa000a000, 0x8000, 0x0, 0xa800a800, 0xa000a000, 0x8000, 0x0, 0xa800a800, 0x8000a000, 0x8000, 0x0, 0xa800a800, 0x8000a000, 0x8000, 0x0, 0xa805a805, 0x8000a001, 0x8000, 0x0, 0xa855a955, 0x8005a015, 0x18001, 0x0, 0xa555a955, 0x8055a155, 0x158055, 0x10005}},
+    {{2, 3, 5, 2}, {0x55555555, 0x55555555, 0x55555555, 0xa0005500, 0x55555555, 0x55555555, 0x55555555, 0x40005540, 0x55555555, 0x55555555, 0x55555555, 0x54005554, 0x55555555, 0x55555555, 0x55555555, 0x55005555, 0x55555555, 0x55555555, 0x55555555, 0x55405555, 0x55555555, 0x55555555, 0x55555555, 0x55545555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 1, 3, 5}, {0xaaa2aaa, 0x2aa02aa, 0x2a00aa, 0x3f002a, 0xaaaaaaaa, 0x2aaaaaaa, 0x2aa0aaa, 0x55aa02aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaaaaaa, 0x56aa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x6aaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa}},
+    {{0, 1, 3, 0}, {0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x55550000, 0xa002a, 0x2000a, 0x0, 0x55550000, 0xaa02aa, 0x2a00aa, 0x2000a, 0x55555556, 0x2aaa2aaa, 0x2aa0aaa, 0xaa00aa, 0x5555555a, 0xaaaaaaaa, 0x2aaaaaaa, 0x56aa0aaa, 0x555a55aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x6aaaaaaa, 0x556a56aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x56aa5aaa}},
+    {{0, 1, 3, 0}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55550000, 0x0, 0x0, 0x0, 0x55550000, 0x0, 0x0, 0x0, 0x55555555, 0x0, 0x0, 0x0, 0x55555555, 0x20002, 0x0, 0x55550000, 0x55555555, 0x2a002a, 0x2000a, 0x55550000, 0x55555555, 0x2aa0aaa, 0x2a00aa, 0x5555555a, 0x55555555}},
+    {{0, 1, 4, 0}, {0xaa80aaa0, 0xa800aa00, 0xa000a800, 0x55559555, 0xaa80aaa0, 0xa800aa00, 0xa554a800, 0x55555555, 0xaa80aaa0, 0xa800aa00, 0x9555a800, 0x55555555, 0xaa80aaa0, 0xa800aa00, 0x9555a954, 0x55555555, 0xaa80aaa0, 0xa800aa00, 0x9555a555, 0x55555555, 0xaa80aaa0, 0xa955aa00, 0x9555a555, 0x55555555, 0xaa80aaa0, 0xa955aa00, 0x5555a555, 0x55555555, 0xaa80aaa0, 0xa955aa55, 0x55559555, 0x55555555}},
+    {{2, 3, 5, 2}, {0x8000a000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5000, 0x0, 0x0, 0x0, 0x5400, 0x0, 0x0, 0x0, 0x5500, 0x0, 0x0, 0x0, 0x50005550, 0x0, 0x0, 0x0}},
+    {{2, 3, 5, 2}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaa8, 0xaa80aaa0, 0xaaaaaaaa, 0xaaa0aaa8, 0xaa80aaa0, 0xaa00aa80, 0xaaa09554, 0xaa80aaa0, 0xaa00aa00, 0xa800a800, 0xaa805555, 0xaa00aa00, 0xa000a800, 0x8000a000, 0x55505555, 0xa000a800, 0x8000a000, 0x0, 0x55545555, 0x80005500, 0x0, 0x0, 0x55555555, 0x40005540, 0x0, 0x0, 0x55555555, 0x54005550, 0x0, 0x0}},
+    {{2, 3, 5, 2}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0xaaa8aaa8, 0x55555555, 0x55555555, 0xaaa0aaa8, 0xaa80aaa0, 0x55555555, 0x55555555, 0xaa805554, 0xaa00aa00}},
+    {{1, 3, 5, 1}, {0xaa00aa, 0xaaa02aa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaa002a, 0x2aa00aa, 0x2aaa0aaa, 0xaaaa2aaa, 0x2a0015, 0xaa00aa, 0xaaa02aa, 0x2aaa2aaa, 0x150155, 0x2a002a, 0x2aa00aa, 0x2aaa0aaa, 0x550555, 0x2a0005, 0xaa002a, 0xaaa02aa, 0x5555555, 0x50055, 0x2a000a, 0x2aa00aa, 0x15555555, 0x550155, 0xa0006, 0xaa002a, 0x55555555, 0x1551555, 0x20015, 0x2a000a}},
+    {{1, 3, 5, 1}, {0x0, 0x0, 0x0, 0x20000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x10015, 0x0, 0x0, 0x0}},
+    {{1, 2, 5, 1}, {0x2aa02aa, 0x2aaa0aaa, 0xaaaa2aaa, 0xaaaaaaaa, 0x2aa00aa, 0xaaa02aa, 0x2aaa0aaa, 0xaaaaaaaa, 0xaa00aa, 0x2aa02aa, 0xaaa0aaa, 0xaaaa2aaa, 0x2a002a, 0x2aa00aa, 0xaaa02aa, 0x2aaa0aaa, 0x2a000a, 0xaa002a, 0x2aa02aa, 0xaaa0aaa, 0xa000a, 0x2a002a, 0x2aa00aa, 0xaaa02aa, 0xa0002, 0x2a000a, 0xaa002a, 0x2aa00aa, 0x20000, 0xa0002, 0x2a002a, 0xa900aa}},
+    {{1, 2, 5, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaa9, 0xaa55aa95, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa95aaa5, 0xa955aa55, 0xaaaaaaaa, 0xaaa9aaaa, 0xaa55aaa5, 0xa555a955, 0xaaaaaaaa, 0xaaa5aaa9, 0xa955aa95, 0x9555a555, 0x2aa92aaa, 0xaa95aaa5, 0xa955aa55, 0x55559555, 0x2aa50aa9, 0xaa552a95, 0xa555a955, 0x55559555, 0xa950aa9, 0x29552a55, 0x9555a555, 0x55555555, 0xa5502a5, 0x25550955, 0x55551555, 0x55555555}},
+    {{1, 2, 5, 1}, {0xa0002, 0x2a000a, 0xaa00aa, 0x2aa02aa, 0x20002, 0xa000a, 0xaa002a, 0x2aa00aa, 0x20000, 0xa0002, 0x2a000a, 0xaa00aa, 0x0, 0x20002, 0xa000a, 0x2a002a, 0x0, 0x20000, 0xa0002, 0x2a000a, 0x0, 0x0, 0x20002, 0x9000a, 0x0, 0x0, 0x0, 0x50002, 0x0, 0x0, 0x0, 0x50001}},
+    {{1, 2, 5, 1}, {0xaaa0aaa, 0x2aa92aaa, 0xaa95aaa5, 0xa555a955, 0xaaa02aa, 0x2aa50aa9, 0xaa552a95, 0x9555a955, 0x2aa02aa, 0xa950aa5, 0x29552a55, 0x5555a555, 0x2a900aa, 0xa5502a5, 0x25550955, 0x55551555, 0xa50029, 0x2550295, 0x5550555, 0x55551555, 0x150025, 0x1550055, 0x15550555, 0x55551555, 0x150005, 0x1550055, 0x15550555, 0x55551555, 0x150005, 0x1550055, 0x15550555, 0x55551555}},
+    {{1, 2, 5, 1}, {0x2a000a, 0x950029, 0x1550055, 0x15550555, 0x9000a, 0x150025, 0x1550055, 0x15550555, 0x50001, 0x150015, 0x1550055, 0x15550555, 0x50001, 0x150015, 0x1550055, 0x15550555, 0x50001, 0x150015, 0x1550055, 0x15550555, 0x50001, 0x550015, 0x1550055, 0x15550555, 0x50001, 0x550015, 0x1550055, 0x15550555, 0x50001, 0x550015, 0x1550055, 0x15550555}},
+    {{0, 3, 4, 0}, {0xa555a555, 0x95559555, 0x1558555, 0x150055, 0x95559555, 0x95559555, 0x15555555, 0x5551555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 4, 0}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaa8aaa9, 0xaaa9aaaa, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa5aaa9, 0xaaa9aaa9, 0xaaa5aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa95aa95, 0xaa55aa95, 0xaa55aa55, 0xaa55aa95, 0xaa55aa55, 0xaa55aa55, 0xa955aa55}},
+    {{0, 3, 4, 0}, {0xaa80aaa0, 0xaa00aa80, 0xa800aa00, 0xa000a000, 0xaa80aaa0, 0xaa00aa80, 0xa800aa00, 0xa000a000, 0xaa80aaa0, 0xaa00aa80, 0xa800a800, 0xa000a000, 0xaa81aaa5, 0xaa00aa80, 0xa800a800, 0x8000a000, 0xaa95aa95, 0xaa01aa85, 0xa800a800, 0x8000a000, 0xaa95aa95, 0xaa55aa55, 0xa805a815, 0x8000a001, 0xaa55aa55, 0xa955aa55, 0xa855a955, 0x8015a015, 0xa955a955, 0xa955a955, 0xa555a555, 0x8155a555}},
+    {{0, 3, 4, 0}, {0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x18005, 0x0, 0x0, 0x0, 0x158055, 0x50005, 0x1, 0x0}},
+    {{0, 1, 3, 0}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2000a, 0x2, 0x0, 0x0, 0xaa00aa, 0xa002a, 0x20002, 0x0, 0xaaa2aaa, 0xaa02aa, 0x2a002a, 0x2000a, 0xaaaaaaaa, 0xaaa2aaa, 0x2aa0aaa, 0x2a00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaaaaaa, 0xaaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x6aaaaaaa}},
+    {{0, 1, 3, 0}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xa002a, 0x2000a, 0x0, 0x54000000, 0x2aa02aa, 0x2a00aa, 0x2000a, 0x55550002}},
+    {{0, 1, 4, 0}, {0xa800a800, 0x8000a000, 0x8000, 0x0, 0xa800a800, 0x8000a000, 0x8000, 0x0, 0xa800a800, 0x8000a000, 0x8000, 0x0, 0xa800a800, 0x8000a000, 0x8000, 0x0, 0xa800a800, 0x8000a000, 0x8000, 0x0, 0xa800a800, 0x8000a000, 0x8000, 0x55550000, 0xa800a800, 0x8000a000, 0x8000, 0x55554000, 0xa800a800, 0x8000a000, 0x8000, 0x55555555}},
+    {{0, 1, 4, 0}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa4aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaa9, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa95aaa9}},
+    {{0, 1, 3, 0}, {0x2aaaaaaa, 0x2aa0aaa, 0x555a55aa, 0x55555555, 0xaaaaaaaa, 0x6aaaaaaa, 0x556a56aa, 0x55555556, 0xaaaaaaaa, 0xaaaaaaaa, 0x56aa6aaa, 0x5556556a, 0xaaaaaaaa, 0xaaaaaaaa, 0x5aaaaaaa, 0x555a55aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55aa5aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x56aa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x6aaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa}},
+    {{0, 1, 3, 0}, {0x0, 0x55000000, 0x55555555, 0x55555555, 0x2000a, 0x55550000, 0x55555555, 0x55555555, 0x2a00aa, 0x5556555a, 0x55555555, 0x55555555, 0x2aa0aaa, 0x555a55aa, 0x55555555, 0x55555555, 0x6aaaaaaa, 0x556a56aa, 0x5555555a, 0x55555555, 0xaaaaaaaa, 0x56aa6aaa, 0x5556556a, 0x55555555, 0xaaaaaaaa, 0x5aaaaaaa, 0x556a55aa, 0x55555556, 0xaaaaaaaa, 0xaaaaaaaa, 0x55aa5aaa, 0x5555555a}},
+    {{0, 1, 3, 0}, {0x0, 0x55550000, 0x55555555, 0x55555555, 0x0, 0x55550000, 0x55555555, 0x55555555, 0x0, 0x55555555, 0x55555555, 0x55555555, 0x40000000, 0x55555555, 0x55555555, 0x55555555, 0x55550000, 0x55555555, 0x55555555, 0x55555555, 0x5556556a, 0x55555555, 0x55555555, 0x55555555, 0x555a55aa, 0x55555555, 0x55555555, 0x55555555, 0x55aa56aa, 0x5555555a, 0x55555555, 0x55555555}},
+    {{0, 1, 4, 0}, {0xaa80aaa0, 0xa555aa55, 0x55559555, 0x55555555, 0xaa95aaa0, 0xa555a955, 0x55559555, 0x55555555, 0xaa55aaa0, 0xa555a955, 0x55555555, 0x55555555, 0xaa55aa95, 0x9555a955, 0x55555555, 0x55555555, 0xaa55aa95, 0x9555a955, 0x55555555, 0x55555555, 0xaa55aa95, 0x9555a555, 0x55555555, 0x55555555, 0xa955aa95, 0x9555a555, 0x55555555, 0x55555555, 0xa955aa55, 0x5555a555, 0x55555555, 0x55555555}},
+    {{2, 3, 5, 2}, {0x55555555, 0x55555555, 0x55405555, 0xa800a800, 0x55555555, 0x55555555, 0x55505555, 0x80005400, 0x55555555, 0x55555555, 0x55545555, 0x40005500, 0x55555555, 0x55555555, 0x55555555, 0x50005540, 0x55555555, 0x55555555, 0x55555555, 0x54005550, 0x55555555, 0x55555555, 0x55555555, 0x55005554, 0x55555555, 0x55555555, 0x55555555, 0x55405555, 0x55555555, 0x55555555, 0x55555555, 0x55505555}},
+    {{1, 3, 5, 1}, {0x55555555, 0x5555555, 0x150155, 0xa0002, 0x55555555, 0x55555555, 0x550555, 0x20005, 0x55555555, 0x55555555, 0x5555555, 0x50055, 0x55555555, 0x55555555, 0x15555555, 0x150155, 0x55555555, 0x55555555, 0x55555555, 0x1551555, 0x55555555, 0x55555555, 0x55555555, 0x5555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{2, 3, 5, 2}, {0x8000a000, 0x8000, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0, 0x5000, 0x0, 0x0, 0x0, 0x5400, 0x0, 0x0, 0x0}},
+    {{2, 3, 5, 2}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaa8, 0xaaa0aaa0, 0xaaaaaaaa, 0xaaa8aaa8, 0xaaa0aaa0, 0xaa00aa80, 0xaaa8aaa8, 0xaaa0aaa0, 0xaa00aa80, 0xa800aa00, 0xaaa05554, 0xaa00aa80, 0xa800aa00, 0xa000a000, 0x55005555, 0xa800aa00, 0xa000a000, 0x8000, 0x55505555, 0xa0005000, 0x80008000, 0x0, 0x55545555, 0x80005400, 0x0, 0x0, 0x55555555, 0x40005500, 0x0, 0x0}},
+    {{2, 3, 5, 2}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa5555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x55555555, 0xaaaa5555, 0xaaaaaaaa, 0xaaa8aaaa, 0x55555555, 0x556a5555, 0xaaa8aaaa, 0xaaa0aaa8, 0x55555555, 0x55555555, 0xaaa06aa8, 0xaa80aa80}},
+    {{1, 3, 5, 1}, {0xaa002a, 0x2aa00aa, 0x2aaa0aaa, 0xaaaaaaaa, 0x2a000a, 0xaa00aa, 0xaaa02aa, 0x2aaa2aaa, 0xa0002, 0x2a002a, 0x2aa00aa, 0x2aaa0aaa, 0x20001, 0x2a000a, 0xaa002a, 0xaaa02aa, 0x10015, 0xa0002, 0x2a000a, 0x2aa00aa, 0x50055, 0x20000, 0xa0002, 0xaa002a, 0x550555, 0x5, 0x20002, 0x2a000a, 0x1551555, 0x50055, 0x0, 0xa0002}},
+    {{1, 2, 5, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aa02aa, 0x2aaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa00aa, 0xaaa02aa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaa002a, 0x2aa00aa, 0x2aaa0aaa, 0xaaa92aaa}},
+    {{1, 2, 5, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaa9, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaa9, 0xaa95aaa5, 0xaaaa2aaa, 0xaaa9aaaa, 0xaa95aaa5, 0xaa55aa95}},
+    {{1, 2, 5, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa0aaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaa9aaa9, 0xaaa02aa, 0x2aaa2aaa, 0xaaa9aaaa, 0xaa95aaa5}},
+    {{1, 2, 5, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa02aa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aa02aa, 0x2aaa0aaa, 0xaaaa2aaa, 0xaaaaaaaa, 0x2aa00aa, 0xaaa02aa, 0x2aaa2aaa, 0xaaaaaaaa, 0xaa002a, 0x2aa00aa, 0x2aaa0aaa, 0xaaa92aaa}},
+    {{1, 2, 5, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaa9, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaa95aaa5, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaa9, 0xaa55aa95, 0xaaaaaaaa, 0xaaa9aaaa, 0xaa95aaa5, 0xa955aa55, 0xaaaaaaaa, 0xaaa5aaa9, 0xaa55aa95, 0xa555a955, 0xaaa92aaa, 0xaa95aaa5, 0xa955aa55, 0x9555a555, 0x2aa50aa9, 0xaa55aa95, 0xa555a955, 0x55559555}},
+    {{1, 2, 5, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaa9, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaa95aaa5, 0x2aaa2aaa, 0xaaaaaaaa, 0xaaa5aaa9, 0xaa55aa95, 0xaaa0aaa, 0xaaa92aaa, 0xaa95aaa5, 0xa955aa55, 0xaaa02aa, 0x2aa50aa9, 0xaa55aa95, 0xa555a955, 0x2a900aa, 0xa950aa5, 0xa9552a55, 0x9555a555, 0xa500a9, 0xa550295, 0x25550955, 0x55551555}},
+    {{1, 2, 5, 1}, {0xaaa0aaa, 0xaaaa2aaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaa02aa, 0x2aaa0aaa, 0xaaaaaaaa, 0xaaa5aaa9, 0x2aa00aa, 0xaaa0aaa, 0xaaa92aaa, 0xaa95aaa5, 0xaa00aa, 0xaaa02aa, 0x2aa50aa9, 0xaa552a95, 0xaa002a, 0x2a900aa, 0xa950aa5, 0x29552a55, 0x2a000a, 0xa500a9, 0x2550295, 0x25550955, 0x90002, 0x150025, 0x1550055, 0x5550155, 0x50001, 0x150005, 0x1550055, 0x5550555}},
+    {{1, 2, 5, 1}, {0xaa95aaa5, 0xa955aa55, 0x9555a555, 0x55555555, 0xaa55aa95, 0xa555a955, 0x55559555, 0x55555555, 0xa955aa55, 0x9555a555, 0x55555555, 0x55555555, 0xa555a955, 0x55559555, 0x55555555, 0x55555555, 0x9555a555, 0x55555555, 0x55555555, 0x55555555, 0x55551555, 0x55555555, 0x55555555, 0x55555555, 0x55551555, 0x55555555, 0x55555555, 0x55555555, 0x55551555, 0x55555555, 0x55555555, 0x55555555}},
+    {{1, 2, 5, 1}, {0x2a002a, 0x2aa00aa, 0xaaa02aa, 0x2aa90aaa, 0x2a000a, 0xaa002a, 0x2aa02aa, 0xaa50aa9, 0xa0002, 0x2a002a, 0xa900aa, 0xa9502a5, 0x20002, 0x2a000a, 0xa50029, 0x2550095, 0x20000, 0x90002, 0x150005, 0x1550055, 0x0, 0x50001, 0x150005, 0x1550055, 0x0, 0x50001, 0x150005, 0x1550055, 0x0, 0x50001, 0x150005, 0x1550055}},
+    {{1, 2, 5, 1}, {0xaa55aaa5, 0xa555a955, 0x55559555, 0x55555555, 0xaa552a95, 0x9555a555, 0x55555555, 0x55555555, 0x29550a55, 0x55551555, 0x55555555, 0x55555555, 0x5550955, 0x55551555, 0x55555555, 0x55555555, 0x5550555, 0x55551555, 0x55555555, 0x55555555, 0x5550555, 0x55551555, 0x55555555, 0x55555555, 0x5550555, 0x55551555, 0x55555555, 0x55555555, 0x15550555, 0x55551555, 0x55555555, 0x55555555}},
+    {{1, 2, 5, 1}, {0x0, 0x20002, 0x2a000a, 0xa50029, 0x0, 0x20000, 0x90002, 0x150005, 0x0, 0x0, 0x50001, 0x150005, 0x0, 0x0, 0x50001, 0x150005, 0x0, 0x0, 0x50001, 0x150005, 0x0, 0x0, 0x50001, 0x150015, 0x0, 0x0, 0x50001, 0x150015, 0x0, 0x0, 0x50001, 0x550015}},
+    {{1, 2, 5, 1}, {0x2550095, 0x5550555, 0x55551555, 0x55555555, 0x1550055, 0x5550555, 0x55551555, 0x55555555, 0x1550055, 0x5550555, 0x55551555, 0x55555555, 0x1550055, 0x15550555, 0x55551555, 0x55555555, 0x1550055, 0x15550555, 0x55551555, 0x55555555, 0x1550055, 0x15550555, 0x55555555, 0x55555555, 0x1550055, 0x15550555, 0x55555555, 0x55555555, 0x1550055, 0x15550555, 0x55555555, 0x55555555}},
+    {{0, 3, 4, 0}, {0x5558555, 0x550155, 0x50015, 0x1, 0x55555555, 0x5551555, 0x550155, 0x150055, 0x55555555, 0x55555555, 0x15555555, 0x1550555, 0x55555555, 0x55555555, 0x55555555, 0x15555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{0, 3, 4, 0}, {0xaaaaaaaa, 0xaaa8aaa8, 0xaa80aaa0, 0xaa00aa80, 0xaaaaaaaa, 0xaaa8aaa8, 0xaa80aaa0, 0xaa00aa80, 0xaaa9aaaa, 0xaaa9aaa9, 0xaa80aaa0, 0xaa00aa80, 0xaaa9aaa9, 0xaaa5aaa5, 0xaa81aaa5, 0xaa00aa80, 0xaaa5aaa5, 0xaa95aaa5, 0xaa95aa95, 0xaa05aa95, 0xaa95aa95, 0xaa95aa95, 0xaa55aa95, 0xaa55aa55, 0xaa55aa95, 0xaa55aa55, 0xaa55aa55, 0xa955a955, 0xaa55aa55, 0xa955aa55, 0xa955a955, 0xa955a955}},
+    {{0, 1, 3, 0}, {0x2aaaaaaa, 0x2aa0aaa, 0xaa00aa, 0x5556556a, 0xaaaaaaaa, 0x2aaaaaaa, 0xaaa2aaa, 0x555a55aa, 0xaaaaaaaa, 0xaaaaaaaa, 0x6aaaaaaa, 0x55aa5aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x56aa6aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x6aaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa}},
+    {{0, 1, 3, 0}, {0x0, 0x0, 0x0, 0x55555555, 0x2000a, 0x0, 0x55540000, 0x55555555, 0x2a00aa, 0xa002a, 0x55554002, 0x55555555, 0xaaa2aaa, 0xaa02aa, 0x5556556a, 0x55555555, 0xaaaaaaaa, 0x5aaa2aaa, 0x555a55aa, 0x55555555, 0xaaaaaaaa, 0xaaaaaaaa, 0x55aa5aaa, 0x5555555a, 0xaaaaaaaa, 0xaaaaaaaa, 0x56aa6aaa, 0x5556556a, 0xaaaaaaaa, 0xaaaaaaaa, 0x6aaaaaaa, 0x556a56aa}},
+    {{0, 1, 3, 4}, {0xfc00fc00, 0xc000f000, 0x5540c000, 0x55555555, 0xfc00fc00, 0xc000f000, 0x5555c000, 0x55555555, 0xfc00fc00, 0xc000f000, 0x55555555, 0x55555555, 0xfc00fc00, 0xd400f000, 0x55555555, 0x55555555, 0xfc00fc02, 0xd555f000, 0x55555555, 0x55555555, 0xfc0afc2a, 0xd555f556, 0x55555555, 0x55555555, 0xfeaafeaa, 0x5556d56a, 0x55555555, 0x55555555, 0xfaaafaaa, 0x555ad5aa, 0x55555556, 0x55555555}},
+    {{1, 2, 3, 5}, {0xaaaaaaaa, 0xaaaaaaaa, 0x3fd5aaa9, 0xff55ff55, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa95aaaa, 0xf5553d55, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaaa, 0x1555a955, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0x9555aa55, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa555aa95, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa955aaa5, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa55aaa9, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa95aaaa}},
+    {{1, 3, 5, 1}, {0x15555555, 0x150155, 0x1, 0x20000, 0x55555555, 0x1550555, 0x10015, 0x0, 0x55555555, 0x5555555, 0x50055, 0x0, 0x55555555, 0x55555555, 0x550555, 0x5, 0x55555555, 0x55555555, 0x1551555, 0x10015, 0x55555555, 0x55555555, 0x15555555, 0x150155, 0x55555555, 0x55555555, 0x55555555, 0x550555, 0x55555555, 0x55555555, 0x55555555, 0x5555555}},
+    {{2, 3, 5, 2}, {0xa000a800, 0x8000a000, 0x0, 0x0, 0x8000a000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0, 0x5000, 0x0, 0x0, 0x0}},
+    {{1, 2, 3, 5}, {0x3f000f, 0xff003f, 0xfff03ff, 0x3ff53ffd, 0xf0003, 0x3f000f, 0x3f500fd, 0xfd50ff5, 0x30000, 0xd000d, 0xd50035, 0x35503d5, 0x10000, 0x50001, 0x150015, 0x1550055, 0x10000, 0x50001, 0x550015, 0x1550055, 0x10002, 0x50005, 0x550015, 0x1550155, 0x1000a, 0x150005, 0x550015, 0x1550155, 0x900aa, 0x150005, 0x550015, 0x5550155}},
+    {{1, 2, 5, 1}, {0xaa95aaa5, 0xaa55aa55, 0xa555a955, 0x95559555, 0xaa552a55, 0xa555a955, 0x9555a555, 0x55555555, 0x29550955, 0x9555a555, 0x55555555, 0x55555555, 0x5550555, 0x55551555, 0x55555555, 0x55555555, 0x15550555, 0x55551555, 0x55555555, 0x55555555, 0x15550555, 0x55551555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555}},
+    {{1, 2, 5, 1}, {0x20000, 0xa000a, 0xaa002a, 0xaaa02aa, 0x0, 0xa0002, 0x2a000a, 0x2a900aa, 0x0, 0x20000, 0xa0002, 0xa50029, 0x0, 0x0, 0x10001, 0x150005, 0x0, 0x0, 0x50001, 0x150005, 0x0, 0x0, 0x50001, 0x150005, 0x0, 0x0, 0x50001, 0x150015, 0x0, 0x0, 0x50001, 0x150015}},
+    {{1, 2, 5, 1}, {0x2aa90aaa, 0xaaa5aaa5, 0xaa55aa95, 0xa955a955, 0xaa502a9, 0xaa952a95, 0xa955aa55, 0x9555a555, 0x29500a5, 0x29550a55, 0xa555a955, 0x55559555, 0x550055, 0x5550155, 0x15551555, 0x55555555, 0x550055, 0x5550155, 0x15551555, 0x55555555, 0x1550055, 0x5550155, 0x55551555, 0x55555555, 0x1550055, 0x5550555, 0x55551555, 0x55555555, 0x1550055, 0x5550555, 0x55551555, 0x55555555}},
+    {{1, 2, 5, 1}, {0x0, 0x20000, 0xa0002, 0xaa002a, 0x0, 0x0, 0x20000, 0x2a000a, 0x0, 0x0, 0x0, 0xa0002, 0x0, 0x0, 0x0, 0x10000, 0x0, 0x0, 0x0, 0x10000, 0x0, 0x0, 0x0, 0x10000, 0x0, 0x0, 0x0, 0x10001, 0x0, 0x0, 0x0, 0x10001}},
+    {{1, 2, 5, 1}, {0x2aa00aa, 0xaaa0aaa, 0xaaa52aa9, 0xaa55aa95, 0xaa002a, 0xaa502a9, 0x2a950aa5, 0xa955aa55, 0x29002a, 0x29500a5, 0xa550a55, 0xa5552955, 0x50005, 0x550015, 0x1550155, 0x15550555, 0x150005, 0x550015, 0x5550155, 0x15550555, 0x150005, 0x550015, 0x5550155, 0x15550555, 0x150005, 0x550055, 0x5550155, 0x15551555, 0x150005, 0x550055, 0x5550155, 0x15551555}},
+    {{1, 2, 5, 1}, {0x2a000a, 0xaa00aa, 0xaa902aa, 0x2aa50aa5, 0xa0002, 0x2a002a, 0x2a500a9, 0xa550a95, 0x20000, 0x29000a, 0x950025, 0x1550255, 0x10000, 0x50001, 0x550015, 0x1550055, 0x10000, 0x50001, 0x550015, 0x1550155, 0x10000, 0x50005, 0x550015, 0x1550155, 0x10000, 0x50005, 0x550015, 0x5550155, 0x10000, 0x150005, 0x550015, 0x5550155}},
+    {{1, 2, 5, 1}, {0xaa55aa95, 0xa555a955, 0x55559555, 0x55555555, 0xa9552a55, 0x9555a555, 0x55555555, 0x55555555, 0x25550555, 0x55559555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555, 0x15550555, 0x55555555, 0x55555555, 0x55555555}},
+    {{1, 2, 5, 1}, {0x20000, 0xa0002, 0x2a002a, 0x2a500a9, 0x0, 0x20000, 0x9000a, 0x950025, 0x0, 0x0, 0x50001, 0x150015, 0x0, 0x0, 0x50001, 0x150015, 0x0, 0x0, 0x50001, 0x550015, 0x0, 0x10000, 0x50001, 0x550015, 0x0, 0x10000, 0x50001, 0x550015, 0x0, 0x10000, 0x50005, 0x550015}},
+    {{1, 2, 5, 1}, {0xa9502a5, 0x29552a55, 0x9555a555, 0x55555555, 0x2550255, 0x25550955, 0x55551555, 0x55555555, 0x1550055, 0x15550555, 0x55551555, 0x55555555, 0x1550055, 0x15550555, 0x55551555, 0x55555555, 0x1550055, 0x15550555, 0x55555555, 0x55555555, 0x1550055, 0x15550555, 0x55555555, 0x55555555, 0x1550155, 0x15550555, 0x55555555, 0x55555555, 0x1550155, 0x15550555, 0x55555555, 0x55555555}},
+    {{1, 2, 5, 1}, {0x0, 0x0, 0x20000, 0x90002, 0x0, 0x0, 0x0, 0x50001, 0x0, 0x0, 0x0, 0x50001, 0x0, 0x0, 0x0, 0x50001, 0x0, 0x0, 0x0, 0x50001, 0x0, 0x0, 0x0, 0x50001, 0x0, 0x0, 0x10000, 0x50001, 0x0, 0x0, 0x10000, 0x50001}},
+    {{1, 2, 5, 1}, {0x150025, 0x1550055, 0x5550555, 0x55551555, 0x150005, 0x1550055, 0x5550555, 0x55551555, 0x150015, 0x1550055, 0x15550555, 0x55551555, 0x150015, 0x1550055, 0x15550555, 0x55551555, 0x550015, 0x1550055, 0x15550555, 0x55555555, 0x550015, 0x1550055, 0x15550555, 0x55555555, 0x550015, 0x1550155, 0x15550555, 0x55555555, 0x550015, 0x1550155, 0x15550555, 0x55555555}},
+    {{1, 3, 4, 1}, {0x9555a555, 0x558555, 0x5, 0x0, 0x95559555, 0x1551555, 0x10015, 0x0, 0x55555555, 0x15555555, 0x150155, 0x1, 0x55555555, 0x55555555, 0x550555, 0x10005, 0x55555555, 0x55555555, 0x5555555, 0x50055, 0x55555555, 0x55555555, 0x15555555, 0x150155, 0x55555555, 0x55555555, 0x55555555, 0x1551555, 0x55555555, 0x55555555, 0x55555555, 0x5555555}},
+    {{1, 3, 4, 1}, {0xaaaaaaaa, 0xaaa8aaaa, 0xaa80aaa0, 0xa000aa00, 0xaaaaaaaa, 0xaaa8aaaa, 0xaa80aaa0, 0xa000a800, 0xaaaaaaaa, 0xaaa8aaaa, 0xaa00aa80, 0xa000a800, 0xaaa9aaa9, 0xaaa0aaa9, 0xaa00aa80, 0x8000a800, 0xaaa5aaa9, 0xaaa5aaa5, 0xa800aa80, 0x8000a000, 0xaaa5aaa5, 0xaa95aaa5, 0xa800aa01, 0x8000a000, 0xaa95aa95, 0xaa95aa95, 0xa801aa05, 0x8000, 0xaa55aa95, 0xaa55aa55, 0xa005a855, 0x8000}},
+    {{1, 2, 3, 1}, {0x2a02aa, 0x150005, 0x550055, 0x5550155, 0x2aa2aaa, 0x150025, 0x550055, 0x5550155, 0xaaaaaaa, 0x1502a9, 0x1550055, 0x5550155, 0xaaaaaaaa, 0x950aaa, 0x1550055, 0x5550555, 0xaaaaaaaa, 0xaa5aaaa, 0x1550055, 0x5550555, 0xaaaaaaaa, 0x2aa9aaaa, 0x1550255, 0x15550555, 0xaaaaaaaa, 0xaaaaaaaa, 0x1552a95, 0x15550555, 0xaaaaaaaa, 0xaaaaaaaa, 0x955aaa5, 0x15550555}},
+    {{1, 3, 4, 1}, {0xaa55aa55, 0xa955a955, 0xa015a955, 0x8005, 0xa955a955, 0xa555a955, 0x8155a555, 0x10015, 0xa555a555, 0xa555a555, 0x8555a555, 0x50055, 0x9555a555, 0x95559555, 0x95559555, 0x550555, 0x95559555, 0x55555555, 0x55555555, 0x1551555, 0x55555555, 0x55555555, 0x55555555, 0x15555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{1, 3, 4, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaa9, 0xaa80aaa9, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa5aaa9, 0xaa80aaa5, 0xaaa5aaa9, 0xaaa5aaa5, 0xaaa5aaa5, 0xaa85aa95}},
+    {{1, 2, 3, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaa55aaa9, 0x15550555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa95aaaa, 0x15552555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaaa, 0x1555a955, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0x9555aa55, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa555aa95, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa955aaa5, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa55aaa9, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa95aaaa}},
+    {{1, 2, 3, 1}, {0x10000, 0x50001, 0x150015, 0x1550055, 0x10000, 0x50001, 0x550015, 0x1550055, 0x10000, 0x50005, 0x550015, 0x1550055, 0x10000, 0x50005, 0x550015, 0x1550155, 0x10001, 0x150005, 0x550015, 0x1550155, 0x10002, 0x150005, 0x550055, 0x5550155, 0x5002a, 0x150005, 0x550055, 0x5550155, 0x900aa, 0x150005, 0x1550055, 0x5550155}},
+    {{1, 3, 4, 1}, {0xaaa5aaa5, 0xaa95aaa5, 0xaa95aa95, 0xaa15aa95, 0xaa95aa95, 0xaa95aa95, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xaa55aa55, 0xa955a955, 0xaa55aa55, 0xa955a955, 0xa955a955, 0xa555a955, 0xa955a955, 0xa555a955, 0xa555a555, 0xa555a555, 0xa555a555, 0xa555a555, 0x95559555, 0x95559555, 0x95559555, 0x95559555, 0x95559555, 0x55555555, 0x95559555, 0x55555555, 0x55555555, 0x55555555}},
+    {{1, 3, 4, 1}, {0xa000a801, 0x8000, 0x0, 0x0, 0x8001a805, 0x0, 0x0, 0x0, 0x8005a055, 0x0, 0x0, 0x0, 0x8015a155, 0x5, 0x0, 0x0, 0x1559555, 0x10015, 0x0, 0x0, 0x5559555, 0x50055, 0x1, 0x0, 0x55555555, 0x550555, 0x5, 0x0, 0x55555555, 0x1551555, 0x50015, 0x0}},
+    {{1, 3, 4, 1}, {0xaaaaaaaa, 0xaaa8aaaa, 0xaa80aaa0, 0xa000aa00, 0xaaaaaaaa, 0xaaa8aaaa, 0xaa80aaa0, 0xa000a800, 0xaaaaaaaa, 0xaaa8aaaa, 0xaa00aa80, 0xa000a800, 0xaaaaaaaa, 0xaaa0aaa8, 0xaa00aa80, 0x8000a800, 0xaaaaaaaa, 0xaaa0aaa8, 0xa800aa80, 0x8000a000, 0xaaaaaaaa, 0xaa80aaa8, 0xa800aa00, 0x8000a000, 0xaaa8aaaa, 0xaa80aaa0, 0xa800aa00, 0x8000, 0xaaa9aaa9, 0xaa80aaa0, 0xa000a800, 0x8000}},
+    {{1, 2, 3, 1}, {0xaa0aaa, 0x150015, 0x1550055, 0x5550155, 0x2aa2aaa, 0x5500a5, 0x1550055, 0x5550555, 0x2aaaaaaa, 0x5502a9, 0x1550055, 0x15550555, 0xaaaaaaaa, 0x2950aaa, 0x1550155, 0x15550555, 0xaaaaaaaa, 0xaa5aaaa, 0x1550155, 0x15550555, 0xaaaaaaaa, 0xaaa9aaaa, 0x5550a55, 0x15550555, 0xaaaaaaaa, 0xaaa9aaaa, 0x5552a95, 0x15551555, 0xaaaaaaaa, 0xaaaaaaaa, 0x2955aa95, 0x15551555}},
+    {{1, 3, 4, 1}, {0xaaa5aaa9, 0xaa00aa80, 0xa000a800, 0x8000, 0xaaa5aaa5, 0xaa00aa85, 0x8000a800, 0x0, 0xaa95aa95, 0xa801aa95, 0x8000a000, 0x0, 0xaa55aa55, 0xa815aa55, 0x8000a001, 0x0, 0xa955aa55, 0xa855a955, 0x18005, 0x0, 0xa955a955, 0xa555a555, 0x58055, 0x0, 0xa555a555, 0xa555a555, 0x158155, 0x1, 0x95559555, 0x95559555, 0x1550555, 0x10015}},
+    {{1, 2, 3, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xa955aaa5, 0x55551555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa55aaa9, 0x55559555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa95aaaa, 0x5555a555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaaa, 0x5555a955, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0x9555aa55, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa555aa95, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa955aaa5, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa55aaa9}},
+    {{1, 2, 3, 1}, {0x10000, 0x50005, 0x550015, 0x1550155, 0x10000, 0x150005, 0x550015, 0x1550155, 0x10001, 0x150005, 0x550015, 0x5550155, 0x50001, 0x150005, 0x550055, 0x5550155, 0x50001, 0x150005, 0x1550055, 0x5550155, 0x50009, 0x150015, 0x1550055, 0x5550155, 0x5002a, 0x150015, 0x1550055, 0x5550555, 0x2502aa, 0x550015, 0x1550055, 0x5550555}},
+    {{1, 3, 4, 1}, {0x55559555, 0x55555555, 0x5555555, 0x50055, 0x55555555, 0x55555555, 0x15555555, 0x550555, 0x55555555, 0x55555555, 0x55555555, 0x1551555, 0x55555555, 0x55555555, 0x55555555, 0x15555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{1, 3, 4, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaa00aa80, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaa0aaa9, 0xaa00aa80, 0xaaa9aaa9, 0xaaa9aaa9, 0xaaa1aaa5, 0xa800aa80, 0xaaa5aaa5, 0xaaa5aaa5, 0xaa85aaa5, 0xa800aa00, 0xaaa5aaa5, 0xaa95aa95, 0xaa95aa95, 0xa800aa05, 0xaa95aa95, 0xaa55aa95, 0xaa55aa55, 0xa001a815, 0xaa55aa55, 0xaa55aa55, 0xa955aa55, 0xa015a855, 0xa955a955, 0xa955a955, 0xa955a955, 0x8055a555}},
+    {{1, 3, 4, 1}, {0xa000a800, 0x8000, 0x0, 0x0, 0x8000a800, 0x0, 0x0, 0x0, 0x8000a000, 0x0, 0x0, 0x0, 0x8000a000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8000, 0x0, 0x0, 0x0, 0x8001, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0}},
+    {{1, 2, 3, 1}, {0xa90aaa, 0x550015, 0x1550155, 0x15550555, 0xaaaaaaa, 0x550095, 0x1550155, 0x15550555, 0x2aaaaaaa, 0x5502a5, 0x5550155, 0x15550555, 0xaaaaaaaa, 0x2552aa9, 0x5550155, 0x15550555, 0xaaaaaaaa, 0xa95aaaa, 0x5550155, 0x15551555, 0xaaaaaaaa, 0xaaa5aaaa, 0x5550955, 0x55551555, 0xaaaaaaaa, 0xaaa9aaaa, 0x5552a55, 0x55551555, 0xaaaaaaaa, 0xaaaaaaaa, 0x2555aa95, 0x55551555}},
+    {{1, 3, 4, 1}, {0xa955a955, 0xa555a555, 0xa555a555, 0x8155a555, 0xa555a555, 0x9555a555, 0x95559555, 0x15559555, 0x95559555, 0x95559555, 0x55559555, 0x55555555, 0x55559555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555}},
+    {{1, 3, 4, 1}, {0xaaa8aaaa, 0xaa00aa80, 0xa000a800, 0x0, 0xaaa0aaa8, 0xaa00aa80, 0x8000a000, 0x0, 0xaaa0aaa8, 0xa800aa00, 0x8000a000, 0x0, 0xaa80aaa0, 0xa800aa00, 0xa000, 0x0, 0xaa80aaa1, 0xa000aa00, 0x8000, 0x0, 0xaa01aaa5, 0xa000a800, 0x8000, 0x0, 0xaa05aa95, 0xa000a800, 0x0, 0x0, 0xaa15aa55, 0x8000a001, 0x0, 0x0}},
+    {{1, 2, 3, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xa955aaa5, 0x55551555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa55aaa5, 0x55559555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa55aaa9, 0x5555a555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa95aaaa, 0x5555a555, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa5aaaa, 0x9555a955, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0x9555aa55, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa555aa95, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa955aaa5}},
+    {{1, 2, 3, 1}, {0x10001, 0x150005, 0x550055, 0x5550155, 0x50001, 0x150005, 0x550055, 0x5550155, 0x50001, 0x150015, 0x1550055, 0x5550155, 0x50001, 0x150015, 0x1550055, 0x5550555, 0x50005, 0x550015, 0x1550055, 0x5550555, 0x50009, 0x550015, 0x1550055, 0x15550555, 0x1500a9, 0x550015, 0x1550155, 0x15550555, 0x1502aa, 0x550015, 0x5550155, 0x15550555}},
+    {{1, 3, 4, 1}, {0xa955a955, 0x8001a015, 0x0, 0x0, 0xa555a955, 0x5a055, 0x1, 0x0, 0xa555a555, 0x558155, 0x5, 0x0, 0x95559555, 0x1559555, 0x50015, 0x0, 0x55555555, 0x5555555, 0x150155, 0x1, 0x55555555, 0x55555555, 0x550555, 0x10005, 0x55555555, 0x55555555, 0x5551555, 0x50055, 0x55555555, 0x55555555, 0x15555555, 0x150155}},
+    {{1, 3, 4, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaaa, 0xaa00aa80, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa8, 0xaa00aa80, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa8, 0xa800aa00, 0xaaaaaaaa, 0xaaa8aaaa, 0xaa80aaa0, 0xa800aa00, 0xaaaaaaaa, 0xaaa8aaaa, 0xaa80aaa0, 0xa000aa00, 0xaaaaaaaa, 0xaaa8aaa9, 0xaa00aa80, 0xa000a800, 0xaaa9aaa9, 0xaaa1aaa9, 0xaa00aa80, 0x8000a800, 0xaaa5aaa5, 0xaaa5aaa5, 0xa800aa81, 0x8000a000}},
+    {{1, 2, 3, 1}, {0x2a50aaa, 0x550055, 0x5550155, 0x15550555, 0xaa9aaaa, 0x1550055, 0x5550155, 0x15551555, 0x2aaaaaaa, 0x1550a95, 0x5550155, 0x15551555, 0xaaaaaaaa, 0x1552aa5, 0x5550555, 0x55551555, 0xaaaaaaaa, 0x2a55aaa9, 0x5550555, 0x55551555, 0xaaaaaaaa, 0xaa95aaaa, 0x15550555, 0x55551555, 0xaaaaaaaa, 0xaaa5aaaa, 0x1555a955, 0x55555555, 0xaaaaaaaa, 0xaaa9aaaa, 0x1555aa55, 0x55555555}},
+    {{1, 3, 4, 1}, {0xaa95aa95, 0xaa95aa95, 0xa800aa05, 0x8000a000, 0xaa95aa95, 0xaa55aa55, 0xa805aa15, 0x8000, 0xaa55aa55, 0xa955aa55, 0xa015a955, 0x8001, 0xa955a955, 0xa955a955, 0xa055a955, 0x18005, 0xa555a955, 0xa555a555, 0x8555a555, 0x50055, 0xa555a555, 0x95559555, 0x95559555, 0x150155, 0x95559555, 0x95559555, 0x55555555, 0x1550555, 0x55555555, 0x55555555, 0x55555555, 0x5555555}},
+    {{1, 3, 4, 1}, {0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa8aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa0aaa8, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa9aaaa, 0xaaa0aaa8}},
+    {{1, 2, 3, 1}, {0xaaaaaaaa, 0xaa0aaa, 0x2000a, 0x10000, 0xaaaaaaaa, 0xaaaaaaa, 0xa00aa, 0x10000, 0xaaaaaaaa, 0x2aaaaaaa, 0x2a02aa, 0x1000a, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aa2aaa, 0x1002a, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaa, 0x2a00aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaa0aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaaaaaa}},
+    {{1, 2, 3, 1}, {0x50001, 0x150015, 0x1550055, 0x5550155, 0x50005, 0x550015, 0x1550055, 0x5550555, 0x50005, 0x550015, 0x1550055, 0x15550555, 0x150005, 0x550015, 0x1550155, 0x15550555, 0x150005, 0x550015, 0x5550155, 0x15550555, 0x150005, 0x550055, 0x5550155, 0x15550555, 0x1500a5, 0x1550055, 0x5550155, 0x15551555, 0x1502a9, 0x1550055, 0x5550155, 0x15551555}},
+    {{1, 3, 4, 1}, {0xaaa9aaaa, 0xaaa9aaa9, 0xaaa9aaa9, 0xaa80aaa1, 0xaaa9aaa9, 0xaaa5aaa5, 0xaaa5aaa5, 0xaa81aaa5, 0xaaa5aaa5, 0xaaa5aaa5, 0xaa95aa95, 0xaa05aa95, 0xaa95aa95, 0xaa95aa95, 0xaa55aa95, 0xaa15aa55, 0xaa55aa95, 0xaa55aa55, 0xaa55aa55, 0xa955aa55, 0xaa55aa55, 0xa955a955, 0xa955a955, 0xa955a955, 0xa955a955, 0xa955a955, 0xa555a555, 0xa555a555, 0xa555a555, 0xa555a555, 0x9555a555, 0x95559555}},
+    {{1, 3, 4, 1}, {0xa800aa00, 0xa000, 0x0, 0x0, 0xa000aa00, 0x8000, 0x0, 0x0, 0xa000a800, 0x8000, 0x0, 0x0, 0xa000a805, 0x0, 0x0, 0x0, 0x8001a015, 0x0, 0x0, 0x0, 0x8015a055, 0x1, 0x0, 0x0, 0x558555, 0x5, 0x0, 0x0, 0x1559555, 0x50015, 0x0, 0x0}},
+    {{1, 2, 3, 1}, {0x2952aaa, 0x1550055, 0x5550555, 0x55551555, 0xaa5aaaa, 0x1550055, 0x5550555, 0x55551555, 0xaaa9aaaa, 0x1550a55, 0x15550555, 0x55551555, 0xaaaaaaaa, 0x5552a95, 0x15550555, 0x55555555, 0xaaaaaaaa, 0x2955aaa5, 0x15550555, 0x55555555, 0xaaaaaaaa, 0xaa55aaa9, 0x15551555, 0x55555555, 0xaaaaaaaa, 0xaa95aaaa, 0x1555a555, 0x55555555, 0xaaaaaaaa, 0xaaa5aaaa, 0x5555a955, 0x55555555}},
+    {{1, 2, 3, 1}, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x2002a, 0x0, 0x0, 0x0, 0xa00aa, 0x2, 0x0, 0x0, 0xaa0aaa, 0xa, 0x0, 0x10000, 0x2aa2aaa, 0xa002a, 0x0, 0x10000, 0x2aaaaaaa, 0x2a02aa, 0x2, 0x10000}},
+    {{1, 3, 4, 1}, {0xaaa8aaaa, 0xaa80aaa0, 0xa800aa00, 0xa000, 0xaaa8aaa9, 0xaa80aaa0, 0xa000a800, 0x8000, 0xaaa1aaa9, 0xaa00aa80, 0xa000a800, 0x8000, 0xaaa5aaa5, 0xaa00aa81, 0x8000a800, 0x0, 0xaa95aa95, 0xa800aa05, 0x8000a000, 0x0, 0xaa55aa55, 0xa805aa15, 0xa000, 0x0, 0xaa55aa55, 0xa015a955, 0x8001, 0x0, 0xa955a955, 0xa055a955, 0x18015, 0x0}},
+    {{1, 2, 3, 1}, {0xaaaaaaaa, 0xaa0aaa, 0x2002a, 0x10001, 0xaaaaaaaa, 0xaaaaaaa, 0xa00aa, 0x10001, 0xaaaaaaaa, 0x2aaaaaaa, 0xaa02aa, 0x5000a, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aa2aaa, 0x5002a, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaa, 0x2902aa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xa90aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaa2aaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0x2aaaaaaa}},
+    {{1, 2, 3, 1}, {0x150005, 0x550015, 0x1550155, 0x15550555, 0x150005, 0x550015, 0x5550155, 0x15550555, 0x150005, 0x550055, 0x5550155, 0x15550555, 0x150005, 0x1550055, 0x5550155, 0x15551555, 0x150015, 0x1550055, 0x5550155, 0x15551555, 0x550015, 0x1550055, 0x5550555, 0x55551555, 0x550095, 0x1550055, 0x5550555, 0x55551555, 0x5502a5, 0x1550155, 0x15550555, 0x55551555}},
+};
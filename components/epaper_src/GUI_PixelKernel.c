@@ -0,0 +1,416 @@
+/*****************************************************************************
+* | File      	:   GUI_PixelKernel.c
+* | Function    :   Per-row pixel kernels shared by the decoders and Paint
+* | Info        :
+*                Words are loaded and stored with memcpy, which the compiler
+*                turns into plain 32-bit accesses where the target allows
+*                them. Byte lanes assume a little-endian CPU (Xtensa, RISC-V
+*                and the host all are).
+*                The PIE kernels keep their data in the vector registers
+*                q0-q7 between statements; the compiler never allocates
+*                those, and FreeRTOS saves them per task like the FPU.
+******************************************************************************/
+#include "GUI_PixelKernel.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+static inline UDOUBLE GUI_Kernel_Load32(const UBYTE *p)
+{
+    UDOUBLE w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+static inline void GUI_Kernel_Store32(UBYTE *p, UDOUBLE w)
+{
+    memcpy(p, &w, sizeof(w));
+}
+
+static void GUI_Kernel_SwapRBPortable(UBYTE *dst, const UBYTE *src, UWORD count)
+{
+    // Four pixels are three words: [b0 g0 r0 b1] [g1 r1 b2 g2] [r2 b3 g3 r3] (lowest byte first).
+    for (; count >= 4; count -= 4, src += 12, dst += 12)
+    {
+        const UDOUBLE w0 = GUI_Kernel_Load32(src);
+        const UDOUBLE w1 = GUI_Kernel_Load32(src + 4);
+        const UDOUBLE w2 = GUI_Kernel_Load32(src + 8);
+        GUI_Kernel_Store32(dst, ((w0 >> 16) & 0xFF) | (w0 & 0xFF00) | ((w0 & 0xFF) << 16) | ((w1 & 0xFF00) << 16));
+        GUI_Kernel_Store32(dst + 4, (w1 & 0xFF) | ((w0 >> 16) & 0xFF00) | ((w2 & 0xFF) << 16) | (w1 & 0xFF000000));
+        GUI_Kernel_Store32(dst + 8,
+                           ((w1 >> 16) & 0xFF) | ((w2 >> 16) & 0xFF00) | (w2 & 0xFF0000) | ((w2 & 0xFF00) << 16));
+    }
+    for (; count > 0; count--, src += 3, dst += 3)
+    {
+        dst[0] = src[2];
+        dst[1] = src[1];
+        dst[2] = src[0];
+    }
+}
+
+static inline UBYTE GUI_Kernel_ExactColor6(UDOUBLE bgr)
+{
+    switch (bgr)
+    {
+    case 0x000000:
+        return 0; // Black
+    case 0xFFFFFF:
+        return 1; // White
+    case 0xFFFF00:
+        return 2; // Yellow (r, g)
+    case 0xFF0000:
+        return 3; // Red
+    case 0x0000FF:
+        return 5; // Blue
+    case 0x00FF00:
+        return 6; // Green
+    default:
+        return 1; // Default white
+    }
+}
+
+void GUI_Kernel_ExactRow6(const UBYTE *bgr, UBYTE *out, UWORD count)
+{
+    // Same three-word grouping as GUI_Kernel_SwapRB; each pixel becomes b | g << 8 | r << 16.
+    for (; count >= 4; count -= 4, bgr += 12, out += 4)
+    {
+        const UDOUBLE w0 = GUI_Kernel_Load32(bgr);
+        const UDOUBLE w1 = GUI_Kernel_Load32(bgr + 4);
+        const UDOUBLE w2 = GUI_Kernel_Load32(bgr + 8);
+        out[0] = GUI_Kernel_ExactColor6(w0 & 0xFFFFFF);
+        out[1] = GUI_Kernel_ExactColor6((w0 >> 24) | ((w1 & 0xFFFF) << 8));
+        out[2] = GUI_Kernel_ExactColor6((w1 >> 16) | ((w2 & 0xFF) << 16));
+        out[3] = GUI_Kernel_ExactColor6(w2 >> 8);
+    }
+    for (; count > 0; count--, bgr += 3)
+    {
+        *out++ = GUI_Kernel_ExactColor6(bgr[0] | ((UDOUBLE)bgr[1] << 8) | ((UDOUBLE)bgr[2] << 16));
+    }
+}
+
+// Four colors [c0 c1 c2 c3] -> two bytes (c0 << 4 | c1), (c2 << 4 | c3) in the low half.
+static inline UDOUBLE GUI_Kernel_Pack4Word(UDOUBLE c)
+{
+    c &= 0x0F0F0F0F;
+    c = ((c << 4) | (c >> 8)) & 0x00FF00FF;
+    return (c & 0xFF) | ((c >> 8) & 0xFF00);
+}
+
+static void GUI_Kernel_Pack4Portable(UBYTE *dst, const UBYTE *colors, int step, UWORD pairs)
+{
+    if (step > 0)
+    {
+        for (; pairs >= 4; pairs -= 4, colors += 8, dst += 4)
+        {
+            const UDOUBLE lo = GUI_Kernel_Pack4Word(GUI_Kernel_Load32(colors));
+            const UDOUBLE hi = GUI_Kernel_Pack4Word(GUI_Kernel_Load32(colors + 4));
+            GUI_Kernel_Store32(dst, lo | (hi << 16));
+        }
+    }
+    else
+    {
+        // Byte-reverse each word so it reads like a forward run.
+        for (; pairs >= 4; pairs -= 4, colors -= 8, dst += 4)
+        {
+            const UDOUBLE lo = GUI_Kernel_Pack4Word(__builtin_bswap32(GUI_Kernel_Load32(colors - 3)));
+            const UDOUBLE hi = GUI_Kernel_Pack4Word(__builtin_bswap32(GUI_Kernel_Load32(colors - 7)));
+            GUI_Kernel_Store32(dst, lo | (hi << 16));
+        }
+    }
+
+    for (; pairs > 0; pairs--, colors += 2 * step)
+    {
+        *dst++ = (UBYTE)((colors[0] << 4) | (colors[step] & 0x0F));
+    }
+}
+
+#if GUI_KERNEL_PIE
+
+#define GUI_PIE_ALIGN 16
+
+#if CONFIG_IDF_TARGET_ESP32S3
+// Unaligned-load pair: q<q> = the aligned 16 bytes holding p, SAR_BYTE = p & 15, p += 16.
+#define GUI_PIE_LDU(q, p) __asm__ volatile("ee.ld.128.usar.ip q" #q ", %0, 16" : "+r"(p) : : "memory")
+// q<a> = ({q<s1>, q<s0>} >> 8 * SAR_BYTE), low 16 bytes; then q<s0> = q<s1>.
+#define GUI_PIE_SRC_QUP(a, s0, s1) __asm__ volatile("ee.src.q.qup q" #a ", q" #s0 ", q" #s1)
+// Aligned load / store, p += 16.
+#define GUI_PIE_LD(q, p) __asm__ volatile("ee.vld.128.ip q" #q ", %0, 16" : "+r"(p) : : "memory")
+#define GUI_PIE_ST(q, p) __asm__ volatile("ee.vst.128.ip q" #q ", %0, 16" : "+r"(p) : : "memory")
+// q<q> = the byte at p in all 16 lanes.
+#define GUI_PIE_LDBC8(q, p) __asm__ volatile("ee.vldbc.8 q" #q ", %0" : : "r"(p) : "memory")
+#define GUI_PIE_AND(a, x, y) __asm__ volatile("ee.andq q" #a ", q" #x ", q" #y)
+#define GUI_PIE_OR(a, x, y) __asm__ volatile("ee.orq q" #a ", q" #x ", q" #y)
+// q<x> = even bytes of {q<y>, q<x>}, q<y> = odd bytes.
+#define GUI_PIE_UNZIP8(x, y) __asm__ volatile("ee.vunzip.8 q" #x ", q" #y)
+// Each 32-bit lane of q<q> shifted left by four bits.
+#define GUI_PIE_SHL4(q) __asm__ volatile("ssai 4\n\tee.vsl.32 q" #q ", q" #q)
+#else
+// Host model of the instructions above, so the kernels can be checked without a board.
+static UBYTE s_pie_q[8][GUI_PIE_ALIGN];
+static unsigned s_pie_sar_byte;
+
+static void GUI_PieEmu_Load(UBYTE *q, const UBYTE **p, bool usar)
+{
+    const UBYTE *block = (const UBYTE *)((uintptr_t)*p & ~(uintptr_t)(GUI_PIE_ALIGN - 1));
+    if (usar)
+        s_pie_sar_byte = (unsigned)((uintptr_t)*p & (GUI_PIE_ALIGN - 1));
+    memcpy(q, block, GUI_PIE_ALIGN);
+    *p += GUI_PIE_ALIGN;
+}
+
+static void GUI_PieEmu_Store(const UBYTE *q, UBYTE **p)
+{
+    memcpy((UBYTE *)((uintptr_t)*p & ~(uintptr_t)(GUI_PIE_ALIGN - 1)), q, GUI_PIE_ALIGN);
+    *p += GUI_PIE_ALIGN;
+}
+
+static void GUI_PieEmu_SrcQup(UBYTE *a, UBYTE *s0, const UBYTE *s1)
+{
+    UBYTE cat[2 * GUI_PIE_ALIGN];
+    memcpy(cat, s0, GUI_PIE_ALIGN);
+    memcpy(cat + GUI_PIE_ALIGN, s1, GUI_PIE_ALIGN);
+    memcpy(a, cat + s_pie_sar_byte, GUI_PIE_ALIGN);
+    memcpy(s0, s1, GUI_PIE_ALIGN);
+}
+
+static void GUI_PieEmu_Unzip8(UBYTE *x, UBYTE *y)
+{
+    UBYTE cat[2 * GUI_PIE_ALIGN];
+    memcpy(cat, x, GUI_PIE_ALIGN);
+    memcpy(cat + GUI_PIE_ALIGN, y, GUI_PIE_ALIGN);
+    for (int i = 0; i < GUI_PIE_ALIGN; i++)
+    {
+        x[i] = cat[2 * i];
+        y[i] = cat[2 * i + 1];
+    }
+}
+
+static void GUI_PieEmu_Shl4(UBYTE *q)
+{
+    for (int i = 0; i < GUI_PIE_ALIGN; i += 4)
+        GUI_Kernel_Store32(q + i, GUI_Kernel_Load32(q + i) << 4);
+}
+
+#define GUI_PIE_LDU(q, p) GUI_PieEmu_Load(s_pie_q[q], (const UBYTE **)&(p), true)
+#define GUI_PIE_SRC_QUP(a, s0, s1) GUI_PieEmu_SrcQup(s_pie_q[a], s_pie_q[s0], s_pie_q[s1])
+#define GUI_PIE_LD(q, p) GUI_PieEmu_Load(s_pie_q[q], (const UBYTE **)&(p), false)
+#define GUI_PIE_ST(q, p) GUI_PieEmu_Store(s_pie_q[q], &(p))
+#define GUI_PIE_LDBC8(q, p) memset(s_pie_q[q], *(const UBYTE *)(p), GUI_PIE_ALIGN)
+#define GUI_PIE_AND(a, x, y)                      \
+    for (int i_ = 0; i_ < GUI_PIE_ALIGN; i_++)    \
+    s_pie_q[a][i_] = s_pie_q[x][i_] & s_pie_q[y][i_]
+#define GUI_PIE_OR(a, x, y)                       \
+    for (int i_ = 0; i_ < GUI_PIE_ALIGN; i_++)    \
+    s_pie_q[a][i_] = s_pie_q[x][i_] | s_pie_q[y][i_]
+#define GUI_PIE_UNZIP8(x, y) GUI_PieEmu_Unzip8(s_pie_q[x], s_pie_q[y])
+#define GUI_PIE_SHL4(q) GUI_PieEmu_Shl4(s_pie_q[q])
+#endif
+
+// q<q> = the 16 bytes at p, any alignment (uses q0 and q1).
+#define GUI_PIE_LOADU(q, p)          \
+    do                               \
+    {                                \
+        const UBYTE *t_ = (p);       \
+        GUI_PIE_LDU(0, t_);          \
+        GUI_PIE_LDU(1, t_);          \
+        GUI_PIE_SRC_QUP(q, 0, 1);    \
+    } while (0)
+
+// Byte masks over 16 pixels (48 bytes, three registers), picking which source byte lands
+// in each destination byte: the one two ahead (blue into red's place), the same one
+// (green), or the one two behind (red into blue's place).
+static const UBYTE GUI_PIE_SWAP_MASKS[3][3][GUI_PIE_ALIGN] __attribute__((aligned(GUI_PIE_ALIGN))) = {
+#define GUI_PIE_M(c, k) \
+    {GUI_PIE_M1(c, k, 0), GUI_PIE_M1(c, k, 1), GUI_PIE_M1(c, k, 2), GUI_PIE_M1(c, k, 3), \
+     GUI_PIE_M1(c, k, 4), GUI_PIE_M1(c, k, 5), GUI_PIE_M1(c, k, 6), GUI_PIE_M1(c, k, 7), \
+     GUI_PIE_M1(c, k, 8), GUI_PIE_M1(c, k, 9), GUI_PIE_M1(c, k, 10), GUI_PIE_M1(c, k, 11), \
+     GUI_PIE_M1(c, k, 12), GUI_PIE_M1(c, k, 13), GUI_PIE_M1(c, k, 14), GUI_PIE_M1(c, k, 15)}
+#define GUI_PIE_M1(c, k, j) ((((c) * GUI_PIE_ALIGN + (j)) % 3 == (k)) ? 0xFF : 0x00)
+    {GUI_PIE_M(0, 0), GUI_PIE_M(0, 1), GUI_PIE_M(0, 2)},
+    {GUI_PIE_M(1, 0), GUI_PIE_M(1, 1), GUI_PIE_M(1, 2)},
+    {GUI_PIE_M(2, 0), GUI_PIE_M(2, 1), GUI_PIE_M(2, 2)},
+#undef GUI_PIE_M1
+#undef GUI_PIE_M
+};
+
+static const UBYTE GUI_PIE_LOW_NIBBLE = 0x0F;
+
+// Pixels before the first one whose destination is 16-byte aligned (at least one, so the
+// loads two bytes behind stay inside the row).
+static UWORD GUI_Pie_SwapHead(const UBYTE *dst)
+{
+    UWORD head = 0;
+    while (((uintptr_t)(dst + 3 * head) & (GUI_PIE_ALIGN - 1)) != 0)
+        head++;
+    return head ? head : GUI_PIE_ALIGN;
+}
+
+void GUI_KernelPie_SwapRB(UBYTE *dst, const UBYTE *src, UWORD count)
+{
+    // The unaligned loads read up to 18 bytes past the 48 a step writes; leave those
+    // pixels to the portable tail.
+    const UWORD head = GUI_Pie_SwapHead(dst);
+    if (count < head + 2 * GUI_PIE_ALIGN)
+    {
+        GUI_Kernel_SwapRBPortable(dst, src, count);
+        return;
+    }
+    GUI_Kernel_SwapRBPortable(dst, src, head);
+    dst += 3 * head;
+    src += 3 * head;
+    count -= head;
+
+    for (; count >= 2 * GUI_PIE_ALIGN; count -= GUI_PIE_ALIGN, src += 3 * GUI_PIE_ALIGN)
+    {
+        const UBYTE *mask = &GUI_PIE_SWAP_MASKS[0][0][0];
+        for (int c = 0; c < 3; c++)
+        {
+            const UBYTE *s = src + c * GUI_PIE_ALIGN;
+            GUI_PIE_LOADU(2, s + 2);
+            GUI_PIE_LOADU(3, s);
+            GUI_PIE_LOADU(4, s - 2);
+            GUI_PIE_LD(5, mask);
+            GUI_PIE_AND(2, 2, 5);
+            GUI_PIE_LD(5, mask);
+            GUI_PIE_AND(3, 3, 5);
+            GUI_PIE_OR(2, 2, 3);
+            GUI_PIE_LD(5, mask);
+            GUI_PIE_AND(4, 4, 5);
+            GUI_PIE_OR(2, 2, 4);
+            GUI_PIE_ST(2, dst);
+        }
+    }
+    GUI_Kernel_SwapRBPortable(dst, src, count);
+}
+
+void GUI_KernelPie_Pack4(UBYTE *dst, const UBYTE *colors, UWORD pairs)
+{
+    // Pairs up to the first aligned destination byte, then 16 per step; the loads reach
+    // into the pair after the step.
+    const UWORD head = (UWORD)((GUI_PIE_ALIGN - ((uintptr_t)dst & (GUI_PIE_ALIGN - 1))) & (GUI_PIE_ALIGN - 1));
+    if (pairs <= head + GUI_PIE_ALIGN)
+    {
+        GUI_Kernel_Pack4Portable(dst, colors, 1, pairs);
+        return;
+    }
+    GUI_Kernel_Pack4Portable(dst, colors, 1, head);
+    dst += head;
+    colors += 2 * head;
+    pairs -= head;
+
+    GUI_PIE_LDBC8(4, &GUI_PIE_LOW_NIBBLE);
+    for (; pairs > GUI_PIE_ALIGN; pairs -= GUI_PIE_ALIGN, colors += 2 * GUI_PIE_ALIGN)
+    {
+        const UBYTE *t = colors;
+        GUI_PIE_LDU(0, t);
+        GUI_PIE_LDU(1, t);
+        GUI_PIE_SRC_QUP(2, 0, 1);
+        GUI_PIE_LDU(1, t);
+        GUI_PIE_SRC_QUP(3, 0, 1);
+        GUI_PIE_UNZIP8(2, 3);
+        GUI_PIE_AND(2, 2, 4);
+        GUI_PIE_AND(3, 3, 4);
+        GUI_PIE_SHL4(2);
+        GUI_PIE_OR(2, 2, 3);
+        GUI_PIE_ST(2, dst);
+    }
+    GUI_Kernel_Pack4Portable(dst, colors, 1, pairs);
+}
+
+#endif
+
+#if CONFIG_IDF_TARGET_ESP32S3
+#define GUI_PIE_CHECK_MAX 48
+#define GUI_PIE_CHECK_ROW 800
+#define GUI_PIE_CHECK_GUARD 32
+
+// 0 not checked yet, 1 PIE kernels match the portable ones, -1 they don't.
+static volatile int s_pie_state;
+
+// Both PIE kernels against the portable ones, `count` pixels (SwapRB) or pairs (Pack4) at
+// the given offsets, including the bytes around the output.
+static bool GUI_Kernel_PieCase(const UBYTE *src, UBYTE *got, UBYTE *want, size_t size, int count, int so,
+                               int dof)
+{
+    memset(got, 0x5A, size);
+    memset(want, 0x5A, size);
+    GUI_KernelPie_SwapRB(got + GUI_PIE_CHECK_GUARD + dof, src + GUI_PIE_CHECK_GUARD + so, (UWORD)count);
+    GUI_Kernel_SwapRBPortable(want + GUI_PIE_CHECK_GUARD + dof, src + GUI_PIE_CHECK_GUARD + so, (UWORD)count);
+    if (memcmp(got, want, size) != 0)
+        return false;
+    GUI_KernelPie_Pack4(got + GUI_PIE_CHECK_GUARD + dof, src + GUI_PIE_CHECK_GUARD + so, (UWORD)count);
+    GUI_Kernel_Pack4Portable(want + GUI_PIE_CHECK_GUARD + dof, src + GUI_PIE_CHECK_GUARD + so, 1, (UWORD)count);
+    return memcmp(got, want, size) == 0;
+}
+
+// Every source and destination alignment for short counts, then full rows. Racing callers
+// just repeat the same check.
+static bool GUI_Kernel_PieReady(void)
+{
+    if (s_pie_state != 0)
+        return s_pie_state > 0;
+
+    const size_t size = 3 * GUI_PIE_CHECK_ROW + 2 * GUI_PIE_CHECK_GUARD;
+    UBYTE *buf = (UBYTE *)malloc(3 * size);
+    if (!buf)
+        return false; // try again next time
+    UBYTE *src = buf, *got = buf + size, *want = buf + 2 * size;
+    UDOUBLE seed = 1;
+    for (size_t i = 0; i < size; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        src[i] = (UBYTE)(seed >> 24);
+    }
+
+    const size_t shortSize = 3 * GUI_PIE_CHECK_MAX + 2 * GUI_PIE_CHECK_GUARD;
+    bool ok = true;
+    for (int count = 0; ok && count <= GUI_PIE_CHECK_MAX; count++)
+    {
+        for (int so = 0; ok && so < GUI_PIE_ALIGN; so++)
+        {
+            for (int dof = 0; ok && dof < GUI_PIE_ALIGN; dof++)
+                ok = GUI_Kernel_PieCase(src, got, want, shortSize, count, so, dof);
+        }
+    }
+    for (int dof = 0; ok && dof < GUI_PIE_ALIGN; dof++)
+        ok = GUI_Kernel_PieCase(src, got, want, size, GUI_PIE_CHECK_ROW, (dof * 7) % GUI_PIE_ALIGN, dof);
+    free(buf);
+
+    s_pie_state = ok ? 1 : -1;
+    return ok;
+}
+#endif
+
+void GUI_Kernel_SwapRB(UBYTE *dst, const UBYTE *src, UWORD count)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    if (GUI_Kernel_PieReady())
+    {
+        GUI_KernelPie_SwapRB(dst, src, count);
+        return;
+    }
+#endif
+    GUI_Kernel_SwapRBPortable(dst, src, count);
+}
+
+void GUI_Kernel_Pack4(UBYTE *dst, const UBYTE *colors, int step, UWORD pairs)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    if (step > 0 && GUI_Kernel_PieReady())
+    {
+        GUI_KernelPie_Pack4(dst, colors, pairs);
+        return;
+    }
+#endif
+    GUI_Kernel_Pack4Portable(dst, colors, step, pairs);
+}
+
+const char *GUI_Kernel_Impl(void)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    return GUI_Kernel_PieReady() ? "esp32s3 pie" : "esp32s3 portable (pie check failed)";
+#else
+    return "portable";
+#endif
+}
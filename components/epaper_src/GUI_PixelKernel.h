@@ -0,0 +1,64 @@
+/*****************************************************************************
+* | File      	:   GUI_PixelKernel.h
+* | Function    :   Per-row pixel kernels shared by the decoders and Paint
+* | Info        :
+*                Channel swap, exact 6-color matching and 4bpp nibble
+*                packing over whole rows. They work a 32-bit word at a time
+*                (four pixels or eight colors per step) instead of byte by
+*                byte; unaligned pointers and any count are fine. On the
+*                ESP32-S3, channel swap and forward packing run 16 bytes per
+*                step on the PIE vector unit instead.
+*                test_host/test_pixel_kernel.c checks them against byte-wise
+*                versions and times both.
+******************************************************************************/
+#ifndef __GUI_PIXELKERNEL_H
+#define __GUI_PIXELKERNEL_H
+
+#include <stdint.h>
+
+#include "sdkconfig.h"
+
+#include "DEV_Config.h"
+
+// PIE (ESP32-S3 SIMD) versions of GUI_Kernel_SwapRB and of GUI_Kernel_Pack4 with step 1.
+// The other cases have no PIE version: three-byte pixels and reversed runs need byte
+// shuffles the S3 vector unit doesn't have. The PIE code is written against one macro per
+// instruction, which the host build (GUI_KERNEL_PIE_EMULATE) expands to C so
+// test_host/test_pixel_kernel can check it against the portable kernels.
+#if CONFIG_IDF_TARGET_ESP32S3 || GUI_KERNEL_PIE_EMULATE
+#define GUI_KERNEL_PIE 1
+#else
+#define GUI_KERNEL_PIE 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// RGB888 from BGR888 (or the reverse), `count` pixels. dst and src must not overlap.
+void GUI_Kernel_SwapRB(UBYTE *dst, const UBYTE *src, UWORD count);
+
+// Paint color index of each BGR888 pixel that is exactly one of the six panel colors;
+// anything else becomes white.
+void GUI_Kernel_ExactRow6(const UBYTE *bgr, UBYTE *out, UWORD count);
+
+// Packs `pairs` pairs of 4bpp colors, high nibble first: dst[i] = colors[2i] << 4 | colors[2i+1].
+// With step -1 the colors are read backwards from `colors`: dst[i] = colors[-2i] << 4 | colors[-2i-1].
+void GUI_Kernel_Pack4(UBYTE *dst, const UBYTE *colors, int step, UWORD pairs);
+
+// Kernels this build runs, reported by /api/bench/dither: "portable", "esp32s3 pie", or
+// "esp32s3 portable (pie check failed)" if the PIE kernels ever disagree with the
+// portable ones on the device (checked once, on first use).
+const char *GUI_Kernel_Impl(void);
+
+#if GUI_KERNEL_PIE
+// The PIE kernels, whatever the build selects. Same contracts as above; Pack4 forward only.
+void GUI_KernelPie_SwapRB(UBYTE *dst, const UBYTE *src, UWORD count);
+void GUI_KernelPie_Pack4(UBYTE *dst, const UBYTE *colors, UWORD pairs);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,314 @@
+/*****************************************************************************
+* | File      	:   GUI_QOIfile.c
+* | Function    :   QOI ("Quite OK Image") photo decoding
+* | Info        :
+*                QOI can only be decoded front to back. A top-down render
+*                decodes one row per request into a ring of the last few rows
+*                (the resampler never reaches further back); a bottom-up one
+*                (180 degrees) needs the last row first, so it gets a full
+*                RGB888 image in PSRAM, decoded on its first row request.
+*                Input is read in blocks into DMA-capable RAM, as for BMPs.
+******************************************************************************/
+#include "GUI_QOIfile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "GUI_QOIfile";
+
+#define GUI_QOI_STREAM_BYTES (8 * 1024)
+// Decoded rows kept for top-down renders: scaled output rows share their edge source rows
+// with the next one, bilinear upscaling reads two.
+#define GUI_QOI_RING_ROWS 4
+
+#define GUI_QOI_OP_INDEX 0x00 // 00xxxxxx
+#define GUI_QOI_OP_DIFF 0x40  // 01xxxxxx
+#define GUI_QOI_OP_LUMA 0x80  // 10xxxxxx
+#define GUI_QOI_OP_RUN 0xC0   // 11xxxxxx
+#define GUI_QOI_OP_RGB 0xFE
+#define GUI_QOI_OP_RGBA 0xFF
+#define GUI_QOI_MASK_2 0xC0
+
+typedef struct {
+    FILE *fp;
+    UWORD width;
+    UWORD height;
+    UBYTE *pixels;     // RGB888, keptRows rows; row y is at y % keptRows
+    UWORD keptRows;    // GUI_QOI_RING_ROWS, or height for bottom-up renders
+    UWORD decodedRows;
+    bool failed;
+
+    UBYTE *in;
+    size_t inLen;
+    size_t inPos;
+
+    UBYTE px[4];       // r, g, b, a
+    UBYTE index[64][4];
+    UBYTE run;
+} GUI_QoiStream;
+
+bool GUI_Qoi_IsQoiPath(const char *path)
+{
+    if (!path)
+    {
+        return false;
+    }
+    const size_t n = strlen(path);
+    return n >= 4 && strcasecmp(path + n - 4, ".qoi") == 0;
+}
+
+static inline UDOUBLE GUI_Qoi_ReadBe32(const UBYTE *p)
+{
+    return ((UDOUBLE)p[0] << 24) | ((UDOUBLE)p[1] << 16) | ((UDOUBLE)p[2] << 8) | (UDOUBLE)p[3];
+}
+
+// Validates a header and returns its size; QOI allows up to 2^32 per side, the panel code only UWORD
+// and the decoder only as much as fits GUI_QOI_MAX_DECODED_BYTES.
+static bool GUI_Qoi_ParseHeader(const UBYTE *h, UWORD *out_width, UWORD *out_height)
+{
+    const UDOUBLE w = GUI_Qoi_ReadBe32(h + 4);
+    const UDOUBLE h32 = GUI_Qoi_ReadBe32(h + 8);
+    const UBYTE channels = h[12];
+
+    if (GUI_Qoi_ReadBe32(h) != GUI_QOI_MAGIC || (channels != 3 && channels != 4))
+    {
+        return false;
+    }
+    if (w == 0 || h32 == 0 || w > 0xFFFF || h32 > 0xFFFF ||
+        (uint64_t)w * h32 * 3 > GUI_QOI_MAX_DECODED_BYTES)
+    {
+        ESP_LOGE(TAG, "Unsupported QOI size %lu x %lu", (unsigned long)w, (unsigned long)h32);
+        return false;
+    }
+
+    *out_width = (UWORD)w;
+    *out_height = (UWORD)h32;
+    return true;
+}
+
+bool GUI_Qoi_GetDimensions(const char *path, int *out_width, int *out_height)
+{
+    if (out_width)
+        *out_width = 0;
+    if (out_height)
+        *out_height = 0;
+
+    if (!path || !out_width || !out_height)
+    {
+        return false;
+    }
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+    {
+        ESP_LOGE(TAG, "Can't open file: %s", path);
+        return false;
+    }
+
+    UBYTE header[GUI_QOI_HEADER_BYTES];
+    const bool read_ok = (fread(header, 1, sizeof(header), fp) == sizeof(header));
+    fclose(fp);
+
+    UWORD w = 0;
+    UWORD h = 0;
+    if (!read_ok || !GUI_Qoi_ParseHeader(header, &w, &h))
+    {
+        return false;
+    }
+
+    *out_width = w;
+    *out_height = h;
+    return true;
+}
+
+static void GUI_QoiStream_Close(GUI_QoiStream *s)
+{
+    if (s->fp)
+    {
+        fclose(s->fp);
+        s->fp = NULL;
+    }
+    if (s->in)
+    {
+        heap_caps_free(s->in);
+        s->in = NULL;
+    }
+    if (s->pixels)
+    {
+        heap_caps_free(s->pixels);
+        s->pixels = NULL;
+    }
+}
+
+static bool GUI_QoiStream_Open(GUI_QoiStream *s, const char *path, bool wholeImage)
+{
+    memset(s, 0, sizeof(*s));
+    s->px[3] = 255;
+
+    s->fp = fopen(path, "rb");
+    if (!s->fp)
+    {
+        ESP_LOGE(TAG, "Can't open file: %s", path);
+        return false;
+    }
+
+    UBYTE header[GUI_QOI_HEADER_BYTES];
+    if (fread(header, 1, sizeof(header), s->fp) != sizeof(header) ||
+        !GUI_Qoi_ParseHeader(header, &s->width, &s->height))
+    {
+        ESP_LOGE(TAG, "Invalid QOI header: %s", path);
+        GUI_QoiStream_Close(s);
+        return false;
+    }
+
+    s->keptRows = (wholeImage || s->height < GUI_QOI_RING_ROWS) ? s->height : GUI_QOI_RING_ROWS;
+    const size_t pixelBytes = (size_t)s->width * s->keptRows * 3;
+    s->pixels = wholeImage ? (UBYTE *)heap_caps_malloc(pixelBytes, MALLOC_CAP_SPIRAM) : (UBYTE *)malloc(pixelBytes);
+    s->in = (UBYTE *)heap_caps_malloc(GUI_QOI_STREAM_BYTES, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (!s->in)
+    {
+        s->in = (UBYTE *)heap_caps_malloc(GUI_QOI_STREAM_BYTES, MALLOC_CAP_8BIT);
+    }
+    if (!s->pixels || !s->in)
+    {
+        ESP_LOGE(TAG, "Memory allocation failed!");
+        GUI_QoiStream_Close(s);
+        return false;
+    }
+
+    // The header went through the stdio buffer; from here on whole blocks are read directly.
+    setvbuf(s->fp, NULL, _IONBF, 0);
+    return true;
+}
+
+static bool GUI_QoiStream_Refill(GUI_QoiStream *s)
+{
+    s->inPos = 0;
+    s->inLen = fread(s->in, 1, GUI_QOI_STREAM_BYTES, s->fp);
+    return s->inLen > 0;
+}
+
+// Next input byte; a truncated file marks the stream failed and yields zeros.
+static inline UBYTE GUI_QoiStream_Byte(GUI_QoiStream *s)
+{
+    if (s->inPos == s->inLen && !GUI_QoiStream_Refill(s))
+    {
+        s->failed = true;
+        return 0;
+    }
+    return s->in[s->inPos++];
+}
+
+static bool GUI_QoiStream_DecodeTo(GUI_QoiStream *s, UWORD rows)
+{
+    while (s->decodedRows < rows && !s->failed)
+    {
+        if ((s->decodedRows % 64) == 63 && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+        {
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
+
+        UBYTE *out = s->pixels + (size_t)(s->decodedRows % s->keptRows) * s->width * 3;
+        UBYTE *px = s->px;
+        for (UWORD x = 0; x < s->width; x++)
+        {
+            if (s->run > 0)
+            {
+                s->run--;
+            }
+            else
+            {
+                const UBYTE b1 = GUI_QoiStream_Byte(s);
+                if (b1 == GUI_QOI_OP_RGB)
+                {
+                    px[0] = GUI_QoiStream_Byte(s);
+                    px[1] = GUI_QoiStream_Byte(s);
+                    px[2] = GUI_QoiStream_Byte(s);
+                }
+                else if (b1 == GUI_QOI_OP_RGBA)
+                {
+                    px[0] = GUI_QoiStream_Byte(s);
+                    px[1] = GUI_QoiStream_Byte(s);
+                    px[2] = GUI_QoiStream_Byte(s);
+                    px[3] = GUI_QoiStream_Byte(s);
+                }
+                else if ((b1 & GUI_QOI_MASK_2) == GUI_QOI_OP_INDEX)
+                {
+                    memcpy(px, s->index[b1], 4);
+                }
+                else if ((b1 & GUI_QOI_MASK_2) == GUI_QOI_OP_DIFF)
+                {
+                    px[0] += ((b1 >> 4) & 0x03) - 2;
+                    px[1] += ((b1 >> 2) & 0x03) - 2;
+                    px[2] += (b1 & 0x03) - 2;
+                }
+                else if ((b1 & GUI_QOI_MASK_2) == GUI_QOI_OP_LUMA)
+                {
+                    const UBYTE b2 = GUI_QoiStream_Byte(s);
+                    const int vg = (b1 & 0x3F) - 32;
+                    px[0] += vg - 8 + ((b2 >> 4) & 0x0F);
+                    px[1] += vg;
+                    px[2] += vg - 8 + (b2 & 0x0F);
+                }
+                else
+                {
+                    s->run = b1 & 0x3F;
+                }
+
+                memcpy(s->index[(px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64], px, 4);
+            }
+
+            *out++ = px[0];
+            *out++ = px[1];
+            *out++ = px[2];
+        }
+
+        s->decodedRows++;
+    }
+
+    if (s->failed)
+    {
+        ESP_LOGE(TAG, "QOI data ends early at line %u", (unsigned)s->decodedRows);
+    }
+    return !s->failed;
+}
+
+// RGB pixels of image row `y` (0 = top), or NULL on a decode error or for a row the ring
+// has already dropped. Valid until the next call.
+static const UBYTE *GUI_QoiStream_SourceRow(void *self, UWORD y)
+{
+    GUI_QoiStream *s = (GUI_QoiStream *)self;
+    if (y >= s->height || !GUI_QoiStream_DecodeTo(s, (UWORD)(y + 1)))
+    {
+        return NULL;
+    }
+    if ((UDOUBLE)y + s->keptRows < s->decodedRows)
+    {
+        ESP_LOGE(TAG, "QOI row %u requested after it was dropped", (unsigned)y);
+        return NULL;
+    }
+    return s->pixels + (size_t)(y % s->keptRows) * s->width * 3;
+}
+
+UBYTE GUI_DrawQoi_RGB_6Color_FitRows(const char *path, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH,
+                                     bool allow_upscale, GUI_DitherMode dither, GUI_RowDoneCallback onRow, void *ctx)
+{
+    GUI_QoiStream s;
+    if (!GUI_QoiStream_Open(&s, path, GUI_FitRows_BottomUp()))
+    {
+        return 0;
+    }
+
+    const GUI_RowSource src = {s.width, s.height, false, GUI_QoiStream_SourceRow, &s, false};
+    const UBYTE ret = GUI_DrawRows_RGB_6Color_FitRows(&src, Xstart, Ystart, boxW, boxH, allow_upscale, dither, onRow, ctx);
+    GUI_QoiStream_Close(&s);
+    return ret;
+}
@@ -0,0 +1,45 @@
+/*****************************************************************************
+* | File      	:   GUI_QOIfile.h
+* | Function    :   QOI ("Quite OK Image") photo decoding
+* | Info        :
+*                Lossless RGB storage for uploaded photos: a 14-byte header
+*                followed by a byte-oriented stream that is typically 2-4x
+*                smaller than the equivalent 24-bit BMP, so less has to come
+*                off the SD card per wake. Rows feed the same fit/dither
+*                renderer as the BMP path.
+******************************************************************************/
+#ifndef __GUI_QOIFILE_H
+#define __GUI_QOIFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DEV_Config.h"
+#include "GUI_BMPfile.h"
+
+#define GUI_QOI_MAGIC 0x716F6966u // "qoif", big-endian
+#define GUI_QOI_HEADER_BYTES 14
+// Bottom-up renders (180 degrees) decode the whole image into PSRAM as RGB888, so images
+// larger than this are rejected; top-down renders only keep a few rows.
+#define GUI_QOI_MAX_DECODED_BYTES (6 * 1024 * 1024)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// True when the path ends in ".qoi" (case-insensitive).
+bool GUI_Qoi_IsQoiPath(const char *path);
+
+// Read QOI dimensions from the header. Returns false for anything the renderer can't decode
+// (not a QOI file, or larger than GUI_QOI_MAX_DECODED_BYTES once decoded).
+bool GUI_Qoi_GetDimensions(const char *path, int *out_width, int *out_height);
+
+// Same contract as GUI_DrawBmp_RGB_6Color_FitRows, for a 3- or 4-channel QOI file (alpha is ignored).
+UBYTE GUI_DrawQoi_RGB_6Color_FitRows(const char *path, UWORD Xstart, UWORD Ystart, UWORD boxW, UWORD boxH,
+                                     bool allow_upscale, GUI_DitherMode dither, GUI_RowDoneCallback onRow, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,219 @@
+/*****************************************************************************
+* | File      	:   GUI_Resample.c
+* | Function    :   Separable fixed-point image resampling
+* | Info        :
+*                Each output row is accumulated from the source rows it
+*                covers: a source row is filtered horizontally (Q14 weights,
+*                kept to Q8) and added to 32-bit per-channel accumulators
+*                with its vertical weight. 255 * 2^8 * 2^14 stays below 2^32,
+*                so no 64-bit math is needed per pixel.
+******************************************************************************/
+#include "GUI_Resample.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "GUI_PixelKernel.h"
+
+static const char *TAG = "GUI_Resample";
+
+static void GUI_ResampleAxis_Free(GUI_ResampleAxis *a)
+{
+    free(a->first);
+    free(a->taps);
+    free(a->offset);
+    free(a->weight);
+    memset(a, 0, sizeof(*a));
+}
+
+static void GUI_ResampleAxis_Put(GUI_ResampleAxis *a, UWORD i, UWORD first, UWORD taps, UDOUBLE *next)
+{
+    a->first[i] = first;
+    a->taps[i] = taps;
+    a->offset[i] = *next;
+    *next += taps;
+}
+
+static bool GUI_ResampleAxis_Init(GUI_ResampleAxis *a, UWORD n, UWORD m)
+{
+    memset(a, 0, sizeof(*a));
+    a->identity = (n == m);
+
+    // Shrinking touches at most ceil(n / m) + 1 source pixels per output pixel, bilinear 2.
+    const UDOUBLE maxTaps = (m < n) ? (UDOUBLE)((n + m - 1) / m + 1) : 2;
+    a->first = (UWORD *)malloc(sizeof(UWORD) * m);
+    a->taps = (UWORD *)malloc(sizeof(UWORD) * m);
+    a->offset = (UDOUBLE *)malloc(sizeof(UDOUBLE) * m);
+    a->weight = (UWORD *)malloc(sizeof(UWORD) * (size_t)maxTaps * m);
+    if (!a->first || !a->taps || !a->offset || !a->weight)
+    {
+        GUI_ResampleAxis_Free(a);
+        return false;
+    }
+
+    UDOUBLE next = 0;
+    for (UWORD i = 0; i < m; i++)
+    {
+        UWORD *w = a->weight + next;
+        if (m < n)
+        {
+            // Area average: output i spans [i*n, (i+1)*n) and source j spans [j*m, (j+1)*m),
+            // both in units of 1/m source pixel.
+            const uint64_t lo = (uint64_t)i * n;
+            const uint64_t hi = lo + n;
+            const UWORD j0 = (UWORD)(lo / m);
+            const UWORD j1 = (UWORD)((hi - 1) / m);
+            UDOUBLE sum = 0;
+            UWORD big = 0;
+            for (UWORD j = j0; j <= j1; j++)
+            {
+                const uint64_t a0 = ((uint64_t)j * m > lo) ? (uint64_t)j * m : lo;
+                const uint64_t a1 = ((uint64_t)(j + 1) * m < hi) ? (uint64_t)(j + 1) * m : hi;
+                const UWORD k = (UWORD)(j - j0);
+                w[k] = (UWORD)(((a1 - a0) * GUI_RESAMPLE_ONE + n / 2) / n);
+                sum += w[k];
+                if (w[k] > w[big])
+                {
+                    big = k;
+                }
+            }
+            // Fold the rounding error into the largest weight so they sum to exactly one.
+            w[big] = (UWORD)(w[big] + GUI_RESAMPLE_ONE - sum);
+            GUI_ResampleAxis_Put(a, i, j0, (UWORD)(j1 - j0 + 1), &next);
+        }
+        else
+        {
+            // Bilinear between the two source pixels around the output pixel's center,
+            // (i + 0.5) * n / m - 0.5, in Q16.
+            const int64_t pos = ((int64_t)(2 * i + 1) * n - m) * 65536 / (2 * (int64_t)m);
+            const UDOUBLE p = (pos > 0) ? (UDOUBLE)pos : 0;
+            const UWORD j0 = (UWORD)(p >> 16);
+            const UWORD w1 = (UWORD)(((p & 0xFFFF) * GUI_RESAMPLE_ONE + 0x8000) >> 16);
+            if (j0 + 1 >= n || w1 == 0)
+            {
+                w[0] = GUI_RESAMPLE_ONE;
+                GUI_ResampleAxis_Put(a, i, (UWORD)((j0 < n) ? j0 : n - 1), 1, &next);
+            }
+            else
+            {
+                w[0] = (UWORD)(GUI_RESAMPLE_ONE - w1);
+                w[1] = w1;
+                GUI_ResampleAxis_Put(a, i, j0, 2, &next);
+            }
+        }
+    }
+    return true;
+}
+
+bool GUI_Resampler_Init(GUI_Resampler *rs, UWORD srcW, UWORD srcH, UWORD dstW, UWORD dstH)
+{
+    memset(rs, 0, sizeof(*rs));
+    if (srcW == 0 || srcH == 0 || dstW == 0 || dstH == 0)
+    {
+        return false;
+    }
+
+    rs->srcW = srcW;
+    rs->srcH = srcH;
+    rs->dstW = dstW;
+    rs->dstH = dstH;
+
+    const bool ok = GUI_ResampleAxis_Init(&rs->x, srcW, dstW) && GUI_ResampleAxis_Init(&rs->y, srcH, dstH);
+    rs->acc = (UDOUBLE *)malloc(sizeof(UDOUBLE) * 3 * dstW);
+    if (!ok || !rs->acc)
+    {
+        ESP_LOGE(TAG, "Memory allocation failed!");
+        GUI_Resampler_Deinit(rs);
+        return false;
+    }
+    return true;
+}
+
+void GUI_Resampler_Deinit(GUI_Resampler *rs)
+{
+    GUI_ResampleAxis_Free(&rs->x);
+    GUI_ResampleAxis_Free(&rs->y);
+    free(rs->acc);
+    rs->acc = NULL;
+}
+
+// acc += horizontally filtered `row` * wy (both Q14; the filtered value is kept to Q8).
+static void GUI_Resampler_AddRow(GUI_Resampler *rs, const UBYTE *row, int r, UDOUBLE wy)
+{
+    const int b = 2 - r;
+    UDOUBLE *acc = rs->acc;
+
+    if (rs->x.identity)
+    {
+        for (UWORD x = 0; x < rs->dstW; x++, row += 3, acc += 3)
+        {
+            acc[0] += ((UDOUBLE)row[r] << 8) * wy;
+            acc[1] += ((UDOUBLE)row[1] << 8) * wy;
+            acc[2] += ((UDOUBLE)row[b] << 8) * wy;
+        }
+        return;
+    }
+
+    for (UWORD x = 0; x < rs->dstW; x++, acc += 3)
+    {
+        const UBYTE *sp = row + (size_t)rs->x.first[x] * 3;
+        const UWORD *w = rs->x.weight + rs->x.offset[x];
+        UDOUBLE hr = 0;
+        UDOUBLE hg = 0;
+        UDOUBLE hb = 0;
+        for (UWORD k = rs->x.taps[x]; k > 0; k--, sp += 3, w++)
+        {
+            hr += sp[r] * (UDOUBLE)*w;
+            hg += sp[1] * (UDOUBLE)*w;
+            hb += sp[b] * (UDOUBLE)*w;
+        }
+        acc[0] += ((hr + 32) >> 6) * wy;
+        acc[1] += ((hg + 32) >> 6) * wy;
+        acc[2] += ((hb + 32) >> 6) * wy;
+    }
+}
+
+bool GUI_Resampler_Row(GUI_Resampler *rs, const GUI_RowSource *src, UWORD y, UBYTE *outRgb)
+{
+    const int r = src->bgr ? 2 : 0;
+
+    // Same size both ways: a plain copy (with the channel swap, if any).
+    if (rs->x.identity && rs->y.identity)
+    {
+        const UBYTE *row = src->row(src->self, y);
+        if (!row)
+        {
+            return false;
+        }
+        if (src->bgr)
+        {
+            GUI_Kernel_SwapRB(outRgb, row, rs->dstW);
+        }
+        else
+        {
+            memcpy(outRgb, row, (size_t)rs->dstW * 3);
+        }
+        return true;
+    }
+
+    memset(rs->acc, 0, sizeof(UDOUBLE) * 3 * rs->dstW);
+    const UWORD *wy = rs->y.weight + rs->y.offset[y];
+    for (UWORD k = 0; k < rs->y.taps[y]; k++)
+    {
+        const UBYTE *row = src->row(src->self, (UWORD)(rs->y.first[y] + k));
+        if (!row)
+        {
+            return false;
+        }
+        GUI_Resampler_AddRow(rs, row, r, wy[k]);
+    }
+
+    const UDOUBLE *acc = rs->acc;
+    for (size_t i = 0; i < (size_t)rs->dstW * 3; i++)
+    {
+        *outRgb++ = (UBYTE)((acc[i] + (1u << 21)) >> 22);
+    }
+    return true;
+}
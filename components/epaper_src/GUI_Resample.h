@@ -0,0 +1,57 @@
+/*****************************************************************************
+* | File      	:   GUI_Resample.h
+* | Function    :   Separable fixed-point image resampling
+* | Info        :
+*                Scales streamed RGB rows to the fit size before dithering:
+*                area averaging when shrinking (every source pixel counts by
+*                how much of it an output pixel covers), bilinear when
+*                enlarging. Taps and weights are computed once per axis, so a
+*                row costs a few multiply-adds per channel and no divides.
+******************************************************************************/
+#ifndef __GUI_RESAMPLE_H
+#define __GUI_RESAMPLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DEV_Config.h"
+#include "GUI_BMPfile.h"
+
+// Weights are Q14; the taps of one output pixel sum to exactly this.
+#define GUI_RESAMPLE_ONE (1 << 14)
+
+// Source samples contributing to each output index along one axis.
+typedef struct {
+    UWORD *first;    // first source index
+    UWORD *taps;     // number of consecutive source indices
+    UDOUBLE *offset; // index of the first weight in `weight`
+    UWORD *weight;   // Q14
+    bool identity;   // one source index per output index, weight 1
+} GUI_ResampleAxis;
+
+typedef struct {
+    UWORD srcW;
+    UWORD srcH;
+    UWORD dstW;
+    UWORD dstH;
+    GUI_ResampleAxis x;
+    GUI_ResampleAxis y;
+    UDOUBLE *acc;    // dstW * 3 vertical accumulators
+} GUI_Resampler;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool GUI_Resampler_Init(GUI_Resampler *rs, UWORD srcW, UWORD srcH, UWORD dstW, UWORD dstH);
+void GUI_Resampler_Deinit(GUI_Resampler *rs);
+
+// Produces output row `y` (RGB888) from the source rows it covers. Rows may be requested in
+// any order. Returns false if the source fails to deliver a row.
+bool GUI_Resampler_Row(GUI_Resampler *rs, const GUI_RowSource *src, UWORD y, UBYTE *outRgb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
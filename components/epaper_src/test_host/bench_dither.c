@@ -0,0 +1,298 @@
+/*****************************************************************************
+* | File      	:   bench_dither.c
+* | Function    :   Fixed-point dither vs the float Floyd-Steinberg it replaced
+* | Info        :
+*                Dithers the reference image (or a P6 PPM given as argv[1])
+*                with GUI_Dither and with a float Floyd-Steinberg that uses the
+*                same calibrated palette and an exact CIELAB search, then
+*                reports how many pixels differ, how far apart the two are
+*                once viewed from a distance (8x8 block means), and the time
+*                per 800x480 frame of each dither mode. The old shipped float
+*                kernel (nominal palette, RGB distance) is timed as well.
+*                Fails if the block means drift further apart than
+*                BENCH_MAX_BLOCK_DIFF color levels on average or
+*                BENCH_MAX_BLOCK_WORST in any block, if more than
+*                BENCH_MAX_DIFFERING of the pixels differ, if the fixed-point
+*                output tracks the source worse than the float, or if
+*                fixed-point Floyd-Steinberg is not faster than the old kernel.
+******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GUI_Dither.h"
+#include "host_image.h"
+
+#define BENCH_RUNS 5
+#define BENCH_BLOCK 8
+#define BENCH_MAX_BLOCK_DIFF 4.0
+// Diffusion is chaotic where the source is outside the palette's gamut, so single blocks
+// there can land far apart (52 levels on the reference image) and over a third of the
+// pixels differ while the block means still agree.
+#define BENCH_MAX_BLOCK_WORST 64.0
+#define BENCH_MAX_DIFFERING 0.40
+
+// The kernel removed from GUI_BMPfile.c: nominal primaries, RGB distance, float errors.
+static const GUI_PaletteEntry BENCH_NOMINAL_6[GUI_PALETTE_6_COUNT] = {
+    {0, 0, 0, 0}, {255, 255, 255, 1}, {255, 255, 0, 2}, {255, 0, 0, 3}, {0, 0, 255, 5}, {0, 255, 0, 6},
+};
+
+typedef int (*Bench_Nearest)(double r, double g, double b);
+
+static int Bench_NearestRgb(double r, double g, double b)
+{
+    int best = 0;
+    int bestD = 0x7FFFFFFF;
+    for (int i = 0; i < GUI_PALETTE_6_COUNT; i++)
+    {
+        const int dr = (int)r - BENCH_NOMINAL_6[i].r;
+        const int dg = (int)g - BENCH_NOMINAL_6[i].g;
+        const int db = (int)b - BENCH_NOMINAL_6[i].b;
+        const int d = dr * dr + dg * dg + db * db;
+        if (d < bestD)
+        {
+            bestD = d;
+            best = i;
+        }
+    }
+    return best;
+}
+
+static float Bench_Clamp255f(float v)
+{
+    return (v < 0.0f) ? 0.0f : ((v > 255.0f) ? 255.0f : v);
+}
+
+// Float Floyd-Steinberg into palette indices, against `pal` with `nearest`.
+static void Bench_FloatFS(const UBYTE *rgb, int w, int h, const GUI_PaletteEntry *pal, Bench_Nearest nearest,
+                          UBYTE *out)
+{
+    float *err = (float *)calloc((size_t)(w + 2) * 3, sizeof(float));
+    float *next = (float *)calloc((size_t)(w + 2) * 3, sizeof(float));
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            const UBYTE *sp = rgb + ((size_t)y * w + x) * 3;
+            float *e = err + (x + 1) * 3;
+            const float r = Bench_Clamp255f(sp[0] + e[0]);
+            const float g = Bench_Clamp255f(sp[1] + e[1]);
+            const float b = Bench_Clamp255f(sp[2] + e[2]);
+            const int i = nearest(r, g, b);
+            out[(size_t)y * w + x] = (UBYTE)i;
+
+            const float er[3] = {r - pal[i].r, g - pal[i].g, b - pal[i].b};
+            for (int c = 0; c < 3; c++)
+            {
+                if (x + 1 < w)
+                    e[3 + c] += er[c] * (7.0f / 16.0f);
+                if (y + 1 < h)
+                {
+                    if (x > 0)
+                        next[x * 3 + c] += er[c] * (3.0f / 16.0f);
+                    next[(x + 1) * 3 + c] += er[c] * (5.0f / 16.0f);
+                    if (x + 1 < w)
+                        next[(x + 2) * 3 + c] += er[c] * (1.0f / 16.0f);
+                }
+            }
+        }
+        float *tmp = err;
+        err = next;
+        next = tmp;
+        memset(next, 0, sizeof(float) * (size_t)(w + 2) * 3);
+    }
+    free(err);
+    free(next);
+}
+
+// GUI_Dither into palette indices (it emits Paint indices).
+static void Bench_Fixed(const UBYTE *rgb, int w, int h, GUI_DitherMode mode, UBYTE *out)
+{
+    UBYTE toIndex[8] = {0};
+    for (int i = 0; i < GUI_PALETTE_6_COUNT; i++)
+    {
+        toIndex[GUI_PALETTE_6[i].paint] = (UBYTE)i;
+    }
+
+    GUI_Dither d;
+    if (!GUI_Dither_Init(&d, (UWORD)w, mode))
+    {
+        fprintf(stderr, "GUI_Dither_Init failed\n");
+        exit(1);
+    }
+    for (int y = 0; y < h; y++)
+    {
+        UBYTE *row = out + (size_t)y * w;
+        GUI_Dither_Row(&d, rgb + (size_t)y * w * 3, row);
+        for (int x = 0; x < w; x++)
+        {
+            row[x] = toIndex[row[x] & 7];
+        }
+    }
+    GUI_Dither_Deinit(&d);
+}
+
+static int Bench_CompareDouble(const void *a, const void *b)
+{
+    const double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Median time of BENCH_RUNS, scaled to one 800x480 frame.
+#define BENCH_TIME(ms_out, w, h, call)                                                  \
+    do                                                                                  \
+    {                                                                                   \
+        double runs_[BENCH_RUNS];                                                       \
+        for (int r_ = 0; r_ < BENCH_RUNS; r_++)                                         \
+        {                                                                               \
+            const double t0_ = Host_NowMs();                                            \
+            call;                                                                       \
+            runs_[r_] = Host_NowMs() - t0_;                                             \
+        }                                                                               \
+        qsort(runs_, BENCH_RUNS, sizeof(double), Bench_CompareDouble);                  \
+        (ms_out) = runs_[BENCH_RUNS / 2] * (HOST_FRAME_W * HOST_FRAME_H) / ((double)(w) * (h)); \
+    } while (0)
+
+// Mean and max over 8x8 blocks of the per-channel difference between the block means of
+// two images, in color levels. Index images are shown as the calibrated palette colors;
+// pass NULL to compare against `src` itself.
+static void Bench_BlockDiff(const UBYTE *a, const UBYTE *b, const UBYTE *src, int w, int h, double *mean,
+                            double *max)
+{
+    double sum = 0.0;
+    int blocks = 0;
+    *max = 0.0;
+    for (int by = 0; by + BENCH_BLOCK <= h; by += BENCH_BLOCK)
+    {
+        for (int bx = 0; bx + BENCH_BLOCK <= w; bx += BENCH_BLOCK)
+        {
+            double ma[3] = {0}, mb[3] = {0};
+            for (int y = by; y < by + BENCH_BLOCK; y++)
+            {
+                for (int x = bx; x < bx + BENCH_BLOCK; x++)
+                {
+                    const size_t i = (size_t)y * w + x;
+                    const GUI_PaletteEntry *pa = &GUI_PALETTE_6[a[i]];
+                    ma[0] += pa->r;
+                    ma[1] += pa->g;
+                    ma[2] += pa->b;
+                    if (b)
+                    {
+                        const GUI_PaletteEntry *pb = &GUI_PALETTE_6[b[i]];
+                        mb[0] += pb->r;
+                        mb[1] += pb->g;
+                        mb[2] += pb->b;
+                    }
+                    else
+                    {
+                        mb[0] += src[i * 3];
+                        mb[1] += src[i * 3 + 1];
+                        mb[2] += src[i * 3 + 2];
+                    }
+                }
+            }
+            double d = 0.0;
+            for (int c = 0; c < 3; c++)
+            {
+                d += fabs(ma[c] - mb[c]) / (BENCH_BLOCK * BENCH_BLOCK);
+            }
+            d /= 3.0;
+            sum += d;
+            *max = (d > *max) ? d : *max;
+            blocks++;
+        }
+    }
+    *mean = blocks ? sum / blocks : 0.0;
+}
+
+int main(int argc, char **argv)
+{
+    int w = HOST_FRAME_W, h = HOST_FRAME_H;
+    UBYTE *rgb;
+    if (argc > 1)
+    {
+        rgb = Host_LoadPpm(argv[1], &w, &h);
+        if (!rgb)
+        {
+            fprintf(stderr, "can't read %s (binary PPM, maxval 255)\n", argv[1]);
+            return 1;
+        }
+    }
+    else
+    {
+        rgb = (UBYTE *)malloc((size_t)w * h * 3);
+        Host_TestImage(rgb, w, h);
+    }
+
+    const size_t n = (size_t)w * h;
+    UBYTE *fixed = (UBYTE *)malloc(n);
+    UBYTE *ref = (UBYTE *)malloc(n);
+    UBYTE *old = (UBYTE *)malloc(n);
+
+    double msFloat, msOld;
+    Bench_Fixed(rgb, w, h, GUI_DITHER_FLOYD_STEINBERG, fixed);
+    BENCH_TIME(msFloat, w, h, Bench_FloatFS(rgb, w, h, GUI_PALETTE_6, Host_NearestLab, ref));
+    BENCH_TIME(msOld, w, h, Bench_FloatFS(rgb, w, h, BENCH_NOMINAL_6, Bench_NearestRgb, old));
+
+    size_t differ = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        differ += fixed[i] != ref[i];
+    }
+    double blockMean, blockMax, fixedSrc, floatSrc, unused;
+    Bench_BlockDiff(fixed, ref, NULL, w, h, &blockMean, &blockMax);
+    Bench_BlockDiff(fixed, NULL, rgb, w, h, &fixedSrc, &unused);
+    Bench_BlockDiff(ref, NULL, rgb, w, h, &floatSrc, &unused);
+
+    printf("%s, %dx%d\n", (argc > 1) ? argv[1] : "reference image", w, h);
+    printf("fixed-point FS vs float FS (same palette, exact Lab):\n");
+    printf("  pixels differing   %zu of %zu (%.2f%%)\n", differ, n, 100.0 * differ / n);
+    printf("  8x8 block means    %.2f levels apart on average, %.2f worst\n", blockMean, blockMax);
+    printf("  vs source          fixed %.2f, float %.2f levels\n", fixedSrc, floatSrc);
+    printf("ms per 800x480 frame (median of %d):\n", BENCH_RUNS);
+    printf("  %-18s %8.2f\n", "float FS, Lab", msFloat);
+    printf("  %-18s %8.2f\n", "old float FS, RGB", msOld);
+    double msFixed = 0.0;
+    for (int m = 0; m < GUI_DITHER_MODE_COUNT; m++)
+    {
+        double ms;
+        BENCH_TIME(ms, w, h, Bench_Fixed(rgb, w, h, (GUI_DitherMode)m, old));
+        if (m == GUI_DITHER_FLOYD_STEINBERG)
+            msFixed = ms;
+        printf("  %-18s %8.2f%s\n", GUI_Dither_ModeName((GUI_DitherMode)m), ms,
+               (m == GUI_DITHER_FLOYD_STEINBERG) ? "  (fixed point)" : "");
+    }
+
+    free(rgb);
+    free(fixed);
+    free(ref);
+    free(old);
+
+    if (blockMean > BENCH_MAX_BLOCK_DIFF)
+    {
+        printf("FAIL: block means differ by more than %.1f levels\n", BENCH_MAX_BLOCK_DIFF);
+        return 1;
+    }
+    if (blockMax > BENCH_MAX_BLOCK_WORST)
+    {
+        printf("FAIL: a block mean differs by more than %.1f levels\n", BENCH_MAX_BLOCK_WORST);
+        return 1;
+    }
+    if (differ > BENCH_MAX_DIFFERING * n)
+    {
+        printf("FAIL: more than %.0f%% of the pixels differ\n", 100.0 * BENCH_MAX_DIFFERING);
+        return 1;
+    }
+    if (fixedSrc > floatSrc + 1.0)
+    {
+        printf("FAIL: fixed point is further from the source than the float kernel\n");
+        return 1;
+    }
+    if (msFixed >= msOld)
+    {
+        printf("FAIL: fixed-point Floyd-Steinberg is not faster than the old float kernel\n");
+        return 1;
+    }
+    return 0;
+}
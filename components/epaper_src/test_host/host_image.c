@@ -0,0 +1,204 @@
+/*****************************************************************************
+* | File      	:   host_image.c
+* | Function    :   Shared helpers for the host tests and benchmarks
+******************************************************************************/
+#include "host_image.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "GUI_Dither.h"
+
+static UBYTE Host_Clamp255(double v)
+{
+    return (UBYTE)((v < 0.0) ? 0 : ((v > 255.0) ? 255 : (int)(v + 0.5)));
+}
+
+void Host_TestImage(UBYTE *rgb, int w, int h)
+{
+    uint32_t seed = 1;
+    for (int y = 0; y < h; y++)
+    {
+        const int band = (y * 3) / h;
+        const double fy = (double)y / (h - 1);
+        for (int x = 0; x < w; x++, rgb += 3)
+        {
+            const double fx = (double)x / (w - 1);
+            double r, g, b;
+
+            // Grain, so flat areas aren't perfectly flat (photos never are).
+            seed = seed * 1664525u + 1013904223u;
+            const double grain = (double)((seed >> 24) & 15) - 7.5;
+
+            if (band == 0)
+            {
+                // Hue around the wheel left to right, dark to light top to bottom.
+                const double hue = fx * 6.0;
+                const double light = (y * 3.0) / h;
+                r = fabs(hue - 3.0) - 1.0;
+                g = 2.0 - fabs(hue - 2.0);
+                b = 2.0 - fabs(hue - 4.0);
+                r = (r < 0 ? 0 : r > 1 ? 1 : r) * 255.0 * light;
+                g = (g < 0 ? 0 : g > 1 ? 1 : g) * 255.0 * light;
+                b = (b < 0 ? 0 : b > 1 ? 1 : b) * 255.0 * light;
+            }
+            else if (band == 1)
+            {
+                // Smooth low-frequency color fields, like sky, skin and foliage.
+                r = 128.0 + 100.0 * sin(fx * 5.1 + fy * 2.3) + 20.0 * sin(fx * 23.0);
+                g = 120.0 + 90.0 * sin(fx * 3.7 - fy * 4.1 + 1.0) + 15.0 * cos(fy * 31.0);
+                b = 110.0 + 95.0 * cos(fx * 2.9 + fy * 6.2 + 2.0);
+                r += grain;
+                g += grain;
+                b += grain;
+            }
+            else if (x < w / 2)
+            {
+                // Gray ramp, and a warm ramp below it.
+                const double v = fx * 2.0 * 255.0;
+                if (fy < 5.0 / 6.0)
+                {
+                    r = g = b = v;
+                }
+                else
+                {
+                    r = v;
+                    g = v * 0.8;
+                    b = v * 0.55;
+                }
+            }
+            else
+            {
+                // Hard edges: an 8-pixel checkerboard of two mid colors crossed by thin lines.
+                const bool check = (((x >> 3) ^ (y >> 3)) & 1) != 0;
+                r = check ? 200.0 : 60.0;
+                g = check ? 170.0 : 90.0;
+                b = check ? 60.0 : 150.0;
+                if ((x % 37) == 0 || (y % 29) == 0)
+                {
+                    r = g = b = 250.0;
+                }
+            }
+
+            rgb[0] = Host_Clamp255(r);
+            rgb[1] = Host_Clamp255(g);
+            rgb[2] = Host_Clamp255(b);
+        }
+    }
+}
+
+static int Host_PpmInt(FILE *fp)
+{
+    int c = fgetc(fp);
+    while (c == '#' || c == ' ' || c == '\t' || c == '\r' || c == '\n')
+    {
+        if (c == '#')
+        {
+            while (c != '\n' && c != EOF)
+                c = fgetc(fp);
+        }
+        c = fgetc(fp);
+    }
+    int v = 0;
+    while (c >= '0' && c <= '9')
+    {
+        v = v * 10 + (c - '0');
+        c = fgetc(fp);
+    }
+    return v;
+}
+
+UBYTE *Host_LoadPpm(const char *path, int *w, int *h)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+    {
+        return NULL;
+    }
+    char magic[2];
+    UBYTE *rgb = NULL;
+    if (fread(magic, 1, 2, fp) == 2 && magic[0] == 'P' && magic[1] == '6')
+    {
+        *w = Host_PpmInt(fp);
+        *h = Host_PpmInt(fp);
+        const int maxval = Host_PpmInt(fp);
+        const size_t size = (size_t)*w * (size_t)*h * 3;
+        if (*w > 0 && *h > 0 && *w <= 0xFFFF && *h <= 0xFFFF && maxval == 255)
+        {
+            rgb = (UBYTE *)malloc(size);
+            if (rgb && fread(rgb, 1, size, fp) != size)
+            {
+                free(rgb);
+                rgb = NULL;
+            }
+        }
+    }
+    fclose(fp);
+    return rgb;
+}
+
+double Host_NowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+static double Host_SrgbToLinear(double c)
+{
+    c /= 255.0;
+    return (c <= 0.04045) ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4);
+}
+
+static double Host_LabF(double t)
+{
+    // pow rather than cbrt: the same rounding as tools/gen_palette6.py, so near-ties match.
+    return (t > 216.0 / 24389.0) ? pow(t, 1.0 / 3.0) : (24389.0 / 27.0 * t + 16.0) / 116.0;
+}
+
+void Host_SrgbToLab(double r, double g, double b, double lab[3])
+{
+    r = Host_SrgbToLinear(r);
+    g = Host_SrgbToLinear(g);
+    b = Host_SrgbToLinear(b);
+    const double x = (0.4124564 * r + 0.3575761 * g + 0.1804375 * b) / 0.95047;
+    const double y = 0.2126729 * r + 0.7151522 * g + 0.0721750 * b;
+    const double z = (0.0193339 * r + 0.1191920 * g + 0.9503041 * b) / 1.08883;
+    const double fx = Host_LabF(x), fy = Host_LabF(y), fz = Host_LabF(z);
+    lab[0] = 116.0 * fy - 16.0;
+    lab[1] = 500.0 * (fx - fy);
+    lab[2] = 200.0 * (fy - fz);
+}
+
+int Host_NearestLab(double r, double g, double b)
+{
+    static double palLab[GUI_PALETTE_6_COUNT][3];
+    static bool ready;
+    if (!ready)
+    {
+        for (int i = 0; i < GUI_PALETTE_6_COUNT; i++)
+        {
+            Host_SrgbToLab(GUI_PALETTE_6[i].r, GUI_PALETTE_6[i].g, GUI_PALETTE_6[i].b, palLab[i]);
+        }
+        ready = true;
+    }
+
+    double lab[3];
+    Host_SrgbToLab(r, g, b, lab);
+    int best = 0;
+    double bestD = 0.0;
+    for (int i = 0; i < GUI_PALETTE_6_COUNT; i++)
+    {
+        const double dl = lab[0] - palLab[i][0], da = lab[1] - palLab[i][1], db = lab[2] - palLab[i][2];
+        const double d = dl * dl + da * da + db * db;
+        if (i == 0 || d < bestD)
+        {
+            best = i;
+            bestD = d;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,37 @@
+/*****************************************************************************
+* | File      	:   host_image.h
+* | Function    :   Shared helpers for the host tests and benchmarks
+* | Info        :
+*                Reference image, PPM loading, timing and an exact (double
+*                precision) CIELAB nearest-color search to compare the
+*                firmware's fixed-point code against.
+******************************************************************************/
+#ifndef __HOST_IMAGE_H
+#define __HOST_IMAGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DEV_Config.h"
+
+// The panel's size; benchmarks report time per frame of this many pixels.
+#define HOST_FRAME_W 800
+#define HOST_FRAME_H 480
+
+// Fills `rgb` (w * h RGB888) with the reference image: hue/lightness sweep, smooth
+// photo-like gradients with grain, gray ramps and hard edges, in horizontal bands.
+// Deterministic, so results are comparable between runs and machines.
+void Host_TestImage(UBYTE *rgb, int w, int h);
+
+// Reads a binary PPM (P6, maxval 255). Returns a malloc'd RGB888 buffer or NULL.
+UBYTE *Host_LoadPpm(const char *path, int *w, int *h);
+
+double Host_NowMs(void);
+
+// CIELAB (D65) of an sRGB color, same formula as tools/gen_palette6.py.
+void Host_SrgbToLab(double r, double g, double b, double lab[3]);
+
+// Index into GUI_PALETTE_6 of the CIE76-nearest color (lowest index wins ties).
+int Host_NearestLab(double r, double g, double b);
+
+#endif
@@ -0,0 +1,2 @@
+// Host stand-in for the generated IDF config: no target options set.
+#pragma once
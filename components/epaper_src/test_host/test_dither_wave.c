@@ -0,0 +1,156 @@
+/*****************************************************************************
+* | File      	:   test_dither_wave.c
+* | Function    :   GUI_DitherWave against GUI_Dither_Row
+* | Info        :
+*                Dithers the reference image with two threads sharing one
+*                GUI_DitherWave, rows dealt out in pairs (as the fit renderer
+*                does), alternately and in runs of three, for every mode that
+*                supports it and a few widths around the chunk size. The
+*                output must match GUI_Dither_Row fed the same rows in order
+*                exactly. Also checks that GUI_DitherWave_Abort releases a
+*                thread waiting on a row that never comes.
+*                On a single-core host the threads only interleave where one
+*                waits, so this checks the row and slot bookkeeping; the pixel
+*                margin between rows is only exercised on two cores.
+******************************************************************************/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GUI_Dither.h"
+#include "host_image.h"
+
+#define TEST_H 96
+
+typedef struct {
+    GUI_DitherWave *wave;
+    const UBYTE *rgb;
+    UBYTE *out;
+    int w;
+    int h;
+    int run; // rows dealt out in runs of this many
+    int task;
+    bool ok;
+} Test_Task;
+
+static void *Test_TaskMain(void *arg)
+{
+    Test_Task *t = (Test_Task *)arg;
+    int64_t busyUs = 0;
+    t->ok = true;
+    for (int y = 0; y < t->h && t->ok; y++)
+    {
+        if ((y / t->run) % 2 == t->task)
+        {
+            t->ok = GUI_DitherWave_Row(t->wave, (UDOUBLE)y, t->rgb + (size_t)y * t->w * 3, t->out + (size_t)y * t->w,
+                                       &busyUs);
+        }
+    }
+    return NULL;
+}
+
+static bool Test_Compare(GUI_DitherMode mode, const UBYTE *rgb, int w, int h, int run)
+{
+    UBYTE *serial = (UBYTE *)malloc((size_t)w * h);
+    UBYTE *wave = (UBYTE *)calloc((size_t)w * h, 1);
+    GUI_Dither d;
+    GUI_DitherWave wv;
+    if (!serial || !wave || !GUI_Dither_Init(&d, (UWORD)w, mode) || !GUI_DitherWave_Init(&wv, (UWORD)w, mode))
+    {
+        printf("out of memory\n");
+        exit(1);
+    }
+    for (int y = 0; y < h; y++)
+    {
+        GUI_Dither_Row(&d, rgb + (size_t)y * w * 3, serial + (size_t)y * w);
+    }
+
+    Test_Task tasks[2];
+    pthread_t threads[2];
+    for (int i = 0; i < 2; i++)
+    {
+        tasks[i] = (Test_Task){&wv, rgb, wave, w, h, run, i, false};
+        pthread_create(&threads[i], NULL, Test_TaskMain, &tasks[i]);
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    size_t differ = 0;
+    for (size_t i = 0; i < (size_t)w * h; i++)
+    {
+        differ += serial[i] != wave[i];
+    }
+    const bool ok = tasks[0].ok && tasks[1].ok && differ == 0;
+    printf("  %-16s width %4d, runs of %d: %zu pixels differ%s\n", GUI_Dither_ModeName(mode), w, run, differ,
+           ok ? "" : "  FAIL");
+
+    GUI_Dither_Deinit(&d);
+    GUI_DitherWave_Deinit(&wv);
+    free(serial);
+    free(wave);
+    return ok;
+}
+
+static bool Test_Abort(void)
+{
+    enum { W = 40 };
+    UBYTE rgb[2 * W * 3];
+    UBYTE out[2 * W];
+    memset(rgb, 128, sizeof(rgb));
+    GUI_DitherWave wv;
+    if (!GUI_DitherWave_Init(&wv, W, GUI_DITHER_FLOYD_STEINBERG))
+    {
+        return false;
+    }
+    // Row 1 waits for row 0, which nobody dithers.
+    Test_Task t = {&wv, rgb, out, W, 2, 1, 1, true};
+    pthread_t thread;
+    pthread_create(&thread, NULL, Test_TaskMain, &t);
+    GUI_DitherWave_Abort(&wv);
+    pthread_join(thread, NULL);
+    GUI_DitherWave_Deinit(&wv);
+    printf("  abort: waiting row %s\n", t.ok ? "finished  FAIL" : "gave up");
+    return !t.ok;
+}
+
+int main(void)
+{
+    static const int widths[] = {HOST_FRAME_W, 17, 16, 5, 1};
+    static const int runs[] = {2, 1, 3};
+    static const GUI_DitherMode modes[] = {GUI_DITHER_FLOYD_STEINBERG, GUI_DITHER_ATKINSON, GUI_DITHER_STUCKI};
+
+    UBYTE *rgb = (UBYTE *)malloc((size_t)HOST_FRAME_W * TEST_H * 3);
+    UBYTE *narrow = (UBYTE *)malloc((size_t)HOST_FRAME_W * TEST_H * 3);
+    if (!rgb || !narrow)
+    {
+        return 1;
+    }
+    Host_TestImage(rgb, HOST_FRAME_W, TEST_H);
+
+    bool ok = !GUI_Dither_WaveSupported(GUI_DITHER_FS_SERPENTINE) && !GUI_Dither_WaveSupported(GUI_DITHER_BAYER);
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        for (size_t wi = 0; wi < sizeof(widths) / sizeof(widths[0]); wi++)
+        {
+            // Left edge of the reference image, packed to this width.
+            const int w = widths[wi];
+            for (int y = 0; y < TEST_H; y++)
+            {
+                memcpy(narrow + (size_t)y * w * 3, rgb + (size_t)y * HOST_FRAME_W * 3, (size_t)w * 3);
+            }
+            for (size_t r = 0; r < sizeof(runs) / sizeof(runs[0]); r++)
+            {
+                ok &= Test_Compare(modes[m], narrow, w, TEST_H, runs[r]);
+            }
+        }
+    }
+    ok &= Test_Abort();
+
+    free(rgb);
+    free(narrow);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
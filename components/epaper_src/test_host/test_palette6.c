@@ -0,0 +1,102 @@
+/*****************************************************************************
+* | File      	:   test_palette6.c
+* | Function    :   GUI_Palette6_Nearest against an exact CIELAB search
+* | Info        :
+*                Checks all 2^24 colors against a double-precision search
+*                over the calibrated palette; every one must match, in
+*                settled and split cells alike. Also reports how often a
+*                cell-center-only LUT would be wrong, how many pixels of the
+*                reference image fall in split cells, and the cost of both
+*                paths.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "GUI_Dither.h"
+#include "host_image.h"
+
+static int Test_Cell(int r, int g, int b)
+{
+    return ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+}
+
+int main(void)
+{
+    // Nearest color of each cell center: what the LUT held before split cells.
+    static UBYTE center[GUI_PALETTE_6_LUT_SIZE];
+    int splitCells = 0;
+    for (int i = 0; i < GUI_PALETTE_6_LUT_SIZE; i++)
+    {
+        center[i] = (UBYTE)Host_NearestLab(((i >> 10) << 3) + 4, (((i >> 5) & 31) << 3) + 4, ((i & 31) << 3) + 4);
+        splitCells += GUI_PALETTE_6_LUT[i] >= GUI_PALETTE_6_COUNT;
+    }
+
+    long settledWrong = 0, splitWrong = 0, centerWrong = 0, inSplit = 0;
+    for (int r = 0; r < 256; r++)
+    {
+        for (int g = 0; g < 256; g++)
+        {
+            for (int b = 0; b < 256; b++)
+            {
+                const int want = Host_NearestLab(r, g, b);
+                const int cell = Test_Cell(r, g, b);
+                const bool split = GUI_PALETTE_6_LUT[cell] >= GUI_PALETTE_6_COUNT;
+                if (GUI_Palette6_Nearest((UBYTE)r, (UBYTE)g, (UBYTE)b) != want)
+                {
+                    if (split)
+                        splitWrong++;
+                    else
+                        settledWrong++;
+                }
+                centerWrong += center[cell] != want;
+                inSplit += split;
+            }
+        }
+    }
+
+    // Cost per lookup, settled cells vs split cells.
+    int settledColor[3] = {0}, splitColor[3] = {0};
+    for (int i = 0; i < GUI_PALETTE_6_LUT_SIZE; i++)
+    {
+        int *c = (GUI_PALETTE_6_LUT[i] >= GUI_PALETTE_6_COUNT) ? splitColor : settledColor;
+        c[0] = (i >> 10) << 3;
+        c[1] = ((i >> 5) & 31) << 3;
+        c[2] = (i & 31) << 3;
+    }
+    const int loops = 1 << 22;
+    volatile unsigned sink = 0;
+    double t0 = Host_NowMs();
+    for (int i = 0; i < loops; i++)
+        sink += GUI_Palette6_Nearest((UBYTE)(settledColor[0] | (i & 7)), (UBYTE)settledColor[1], (UBYTE)settledColor[2]);
+    const double nsSettled = (Host_NowMs() - t0) * 1e6 / loops;
+    t0 = Host_NowMs();
+    for (int i = 0; i < loops; i++)
+        sink += GUI_Palette6_Nearest((UBYTE)(splitColor[0] | (i & 7)), (UBYTE)splitColor[1], (UBYTE)splitColor[2]);
+    const double nsSplit = (Host_NowMs() - t0) * 1e6 / loops;
+
+    UBYTE *rgb = (UBYTE *)malloc((size_t)HOST_FRAME_W * HOST_FRAME_H * 3);
+    Host_TestImage(rgb, HOST_FRAME_W, HOST_FRAME_H);
+    long imageSplit = 0;
+    for (size_t i = 0; i < (size_t)HOST_FRAME_W * HOST_FRAME_H; i++)
+    {
+        imageSplit += GUI_PALETTE_6_LUT[Test_Cell(rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2])] >= GUI_PALETTE_6_COUNT;
+    }
+    free(rgb);
+
+    const double all = 256.0 * 256.0 * 256.0;
+    printf("split LUT cells           %d of %d (%.1f%%), %.1f%% of colors\n", splitCells, GUI_PALETTE_6_LUT_SIZE,
+           100.0 * splitCells / GUI_PALETTE_6_LUT_SIZE, 100.0 * inSplit / all);
+    printf("wrong, cell-center LUT    %ld colors (%.2f%%)\n", centerWrong, 100.0 * centerWrong / all);
+    printf("wrong, settled cells      %ld colors\n", settledWrong);
+    printf("wrong, split cells        %ld colors\n", splitWrong);
+    printf("ns per lookup             %.1f settled, %.1f split\n", nsSettled, nsSplit);
+    printf("reference image           %.1f%% of pixels in split cells\n",
+           100.0 * imageSplit / (HOST_FRAME_W * HOST_FRAME_H));
+
+    if (settledWrong != 0 || splitWrong != 0)
+    {
+        printf("FAIL\n");
+        return 1;
+    }
+    return 0;
+}
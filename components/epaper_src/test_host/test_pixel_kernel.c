@@ -0,0 +1,242 @@
+/*****************************************************************************
+* | File      	:   test_pixel_kernel.c
+* | Function    :   GUI_PixelKernel against byte-at-a-time references
+* | Info        :
+*                Runs every kernel over random rows for all counts up to 70
+*                and all source/destination alignments (both directions for
+*                Pack4), compares the result and the bytes around it with a
+*                plain byte loop, then times kernel and reference per
+*                800x480 frame. The references are kept scalar, like the
+*                loops these kernels replaced on the device.
+*                The ESP32-S3 PIE kernels run here on a C model of their
+*                instructions (GUI_KERNEL_PIE_EMULATE) and get the same
+*                check over all 16 alignments; they are not timed, the model
+*                says nothing about their speed.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GUI_PixelKernel.h"
+#include "host_image.h"
+
+#define TEST_MAX_COUNT 70
+#define TEST_GUARD 8
+#define TEST_RUNS 20
+// Long enough for several 16-pixel PIE steps after the alignment head.
+#define TEST_PIE_LONG 200
+
+#define TEST_SCALAR __attribute__((noinline, optimize("no-tree-vectorize")))
+
+static uint32_t s_seed = 1;
+
+static UBYTE Test_Random(void)
+{
+    s_seed = s_seed * 1664525u + 1013904223u;
+    return (UBYTE)(s_seed >> 24);
+}
+
+TEST_SCALAR static void Ref_SwapRB(UBYTE *dst, const UBYTE *src, UWORD count)
+{
+    for (UWORD i = 0; i < count; i++)
+    {
+        dst[i * 3] = src[i * 3 + 2];
+        dst[i * 3 + 1] = src[i * 3 + 1];
+        dst[i * 3 + 2] = src[i * 3];
+    }
+}
+
+TEST_SCALAR static void Ref_ExactRow6(const UBYTE *bgr, UBYTE *out, UWORD count)
+{
+    // R, G, B and Paint index of the six panel colors; anything else is white.
+    static const UBYTE colors[6][4] = {
+        {0, 0, 0, 0}, {255, 255, 255, 1}, {255, 255, 0, 2}, {255, 0, 0, 3}, {0, 0, 255, 5}, {0, 255, 0, 6},
+    };
+    for (UWORD i = 0; i < count; i++, bgr += 3)
+    {
+        out[i] = 1;
+        for (int c = 0; c < 6; c++)
+        {
+            if (bgr[2] == colors[c][0] && bgr[1] == colors[c][1] && bgr[0] == colors[c][2])
+            {
+                out[i] = colors[c][3];
+                break;
+            }
+        }
+    }
+}
+
+TEST_SCALAR static void Ref_Pack4(UBYTE *dst, const UBYTE *colors, int step, UWORD pairs)
+{
+    for (UWORD i = 0; i < pairs; i++, colors += 2 * step)
+    {
+        dst[i] = (UBYTE)((colors[0] << 4) | (colors[step] & 0x0F));
+    }
+}
+
+// Random pixels, a third of them panel colors so ExactRow6 sees every case.
+static void Test_Fill(UBYTE *p, size_t pixels)
+{
+    static const UBYTE exact[6][3] = {
+        {0, 0, 0}, {255, 255, 255}, {0, 255, 255}, {0, 0, 255}, {255, 0, 0}, {0, 255, 0},
+    };
+    for (size_t i = 0; i < pixels; i++, p += 3)
+    {
+        const UBYTE pick = Test_Random();
+        for (int c = 0; c < 3; c++)
+        {
+            p[c] = (pick < 85) ? exact[pick % 6][c] : Test_Random();
+        }
+    }
+}
+
+static int Test_Check(const char *name, const UBYTE *got, const UBYTE *want, size_t bytes, int count, int a,
+                      int b)
+{
+    if (memcmp(got, want, bytes) == 0)
+    {
+        return 0;
+    }
+    printf("FAIL: %s differs (count %d, offsets %d/%d)\n", name, count, a, b);
+    return 1;
+}
+
+static int Test_Correctness(void)
+{
+    enum { BUF = TEST_MAX_COUNT * 3 + 2 * TEST_GUARD };
+    UBYTE src[BUF], got[BUF], want[BUF];
+    int failures = 0;
+
+    for (int count = 0; count <= TEST_MAX_COUNT; count++)
+    {
+        for (int so = 0; so < 4; so++)
+        {
+            for (int dof = 0; dof < 4; dof++)
+            {
+                Test_Fill(src, BUF / 3);
+                for (size_t i = 0; i < BUF; i++)
+                    got[i] = want[i] = Test_Random();
+
+                GUI_Kernel_SwapRB(got + TEST_GUARD + dof, src + TEST_GUARD + so, (UWORD)count);
+                Ref_SwapRB(want + TEST_GUARD + dof, src + TEST_GUARD + so, (UWORD)count);
+                failures += Test_Check("SwapRB", got, want, BUF, count, so, dof);
+
+                GUI_Kernel_ExactRow6(src + TEST_GUARD + so, got + TEST_GUARD + dof, (UWORD)count);
+                Ref_ExactRow6(src + TEST_GUARD + so, want + TEST_GUARD + dof, (UWORD)count);
+                failures += Test_Check("ExactRow6", got, want, BUF, count, so, dof);
+
+                // Colors are Paint indices (0..7) in use; random bytes also check the masking.
+                const int pairs = count / 2;
+                GUI_Kernel_Pack4(got + TEST_GUARD + dof, src + TEST_GUARD + so, 1, (UWORD)pairs);
+                Ref_Pack4(want + TEST_GUARD + dof, src + TEST_GUARD + so, 1, (UWORD)pairs);
+                failures += Test_Check("Pack4 forward", got, want, BUF, count, so, dof);
+
+                const UBYTE *last = src + TEST_GUARD + so + 2 * pairs - 1;
+                GUI_Kernel_Pack4(got + TEST_GUARD + dof, last, -1, (UWORD)pairs);
+                Ref_Pack4(want + TEST_GUARD + dof, last, -1, (UWORD)pairs);
+                failures += Test_Check("Pack4 reverse", got, want, BUF, count, so, dof);
+            }
+        }
+    }
+    return failures;
+}
+
+static int Test_Pie(void)
+{
+    // Multiples of 16 and 16-byte aligned, like any buffer the PIE model may read blocks of.
+    enum { BUF = (TEST_PIE_LONG * 3 + 2 * TEST_GUARD + 15) & ~15 };
+    static UBYTE src[BUF] __attribute__((aligned(16)));
+    static UBYTE got[BUF] __attribute__((aligned(16)));
+    static UBYTE want[BUF] __attribute__((aligned(16)));
+    int failures = 0;
+
+    for (int k = 0; k <= TEST_MAX_COUNT + 1; k++)
+    {
+        const int count = (k <= TEST_MAX_COUNT) ? k : TEST_PIE_LONG;
+        for (int so = 0; so < 16; so++)
+        {
+            for (int dof = 0; dof < 16; dof++)
+            {
+                Test_Fill(src, BUF / 3);
+                for (size_t i = 0; i < BUF; i++)
+                    got[i] = want[i] = Test_Random();
+
+                GUI_KernelPie_SwapRB(got + TEST_GUARD + dof, src + TEST_GUARD + so, (UWORD)count);
+                Ref_SwapRB(want + TEST_GUARD + dof, src + TEST_GUARD + so, (UWORD)count);
+                failures += Test_Check("PIE SwapRB", got, want, BUF, count, so, dof);
+
+                GUI_KernelPie_Pack4(got + TEST_GUARD + dof, src + TEST_GUARD + so, (UWORD)count);
+                Ref_Pack4(want + TEST_GUARD + dof, src + TEST_GUARD + so, 1, (UWORD)count);
+                failures += Test_Check("PIE Pack4", got, want, BUF, count, so, dof);
+            }
+        }
+    }
+    return failures;
+}
+
+static int Test_CompareDouble(const void *a, const void *b)
+{
+    const double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Median ms of TEST_RUNS frames, each HOST_FRAME_H calls of `call`.
+#define TEST_TIME(ms_out, call)                                               \
+    do                                                                        \
+    {                                                                         \
+        double runs_[TEST_RUNS];                                              \
+        for (int r_ = 0; r_ < TEST_RUNS; r_++)                                \
+        {                                                                     \
+            const double t0_ = Host_NowMs();                                  \
+            for (int y_ = 0; y_ < HOST_FRAME_H; y_++)                         \
+            {                                                                 \
+                call;                                                         \
+            }                                                                 \
+            runs_[r_] = Host_NowMs() - t0_;                                   \
+        }                                                                     \
+        qsort(runs_, TEST_RUNS, sizeof(double), Test_CompareDouble);          \
+        (ms_out) = runs_[TEST_RUNS / 2];                                      \
+    } while (0)
+
+static void Test_Speed(void)
+{
+    const UWORD w = HOST_FRAME_W;
+    UBYTE *src = (UBYTE *)malloc((size_t)w * 3 * HOST_FRAME_H);
+    UBYTE *dst = (UBYTE *)malloc((size_t)w * 3);
+    Test_Fill(src, (size_t)w * HOST_FRAME_H);
+    // Pack4 reads Paint indices.
+    UBYTE *colors = (UBYTE *)malloc((size_t)w * HOST_FRAME_H);
+    for (size_t i = 0; i < (size_t)w * HOST_FRAME_H; i++)
+        colors[i] = Test_Random() & 7;
+
+    double k, r;
+    printf("ms per 800x480 frame (median of %d)  kernel  byte loop\n", TEST_RUNS);
+    TEST_TIME(k, GUI_Kernel_SwapRB(dst, src + (size_t)y_ * w * 3, w));
+    TEST_TIME(r, Ref_SwapRB(dst, src + (size_t)y_ * w * 3, w));
+    printf("  %-33s %7.3f %10.3f\n", "SwapRB", k, r);
+    TEST_TIME(k, GUI_Kernel_ExactRow6(src + (size_t)y_ * w * 3, dst, w));
+    TEST_TIME(r, Ref_ExactRow6(src + (size_t)y_ * w * 3, dst, w));
+    printf("  %-33s %7.3f %10.3f\n", "ExactRow6", k, r);
+    TEST_TIME(k, GUI_Kernel_Pack4(dst, colors + (size_t)y_ * w, 1, w / 2));
+    TEST_TIME(r, Ref_Pack4(dst, colors + (size_t)y_ * w, 1, w / 2));
+    printf("  %-33s %7.3f %10.3f\n", "Pack4 forward", k, r);
+    TEST_TIME(k, GUI_Kernel_Pack4(dst, colors + (size_t)y_ * w + w - 1, -1, w / 2));
+    TEST_TIME(r, Ref_Pack4(dst, colors + (size_t)y_ * w + w - 1, -1, w / 2));
+    printf("  %-33s %7.3f %10.3f\n", "Pack4 reverse", k, r);
+
+    free(src);
+    free(dst);
+    free(colors);
+}
+
+int main(void)
+{
+    printf("kernels: %s\n", GUI_Kernel_Impl());
+    int failures = Test_Correctness();
+    printf("%s\n", failures ? "correctness: FAILED" : "correctness: all counts and alignments match");
+    const int pieFailures = Test_Pie();
+    printf("%s\n", pieFailures ? "PIE model: FAILED" : "PIE model: all counts and alignments match");
+    failures += pieFailures;
+    Test_Speed();
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""Generate the blue-noise threshold tile used by the ordered dither modes.
+
+Void-and-cluster (Ulichney 1993) on a 64x64 torus with a Gaussian filter: every
+pixel gets a rank such that the first k ranked pixels are as evenly spread as
+possible for every k. Thresholding with it gives the flat, pattern-free look of
+error diffusion at the cost of an ordered dither (no state between pixels).
+
+Output (checked in; re-run this script after changing SIZE, SIGMA or SEED):
+  ../GUI_BlueNoise.c    64x64 ranks scaled to 0..255
+
+Usage: python3 components/epaper_src/tools/gen_blue_noise.py [--check]
+"""
+
+import math
+import os
+import random
+import sys
+
+SIZE = 64
+SIGMA = 1.5
+RADIUS = 6  # exp(-r^2 / 2 sigma^2) is < 1e-3 beyond this
+INITIAL_FRACTION = 0.1
+SEED = 1
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+C_OUT = os.path.normpath(os.path.join(HERE, "..", "GUI_BlueNoise.c"))
+
+N = SIZE * SIZE
+KERNEL = [
+    (dx, dy, math.exp(-(dx * dx + dy * dy) / (2.0 * SIGMA * SIGMA)))
+    for dy in range(-RADIUS, RADIUS + 1)
+    for dx in range(-RADIUS, RADIUS + 1)
+]
+
+
+class Energy:
+    """Gaussian-filtered density of the set pixels, updated incrementally."""
+
+    def __init__(self, bits):
+        self.e = [0.0] * N
+        for i, v in enumerate(bits):
+            if v:
+                self.add(i, 1.0)
+
+    def add(self, i, sign):
+        x, y = i % SIZE, i // SIZE
+        e = self.e
+        for dx, dy, w in KERNEL:
+            e[((y + dy) % SIZE) * SIZE + (x + dx) % SIZE] += sign * w
+
+
+def tightest_cluster(bits, en):
+    return max((i for i in range(N) if bits[i]), key=en.e.__getitem__)
+
+
+def largest_void(bits, en):
+    return min((i for i in range(N) if not bits[i]), key=en.e.__getitem__)
+
+
+def build_ranks():
+    rnd = random.Random(SEED)
+    bits = [False] * N
+    for i in rnd.sample(range(N), int(N * INITIAL_FRACTION)):
+        bits[i] = True
+
+    # Spread the initial pattern: move the tightest cluster into the largest void until stable.
+    en = Energy(bits)
+    while True:
+        c = tightest_cluster(bits, en)
+        bits[c] = False
+        en.add(c, -1.0)
+        v = largest_void(bits, en)
+        bits[v] = True
+        en.add(v, 1.0)
+        if v == c:
+            break
+
+    ranks = [0] * N
+    ones = sum(bits)
+
+    # Phase 1: rank the initial pattern by removing tightest clusters.
+    work = list(bits)
+    wen = Energy(work)
+    for r in range(ones - 1, -1, -1):
+        c = tightest_cluster(work, wen)
+        work[c] = False
+        wen.add(c, -1.0)
+        ranks[c] = r
+
+    # Phase 2: fill largest voids up to half.
+    for r in range(ones, N // 2):
+        v = largest_void(bits, en)
+        bits[v] = True
+        en.add(v, 1.0)
+        ranks[v] = r
+
+    # Phase 3: past half the zeros are the minority; place them as clusters of the complement.
+    inv = [not b for b in bits]
+    ien = Energy(inv)
+    for r in range(N // 2, N):
+        c = tightest_cluster(inv, ien)
+        inv[c] = False
+        ien.add(c, -1.0)
+        ranks[c] = r
+
+    return ranks
+
+
+def render_c(ranks):
+    out = [
+        "/*****************************************************************************",
+        "* | File      \t:   GUI_BlueNoise.c",
+        "* | Function    :   Blue-noise threshold tile for ordered dithering",
+        "* | Info        :",
+        "*                Generated by tools/gen_blue_noise.py (void-and-cluster,",
+        "*                sigma %.1f, seed %d); re-run it instead of changing this file." % (SIGMA, SEED),
+        "******************************************************************************/",
+        '#include "GUI_Dither.h"',
+        "",
+        "// Rank of each pixel scaled to 0..255, row-major; tiles seamlessly.",
+        "const UBYTE GUI_BLUE_NOISE[GUI_BLUE_NOISE_SIZE * GUI_BLUE_NOISE_SIZE] = {",
+    ]
+    for y in range(SIZE):
+        row = ranks[y * SIZE : (y + 1) * SIZE]
+        out.append("    " + ", ".join(str(r * 256 // N) for r in row) + ",")
+    out += ["};", ""]
+    return "\n".join(out)
+
+
+def main():
+    text = render_c(build_ranks())
+
+    if "--check" in sys.argv:
+        if not os.path.exists(C_OUT) or open(C_OUT).read() != text:
+            print("out of date: %s" % C_OUT)
+            return 1
+        return 0
+
+    with open(C_OUT, "w", newline="\n") as f:
+        f.write(text)
+    print("wrote %s" % C_OUT)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
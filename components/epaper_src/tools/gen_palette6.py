@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+"""Generate the 6-color palette tables shared by the firmware and the web app.
+
+The panel cannot show pure RGB primaries, so dithering works against the colors it
+actually shows (PALETTE below, sRGB). Nearest-color decisions are made in CIELAB
+(D65), where Euclidean distance tracks perceived difference far better than in RGB.
+
+Outputs (both checked in; re-run this script after editing PALETTE):
+  ../GUI_Palette6.c                        palette + 32x32x32 nearest-color LUT, with a
+                                           per-color table for each cell a palette
+                                           boundary runs through
+  ../../../web-app/src/utils/palette.ts    palette + Lab values for the web app
+
+Usage: python3 components/epaper_src/tools/gen_palette6.py [--check]
+"""
+
+import os
+import sys
+
+# name, calibrated sRGB as shown by the panel, nominal sRGB, Paint color index.
+# The calibrated values are typical Spectra 6 panel measurements (D65 light, white
+# balanced on paper); replace them with your own panel's if they differ.
+PALETTE = [
+    ("black", (0x19, 0x1E, 0x21), (0, 0, 0), 0),
+    ("white", (0xE8, 0xE8, 0xE8), (255, 255, 255), 1),
+    ("yellow", (0xEF, 0xDE, 0x44), (255, 255, 0), 2),
+    ("red", (0xB2, 0x13, 0x18), (255, 0, 0), 3),
+    ("blue", (0x21, 0x57, 0xBA), (0, 0, 255), 5),
+    ("green", (0x12, 0x5F, 0x20), (0, 255, 0), 6),
+]
+
+LUT_BITS = 5
+# build_lut() value for cells a palette boundary runs through; split_cells() resolves them.
+AMBIGUOUS = 0xFF
+# LUT values from these on index GUI_PALETTE_6_PAIRS / GUI_PALETTE_6_QUADS (GUI_Dither.h).
+SPLIT_PAIR = 0x4000
+SPLIT_QUAD = 0x8000
+SPLIT_INDEX_MASK = 0x3FFF
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+C_OUT = os.path.normpath(os.path.join(HERE, "..", "GUI_Palette6.c"))
+TS_OUT = os.path.normpath(os.path.join(HERE, "..", "..", "..", "web-app", "src", "utils", "palette.ts"))
+
+
+def srgb_to_linear(c):
+    c /= 255.0
+    return c / 12.92 if c <= 0.04045 else ((c + 0.055) / 1.055) ** 2.4
+
+
+def srgb_to_lab(rgb):
+    r, g, b = (srgb_to_linear(float(v)) for v in rgb)
+    x = (0.4124564 * r + 0.3575761 * g + 0.1804375 * b) / 0.95047
+    y = 0.2126729 * r + 0.7151522 * g + 0.0721750 * b
+    z = (0.0193339 * r + 0.1191920 * g + 0.9503041 * b) / 1.08883
+
+    def f(t):
+        return t ** (1.0 / 3.0) if t > 216.0 / 24389.0 else (24389.0 / 27.0 * t + 16.0) / 116.0
+
+    fx, fy, fz = f(x), f(y), f(z)
+    return (116.0 * fy - 16.0, 500.0 * (fx - fy), 200.0 * (fy - fz))
+
+
+PALETTE_LAB = [srgb_to_lab(p[1]) for p in PALETTE]
+
+
+def nearest(rgb):
+    """Palette index with the smallest CIE76 distance (lowest index wins ties)."""
+    L, a, b = srgb_to_lab(rgb)
+    best, best_d = 0, None
+    for i, (pl, pa, pb) in enumerate(PALETTE_LAB):
+        d = (L - pl) ** 2 + (a - pa) ** 2 + (b - pb) ** 2
+        if best_d is None or d < best_d:
+            best, best_d = i, d
+    return best
+
+
+def build_lut():
+    """Nearest color of each cell, or AMBIGUOUS unless its corners, edge midpoints, face
+    centers and center all agree (test_host/test_palette6.c checks every color)."""
+    side = 1 << LUT_BITS
+    shift = 8 - LUT_BITS
+    offsets = (0, 1 << (shift - 1), (1 << shift) - 1)
+    lut = []
+    for ri in range(side):
+        for gi in range(side):
+            for bi in range(side):
+                base = (ri << shift, gi << shift, bi << shift)
+                found = {
+                    nearest((base[0] + dr, base[1] + dg, base[2] + db))
+                    for dr in offsets
+                    for dg in offsets
+                    for db in offsets
+                }
+                lut.append(found.pop() if len(found) == 1 else AMBIGUOUS)
+    return lut
+
+
+def split_cells(lut):
+    """Replace each AMBIGUOUS cell with a reference to a table holding the nearest color of
+    every color in it, bit-packed in (r, g, b) & 7 order: one bit per color for cells
+    shared by two palette colors (pairs), two bits for cells shared by three or four (quads)."""
+    shift = 8 - LUT_BITS
+    side = 1 << shift
+    pairs, quads = [], []
+    out = []
+    for i, v in enumerate(lut):
+        if v != AMBIGUOUS:
+            out.append(v)
+            continue
+        r0 = (i >> (2 * LUT_BITS)) << shift
+        g0 = ((i >> LUT_BITS) & ((1 << LUT_BITS) - 1)) << shift
+        b0 = (i & ((1 << LUT_BITS) - 1)) << shift
+        picks = [
+            nearest((r0 + dr, g0 + dg, b0 + db)) for dr in range(side) for dg in range(side) for db in range(side)
+        ]
+        colors = sorted(set(picks))
+        bits = 1 if len(colors) <= 2 else 2
+        if len(colors) > 1 << bits:
+            raise SystemExit("cell %d is shared by %d palette colors" % (i, len(colors)))
+        per_word = 32 // bits
+        words = [0] * (len(picks) // per_word)
+        for s, c in enumerate(picks):
+            words[s // per_word] |= colors.index(c) << ((s % per_word) * bits)
+        colors += [colors[0]] * ((1 << bits) - len(colors))
+        table, tag = (pairs, SPLIT_PAIR) if bits == 1 else (quads, SPLIT_QUAD)
+        if len(table) > SPLIT_INDEX_MASK:
+            raise SystemExit("too many split cells")
+        out.append(tag | len(table))
+        table.append((colors, words))
+    return out, pairs, quads
+
+
+def render_c(lut, pairs, quads):
+    out = [
+        "/*****************************************************************************",
+        "* | File      \t:   GUI_Palette6.c",
+        "* | Function    :   Calibrated 6-color palette and nearest-color LUT",
+        "* | Info        :",
+        "*                Generated by tools/gen_palette6.py; edit the palette there",
+        "*                and re-run it instead of changing this file.",
+        "******************************************************************************/",
+        '#include "GUI_Dither.h"',
+        "",
+        "const GUI_PaletteEntry GUI_PALETTE_6[GUI_PALETTE_6_COUNT] = {",
+    ]
+    for name, (r, g, b), _, paint in PALETTE:
+        out.append("    {%d, %d, %d, %d}, // %s" % (r, g, b, paint, name))
+    out += [
+        "};",
+        "",
+        "// Index into GUI_PALETTE_6 of the CIELAB-nearest color of every color in each cell, or",
+        "// GUI_PALETTE_6_SPLIT_PAIR / GUI_PALETTE_6_SPLIT_QUAD | table index where that depends on",
+        "// the color, indexed by (r >> %d) << %d | (g >> %d) << %d | (b >> %d)."
+        % (8 - LUT_BITS, 2 * LUT_BITS, 8 - LUT_BITS, LUT_BITS, 8 - LUT_BITS),
+        "const UWORD GUI_PALETTE_6_LUT[GUI_PALETTE_6_LUT_SIZE] = {",
+    ]
+    for i in range(0, len(lut), 16):
+        out.append("    " + ", ".join(str(v) for v in lut[i : i + 16]) + ",")
+    for name, table in (("PAIRS", pairs), ("QUADS", quads)):
+        out += [
+            "};",
+            "",
+            "const GUI_Palette6Split%s GUI_PALETTE_6_%s[] = {" % (name[:-1].capitalize(), name),
+        ]
+        for colors, words in table:
+            out.append(
+                "    {{%s}, {%s}},"
+                % (", ".join(str(c) for c in colors), ", ".join("0x%x" % w for w in words))
+            )
+    out += ["};", ""]
+    return "\n".join(out)
+
+
+def render_ts():
+    out = [
+        "// Generated by components/epaper_src/tools/gen_palette6.py; edit the palette there",
+        "// and re-run it instead of changing this file.",
+        "",
+        "export interface PaletteColor {",
+        "  name: string",
+        "  // Color as shown by the panel (what dithering aims for).",
+        "  r: number",
+        "  g: number",
+        "  b: number",
+        "  // CIELAB (D65) of the shown color.",
+        "  L: number",
+        "  A: number",
+        "  B: number",
+        "  // Color the firmware expects in pre-dithered images.",
+        "  nominal: [number, number, number]",
+        "}",
+        "",
+        "export const PALETTE: readonly PaletteColor[] = [",
+    ]
+    for (name, (r, g, b), nominal, _), lab in zip(PALETTE, PALETTE_LAB):
+        L, A, B = (round(v, 4) + 0.0 for v in lab)  # + 0.0 turns -0.0 into 0.0
+        out.append(
+            "  { name: '%s', r: %d, g: %d, b: %d, L: %.4f, A: %.4f, B: %.4f, nominal: [%d, %d, %d] },"
+            % ((name, r, g, b, L, A, B) + tuple(nominal))
+        )
+    out += ["]", ""]
+    return "\n".join(out)
+
+
+def main():
+    lut, pairs, quads = split_cells(build_lut())
+    outputs = {C_OUT: render_c(lut, pairs, quads), TS_OUT: render_ts()}
+
+    if "--check" in sys.argv:
+        stale = [p for p, text in outputs.items() if not os.path.exists(p) or open(p).read() != text]
+        for p in stale:
+            print("out of date: %s" % p)
+        return 1 if stale else 0
+
+    for path, text in outputs.items():
+        with open(path, "w", newline="\n") as f:
+            f.write(text)
+        print("wrote %s" % path)
+
+    print(
+        "%d of %d LUT cells (%.1f%%) split: %d pairs, %d quads"
+        % (len(pairs) + len(quads), len(lut), 100.0 * (len(pairs) + len(quads)) / len(lut), len(pairs), len(quads))
+    )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -3,6 +3,7 @@
 #include "floyd_steinberg.h"
 #include "esp_heap_caps.h"
 #include "sdcard_bsp.h"
+#include "GUI_Dither.h"
 
 
 #include "jpeg_decoder.h"
@@ -13,14 +14,15 @@
 static const char *TAG = "dither";
 
 #define CLAMP(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
-// 6-color palette (RGB888) jitter algorithm
-static const uint8_t PALETTE[6][3] = {
+// Colors written to the output image, in GUI_PALETTE_6 order. The BMP reader matches
+// these exactly; the error is diffused against the calibrated colors the panel shows.
+static const uint8_t PALETTE[GUI_PALETTE_6_COUNT][3] = {
     {0, 0, 0},       // Black
     {255, 255, 255}, // White
+    {255, 255, 0},   // Yellow
     {255, 0, 0},     // Red
-    {0, 255, 0},     // Green
     {0, 0, 255},     // Blue
-    {255, 255, 0}    // Yellow
+    {0, 255, 0}      // Green
 };
 
 floyd_steinberg::floyd_steinberg() {
@@ -47,22 +49,9 @@ void floyd_steinberg::Jpeg_dec_buffer_free(uint8_t *outbuffer) {
     }
 }
 
-// Find the closest color from the palette (RGB888)
+// Find the perceptually closest panel color (index into GUI_PALETTE_6 / PALETTE)
 int floyd_steinberg::nearest_color(uint8_t r, uint8_t g, uint8_t b) {
-    int best      = 0;
-    int best_dist = 999999;
-
-    for (int i = 0; i < 6; i++) {
-        int dr   = (int) r - PALETTE[i][0];
-        int dg   = (int) g - PALETTE[i][1];
-        int db   = (int) b - PALETTE[i][2];
-        int dist = dr * dr + dg * dg + db * db;
-        if (dist < best_dist) {
-            best_dist = dist;
-            best      = i;
-        }
-    }
-    return best;
+    return GUI_Palette6_Nearest(r, g, b);
 }
 
 // Floyd–Steinberg Dithering
@@ -95,9 +84,9 @@ void floyd_steinberg::dither_fs_rgb888(uint8_t *in_img, uint8_t *out_img, int w,
             out_img[idx + 2] = bb;
 
             // Error
-            int err_r = (int) r - rr;
-            int err_g = (int) g - gg;
-            int err_b = (int) b - bb;
+            int err_r = (int) r - GUI_PALETTE_6[ci].r;
+            int err_g = (int) g - GUI_PALETTE_6[ci].g;
+            int err_b = (int) b - GUI_PALETTE_6[ci].b;
 
             // Floyd–Steinberg diffusion
             //     *   7
@@ -3,9 +3,11 @@
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/event_groups.h>
+#include <freertos/queue.h>
 #include <freertos/semphr.h>
 #include <freertos/task.h>
 
+#include "esp_attr.h"
 #include "esp_check.h"
 #include "esp_event.h"
 #include "esp_http_server.h"
@@ -16,12 +18,18 @@
 #include "esp_wifi.h"
 #include "esp_heap_caps.h"
 #include "esp_timer.h"
+#include "esp_rom_crc.h"
+#include "esp_random.h"
 #include "mdns.h"
 
 #include "ssid_manager.h"
 
 #include "nvs.h"
 #include "sdcard_bsp.h"
+#include "GUI_Dither.h"
+#include "GUI_JPEGfile.h"
+#include "GUI_PixelKernel.h"
+#include "GUI_QOIfile.h"
 #include "cJSON.h"
 #include <stdio.h>
 #include <string.h>
@@ -32,6 +40,7 @@
 #include <dirent.h>
 #include <algorithm>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 static const char *TAG = "server_bsp";
@@ -48,6 +57,7 @@ static const char *kNvsKeyPhotoSeq = "photo_seq";
 static const char *kNvsKeySlideshowEnabled = "slideshow_en";
 static const char *kNvsKeySlideshowIntervalS = "slideshow_int_s";
 static const char *kNvsKeyStatusIcons = "status_icons";
+static const char *kNvsKeyDitherMode = "dither_mode";
 
 // Wi-Fi (PhotoFrame / browser upload app)
 // SoftAP defaults (used when no STA credentials, or when STA connect fails).
@@ -156,6 +166,20 @@ static TaskHandle_t s_wifi_monitor_task = NULL;
 static const char *kSdWebRoot = "/sdcard/web-app";
 static const char *kUserPhotoDir = "/sdcard/user/current-img";
 static const char *kLibraryPath = "/sdcard/user/current-img/library.json";
+static const char *kLibraryTmpPath = "/sdcard/user/current-img/library.json.tmp";
+// Upload/delete append one line here instead of rewriting library.json; see
+// server_bsp_journal_append_locked() for the record format.
+static const char *kLibraryJournalPath = "/sdcard/user/current-img/library.journal";
+static const size_t kLibraryJournalMaxRecords = 64;
+static const long kLibraryMaxBytes = 512 * 1024;
+// Binary copy of library.json for boot (see LibraryIndexHeader). library.json stays the
+// export format and the fallback when the index is missing or fails its checksum.
+static const char *kLibraryIndexPath = "/sdcard/user/current-img/library.idx";
+
+// Pre-rendered panel framebuffers (see server_bsp_get_frame_cache_path()).
+// File name: <image basename without extension>_d<display rotation>_m<dither mode>.epd
+static const char *kFrameCacheDir = "/sdcard/user/current-img/.cache";
+static const char *kFrameCacheExt = ".epd";
 
 static const char *kFallbackDir = "/sdcard/fallback-frame";
 static const char *kFallbackLandscape = "/sdcard/fallback-frame/fallback_landscape.bmp";
@@ -179,25 +203,97 @@ static uint32_t s_slideshow_interval_s = 3600;
 // UI preference: overlay status icons on the rendered photo.
 static uint8_t s_status_icons = 0;
 
+// Global dither mode (GUI_DitherMode); photos may override it (LibraryPhoto::dither).
+static uint8_t s_dither_mode = GUI_DITHER_FLOYD_STEINBERG;
+// LibraryPhoto::dither value for "use the global mode".
+static const uint8_t kPhotoDitherDefault = 0xFF;
+// Override of the current photo when it was picked from the wake plan (library not loaded).
+static uint8_t s_wake_photo_dither = kPhotoDitherDefault;
+
 struct LibraryPhoto
 {
     std::string id;
     std::string landscape;
     std::string portrait;
+    uint8_t dither = kPhotoDitherDefault;
 };
 
-static std::vector<LibraryPhoto> s_library_photos;
+// Photos keyed by id (node-based, so LibraryPhoto pointers stay valid across inserts),
+// plus the display order and each id's position in it.
+static std::unordered_map<std::string, LibraryPhoto> s_library_photos;
 static std::vector<std::string> s_library_order;
+static std::unordered_map<std::string, size_t> s_library_order_pos;
+static size_t s_library_journal_records = 0;
+// The journal ends in a line without its newline (a reset or full card mid-append). Appending
+// after it would glue the next record onto it, so the library is rewritten first.
+static bool s_library_journal_torn = false;
+// Bumped on every library change; /api/photos derives its ETag from it. Seeded randomly at
+// boot so a tag cached before a restart can't match the reloaded library by accident.
+static uint32_t s_library_generation = 0;
+
+// Cached listing of kUserPhotoDir, shared by the merge and rebuild paths. FAT leaves a
+// directory's mtime alone when entries come and go, so handlers that add or remove photo
+// files also bump s_photo_dir_writes (guarded by s_state_mux) to force a re-read.
+static sdcard_scan_t s_photo_dir_scan;
+static bool s_photo_dir_scan_ready = false;
+static uint32_t s_photo_dir_writes = 0;
+static uint32_t s_photo_dir_scanned_writes = 0;
+// Scan generation the library was last built from; 0 = not built from a scan yet.
+static uint32_t s_library_scan_generation = 0;
+
+// library.idx layout: header, `count` records in display order, then a string pool of
+// NUL-terminated names. Offsets are into the pool; offset 0 is always the empty string.
+// The CRC covers everything after the header.
+static const uint32_t kLibraryIndexMagic = 0x58494C4Du; // "MLIX"
+static const uint16_t kLibraryIndexVersion = 2;
+
+struct LibraryIndexHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t count;
+    uint32_t pool_len;
+    uint32_t crc32;
+};
+
+struct LibraryIndexRecord
+{
+    uint32_t id;
+    uint32_t landscape;
+    uint32_t portrait;
+    uint32_t dither; // LibraryPhoto::dither
+};
 static bool s_state_initialized = false;
 static SemaphoreHandle_t s_library_mutex = NULL;
 
 static uint64_t s_last_activity_us = 0;
 static portMUX_TYPE s_activity_mux = portMUX_INITIALIZER_UNLOCKED;
 
+// Write-back cache for the NVS keys that change on every photo switch. Setters update the
+// RAM copy and mark the key dirty; one nvs_commit() covers everything dirtied within
+// kNvsFlushDelayUs, or happens earlier via server_bsp_flush_settings() (before sleep/restart).
+// The dirty bits are guarded by s_state_mux, like the values they mirror. Flushes are
+// serialized by s_nvs_flush_mutex, so a flush before sleep waits for one the timer task has
+// already started instead of returning while that commit is still in flight.
+#define SERVER_BSP_NVS_DIRTY_ROTATION (1u << 0)
+#define SERVER_BSP_NVS_DIRTY_IMAGE_ROTATION (1u << 1)
+#define SERVER_BSP_NVS_DIRTY_CURRENT_IMAGE (1u << 2)
+#define SERVER_BSP_NVS_DIRTY_CURRENT_PHOTO_ID (1u << 3)
+
+static const uint64_t kNvsFlushDelayUs = 2ULL * 1000ULL * 1000ULL;
+static uint8_t s_nvs_dirty = 0;
+static esp_timer_handle_t s_nvs_flush_timer = NULL;
+static SemaphoreHandle_t s_nvs_flush_mutex = NULL;
+
 // Forward declarations for static helpers (some are referenced before their definitions below).
 static void server_bsp_update_current_image_for_rotation(void);
 static void server_bsp_set_current_image_internal(const char *full_path, uint16_t img_rot);
 static esp_err_t server_bsp_recv_small_body(httpd_req_t *req, char *body, size_t body_size);
+static LibraryPhoto *server_bsp_find_photo_locked(const char *id);
+static void server_bsp_frame_cache_invalidate_photo(const char *id);
+static void server_bsp_frame_cache_purge(void);
+static void server_bsp_sweep_upload_temp_files(void);
 
 // Wi-Fi helpers (PhotoFrame / browser upload app)
 static void server_bsp_start_softap(void);
@@ -209,6 +305,128 @@ static esp_err_t get_wifi_status_callback(httpd_req_t *req);
 static esp_err_t post_wifi_config_callback(httpd_req_t *req);
 static esp_err_t post_wifi_clear_callback(httpd_req_t *req);
 
+static void server_bsp_nvs_flush_timer_cb(void *arg)
+{
+    (void)arg;
+    (void)server_bsp_flush_settings();
+}
+
+// Creates the flush mutex and timer. Called once from the state init paths, before any
+// other task can mark keys dirty.
+static void server_bsp_nvs_flush_init(void)
+{
+    if (!s_nvs_flush_mutex)
+    {
+        s_nvs_flush_mutex = xSemaphoreCreateMutex();
+    }
+    if (!s_nvs_flush_timer)
+    {
+        const esp_timer_create_args_t args = {
+            .callback = server_bsp_nvs_flush_timer_cb,
+            .arg = NULL,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "nvs_flush",
+            .skip_unhandled_events = true,
+        };
+        if (esp_timer_create(&args, &s_nvs_flush_timer) != ESP_OK)
+        {
+            ESP_LOGW(TAG, "NVS flush timer unavailable; settings are written immediately");
+            s_nvs_flush_timer = NULL;
+        }
+    }
+}
+
+static void server_bsp_nvs_mark_dirty(uint8_t bits)
+{
+    portENTER_CRITICAL(&s_state_mux);
+    s_nvs_dirty |= bits;
+    portEXIT_CRITICAL(&s_state_mux);
+
+    if (!s_nvs_flush_timer)
+    {
+        (void)server_bsp_flush_settings();
+        return;
+    }
+
+    // Not re-armed while pending: a steady stream of changes still commits every kNvsFlushDelayUs.
+    if (!esp_timer_is_active(s_nvs_flush_timer))
+    {
+        esp_timer_start_once(s_nvs_flush_timer, kNvsFlushDelayUs);
+    }
+}
+
+esp_err_t server_bsp_flush_settings(void)
+{
+    char image_path[sizeof(s_current_image_path)];
+    char photo_id[sizeof(s_current_photo_id)];
+
+    // Held across the write: the dirty bits are cleared up front, so a concurrent flush
+    // that found them clear must not return before this one has committed.
+    if (s_nvs_flush_mutex)
+    {
+        xSemaphoreTake(s_nvs_flush_mutex, portMAX_DELAY);
+    }
+
+    portENTER_CRITICAL(&s_state_mux);
+    const uint8_t dirty = s_nvs_dirty;
+    s_nvs_dirty = 0;
+    const uint16_t rot = s_rotation_deg;
+    const uint16_t img_rot = s_image_rotation_deg;
+    memcpy(image_path, s_current_image_path, sizeof(image_path));
+    memcpy(photo_id, s_current_photo_id, sizeof(photo_id));
+    portEXIT_CRITICAL(&s_state_mux);
+
+    if (dirty == 0)
+    {
+        if (s_nvs_flush_mutex)
+        {
+            xSemaphoreGive(s_nvs_flush_mutex);
+        }
+        return ESP_OK;
+    }
+
+    nvs_handle_t nvs = 0;
+    esp_err_t err = nvs_open(kNvsNamespace, NVS_READWRITE, &nvs);
+    if (err == ESP_OK)
+    {
+        if (dirty & SERVER_BSP_NVS_DIRTY_ROTATION)
+        {
+            err = nvs_set_u16(nvs, kNvsKeyRotation, rot);
+        }
+        if (err == ESP_OK && (dirty & SERVER_BSP_NVS_DIRTY_IMAGE_ROTATION))
+        {
+            err = nvs_set_u16(nvs, kNvsKeyImageRotation, img_rot);
+        }
+        if (err == ESP_OK && (dirty & SERVER_BSP_NVS_DIRTY_CURRENT_IMAGE))
+        {
+            err = nvs_set_str(nvs, kNvsKeyCurrentImage, image_path);
+        }
+        if (err == ESP_OK && (dirty & SERVER_BSP_NVS_DIRTY_CURRENT_PHOTO_ID))
+        {
+            err = nvs_set_str(nvs, kNvsKeyCurrentPhotoId, photo_id);
+        }
+        if (err == ESP_OK)
+        {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+
+    if (err != ESP_OK)
+    {
+        // Keep the keys dirty so the next flush retries them.
+        ESP_LOGW(TAG, "NVS flush failed (%s)", esp_err_to_name(err));
+        portENTER_CRITICAL(&s_state_mux);
+        s_nvs_dirty |= dirty;
+        portEXIT_CRITICAL(&s_state_mux);
+    }
+    if (s_nvs_flush_mutex)
+    {
+        xSemaphoreGive(s_nvs_flush_mutex);
+    }
+    return err;
+}
+
 static void server_bsp_mark_activity_internal(void)
 {
     const uint64_t now = esp_timer_get_time();
@@ -307,6 +525,32 @@ esp_err_t server_bsp_set_status_icons_enabled(bool enabled)
     return err;
 }
 
+static esp_err_t server_bsp_set_dither_mode_global(GUI_DitherMode mode)
+{
+    if (s_dither_mode != (uint8_t)mode)
+    {
+        // Cached frames of photos without their own mode were dithered the old way.
+        s_dither_mode = (uint8_t)mode;
+        server_bsp_frame_cache_purge();
+    }
+
+    nvs_handle_t nvs = 0;
+    esp_err_t err = nvs_open(kNvsNamespace, NVS_READWRITE, &nvs);
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+
+    err = nvs_set_u8(nvs, kNvsKeyDitherMode, s_dither_mode);
+    if (err == ESP_OK)
+    {
+        err = nvs_commit(nvs);
+    }
+
+    nvs_close(nvs);
+    return err;
+}
+
 uint16_t server_bsp_get_rotation(void)
 {
     return s_rotation_deg;
@@ -385,6 +629,34 @@ const char *server_bsp_get_current_image_path(void)
     return s_current_image_path;
 }
 
+uint8_t server_bsp_get_dither_mode(void)
+{
+    uint8_t photo = kPhotoDitherDefault;
+    if (!s_state_initialized)
+    {
+        // Fast wake: the library isn't loaded, the wake plan entry carried the photo's setting.
+        portENTER_CRITICAL(&s_state_mux);
+        photo = s_wake_photo_dither;
+        portEXIT_CRITICAL(&s_state_mux);
+    }
+    else if (s_library_mutex && xSemaphoreTake(s_library_mutex, pdMS_TO_TICKS(1000)) == pdTRUE)
+    {
+        char id[64] = {0};
+        portENTER_CRITICAL(&s_state_mux);
+        snprintf(id, sizeof(id), "%s", s_current_photo_id);
+        portEXIT_CRITICAL(&s_state_mux);
+
+        const LibraryPhoto *p = server_bsp_find_photo_locked(id);
+        if (p)
+        {
+            photo = p->dither;
+        }
+        xSemaphoreGive(s_library_mutex);
+    }
+
+    return (photo < GUI_DITHER_MODE_COUNT) ? photo : s_dither_mode;
+}
+
 esp_err_t server_bsp_set_rotation(uint16_t rotation_deg)
 {
     if (!(rotation_deg == 0 || rotation_deg == 90 || rotation_deg == 180 || rotation_deg == 270))
@@ -392,26 +664,22 @@ esp_err_t server_bsp_set_rotation(uint16_t rotation_deg)
         return ESP_ERR_INVALID_ARG;
     }
 
+    const bool changed = (s_rotation_deg != rotation_deg);
     s_rotation_deg = rotation_deg;
 
-    nvs_handle_t nvs = 0;
-    esp_err_t err = nvs_open(kNvsNamespace, NVS_READWRITE, &nvs);
-    if (err != ESP_OK)
+    // Cached frames are rendered for one display rotation only.
+    if (changed)
     {
-        return err;
+        server_bsp_frame_cache_purge();
     }
 
-    err = nvs_set_u16(nvs, kNvsKeyRotation, s_rotation_deg);
-    if (err == ESP_OK)
-    {
-        err = nvs_commit(nvs);
-    }
-    nvs_close(nvs);
+    // Committed together with the current image picked below.
+    server_bsp_nvs_mark_dirty(SERVER_BSP_NVS_DIRTY_ROTATION);
 
     // Pick the correct variant for the new orientation.
     server_bsp_update_current_image_for_rotation();
 
-    return err;
+    return ESP_OK;
 }
 
 static bool server_bsp_ends_with_ignore_case(const char *s, const char *suffix)
@@ -436,6 +704,23 @@ static bool server_bsp_ends_with_ignore_case(const char *s, const char *suffix)
     return true;
 }
 
+// Stored photo formats: 24-bit BMP (legacy, and what older clients upload), QOI and baseline JPEG.
+// All extensions are four characters, which the frame cache naming relies on.
+static bool server_bsp_photo_ext_is_supported(const char *name)
+{
+    return server_bsp_ends_with_ignore_case(name, ".bmp") || server_bsp_ends_with_ignore_case(name, ".qoi") ||
+           server_bsp_ends_with_ignore_case(name, ".jpg");
+}
+
+static const char *server_bsp_photo_content_type(const char *name)
+{
+    if (server_bsp_ends_with_ignore_case(name, ".jpg"))
+        return "image/jpeg";
+    if (server_bsp_ends_with_ignore_case(name, ".qoi"))
+        return "image/qoi";
+    return "image/bmp";
+}
+
 static uint16_t server_bsp_parse_rotation_from_filename(const char *name, uint16_t default_rot)
 {
     if (!name)
@@ -471,6 +756,104 @@ static const char *server_bsp_basename(const char *path)
     return base ? (base + 1) : path;
 }
 
+bool server_bsp_get_frame_cache_path(char *out_path, size_t out_path_len)
+{
+    if (!out_path || out_path_len == 0)
+    {
+        return false;
+    }
+    out_path[0] = '\0';
+
+    char img_path[192] = {0};
+    portENTER_CRITICAL(&s_state_mux);
+    snprintf(img_path, sizeof(img_path), "%s", s_current_image_path);
+    const uint16_t rot = s_rotation_deg;
+    portEXIT_CRITICAL(&s_state_mux);
+
+    // Only user photos are cached; fallback frames live outside the user dir.
+    const size_t dir_len = strlen(kUserPhotoDir);
+    if (strncmp(img_path, kUserPhotoDir, dir_len) != 0 || img_path[dir_len] != '/')
+    {
+        return false;
+    }
+
+    const char *name = img_path + dir_len + 1;
+    if (strchr(name, '/') != NULL || !server_bsp_photo_ext_is_supported(name))
+    {
+        return false;
+    }
+
+    const int stem_len = (int)(strlen(name) - 4);
+    const int n = snprintf(out_path, out_path_len, "%s/%.*s_d%u_m%u%s", kFrameCacheDir, stem_len, name, (unsigned)rot,
+                           (unsigned)server_bsp_get_dither_mode(), kFrameCacheExt);
+    if (n <= 0 || (size_t)n >= out_path_len)
+    {
+        out_path[0] = '\0';
+        return false;
+    }
+    return true;
+}
+
+// Removes cached frames whose file name starts with prefix (all entries when prefix is NULL).
+static void server_bsp_frame_cache_remove_matching(const char *prefix)
+{
+    DIR *dir = opendir(kFrameCacheDir);
+    if (!dir)
+    {
+        return;
+    }
+
+    // Collect first; don't mutate the directory while iterating it.
+    std::vector<std::string> victims;
+    const size_t prefix_len = prefix ? strlen(prefix) : 0;
+    struct dirent *ent = NULL;
+    while ((ent = readdir(dir)) != NULL)
+    {
+        const char *name = ent->d_name;
+        if (name[0] == '.')
+        {
+            continue;
+        }
+        if (prefix && strncmp(name, prefix, prefix_len) != 0)
+        {
+            continue;
+        }
+        victims.emplace_back(name);
+    }
+    closedir(dir);
+
+    for (const auto &name : victims)
+    {
+        char full[256] = {0};
+        snprintf(full, sizeof(full), "%s/%s", kFrameCacheDir, name.c_str());
+        (void)remove(full);
+    }
+
+    if (!victims.empty())
+    {
+        ESP_LOGI(TAG, "Frame cache: removed %u entr%s (%s)", (unsigned)victims.size(),
+                 victims.size() == 1 ? "y" : "ies", prefix ? prefix : "all");
+    }
+}
+
+static void server_bsp_frame_cache_invalidate_photo(const char *id)
+{
+    if (!id || id[0] == '\0')
+    {
+        return;
+    }
+
+    // Variant files are named <id>_L_..., <id>_P_..., <id>_S_... (legacy: <id>_r<rot>).
+    char prefix[72] = {0};
+    snprintf(prefix, sizeof(prefix), "%s_", id);
+    server_bsp_frame_cache_remove_matching(prefix);
+}
+
+static void server_bsp_frame_cache_purge(void)
+{
+    server_bsp_frame_cache_remove_matching(NULL);
+}
+
 static bool server_bsp_photo_id_is_safe(const char *id)
 {
     if (!id || id[0] == '\0')
@@ -514,14 +897,8 @@ static LibraryPhoto *server_bsp_find_photo_locked(const char *id)
         return nullptr;
     }
 
-    for (auto &p : s_library_photos)
-    {
-        if (p.id == id)
-        {
-            return &p;
-        }
-    }
-    return nullptr;
+    auto it = s_library_photos.find(id);
+    return (it != s_library_photos.end()) ? &it->second : nullptr;
 }
 
 static LibraryPhoto *server_bsp_get_or_create_photo_locked(const char *id)
@@ -537,13 +914,67 @@ static LibraryPhoto *server_bsp_get_or_create_photo_locked(const char *id)
         return p;
     }
 
-    s_library_photos.push_back(LibraryPhoto{std::string(id), std::string(), std::string()});
-    return &s_library_photos.back();
+    auto res = s_library_photos.emplace(std::string(id), LibraryPhoto{std::string(id), std::string(), std::string()});
+    return &res.first->second;
+}
+
+static void server_bsp_reindex_order_locked(void)
+{
+    s_library_order_pos.clear();
+    s_library_order_pos.reserve(s_library_order.size());
+    for (size_t i = 0; i < s_library_order.size(); i++)
+    {
+        s_library_order_pos[s_library_order[i]] = i;
+    }
+}
+
+static bool server_bsp_order_find_locked(const char *id, size_t *out_pos)
+{
+    if (!id)
+    {
+        return false;
+    }
+    auto it = s_library_order_pos.find(id);
+    if (it == s_library_order_pos.end())
+    {
+        return false;
+    }
+    if (out_pos)
+    {
+        *out_pos = it->second;
+    }
+    return true;
+}
+
+static void server_bsp_order_append_locked(const std::string &id)
+{
+    if (s_library_order_pos.count(id) != 0)
+    {
+        return;
+    }
+    s_library_order_pos[id] = s_library_order.size();
+    s_library_order.push_back(id);
+}
+
+static void server_bsp_remove_photo_locked(const std::string &id)
+{
+    size_t pos = 0;
+    if (server_bsp_order_find_locked(id.c_str(), &pos))
+    {
+        s_library_order.erase(s_library_order.begin() + (ptrdiff_t)pos);
+        s_library_order_pos.erase(id);
+        for (size_t i = pos; i < s_library_order.size(); i++)
+        {
+            s_library_order_pos[s_library_order[i]] = i;
+        }
+    }
+    s_library_photos.erase(id);
 }
 
 static void server_bsp_sort_order_locked(void)
 {
     std::sort(s_library_order.begin(), s_library_order.end());
+    server_bsp_reindex_order_locked();
 }
 
 static bool server_bsp_file_exists(const char *path)
@@ -566,7 +997,7 @@ static bool server_bsp_extract_photo_id_from_filename(const char *name, char *ou
     const char *end = strstr(name, "_r");
     if (!end)
     {
-        // Also accept IDs without _r (fallback images etc) by stripping .bmp.
+        // Also accept IDs without _r (fallback images etc) by stripping the extension.
         const char *dot = strrchr(name, '.');
         if (!dot)
         {
@@ -603,7 +1034,7 @@ static const char *server_bsp_choose_fallback_path(uint16_t rotation_deg)
         return preferred;
     }
 
-    // If preferred file doesn't exist, fall back to any BMP in the fallback dir.
+    // If preferred file doesn't exist, fall back to any photo in the fallback dir.
     DIR *dir = opendir(kFallbackDir);
     if (!dir)
     {
@@ -621,7 +1052,7 @@ static const char *server_bsp_choose_fallback_path(uint16_t rotation_deg)
         {
             continue;
         }
-        if (!server_bsp_ends_with_ignore_case(n, ".bmp"))
+        if (!server_bsp_photo_ext_is_supported(n))
         {
             continue;
         }
@@ -647,34 +1078,37 @@ static const char *server_bsp_choose_fallback_path(uint16_t rotation_deg)
     return chosen;
 }
 
+static void server_bsp_library_changed_locked(void)
+{
+    s_library_generation++;
+}
+
 static void server_bsp_clear_library_locked(void)
 {
+    server_bsp_library_changed_locked();
     s_library_photos.clear();
     s_library_order.clear();
+    s_library_order_pos.clear();
 }
 
 static bool server_bsp_library_has_id_locked(const std::string &id)
 {
-    for (const auto &p : s_library_photos)
-    {
-        if (p.id == id)
-        {
-            return true;
-        }
-    }
-    return false;
+    return s_library_photos.count(id) != 0;
 }
 
+// Drops unknown and duplicate IDs from the order and rebuilds the position index.
 static void server_bsp_library_filter_order_locked(void)
 {
     std::vector<std::string> filtered;
     filtered.reserve(s_library_order.size());
+    s_library_order_pos.clear();
 
-    for (const auto &id : s_library_order)
+    for (auto &id : s_library_order)
     {
-        if (server_bsp_library_has_id_locked(id))
+        if (server_bsp_library_has_id_locked(id) && s_library_order_pos.count(id) == 0)
         {
-            filtered.push_back(id);
+            s_library_order_pos[id] = filtered.size();
+            filtered.push_back(std::move(id));
         }
     }
 
@@ -683,131 +1117,167 @@ static void server_bsp_library_filter_order_locked(void)
 
 static void server_bsp_library_ensure_order_contains_all_photos_locked(void)
 {
-    for (const auto &p : s_library_photos)
+    // Map iteration order is arbitrary; append the missing IDs sorted so the result is stable.
+    std::vector<std::string> missing;
+    for (const auto &kv : s_library_photos)
     {
-        bool found = false;
-        for (const auto &id : s_library_order)
-        {
-            if (id == p.id)
-            {
-                found = true;
-                break;
-            }
-        }
-        if (!found)
+        if (s_library_order_pos.count(kv.first) == 0)
         {
-            s_library_order.push_back(p.id);
+            missing.push_back(kv.first);
         }
     }
+    std::sort(missing.begin(), missing.end());
+    for (const auto &id : missing)
+    {
+        server_bsp_order_append_locked(id);
+    }
 }
 
-static void server_bsp_merge_with_sd_locked(void)
+static void server_bsp_photo_dir_changed(void)
 {
-    DIR *dir = opendir(kUserPhotoDir);
-    if (!dir)
+    portENTER_CRITICAL(&s_state_mux);
+    s_photo_dir_writes++;
+    portEXIT_CRITICAL(&s_state_mux);
+}
+
+// Returns the photo directory listing, re-reading it only if it may have changed.
+static const sdcard_scan_t *server_bsp_scan_photo_dir_locked(void)
+{
+    if (!s_photo_dir_scan_ready)
     {
-        return;
+        sdcard_scan_init(&s_photo_dir_scan, kUserPhotoDir);
+        s_photo_dir_scan_ready = true;
     }
 
-    struct dirent *ent = NULL;
-    while ((ent = readdir(dir)) != NULL)
+    portENTER_CRITICAL(&s_state_mux);
+    const uint32_t writes = s_photo_dir_writes;
+    portEXIT_CRITICAL(&s_state_mux);
+    if (writes != s_photo_dir_scanned_writes)
     {
-        const char *name = ent->d_name;
-        if (!name || name[0] == '.')
-        {
-            continue;
-        }
-        if (!server_bsp_photo_name_is_safe(name))
-        {
-            continue;
-        }
+        sdcard_scan_invalidate(&s_photo_dir_scan);
+        s_photo_dir_scanned_writes = writes;
+    }
 
-        char id[64] = {0};
-        if (!server_bsp_extract_photo_id_from_filename(name, id, sizeof(id)))
-        {
-            continue;
-        }
+    if (sdcard_scan_refresh(&s_photo_dir_scan) != ESP_OK)
+    {
+        return NULL;
+    }
+    return &s_photo_dir_scan;
+}
 
-        LibraryPhoto *p = server_bsp_get_or_create_photo_locked(id);
-        if (!p)
-        {
-            continue;
-        }
+// Registers a photo file found on the card as a variant of the id in its name; the first
+// file seen for an orientation wins. Returns NULL for files that aren't photos.
+static LibraryPhoto *server_bsp_add_photo_file_locked(const char *name)
+{
+    if (!name || name[0] == '.')
+    {
+        return NULL;
+    }
+    if (!server_bsp_photo_name_is_safe(name))
+    {
+        return NULL;
+    }
 
-        const bool has_P = (strstr(name, "_P_") != NULL);
-        const bool has_L = (strstr(name, "_L_") != NULL);
+    char id[64] = {0};
+    if (!server_bsp_extract_photo_id_from_filename(name, id, sizeof(id)))
+    {
+        return NULL;
+    }
 
-        bool is_portrait = false;
-        if (has_P)
-        {
-            is_portrait = true;
-        }
-        else if (has_L)
-        {
-            is_portrait = false;
-        }
-        else
-        {
-            const uint16_t rot = server_bsp_parse_rotation_from_filename(name, 0);
-            is_portrait = (rot == 90 || rot == 270);
-        }
+    LibraryPhoto *p = server_bsp_get_or_create_photo_locked(id);
+    if (!p)
+    {
+        return NULL;
+    }
 
-        if (is_portrait)
+    const bool has_P = (strstr(name, "_P_") != NULL);
+    const bool has_L = (strstr(name, "_L_") != NULL);
+
+    bool is_portrait = false;
+    if (has_P)
+    {
+        is_portrait = true;
+    }
+    else if (has_L)
+    {
+        is_portrait = false;
+    }
+    else
+    {
+        const uint16_t rot = server_bsp_parse_rotation_from_filename(name, 0);
+        is_portrait = (rot == 90 || rot == 270);
+    }
+
+    if (is_portrait)
+    {
+        if (p->portrait.empty())
         {
-            if (p->portrait.empty())
-            {
-                p->portrait = name;
-            }
+            p->portrait = name;
         }
-        else
+    }
+    else
+    {
+        if (p->landscape.empty())
         {
-            if (p->landscape.empty())
-            {
-                p->landscape = name;
-            }
+            p->landscape = name;
         }
+    }
+
+    return p;
+}
+
+static void server_bsp_merge_with_sd_locked(void)
+{
+    const sdcard_scan_t *scan = server_bsp_scan_photo_dir_locked();
+    if (!scan)
+    {
+        return;
+    }
 
-        if (!server_bsp_library_has_id_locked(p->id))
+    for (const char *name = sdcard_scan_next(scan, NULL); name; name = sdcard_scan_next(scan, name))
+    {
+        LibraryPhoto *p = server_bsp_add_photo_file_locked(name);
+        if (p)
         {
-            s_library_order.push_back(p->id);
+            server_bsp_order_append_locked(p->id);
         }
     }
+    s_library_scan_generation = scan->generation;
 
-    closedir(dir);
     server_bsp_library_filter_order_locked();
     server_bsp_library_ensure_order_contains_all_photos_locked();
 }
 
-static bool server_bsp_load_library_from_sd_locked(void)
+// Parses library.json into the in-memory library. Returns false (library untouched)
+// if the file is missing or unreadable.
+static bool server_bsp_load_library_json_locked(void)
 {
     FILE *fp = fopen(kLibraryPath, "r");
+    if (!fp && rename(kLibraryTmpPath, kLibraryPath) == 0)
+    {
+        // Power was lost between removing the old file and renaming the new one.
+        fp = fopen(kLibraryPath, "r");
+    }
     if (!fp)
     {
-        // If no library.json, we'll merge from SD later.
-        server_bsp_clear_library_locked();
-        server_bsp_merge_with_sd_locked();
-        return !s_library_photos.empty();
+        return false;
     }
 
     fseek(fp, 0, SEEK_END);
     long sz = ftell(fp);
     fseek(fp, 0, SEEK_SET);
 
-    if (sz <= 0 || sz > (64 * 1024))
+    if (sz <= 0 || sz > kLibraryMaxBytes)
     {
         fclose(fp);
-        server_bsp_clear_library_locked();
-        server_bsp_merge_with_sd_locked();
-        return !s_library_photos.empty();
+        return false;
     }
 
     char *buf = (char *)malloc((size_t)sz + 1);
     if (!buf)
     {
         fclose(fp);
-        server_bsp_clear_library_locked();
-        server_bsp_merge_with_sd_locked();
-        return !s_library_photos.empty();
+        return false;
     }
 
     const size_t rd = fread(buf, 1, (size_t)sz, fp);
@@ -819,9 +1289,7 @@ static bool server_bsp_load_library_from_sd_locked(void)
     free(buf);
     if (!root)
     {
-        server_bsp_clear_library_locked();
-        server_bsp_merge_with_sd_locked();
-        return !s_library_photos.empty();
+        return false;
     }
 
     server_bsp_clear_library_locked();
@@ -867,6 +1335,14 @@ static bool server_bsp_load_library_from_sd_locked(void)
             {
                 p->portrait = jport->valuestring;
             }
+
+            // Optional; absent means the global mode.
+            GUI_DitherMode mode;
+            const cJSON *jdither = cJSON_GetObjectItem(item, "dither");
+            if (cJSON_IsString(jdither) && GUI_Dither_ModeFromName(jdither->valuestring, &mode))
+            {
+                p->dither = (uint8_t)mode;
+            }
         }
     }
 
@@ -891,13 +1367,282 @@ static bool server_bsp_load_library_from_sd_locked(void)
             // Only include IDs we actually have photo records for.
             if (server_bsp_find_photo_locked(id) != nullptr)
             {
-                s_library_order.push_back(id);
+                server_bsp_order_append_locked(id);
             }
         }
     }
 
     cJSON_Delete(root);
+    return true;
+}
+
+// Journal records, one per line:
+//   P <id> <landscape|-> <portrait|-> [dither]   add/update a photo (new IDs go to the end
+//                                                of the order); no dither = global mode
+//   D <id>                                       remove a photo
+// Replaying a record twice is harmless, so the journal is only removed after library.json
+// has been rewritten. A line is only applied once its newline is there: a torn append can
+// leave e.g. "P <id> <landscape> <portr", which would otherwise clear a valid variant.
+static void server_bsp_journal_apply_line_locked(char *line)
+{
+    char *save = NULL;
+    const char *op = strtok_r(line, " \r\n", &save);
+    const char *id = strtok_r(NULL, " \r\n", &save);
+    if (!op || !id || !server_bsp_photo_id_is_safe(id))
+    {
+        return;
+    }
+
+    if (strcmp(op, "D") == 0)
+    {
+        server_bsp_remove_photo_locked(id);
+        return;
+    }
+    if (strcmp(op, "P") != 0)
+    {
+        return;
+    }
 
+    const char *land = strtok_r(NULL, " \r\n", &save);
+    const char *port = strtok_r(NULL, " \r\n", &save);
+    const char *dither = strtok_r(NULL, " \r\n", &save);
+    if (!land || !port)
+    {
+        return;
+    }
+
+    LibraryPhoto *p = server_bsp_get_or_create_photo_locked(id);
+    if (!p)
+    {
+        return;
+    }
+    p->landscape = server_bsp_photo_name_is_safe(land) ? land : "";
+    p->portrait = server_bsp_photo_name_is_safe(port) ? port : "";
+
+    GUI_DitherMode mode;
+    p->dither = GUI_Dither_ModeFromName(dither, &mode) ? (uint8_t)mode : kPhotoDitherDefault;
+    server_bsp_order_append_locked(p->id);
+}
+
+static void server_bsp_replay_journal_locked(void)
+{
+    s_library_journal_records = 0;
+    s_library_journal_torn = false;
+
+    FILE *fp = fopen(kLibraryJournalPath, "r");
+    if (!fp)
+    {
+        return;
+    }
+
+    char line[384];
+    bool partial = false; // the previous read ended without a newline
+    while (fgets(line, sizeof(line), fp))
+    {
+        const bool complete = (strchr(line, '\n') != NULL);
+        if (complete && !partial)
+        {
+            server_bsp_journal_apply_line_locked(line);
+            s_library_journal_records++;
+        }
+        else if (complete)
+        {
+            // Rest of a line longer than any record we write.
+            ESP_LOGW(TAG, "Skipping overlong library journal line");
+        }
+        partial = !complete;
+    }
+    fclose(fp);
+
+    s_library_journal_torn = partial;
+    if (s_library_journal_torn)
+    {
+        ESP_LOGW(TAG, "Library journal ends in a torn record; skipped");
+    }
+    ESP_LOGI(TAG, "Replayed %u library journal records", (unsigned)s_library_journal_records);
+}
+
+// Loads library.idx with a single read into one buffer. Returns false (library cleared)
+// if the file is missing, from another version, or fails the size/CRC checks.
+static bool server_bsp_load_library_index_locked(void)
+{
+    FILE *fp = fopen(kLibraryIndexPath, "rb");
+    if (!fp)
+    {
+        return false;
+    }
+    setvbuf(fp, NULL, _IONBF, 0);
+
+    fseek(fp, 0, SEEK_END);
+    const long sz = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    if (sz < (long)sizeof(LibraryIndexHeader) || sz > kLibraryMaxBytes)
+    {
+        fclose(fp);
+        return false;
+    }
+
+    uint8_t *buf = (uint8_t *)malloc((size_t)sz);
+    if (!buf)
+    {
+        fclose(fp);
+        return false;
+    }
+
+    const size_t rd = fread(buf, 1, (size_t)sz, fp);
+    fclose(fp);
+
+    LibraryIndexHeader hdr;
+    memcpy(&hdr, buf, sizeof(hdr));
+
+    const size_t body_len = (size_t)sz - sizeof(hdr);
+    const size_t records_len = (hdr.count <= body_len / sizeof(LibraryIndexRecord))
+                                   ? (size_t)hdr.count * sizeof(LibraryIndexRecord)
+                                   : body_len + 1;
+    if (rd != (size_t)sz || hdr.magic != kLibraryIndexMagic || hdr.version != kLibraryIndexVersion ||
+        hdr.record_size != sizeof(LibraryIndexRecord) || hdr.pool_len == 0 || records_len > body_len ||
+        records_len + hdr.pool_len != body_len)
+    {
+        free(buf);
+        return false;
+    }
+
+    const uint8_t *body = buf + sizeof(hdr);
+    if (esp_rom_crc32_le(0, body, (uint32_t)body_len) != hdr.crc32)
+    {
+        ESP_LOGW(TAG, "library.idx checksum mismatch; falling back to library.json");
+        free(buf);
+        return false;
+    }
+
+    const char *pool = (const char *)(body + records_len);
+    if (pool[hdr.pool_len - 1] != '\0')
+    {
+        free(buf);
+        return false;
+    }
+
+    s_library_photos.reserve(hdr.count);
+    s_library_order.reserve(hdr.count);
+    s_library_order_pos.reserve(hdr.count);
+
+    bool ok = true;
+    for (uint32_t i = 0; i < hdr.count && ok; i++)
+    {
+        LibraryIndexRecord rec;
+        memcpy(&rec, body + (size_t)i * sizeof(rec), sizeof(rec));
+        if (rec.id >= hdr.pool_len || rec.landscape >= hdr.pool_len || rec.portrait >= hdr.pool_len)
+        {
+            ok = false;
+            break;
+        }
+
+        const char *id = pool + rec.id;
+        if (!server_bsp_photo_id_is_safe(id))
+        {
+            ok = false;
+            break;
+        }
+
+        LibraryPhoto *p = server_bsp_get_or_create_photo_locked(id);
+        if (!p)
+        {
+            ok = false;
+            break;
+        }
+        p->landscape = pool + rec.landscape;
+        p->portrait = pool + rec.portrait;
+        p->dither = (rec.dither < GUI_DITHER_MODE_COUNT) ? (uint8_t)rec.dither : kPhotoDitherDefault;
+        server_bsp_order_append_locked(p->id);
+    }
+
+    free(buf);
+    if (!ok)
+    {
+        server_bsp_clear_library_locked();
+    }
+    return ok;
+}
+
+static bool server_bsp_write_library_index_locked(void)
+{
+    std::vector<LibraryIndexRecord> records;
+    records.reserve(s_library_order.size());
+
+    std::string pool(1, '\0');
+    for (const auto &id : s_library_order)
+    {
+        const LibraryPhoto *p = server_bsp_find_photo_locked(id.c_str());
+        if (!p)
+        {
+            continue;
+        }
+
+        LibraryIndexRecord rec = {};
+        rec.id = (uint32_t)pool.size();
+        pool.append(p->id).push_back('\0');
+        if (!p->landscape.empty())
+        {
+            rec.landscape = (uint32_t)pool.size();
+            pool.append(p->landscape).push_back('\0');
+        }
+        if (!p->portrait.empty())
+        {
+            rec.portrait = (uint32_t)pool.size();
+            pool.append(p->portrait).push_back('\0');
+        }
+        rec.dither = p->dither;
+        records.push_back(rec);
+    }
+
+    const size_t records_len = records.size() * sizeof(LibraryIndexRecord);
+
+    LibraryIndexHeader hdr = {};
+    hdr.magic = kLibraryIndexMagic;
+    hdr.version = kLibraryIndexVersion;
+    hdr.record_size = sizeof(LibraryIndexRecord);
+    hdr.count = (uint32_t)records.size();
+    hdr.pool_len = (uint32_t)pool.size();
+    hdr.crc32 = esp_rom_crc32_le(0, (const uint8_t *)records.data(), (uint32_t)records_len);
+    hdr.crc32 = esp_rom_crc32_le(hdr.crc32, (const uint8_t *)pool.data(), (uint32_t)pool.size());
+
+    FILE *fp = fopen(kLibraryIndexPath, "wb");
+    if (!fp)
+    {
+        return false;
+    }
+
+    bool ok = (fwrite(&hdr, 1, sizeof(hdr), fp) == sizeof(hdr));
+    ok = ok && (records_len == 0 || fwrite(records.data(), 1, records_len, fp) == records_len);
+    ok = ok && (fwrite(pool.data(), 1, pool.size(), fp) == pool.size());
+    ok = (fclose(fp) == 0) && ok;
+    if (!ok)
+    {
+        remove(kLibraryIndexPath);
+    }
+    return ok;
+}
+
+static bool server_bsp_load_library_from_sd_locked(void)
+{
+    server_bsp_clear_library_locked();
+    if (server_bsp_load_library_index_locked())
+    {
+        server_bsp_replay_journal_locked();
+        server_bsp_library_filter_order_locked();
+        server_bsp_library_ensure_order_contains_all_photos_locked();
+        return !s_library_photos.empty();
+    }
+
+    if (!server_bsp_load_library_json_locked())
+    {
+        // If no usable library.json, we'll merge from SD later.
+        server_bsp_clear_library_locked();
+        server_bsp_merge_with_sd_locked();
+    }
+
+    server_bsp_replay_journal_locked();
     server_bsp_library_filter_order_locked();
     server_bsp_library_ensure_order_contains_all_photos_locked();
     return !s_library_photos.empty();
@@ -905,6 +1650,12 @@ static bool server_bsp_load_library_from_sd_locked(void)
 
 static bool server_bsp_write_library_to_sd_locked(void)
 {
+    server_bsp_library_changed_locked();
+
+    // An index that exists always matches library.json: drop it before the JSON changes
+    // and write it again afterwards.
+    remove(kLibraryIndexPath);
+
     cJSON *root = cJSON_CreateObject();
     if (!root)
     {
@@ -925,17 +1676,28 @@ static bool server_bsp_write_library_to_sd_locked(void)
     cJSON *photos = cJSON_AddArrayToObject(root, "photos");
     if (photos)
     {
-        for (const auto &p : s_library_photos)
+        // Written in display order so the file does not depend on hash-map iteration order.
+        for (const auto &id : s_library_order)
         {
+            const LibraryPhoto *p = server_bsp_find_photo_locked(id.c_str());
+            if (!p)
+            {
+                continue;
+            }
+
             cJSON *item = cJSON_CreateObject();
             if (!item)
             {
                 continue;
             }
 
-            cJSON_AddStringToObject(item, "id", p.id.c_str());
-            cJSON_AddStringToObject(item, "landscape", p.landscape.c_str());
-            cJSON_AddStringToObject(item, "portrait", p.portrait.c_str());
+            cJSON_AddStringToObject(item, "id", p->id.c_str());
+            cJSON_AddStringToObject(item, "landscape", p->landscape.c_str());
+            cJSON_AddStringToObject(item, "portrait", p->portrait.c_str());
+            if (p->dither < GUI_DITHER_MODE_COUNT)
+            {
+                cJSON_AddStringToObject(item, "dither", GUI_Dither_ModeName((GUI_DitherMode)p->dither));
+            }
             cJSON_AddItemToArray(photos, item);
         }
     }
@@ -948,7 +1710,7 @@ static bool server_bsp_write_library_to_sd_locked(void)
         return false;
     }
 
-    FILE *fp = fopen(kLibraryPath, "w");
+    FILE *fp = fopen(kLibraryTmpPath, "w");
     if (!fp)
     {
         cJSON_free(text);
@@ -957,88 +1719,101 @@ static bool server_bsp_write_library_to_sd_locked(void)
 
     const size_t len = strlen(text);
     const size_t wr = fwrite(text, 1, len, fp);
-    fclose(fp);
+    const bool closed = (fclose(fp) == 0);
     cJSON_free(text);
 
-    return (wr == len);
+    if (wr != len || !closed)
+    {
+        remove(kLibraryTmpPath);
+        return false;
+    }
+
+    // FATFS rename() does not replace an existing file.
+    remove(kLibraryPath);
+    if (rename(kLibraryTmpPath, kLibraryPath) != 0)
+    {
+        return false;
+    }
+
+    if (!server_bsp_write_library_index_locked())
+    {
+        ESP_LOGW(TAG, "Failed to write library.idx");
+    }
+
+    // Everything in the journal is now part of library.json.
+    remove(kLibraryJournalPath);
+    s_library_journal_records = 0;
+    s_library_journal_torn = false;
+    return true;
 }
 
-static void server_bsp_build_library_from_sd_scan_locked(void)
+static bool server_bsp_journal_append_locked(const char *line)
 {
-    server_bsp_clear_library_locked();
+    server_bsp_library_changed_locked();
 
-    DIR *dir = opendir(kUserPhotoDir);
-    if (!dir)
+    if (s_library_journal_records >= kLibraryJournalMaxRecords || s_library_journal_torn)
     {
-        return;
+        return server_bsp_write_library_to_sd_locked();
     }
 
-    struct dirent *ent = NULL;
-    while ((ent = readdir(dir)) != NULL)
+    FILE *fp = fopen(kLibraryJournalPath, "a");
+    if (!fp)
     {
-        const char *name = ent->d_name;
-        if (!name || name[0] == '.')
-        {
-            continue;
-        }
-        if (!server_bsp_photo_name_is_safe(name))
-        {
-            continue;
-        }
+        return server_bsp_write_library_to_sd_locked();
+    }
 
-        char id[64] = {0};
-        if (!server_bsp_extract_photo_id_from_filename(name, id, sizeof(id)))
-        {
-            continue;
-        }
+    const size_t len = strlen(line);
+    const size_t wr = fwrite(line, 1, len, fp);
+    const bool closed = (fclose(fp) == 0);
+    if (wr != len || !closed)
+    {
+        // A torn last line is skipped on replay; rewrite the full library instead (which
+        // also drops the journal; until then, nothing more is appended to it).
+        s_library_journal_torn = true;
+        return server_bsp_write_library_to_sd_locked();
+    }
 
-        LibraryPhoto *p = server_bsp_get_or_create_photo_locked(id);
-        if (!p)
-        {
-            continue;
-        }
+    s_library_journal_records++;
+    return true;
+}
 
-        const bool has_P = (strstr(name, "_P_") != NULL);
-        const bool has_L = (strstr(name, "_L_") != NULL);
+static bool server_bsp_journal_put_photo_locked(const LibraryPhoto &p)
+{
+    char line[384];
+    const bool has_dither = (p.dither < GUI_DITHER_MODE_COUNT);
+    snprintf(line, sizeof(line), "P %s %s %s%s%s\n", p.id.c_str(), p.landscape.empty() ? "-" : p.landscape.c_str(),
+             p.portrait.empty() ? "-" : p.portrait.c_str(), has_dither ? " " : "",
+             has_dither ? GUI_Dither_ModeName((GUI_DitherMode)p.dither) : "");
+    return server_bsp_journal_append_locked(line);
+}
 
-        bool is_portrait = false;
-        if (has_P)
-        {
-            is_portrait = true;
-        }
-        else if (has_L)
-        {
-            is_portrait = false;
-        }
-        else
-        {
-            const uint16_t rot = server_bsp_parse_rotation_from_filename(name, 0);
-            is_portrait = (rot == 90 || rot == 270);
-        }
+static bool server_bsp_journal_delete_photo_locked(const char *id)
+{
+    char line[96];
+    snprintf(line, sizeof(line), "D %s\n", id);
+    return server_bsp_journal_append_locked(line);
+}
 
-        if (is_portrait)
-        {
-            if (p->portrait.empty())
-            {
-                p->portrait = name;
-            }
-        }
-        else
-        {
-            if (p->landscape.empty())
-            {
-                p->landscape = name;
-            }
-        }
+static void server_bsp_build_library_from_sd_scan_locked(void)
+{
+    server_bsp_clear_library_locked();
 
-        // Order is derived from photo IDs (lexicographic) when no library.json exists.
+    const sdcard_scan_t *scan = server_bsp_scan_photo_dir_locked();
+    if (!scan)
+    {
+        return;
     }
 
-    closedir(dir);
+    for (const char *name = sdcard_scan_next(scan, NULL); name; name = sdcard_scan_next(scan, name))
+    {
+        (void)server_bsp_add_photo_file_locked(name);
+    }
+    s_library_scan_generation = scan->generation;
 
-    for (const auto &p : s_library_photos)
+    // Order is derived from photo IDs (lexicographic) when no library.json exists.
+    for (const auto &kv : s_library_photos)
     {
-        s_library_order.push_back(p.id);
+        s_library_order.push_back(kv.first);
     }
 
     server_bsp_sort_order_locked();
@@ -1120,17 +1895,10 @@ static void server_bsp_update_current_image_for_rotation(void)
     server_bsp_set_current_image_internal(full, img_rot);
 }
 
-static void server_bsp_save_current_photo_id_to_nvs(const char *id)
+// Persists s_current_photo_id (deferred; see server_bsp_flush_settings()).
+static void server_bsp_save_current_photo_id_to_nvs(void)
 {
-    nvs_handle_t nvs = 0;
-    if (nvs_open(kNvsNamespace, NVS_READWRITE, &nvs) != ESP_OK)
-    {
-        return;
-    }
-
-    nvs_set_str(nvs, kNvsKeyCurrentPhotoId, id ? id : "");
-    nvs_commit(nvs);
-    nvs_close(nvs);
+    server_bsp_nvs_mark_dirty(SERVER_BSP_NVS_DIRTY_CURRENT_PHOTO_ID);
 }
 
 static void server_bsp_set_current_photo_id_internal(const char *id)
@@ -1143,17 +1911,34 @@ static void server_bsp_set_current_photo_id_internal(const char *id)
     s_pending_new_photo_id[0] = '\0';
     portEXIT_CRITICAL(&s_state_mux);
 
-    server_bsp_save_current_photo_id_to_nvs(safe);
+    server_bsp_save_current_photo_id_to_nvs();
     server_bsp_update_current_image_for_rotation();
 }
 
 static void server_bsp_refresh_library_from_sd_locked(void)
 {
+    // An empty library sends every request through here; if the photo directory still
+    // lists what the last rebuild saw, reloading and rewriting library.json changes nothing.
+    if (s_library_photos.empty() && s_library_scan_generation != 0)
+    {
+        const sdcard_scan_t *scan = server_bsp_scan_photo_dir_locked();
+        if (scan && scan->generation == s_library_scan_generation)
+        {
+            return;
+        }
+    }
+
     if (!server_bsp_load_library_from_sd_locked())
     {
         server_bsp_build_library_from_sd_scan_locked();
         (void)server_bsp_write_library_to_sd_locked();
     }
+    else if (s_library_journal_records > 0 || s_library_journal_torn || !server_bsp_file_exists(kLibraryIndexPath))
+    {
+        // Compact on load so the journal (and any torn tail) never outlives a reboot, and
+        // (re)create a missing index so the next boot can skip the JSON parse.
+        (void)server_bsp_write_library_to_sd_locked();
+    }
 }
 
 static void server_bsp_ensure_library_loaded(void)
@@ -1213,14 +1998,7 @@ static void server_bsp_set_current_image_internal(const char *full_path, uint16_
     s_image_rotation_deg = img_rot;
     portEXIT_CRITICAL(&s_state_mux);
 
-    nvs_handle_t nvs = 0;
-    if (nvs_open(kNvsNamespace, NVS_READWRITE, &nvs) == ESP_OK)
-    {
-        nvs_set_str(nvs, kNvsKeyCurrentImage, s_current_image_path);
-        nvs_set_u16(nvs, kNvsKeyImageRotation, s_image_rotation_deg);
-        nvs_commit(nvs);
-        nvs_close(nvs);
-    }
+    server_bsp_nvs_mark_dirty(SERVER_BSP_NVS_DIRTY_CURRENT_IMAGE | SERVER_BSP_NVS_DIRTY_IMAGE_ROTATION);
 }
 
 static void server_bsp_load_state_from_nvs(void)
@@ -1248,6 +2026,7 @@ static void server_bsp_load_state_from_nvs(void)
     uint8_t slideshow_en_u8 = 0;
     uint32_t slideshow_interval_s = 0;
     uint8_t status_icons_u8 = 0;
+    uint8_t dither_u8 = 0;
 
     const esp_err_t err_rot = nvs_get_u16(nvs, kNvsKeyRotation, &rot);
     const esp_err_t err_img = nvs_get_u16(nvs, kNvsKeyImageRotation, &img_rot);
@@ -1262,6 +2041,7 @@ static void server_bsp_load_state_from_nvs(void)
     const esp_err_t err_sl_int = nvs_get_u32(nvs, kNvsKeySlideshowIntervalS, &slideshow_interval_s);
 
     const esp_err_t err_icons = nvs_get_u8(nvs, kNvsKeyStatusIcons, &status_icons_u8);
+    const esp_err_t err_dither = nvs_get_u8(nvs, kNvsKeyDitherMode, &dither_u8);
 
     nvs_close(nvs);
 
@@ -1320,6 +2100,15 @@ static void server_bsp_load_state_from_nvs(void)
     {
         s_status_icons = 0;
     }
+
+    if (err_dither == ESP_OK && dither_u8 < GUI_DITHER_MODE_COUNT)
+    {
+        s_dither_mode = dither_u8;
+    }
+    else
+    {
+        s_dither_mode = GUI_DITHER_FLOYD_STEINBERG;
+    }
 }
 
 esp_err_t server_bsp_select_next_photo(void)
@@ -1352,35 +2141,218 @@ esp_err_t server_bsp_select_next_photo(void)
         portEXIT_CRITICAL(&s_state_mux);
     }
 
-    size_t idx = 0;
-    bool found = false;
-    for (size_t i = 0; i < s_library_order.size(); i++)
+    size_t idx = 0;
+    const bool found = server_bsp_order_find_locked(cur_id, &idx);
+
+    size_t next_idx = 0;
+    if (found)
+    {
+        next_idx = (idx + 1) % s_library_order.size();
+    }
+
+    next_id = s_library_order[next_idx];
+    xSemaphoreGive(s_library_mutex);
+
+    if (next_id.empty())
+    {
+        server_bsp_set_current_photo_id_internal("");
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    server_bsp_set_current_photo_id_internal(next_id.c_str());
+    return ESP_OK;
+}
+
+// Photos for the next few slideshow/key wakes, resolved before deep sleep so those wakes
+// can skip the library load. Entries are consumed in order; each one follows `base_id`.
+#define SERVER_BSP_WAKE_PLAN_DEPTH 4
+
+struct WakePlanEntry
+{
+    char id[64];
+    char name[128];
+    uint16_t img_rot;
+    uint8_t dither; // LibraryPhoto::dither
+};
+
+struct WakePlan
+{
+    uint32_t magic;
+    uint32_t generation;
+    uint16_t rotation;
+    uint8_t head;
+    uint8_t count;
+    char base_id[64];
+    WakePlanEntry entries[SERVER_BSP_WAKE_PLAN_DEPTH];
+};
+
+static const uint32_t kWakePlanMagic = 0x57504C4Eu; // "WPLN"
+RTC_DATA_ATTR static WakePlan s_wake_plan;
+
+// Changes whenever the library files or the photos on SD change (from this firmware or from
+// a PC while the frame was asleep). FAT leaves the photo directory's mtime alone when files
+// come and go, so its listing is hashed: one directory read plus three stats, still far
+// cheaper than loading the library. Call with s_library_mutex held.
+static uint32_t server_bsp_library_generation_locked(void)
+{
+    const char *paths[] = {kLibraryPath, kLibraryIndexPath, kLibraryJournalPath};
+    uint32_t h = 2166136261u;
+    for (const char *path : paths)
+    {
+        struct stat st = {};
+        const bool ok = (stat(path, &st) == 0);
+        const uint32_t parts[2] = {ok ? (uint32_t)st.st_size : 0xFFFFFFFFu, ok ? (uint32_t)st.st_mtime : 0u};
+        for (uint32_t v : parts)
+        {
+            h = (h ^ v) * 16777619u;
+        }
+    }
+    const sdcard_scan_t *scan = server_bsp_scan_photo_dir_locked();
+    h = (h ^ (scan ? scan->hash : 0xFFFFFFFFu)) * 16777619u;
+    return h;
+}
+
+void server_bsp_prepare_wake_plan(void)
+{
+    if (!s_library_mutex)
+    {
+        return;
+    }
+
+    // After a fast wake the library was never loaded; keep the rest of the existing plan.
+    if (!s_state_initialized)
+    {
+        return;
+    }
+
+    WakePlan plan = {};
+    plan.magic = kWakePlanMagic;
+    plan.rotation = s_rotation_deg;
+
+    portENTER_CRITICAL(&s_state_mux);
+    snprintf(plan.base_id, sizeof(plan.base_id), "%.*s", (int)sizeof(plan.base_id) - 1, s_current_photo_id);
+    portEXIT_CRITICAL(&s_state_mux);
+
+    const bool want_portrait = (plan.rotation == 90 || plan.rotation == 270);
+
+    if (xSemaphoreTake(s_library_mutex, pdMS_TO_TICKS(2000)) != pdTRUE)
+    {
+        s_wake_plan.magic = 0;
+        return;
+    }
+
+    const size_t n = s_library_order.size();
+    size_t pos = 0;
+    const size_t start = server_bsp_order_find_locked(plan.base_id, &pos) ? pos + 1 : 0;
+    for (size_t k = 0; n > 0 && k < SERVER_BSP_WAKE_PLAN_DEPTH; k++)
+    {
+        const LibraryPhoto *p = server_bsp_find_photo_locked(s_library_order[(start + k) % n].c_str());
+        if (!p)
+        {
+            break;
+        }
+
+        const std::string &preferred = want_portrait ? p->portrait : p->landscape;
+        const std::string &secondary = want_portrait ? p->landscape : p->portrait;
+        const std::string &name = !preferred.empty() ? preferred : secondary;
+        if (name.empty() || name.size() >= sizeof(plan.entries[0].name))
+        {
+            // Let the full path pick the fallback frame.
+            break;
+        }
+
+        WakePlanEntry &e = plan.entries[k];
+        snprintf(e.id, sizeof(e.id), "%s", p->id.c_str());
+        snprintf(e.name, sizeof(e.name), "%s", name.c_str());
+        e.img_rot = server_bsp_parse_rotation_from_filename(e.name, want_portrait ? 90 : 0);
+        e.dither = p->dither;
+        plan.count++;
+    }
+
+    plan.generation = server_bsp_library_generation_locked();
+    xSemaphoreGive(s_library_mutex);
+
+    s_wake_plan = plan;
+    ESP_LOGI(TAG, "Wake plan: %u photos after '%s'", (unsigned)plan.count, plan.base_id);
+}
+
+bool server_bsp_advance_from_wake_plan(bool require_slideshow)
+{
+    if (s_state_initialized)
+    {
+        return false;
+    }
+
+    if (!s_library_mutex)
+    {
+        s_library_mutex = xSemaphoreCreateMutex();
+        s_library_generation = esp_random();
+    }
+    server_bsp_nvs_flush_init();
+
+    server_bsp_load_state_from_nvs();
+
+    WakePlan &plan = s_wake_plan;
+    const char *why = NULL;
+    if (plan.magic != kWakePlanMagic || plan.count == 0 || plan.head >= SERVER_BSP_WAKE_PLAN_DEPTH)
+    {
+        why = "no plan";
+    }
+    else if (require_slideshow && !s_slideshow_enabled)
+    {
+        why = "slideshow off";
+    }
+    else if (plan.rotation != s_rotation_deg || strcmp(plan.base_id, s_current_photo_id) != 0)
+    {
+        why = "state changed";
+    }
+    else if (xSemaphoreTake(s_library_mutex, pdMS_TO_TICKS(2000)) != pdTRUE)
+    {
+        why = "library busy";
+    }
+    else
+    {
+        const uint32_t generation = server_bsp_library_generation_locked();
+        xSemaphoreGive(s_library_mutex);
+        if (generation != plan.generation)
+        {
+            why = "library changed";
+        }
+    }
+
+    char full[192] = {0};
+    const WakePlanEntry *e = why ? NULL : &plan.entries[plan.head];
+    if (e)
     {
-        if (s_library_order[i] == cur_id)
+        snprintf(full, sizeof(full), "%s/%s", kUserPhotoDir, e->name);
+        if (!server_bsp_file_exists(full))
         {
-            idx = i;
-            found = true;
-            break;
+            why = "file missing";
         }
     }
 
-    size_t next_idx = 0;
-    if (found)
+    if (why)
     {
-        next_idx = (idx + 1) % s_library_order.size();
+        ESP_LOGI(TAG, "Wake plan not used (%s)", why);
+        plan.magic = 0;
+        return false;
     }
 
-    next_id = s_library_order[next_idx];
-    xSemaphoreGive(s_library_mutex);
+    portENTER_CRITICAL(&s_state_mux);
+    snprintf(s_current_photo_id, sizeof(s_current_photo_id), "%s", e->id);
+    s_pending_new_photo_id[0] = '\0';
+    s_wake_photo_dither = e->dither;
+    portEXIT_CRITICAL(&s_state_mux);
 
-    if (next_id.empty())
-    {
-        server_bsp_set_current_photo_id_internal("");
-        return ESP_ERR_NOT_FOUND;
-    }
+    server_bsp_save_current_photo_id_to_nvs();
+    server_bsp_set_current_image_internal(full, e->img_rot);
 
-    server_bsp_set_current_photo_id_internal(next_id.c_str());
-    return ESP_OK;
+    snprintf(plan.base_id, sizeof(plan.base_id), "%s", e->id);
+    plan.head++;
+    plan.count--;
+
+    ESP_LOGI(TAG, "Wake plan: showing '%s' (%u left)", e->id, (unsigned)plan.count);
+    return true;
 }
 
 // Static web UI is served from the SD card under:
@@ -1389,8 +2361,8 @@ esp_err_t server_bsp_select_next_photo(void)
 //   sd-content/web-app/
 
 #define MIN(x, y) ((x < y) ? (x) : (y))
-#define READ_LEN_MAX (10 * 1024) // Buffer area for receiving data
-#define SEND_LEN_MAX (5 * 1024)  // Data for sending response
+#define SEND_LEN_MAX (16 * 1024) // SD file chunk per send (a multiple of the 512-byte sector)
+#define UPLOAD_PIPE_BUF_BYTES (16 * 1024) // Receive buffer handed to the upload writer task
 
 EventGroupHandle_t server_groups = NULL;
 
@@ -1410,6 +2382,14 @@ esp_err_t post_slideshow_callback(httpd_req_t *req);
 esp_err_t get_status_icons_callback(httpd_req_t *req);
 esp_err_t post_status_icons_callback(httpd_req_t *req);
 
+// Dither mode API
+esp_err_t get_dither_callback(httpd_req_t *req);
+esp_err_t post_dither_callback(httpd_req_t *req);
+
+// Diagnostics API
+esp_err_t get_bench_static_callback(httpd_req_t *req);
+esp_err_t get_bench_dither_callback(httpd_req_t *req);
+
 // Photo management API
 esp_err_t get_photos_callback(httpd_req_t *req);
 esp_err_t get_photos_file_callback(httpd_req_t *req);
@@ -1452,12 +2432,16 @@ void server_bsp_init_state(void)
     if (!s_library_mutex)
     {
         s_library_mutex = xSemaphoreCreateMutex();
+        s_library_generation = esp_random();
     }
+    server_bsp_nvs_flush_init();
 
     // Ensure SD layout exists.
     server_bsp_ensure_dir("/sdcard/user");
     server_bsp_ensure_dir(kUserPhotoDir);
+    server_bsp_ensure_dir(kFrameCacheDir);
     server_bsp_ensure_dir(kFallbackDir);
+    server_bsp_sweep_upload_temp_files();
 
     server_bsp_load_state_from_nvs();
 
@@ -1592,6 +2576,18 @@ void http_server_init(void)
     uri_icons.handler = post_status_icons_callback;
     httpd_register_uri_handler(server, &uri_icons);
 
+    // Dither mode API
+    httpd_uri_t uri_dither = {};
+    uri_dither.uri = "/api/dither";
+    uri_dither.user_ctx = NULL;
+    uri_dither.method = HTTP_GET;
+    uri_dither.handler = get_dither_callback;
+    httpd_register_uri_handler(server, &uri_dither);
+
+    uri_dither.method = HTTP_POST;
+    uri_dither.handler = post_dither_callback;
+    httpd_register_uri_handler(server, &uri_dither);
+
     // Photo management API
     httpd_uri_t uri_photos = {};
     uri_photos.user_ctx = NULL;
@@ -1631,6 +2627,18 @@ void http_server_init(void)
     uri_photos.handler = post_photos_upload_callback;
     httpd_register_uri_handler(server, &uri_photos);
 
+    // Diagnostics API
+    httpd_uri_t uri_bench = {};
+    uri_bench.uri = "/api/bench/static";
+    uri_bench.method = HTTP_GET;
+    uri_bench.handler = get_bench_static_callback;
+    uri_bench.user_ctx = NULL;
+    httpd_register_uri_handler(server, &uri_bench);
+
+    uri_bench.uri = "/api/bench/dither";
+    uri_bench.handler = get_bench_dither_callback;
+    httpd_register_uri_handler(server, &uri_bench);
+
     httpd_uri_t uri_post = {};
     uri_post.uri = "/dataUP";
     uri_post.method = HTTP_POST;
@@ -1691,126 +2699,529 @@ static const char *server_bsp_content_type_for_path(const char *path)
     return "application/octet-stream";
 }
 
+// Per-request read buffer. Internal DMA-capable RAM lets FATFS read whole sectors
+// straight into it; PSRAM is the fallback when internal memory is tight.
+static char *server_bsp_alloc_file_chunk(void)
+{
+    char *buf = (char *)heap_caps_malloc(SEND_LEN_MAX, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (!buf)
+    {
+        buf = (char *)heap_caps_malloc(SEND_LEN_MAX, MALLOC_CAP_SPIRAM);
+    }
+    return buf;
+}
+
+// Opens an SD file for sequential whole-chunk reads (no stdio buffer, so no extra copy).
+static FILE *server_bsp_open_sd_file(const char *sd_path)
+{
+    FILE *fp = fopen(sd_path, "rb");
+    if (fp)
+    {
+        setvbuf(fp, NULL, _IONBF, 0);
+    }
+    return fp;
+}
+
 static esp_err_t server_bsp_send_sd_file(httpd_req_t *req, const char *sd_path)
 {
-    char *resp_str = (char *)heap_caps_malloc(SEND_LEN_MAX + 1, MALLOC_CAP_SPIRAM);
-    if (!resp_str)
+    FILE *fp = server_bsp_open_sd_file(sd_path);
+    if (!fp)
+    {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Not found on SD");
+        return ESP_OK;
+    }
+
+    char *buf = server_bsp_alloc_file_chunk();
+    if (!buf)
     {
+        fclose(fp);
         httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
         return ESP_OK;
     }
 
-    size_t off = 0;
-    size_t len = sdcard_read_offset(sd_path, resp_str, SEND_LEN_MAX, off);
-    if (len == 0)
+    const int64_t t0 = esp_timer_get_time();
+    size_t total = 0;
+    esp_err_t send_err = ESP_OK;
+    for (;;)
+    {
+        const size_t len = fread(buf, 1, SEND_LEN_MAX, fp);
+        if (len == 0)
+        {
+            break;
+        }
+
+        send_err = httpd_resp_send_chunk(req, buf, len);
+        if (send_err != ESP_OK)
+        {
+            // Common case: client navigated away / disconnected while we were streaming.
+            // Stop reading/sending to avoid spamming httpd_txrx send() errors.
+            ESP_LOGW(TAG, "Failed to send chunk for %s (%d)", sd_path, (int)send_err);
+            break;
+        }
+        total += len;
+    }
+    fclose(fp);
+
+    if (send_err == ESP_OK)
+    {
+        (void)httpd_resp_send_chunk(req, NULL, 0);
+    }
+
+    heap_caps_free(buf);
+
+    ESP_LOGI(TAG, "Served SD file: %s (%u bytes, %lld ms)", sd_path, (unsigned)total,
+             (long long)((esp_timer_get_time() - t0) / 1000));
+
+    // If the socket is already broken, returning ESP_FAIL tells httpd to close it.
+    return (send_err == ESP_OK) ? ESP_OK : ESP_FAIL;
+}
+
+static bool server_bsp_uri_is_safe(const char *uri)
+{
+    // Very small allowlist: block path traversal and backslashes.
+    if (strstr(uri, "..") != NULL)
+    {
+        return false;
+    }
+    if (strchr(uri, '\\') != NULL)
+    {
+        return false;
+    }
+    return true;
+}
+
+static void server_bsp_normalize_uri_path(const char *uri, char *out_path, size_t out_path_len)
+{
+    // Strip query string ("?foo=bar") if present.
+    const char *q = strchr(uri, '?');
+    const size_t uri_len = q ? (size_t)(q - uri) : strlen(uri);
+
+    // Root -> /index.html
+    if (uri_len == 1 && uri[0] == '/')
+    {
+        snprintf(out_path, out_path_len, "%s/index.html", kSdWebRoot);
+        return;
+    }
+
+    // Copy the path part into a small buffer so we can check trailing '/'.
+    char tmp[128] = {0};
+    snprintf(tmp, sizeof(tmp), "%.*s", (int)uri_len, uri);
+
+    if (tmp[0] == '\0')
+    {
+        snprintf(out_path, out_path_len, "%s/index.html", kSdWebRoot);
+        return;
+    }
+
+    // Directory -> append index.html
+    const size_t tlen = strlen(tmp);
+    if (tlen > 0 && tmp[tlen - 1] == '/')
+    {
+        snprintf(out_path, out_path_len, "%s%.*sindex.html", kSdWebRoot, (int)tlen, tmp);
+        return;
+    }
+
+    snprintf(out_path, out_path_len, "%s%.*s", kSdWebRoot, (int)uri_len, uri);
+}
+
+// Vite emits content-hashed names under /assets/ (e.g. index-BkD3x9aQ.js); those never change.
+static bool server_bsp_is_hashed_asset(const char *sd_path)
+{
+    const size_t root_len = strlen(kSdWebRoot);
+    if (strncmp(sd_path + root_len, "/assets/", 8) != 0)
+    {
+        return false;
+    }
+
+    const char *name = strrchr(sd_path, '/') + 1;
+    const char *dot = strrchr(name, '.');
+    const char *dash = strrchr(name, '-');
+    if (!dot || !dash || dash > dot)
+    {
+        return false;
+    }
+
+    const size_t hash_len = (size_t)(dot - dash - 1);
+    if (hash_len < 8)
+    {
+        return false;
+    }
+    for (const char *c = dash + 1; c < dot; c++)
+    {
+        if (!isalnum((unsigned char)*c) && *c != '_' && *c != '-')
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// True when the Accept-Encoding header lists `coding` without q=0.
+static bool server_bsp_accepts_encoding(const char *accept, const char *coding)
+{
+    const size_t n = strlen(coding);
+    const char *p = accept;
+    while (*p)
+    {
+        // One comma-separated element: "<token>[;q=<value>]".
+        while (*p == ' ' || *p == ',')
+        {
+            p++;
+        }
+        const char *end = strchr(p, ',');
+        if (!end)
+        {
+            end = p + strlen(p);
+        }
+
+        if (strncasecmp(p, coding, n) == 0 && (p + n == end || p[n] == ';' || p[n] == ' '))
+        {
+            const char *q = strstr(p, "q=");
+            if (!q || q > end)
+            {
+                return true;
+            }
+            return strtod(q + 2, NULL) > 0.0;
+        }
+        p = end;
+    }
+    return false;
+}
+
+/*The callback function for handling GET requests*/
+esp_err_t get_static_callback(httpd_req_t *req)
+{
+    const char *uri = req->uri;
+    server_bsp_mark_activity_internal();
+
+    if (!server_bsp_uri_is_safe(uri))
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid path");
+        return ESP_OK;
+    }
+
+    char sd_path[192] = {0};
+    server_bsp_normalize_uri_path(uri, sd_path, sizeof(sd_path));
+
+    // Prefer the gzip sibling (written by the web-app build) when the client takes it.
+    // Browsers only offer br over HTTPS, so there is no point keeping a brotli copy.
+    char accept[128] = {0};
+    if (httpd_req_get_hdr_value_str(req, "Accept-Encoding", accept, sizeof(accept)) != ESP_OK)
+    {
+        accept[0] = '\0';
+    }
+
+    char send_path[200] = {0};
+    const char *encoding = NULL;
+    struct stat st = {};
+    if (server_bsp_accepts_encoding(accept, "gzip"))
+    {
+        snprintf(send_path, sizeof(send_path), "%s.gz", sd_path);
+        if (stat(send_path, &st) == 0 && S_ISREG(st.st_mode))
+        {
+            encoding = "gzip";
+        }
+    }
+    if (!encoding)
+    {
+        snprintf(send_path, sizeof(send_path), "%s", sd_path);
+        if (stat(send_path, &st) != 0 || !S_ISREG(st.st_mode))
+        {
+            httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Not found on SD");
+            return ESP_OK;
+        }
+    }
+
+    // Strong validator: size + mtime of the file actually sent, tagged with its encoding.
+    char etag[48] = {0};
+    snprintf(etag, sizeof(etag), "\"%lx-%llx%s%s\"", (unsigned long)st.st_size, (unsigned long long)st.st_mtime,
+             encoding ? "-" : "", encoding ? encoding : "");
+
+    const bool immutable = server_bsp_is_hashed_asset(sd_path);
+    httpd_resp_set_hdr(req, "Cache-Control", immutable ? "public, max-age=31536000, immutable" : "no-cache");
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+
+    char inm[128] = {0};
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) == ESP_OK &&
+        (strstr(inm, etag) != NULL || strcmp(inm, "*") == 0))
+    {
+        httpd_resp_set_status(req, "304 Not Modified");
+        httpd_resp_send(req, NULL, 0);
+        return ESP_OK;
+    }
+
+    httpd_resp_set_type(req, server_bsp_content_type_for_path(sd_path));
+    if (encoding)
+    {
+        httpd_resp_set_hdr(req, "Content-Encoding", encoding);
+    }
+
+    return server_bsp_send_sd_file(req, send_path);
+}
+
+// Regular files under dir (recursing a few levels), as paths relative to kSdWebRoot.
+static void server_bsp_list_web_files(const char *dir, int depth, std::vector<std::string> &out)
+{
+    DIR *d = opendir(dir);
+    if (!d)
+    {
+        return;
+    }
+
+    const size_t root_len = strlen(kSdWebRoot);
+    struct dirent *ent = NULL;
+    while ((ent = readdir(d)) != NULL)
+    {
+        if (ent->d_name[0] == '.')
+        {
+            continue;
+        }
+
+        std::string path = std::string(dir) + "/" + ent->d_name;
+        struct stat st = {};
+        if (stat(path.c_str(), &st) != 0)
+        {
+            continue;
+        }
+        if (S_ISDIR(st.st_mode))
+        {
+            if (depth > 0)
+            {
+                server_bsp_list_web_files(path.c_str(), depth - 1, out);
+            }
+        }
+        else if (S_ISREG(st.st_mode))
+        {
+            out.push_back(path.substr(root_len));
+        }
+    }
+    closedir(d);
+}
+
+// Reads one file the way the static handler does (or, with legacy, via the old
+// reopen-per-chunk helper) and returns the byte count; no network involved.
+static size_t server_bsp_bench_read_file(const char *sd_path, char *buf, bool legacy)
+{
+    size_t total = 0;
+    if (legacy)
+    {
+        for (;;)
+        {
+            const int n = sdcard_read_offset(sd_path, buf, 5 * 1024, total);
+            if (n <= 0)
+            {
+                break;
+            }
+            total += (size_t)n;
+        }
+        return total;
+    }
+
+    FILE *fp = server_bsp_open_sd_file(sd_path);
+    if (!fp)
+    {
+        return 0;
+    }
+    size_t n = 0;
+    while ((n = fread(buf, 1, SEND_LEN_MAX, fp)) > 0)
+    {
+        total += n;
+    }
+    fclose(fp);
+    return total;
+}
+
+// GET /api/bench/static[?mode=legacy]
+// Reports SD read throughput for every web-app asset, to compare static-serving strategies.
+esp_err_t get_bench_static_callback(httpd_req_t *req)
+{
+    server_bsp_mark_activity_internal();
+
+    bool legacy = false;
+    char qstr[64] = {0};
+    if (httpd_req_get_url_query_str(req, qstr, sizeof(qstr)) == ESP_OK)
+    {
+        char mode[16] = {0};
+        if (httpd_query_key_value(qstr, "mode", mode, sizeof(mode)) == ESP_OK)
+        {
+            legacy = (strcmp(mode, "legacy") == 0);
+        }
+    }
+
+    std::vector<std::string> files;
+    server_bsp_list_web_files(kSdWebRoot, 2, files);
+    std::sort(files.begin(), files.end());
+
+    char *buf = server_bsp_alloc_file_chunk();
+    cJSON *root = cJSON_CreateObject();
+    cJSON *arr = root ? cJSON_AddArrayToObject(root, "files") : NULL;
+    if (!buf || !root || !arr)
     {
-        heap_caps_free(resp_str);
-        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Not found on SD");
+        if (buf)
+        {
+            heap_caps_free(buf);
+        }
+        cJSON_Delete(root);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "OOM");
         return ESP_OK;
     }
 
-    ESP_LOGI(TAG, "Serving SD file: %s", sd_path);
-
-    esp_err_t send_err = ESP_OK;
-    while (len)
+    uint64_t total_bytes = 0;
+    int64_t total_us = 0;
+    for (const auto &rel : files)
     {
-        send_err = httpd_resp_send_chunk(req, resp_str, len);
-        if (send_err != ESP_OK)
+        const std::string path = std::string(kSdWebRoot) + rel;
+        const int64_t t0 = esp_timer_get_time();
+        const size_t bytes = server_bsp_bench_read_file(path.c_str(), buf, legacy);
+        const int64_t us = esp_timer_get_time() - t0;
+        total_bytes += bytes;
+        total_us += us;
+
+        cJSON *item = cJSON_CreateObject();
+        if (!item)
         {
-            // Common case: client navigated away / disconnected while we were streaming.
-            // Stop reading/sending to avoid spamming httpd_txrx send() errors.
-            ESP_LOGW(TAG, "Failed to send chunk for %s (%d)", sd_path, (int)send_err);
-            break;
+            continue;
         }
-
-        off += len;
-        len = sdcard_read_offset(sd_path, resp_str, SEND_LEN_MAX, off);
+        cJSON_AddStringToObject(item, "path", rel.c_str());
+        cJSON_AddNumberToObject(item, "bytes", (double)bytes);
+        cJSON_AddNumberToObject(item, "us", (double)us);
+        cJSON_AddNumberToObject(item, "bytes_per_s", us > 0 ? (double)bytes * 1e6 / (double)us : 0.0);
+        cJSON_AddItemToArray(arr, item);
     }
+    heap_caps_free(buf);
 
-    if (send_err == ESP_OK)
+    cJSON_AddStringToObject(root, "mode", legacy ? "legacy" : "stream");
+    cJSON_AddNumberToObject(root, "chunk", legacy ? 5 * 1024 : SEND_LEN_MAX);
+    cJSON_AddNumberToObject(root, "total_bytes", (double)total_bytes);
+    cJSON_AddNumberToObject(root, "total_us", (double)total_us);
+    cJSON_AddNumberToObject(root, "bytes_per_s", total_us > 0 ? (double)total_bytes * 1e6 / (double)total_us : 0.0);
+
+    ESP_LOGI(TAG, "Static bench (%s): %u files, %llu bytes in %lld ms", legacy ? "legacy" : "stream",
+             (unsigned)files.size(), (unsigned long long)total_bytes, (long long)(total_us / 1000));
+
+    char *text = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (!text)
     {
-        (void)httpd_resp_send_chunk(req, NULL, 0);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Encode error");
+        return ESP_OK;
     }
 
-    heap_caps_free(resp_str);
-
-    // If the socket is already broken, returning ESP_FAIL tells httpd to close it.
-    return (send_err == ESP_OK) ? ESP_OK : ESP_FAIL;
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    httpd_resp_send(req, text, HTTPD_RESP_USE_STRLEN);
+    cJSON_free(text);
+    return ESP_OK;
 }
 
-static bool server_bsp_uri_is_safe(const char *uri)
+// Synthetic test row: hue sweep across, brightness ramp down, so every mode sees the same
+// mix of flat, graded and saturated areas.
+static void server_bsp_bench_dither_row(uint8_t *rgb, uint16_t width, uint16_t y, uint16_t height)
 {
-    // Very small allowlist: block path traversal and backslashes.
-    if (strstr(uri, "..") != NULL)
-    {
-        return false;
-    }
-    if (strchr(uri, '\\') != NULL)
-    {
-        return false;
+    const uint32_t v = (uint32_t)y * 255 / (height > 1 ? height - 1 : 1);
+    for (uint16_t x = 0; x < width; x++, rgb += 3)
+    {
+        const uint32_t h = (uint32_t)x * 6 * 255 / width; // 0..6*255
+        const uint32_t f = h % 255;
+        uint32_t r = 0;
+        uint32_t g = 0;
+        uint32_t b = 0;
+        switch (h / 255)
+        {
+        case 0: r = 255; g = f; break;
+        case 1: r = 255 - f; g = 255; break;
+        case 2: g = 255; b = f; break;
+        case 3: g = 255 - f; b = 255; break;
+        case 4: r = f; b = 255; break;
+        default: r = 255; b = 255 - f; break;
+        }
+        rgb[0] = (uint8_t)(r * v / 255);
+        rgb[1] = (uint8_t)(g * v / 255);
+        rgb[2] = (uint8_t)(b * v / 255);
     }
-    return true;
 }
 
-static void server_bsp_normalize_uri_path(const char *uri, char *out_path, size_t out_path_len)
+// GET /api/bench/dither
+// Dithers one synthetic panel-sized frame with every mode and reports the time each took
+// (dithering only; generating the test rows is not counted).
+esp_err_t get_bench_dither_callback(httpd_req_t *req)
 {
-    // Strip query string ("?foo=bar") if present.
-    const char *q = strchr(uri, '?');
-    const size_t uri_len = q ? (size_t)(q - uri) : strlen(uri);
-
-    // Root -> /index.html
-    if (uri_len == 1 && uri[0] == '/')
-    {
-        snprintf(out_path, out_path_len, "%s/index.html", kSdWebRoot);
-        return;
-    }
+    server_bsp_mark_activity_internal();
 
-    // Copy the path part into a small buffer so we can check trailing '/'.
-    char tmp[128] = {0};
-    snprintf(tmp, sizeof(tmp), "%.*s", (int)uri_len, uri);
+    const uint16_t width = 800;
+    const uint16_t height = 480;
 
-    if (tmp[0] == '\0')
+    uint8_t *rgb = (uint8_t *)malloc((size_t)width * 3);
+    uint8_t *paint = (uint8_t *)malloc(width);
+    cJSON *root = cJSON_CreateObject();
+    cJSON *arr = root ? cJSON_AddArrayToObject(root, "modes") : NULL;
+    if (!rgb || !paint || !root || !arr)
     {
-        snprintf(out_path, out_path_len, "%s/index.html", kSdWebRoot);
-        return;
+        free(rgb);
+        free(paint);
+        cJSON_Delete(root);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "OOM");
+        return ESP_OK;
     }
 
-    // Directory -> append index.html
-    const size_t tlen = strlen(tmp);
-    if (tlen > 0 && tmp[tlen - 1] == '/')
+    for (int m = 0; m < GUI_DITHER_MODE_COUNT; m++)
     {
-        snprintf(out_path, out_path_len, "%s%.*sindex.html", kSdWebRoot, (int)tlen, tmp);
-        return;
-    }
+        GUI_Dither ds;
+        if (!GUI_Dither_Init(&ds, width, (GUI_DitherMode)m))
+        {
+            continue;
+        }
+        for (uint16_t y = 0; y < height; y++)
+        {
+            if ((y % 16) == 0)
+            {
+                vTaskDelay(pdMS_TO_TICKS(1));
+            }
+            server_bsp_bench_dither_row(rgb, width, y, height);
+            GUI_Dither_Row(&ds, rgb, paint);
+        }
 
-    snprintf(out_path, out_path_len, "%s%.*s", kSdWebRoot, (int)uri_len, uri);
-}
+        const char *name = GUI_Dither_ModeName((GUI_DitherMode)m);
+        ESP_LOGI(TAG, "Dither bench %s: %lld ms per %ux%u frame", name, (long long)(ds.busyUs / 1000),
+                 (unsigned)width, (unsigned)height);
 
-/*The callback function for handling GET requests*/
-esp_err_t get_static_callback(httpd_req_t *req)
-{
-    const char *uri = req->uri;
-    server_bsp_mark_activity_internal();
+        cJSON *item = cJSON_CreateObject();
+        if (item)
+        {
+            cJSON_AddStringToObject(item, "mode", name);
+            cJSON_AddNumberToObject(item, "us", (double)ds.busyUs);
+            cJSON_AddItemToArray(arr, item);
+        }
+        GUI_Dither_Deinit(&ds);
+    }
+    free(rgb);
+    free(paint);
 
-    if (!server_bsp_uri_is_safe(uri))
+    cJSON_AddNumberToObject(root, "width", width);
+    cJSON_AddNumberToObject(root, "height", height);
+    cJSON_AddStringToObject(root, "kernels", GUI_Kernel_Impl());
+
+    char *text = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (!text)
     {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid path");
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Encode error");
         return ESP_OK;
     }
 
-    char sd_path[192] = {0};
-    server_bsp_normalize_uri_path(uri, sd_path, sizeof(sd_path));
-
-    httpd_resp_set_type(req, server_bsp_content_type_for_path(sd_path));
+    httpd_resp_set_type(req, "application/json");
     httpd_resp_set_hdr(req, "Cache-Control", "no-store");
-
-    return server_bsp_send_sd_file(req, sd_path);
+    httpd_resp_send(req, text, HTTPD_RESP_USE_STRLEN);
+    cJSON_free(text);
+    return ESP_OK;
 }
 
 static void server_bsp_restart_task(void *arg)
 {
     const uint32_t delay_ms = (uint32_t)(uintptr_t)arg;
     vTaskDelay(pdMS_TO_TICKS(delay_ms));
+    (void)server_bsp_flush_settings();
     esp_restart();
 }
 
@@ -2208,6 +3619,156 @@ esp_err_t post_status_icons_callback(httpd_req_t *req)
     return ESP_OK;
 }
 
+// {"mode":"<global mode>","modes":["floyd-steinberg",...]}
+static void server_bsp_send_dither_settings(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+    char resp[256] = {0};
+    int len = snprintf(resp, sizeof(resp), "{\"mode\":\"%s\",\"modes\":[",
+                       GUI_Dither_ModeName((GUI_DitherMode)s_dither_mode));
+    for (int i = 0; i < GUI_DITHER_MODE_COUNT && len < (int)sizeof(resp); i++)
+    {
+        len += snprintf(resp + len, sizeof(resp) - len, "%s\"%s\"", i ? "," : "",
+                        GUI_Dither_ModeName((GUI_DitherMode)i));
+    }
+    if (len < (int)sizeof(resp))
+    {
+        snprintf(resp + len, sizeof(resp) - len, "]}\n");
+    }
+    httpd_resp_send(req, resp, HTTPD_RESP_USE_STRLEN);
+}
+
+esp_err_t get_dither_callback(httpd_req_t *req)
+{
+    server_bsp_mark_activity_internal();
+    server_bsp_send_dither_settings(req);
+    return ESP_OK;
+}
+
+// POST /api/dither
+//   {"mode":"<name>"}              global mode
+//   {"id":"<photo id>","mode":"<name>"|null}   per-photo mode (null: back to the global one)
+esp_err_t post_dither_callback(httpd_req_t *req)
+{
+    server_bsp_mark_activity_internal();
+
+    char body[192] = {0};
+    const esp_err_t body_err = server_bsp_recv_small_body(req, body, sizeof(body));
+    if (body_err == ESP_ERR_INVALID_SIZE)
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Payload too large");
+        return ESP_OK;
+    }
+    if (body_err != ESP_OK)
+    {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Receive error");
+        return ESP_OK;
+    }
+
+    cJSON *root = cJSON_Parse(body);
+    if (!root)
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid JSON");
+        return ESP_OK;
+    }
+
+    const cJSON *jid = cJSON_GetObjectItem(root, "id");
+    const cJSON *jmode = cJSON_GetObjectItem(root, "mode");
+
+    char id[64] = {0};
+    if (cJSON_IsString(jid) && jid->valuestring)
+    {
+        snprintf(id, sizeof(id), "%s", jid->valuestring);
+    }
+
+    GUI_DitherMode mode = GUI_DITHER_FLOYD_STEINBERG;
+    const bool has_mode = cJSON_IsString(jmode) && GUI_Dither_ModeFromName(jmode->valuestring, &mode);
+    const bool clear = (id[0] != '\0') && (!jmode || cJSON_IsNull(jmode));
+    cJSON_Delete(root);
+
+    if (!has_mode && !clear)
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing/invalid mode");
+        return ESP_OK;
+    }
+    if (jid && !server_bsp_photo_id_is_safe(id))
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid photo id");
+        return ESP_OK;
+    }
+
+    const uint8_t before = server_bsp_get_dither_mode();
+
+    if (id[0] == '\0')
+    {
+        const esp_err_t err = server_bsp_set_dither_mode_global(mode);
+        if (err != ESP_OK)
+        {
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to save setting");
+            return ESP_OK;
+        }
+        server_bsp_send_dither_settings(req);
+    }
+    else
+    {
+        server_bsp_ensure_library_loaded();
+
+        bool found = false;
+        bool saved = false;
+        const uint8_t value = has_mode ? (uint8_t)mode : kPhotoDitherDefault;
+        if (s_library_mutex && xSemaphoreTake(s_library_mutex, pdMS_TO_TICKS(2000)) == pdTRUE)
+        {
+            LibraryPhoto *p = server_bsp_find_photo_locked(id);
+            found = (p != nullptr);
+            if (p && p->dither == value)
+            {
+                saved = true;
+            }
+            else if (p)
+            {
+                p->dither = value;
+                saved = server_bsp_journal_put_photo_locked(*p);
+            }
+            xSemaphoreGive(s_library_mutex);
+        }
+
+        if (!found)
+        {
+            httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Photo not found");
+            return ESP_OK;
+        }
+        if (!saved)
+        {
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to save library");
+            return ESP_OK;
+        }
+        server_bsp_frame_cache_invalidate_photo(id);
+
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+        char resp[192] = {0};
+        if (has_mode)
+        {
+            snprintf(resp, sizeof(resp), "{\"id\":\"%s\",\"dither\":\"%s\"}\n", id, GUI_Dither_ModeName(mode));
+        }
+        else
+        {
+            snprintf(resp, sizeof(resp), "{\"id\":\"%s\",\"dither\":null}\n", id);
+        }
+        httpd_resp_send(req, resp, HTTPD_RESP_USE_STRLEN);
+    }
+
+    // Re-display the current photo if it now dithers differently (after responding).
+    if (server_bsp_get_dither_mode() != before)
+    {
+        xEventGroupSetBits(server_groups, set_bit_button(2));
+    }
+    return ESP_OK;
+}
+
 static void server_bsp_trim_in_place(char *s)
 {
     if (!s)
@@ -2259,7 +3820,7 @@ static bool server_bsp_photo_name_is_safe(const char *name)
     {
         return false;
     }
-    if (!server_bsp_ends_with_ignore_case(name, ".bmp"))
+    if (!server_bsp_photo_ext_is_supported(name))
     {
         return false;
     }
@@ -2318,12 +3879,100 @@ static esp_err_t server_bsp_recv_small_body(httpd_req_t *req, char *body, size_t
     return ESP_OK;
 }
 
+// Items encoded per library lock; the lock is dropped while the chunk goes out.
+static const size_t kPhotosBatchItems = 8;
+static const size_t kPhotosChunkBytes = 2048;
+
+// Accumulates a JSON response and sends it in chunks as the buffer fills.
+struct JsonChunkWriter
+{
+    httpd_req_t *req;
+    char *buf;
+    size_t len;
+    esp_err_t err;
+};
+
+static void server_bsp_json_flush(JsonChunkWriter *w)
+{
+    if (w->err == ESP_OK && w->len > 0)
+    {
+        w->err = httpd_resp_send_chunk(w->req, w->buf, (ssize_t)w->len);
+    }
+    w->len = 0;
+}
+
+static void server_bsp_json_raw(JsonChunkWriter *w, const char *data, size_t n)
+{
+    while (n > 0 && w->err == ESP_OK)
+    {
+        if (w->len == kPhotosChunkBytes)
+        {
+            server_bsp_json_flush(w);
+        }
+        const size_t take = std::min(n, kPhotosChunkBytes - w->len);
+        memcpy(w->buf + w->len, data, take);
+        w->len += take;
+        data += take;
+        n -= take;
+    }
+}
+
+static void server_bsp_json_lit(JsonChunkWriter *w, const char *text)
+{
+    server_bsp_json_raw(w, text, strlen(text));
+}
+
+static void server_bsp_json_uint(JsonChunkWriter *w, unsigned long v)
+{
+    char num[16];
+    const int n = snprintf(num, sizeof(num), "%lu", v);
+    server_bsp_json_raw(w, num, (size_t)n);
+}
+
+// Quoted JSON string. Names are validated before they get into the library, but escape anyway.
+static void server_bsp_json_str(JsonChunkWriter *w, const char *text)
+{
+    server_bsp_json_raw(w, "\"", 1);
+    const char *run = text;
+    for (const char *c = text; *c; c++)
+    {
+        const unsigned char ch = (unsigned char)*c;
+        if (ch >= 0x20 && ch != '"' && ch != '\\')
+        {
+            continue;
+        }
+        server_bsp_json_raw(w, run, (size_t)(c - run));
+        char esc[8];
+        const int n = (ch == '"' || ch == '\\') ? snprintf(esc, sizeof(esc), "\\%c", ch)
+                                                : snprintf(esc, sizeof(esc), "\\u%04x", ch);
+        server_bsp_json_raw(w, esc, (size_t)n);
+        run = c + 1;
+    }
+    server_bsp_json_lit(w, run);
+    server_bsp_json_raw(w, "\"", 1);
+}
+
+static unsigned long server_bsp_query_ulong(const char *qstr, const char *key, unsigned long def)
+{
+    char val[16] = {0};
+    if (!qstr || httpd_query_key_value(qstr, key, val, sizeof(val)) != ESP_OK || val[0] == '\0')
+    {
+        return def;
+    }
+    char *end = NULL;
+    const unsigned long v = strtoul(val, &end, 10);
+    return (end && *end == '\0') ? v : def;
+}
+
 esp_err_t get_photos_callback(httpd_req_t *req)
 {
     server_bsp_mark_activity_internal();
 
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    // Optional paging: ?offset=N&limit=M (limit 0 or absent = to the end).
+    char qstr[64] = {0};
+    const bool has_query = (httpd_req_get_url_query_str(req, qstr, sizeof(qstr)) == ESP_OK);
+    const unsigned long offset = server_bsp_query_ulong(has_query ? qstr : NULL, "offset", 0);
+    const unsigned long limit = server_bsp_query_ulong(has_query ? qstr : NULL, "limit", 0);
 
     server_bsp_ensure_library_loaded();
 
@@ -2343,60 +3992,116 @@ esp_err_t get_photos_callback(httpd_req_t *req)
     const char *base = server_bsp_basename(cur_path);
     if (base && server_bsp_photo_name_is_safe(base))
     {
-        displaying = base;
+        displaying = base;
+    }
+
+    const uint16_t rotation = server_bsp_get_rotation();
+
+    if (!s_library_mutex || xSemaphoreTake(s_library_mutex, pdMS_TO_TICKS(2000)) != pdTRUE)
+    {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Lock failed");
+        return ESP_OK;
+    }
+    uint32_t generation = s_library_generation;
+    const size_t total = s_library_order.size();
+    xSemaphoreGive(s_library_mutex);
+
+    // The tag covers everything in the body: library contents, the page, and the
+    // current/displaying/rotation state (hashed, it changes without touching the library).
+    char state[160] = {0};
+    snprintf(state, sizeof(state), "%u|%s|%s", (unsigned)rotation, cur_id, displaying);
+    const uint32_t state_crc = esp_rom_crc32_le(0, (const uint8_t *)state, (uint32_t)strlen(state));
+
+    char etag[64] = {0};
+    snprintf(etag, sizeof(etag), "\"%08lx-%08lx-%lu-%lu\"", (unsigned long)generation, (unsigned long)state_crc,
+             offset, limit);
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    httpd_resp_set_hdr(req, "ETag", etag);
+
+    char inm[80] = {0};
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) == ESP_OK && strstr(inm, etag) != NULL)
+    {
+        httpd_resp_set_status(req, "304 Not Modified");
+        httpd_resp_send(req, NULL, 0);
+        return ESP_OK;
     }
 
-    cJSON *root = cJSON_CreateObject();
-    if (!root)
+    JsonChunkWriter w = {req, (char *)malloc(kPhotosChunkBytes), 0, ESP_OK};
+    if (!w.buf)
     {
         httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "OOM");
         return ESP_OK;
     }
 
-    cJSON_AddNumberToObject(root, "rotation", (double)server_bsp_get_rotation());
-    cJSON_AddStringToObject(root, "current", cur_id);
-    cJSON_AddStringToObject(root, "displaying", displaying);
-
-    cJSON *arr = cJSON_AddArrayToObject(root, "photos");
-    unsigned count = 0;
-
-    if (arr && s_library_mutex && xSemaphoreTake(s_library_mutex, pdMS_TO_TICKS(2000)) == pdTRUE)
-    {
-        for (const auto &id : s_library_order)
+    server_bsp_json_lit(&w, "{\"rotation\":");
+    server_bsp_json_uint(&w, rotation);
+    server_bsp_json_lit(&w, ",\"current\":");
+    server_bsp_json_str(&w, cur_id);
+    server_bsp_json_lit(&w, ",\"displaying\":");
+    server_bsp_json_str(&w, displaying);
+    server_bsp_json_lit(&w, ",\"total\":");
+    server_bsp_json_uint(&w, (unsigned long)total);
+    server_bsp_json_lit(&w, ",\"offset\":");
+    server_bsp_json_uint(&w, offset);
+    server_bsp_json_lit(&w, ",\"photos\":[");
+
+    // A change between batches shows up as a mixed page; its ETag is already stale, so the
+    // client's next revalidation fetches the list again.
+    unsigned long count = 0;
+    size_t pos = offset;
+    while (w.err == ESP_OK && (limit == 0 || count < limit))
+    {
+        if (xSemaphoreTake(s_library_mutex, pdMS_TO_TICKS(2000)) != pdTRUE)
+        {
+            break;
+        }
+        size_t batch = 0;
+        for (; pos < s_library_order.size() && batch < kPhotosBatchItems && (limit == 0 || count < limit); pos++)
         {
-            LibraryPhoto *p = server_bsp_find_photo_locked(id.c_str());
+            const LibraryPhoto *p = server_bsp_find_photo_locked(s_library_order[pos].c_str());
             if (!p)
             {
                 continue;
             }
-
-            cJSON *item = cJSON_CreateObject();
-            if (!item)
+            server_bsp_json_lit(&w, count ? ",{\"id\":" : "{\"id\":");
+            server_bsp_json_str(&w, p->id.c_str());
+            server_bsp_json_lit(&w, ",\"landscape\":");
+            server_bsp_json_str(&w, p->landscape.c_str());
+            server_bsp_json_lit(&w, ",\"portrait\":");
+            server_bsp_json_str(&w, p->portrait.c_str());
+            if (p->dither < GUI_DITHER_MODE_COUNT)
             {
-                continue;
+                server_bsp_json_lit(&w, ",\"dither\":");
+                server_bsp_json_str(&w, GUI_Dither_ModeName((GUI_DitherMode)p->dither));
             }
-            cJSON_AddStringToObject(item, "id", p->id.c_str());
-            cJSON_AddStringToObject(item, "landscape", p->landscape.c_str());
-            cJSON_AddStringToObject(item, "portrait", p->portrait.c_str());
-            cJSON_AddItemToArray(arr, item);
+            server_bsp_json_raw(&w, "}", 1);
             count++;
+            batch++;
         }
+        const bool done = (pos >= s_library_order.size());
         xSemaphoreGive(s_library_mutex);
-    }
 
-    cJSON_AddNumberToObject(root, "count", (double)count);
+        if (done)
+        {
+            break;
+        }
+        server_bsp_json_flush(&w);
+    }
 
-    char *text = cJSON_PrintUnformatted(root);
-    cJSON_Delete(root);
+    server_bsp_json_lit(&w, "],\"count\":");
+    server_bsp_json_uint(&w, count);
+    server_bsp_json_raw(&w, "}", 1);
+    server_bsp_json_flush(&w);
+    free(w.buf);
 
-    if (!text)
+    if (w.err != ESP_OK)
     {
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Encode error");
-        return ESP_OK;
+        ESP_LOGW(TAG, "/api/photos send failed: %s", esp_err_to_name(w.err));
+        return ESP_FAIL;
     }
-
-    httpd_resp_send(req, text, HTTPD_RESP_USE_STRLEN);
-    cJSON_free(text);
+    httpd_resp_send_chunk(req, NULL, 0);
     return ESP_OK;
 }
 
@@ -2404,7 +4109,7 @@ esp_err_t get_photos_file_callback(httpd_req_t *req)
 {
     server_bsp_mark_activity_internal();
 
-    // Extract filename from URI: /api/photos/file/filename.bmp -> filename.bmp
+    // Extract filename from URI: /api/photos/file/filename.bmp -> filename.bmp (or .qoi, .jpg)
     const char *uri = req->uri;
     const char *prefix = "/api/photos/file/";
     const size_t prefix_len = strlen(prefix);
@@ -2417,7 +4122,7 @@ esp_err_t get_photos_file_callback(httpd_req_t *req)
 
     const char *filename = uri + prefix_len;
 
-    // Validate filename (no path traversal, must end with .bmp)
+    // Validate filename (no path traversal, must be a supported photo extension)
     if (!server_bsp_photo_name_is_safe(filename))
     {
         httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid filename");
@@ -2436,8 +4141,7 @@ esp_err_t get_photos_file_callback(httpd_req_t *req)
         return ESP_OK;
     }
 
-    // Set content type for BMP
-    httpd_resp_set_type(req, "image/bmp");
+    httpd_resp_set_type(req, server_bsp_photo_content_type(filename));
     httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=3600");
 
     // Serve the file
@@ -2580,29 +4284,8 @@ esp_err_t post_photos_delete_callback(httpd_req_t *req)
             land_name = p->landscape;
             port_name = p->portrait;
 
-            // Remove from order
-            std::vector<std::string> new_order;
-            new_order.reserve(s_library_order.size());
-            for (const auto &oid : s_library_order)
-            {
-                if (oid != id)
-                {
-                    new_order.push_back(oid);
-                }
-            }
-            s_library_order.swap(new_order);
-
-            // Remove from photos
-            for (auto it = s_library_photos.begin(); it != s_library_photos.end(); ++it)
-            {
-                if (it->id == id)
-                {
-                    s_library_photos.erase(it);
-                    break;
-                }
-            }
-
-            (void)server_bsp_write_library_to_sd_locked();
+            server_bsp_remove_photo_locked(id);
+            (void)server_bsp_journal_delete_photo_locked(id);
         }
         xSemaphoreGive(s_library_mutex);
     }
@@ -2614,6 +4297,7 @@ esp_err_t post_photos_delete_callback(httpd_req_t *req)
     }
 
     // Best-effort delete of variant files.
+    server_bsp_frame_cache_invalidate_photo(id);
     if (!land_name.empty())
     {
         char full[192] = {0};
@@ -2626,6 +4310,7 @@ esp_err_t post_photos_delete_callback(httpd_req_t *req)
         snprintf(full, sizeof(full), "%s/%s", kUserPhotoDir, port_name.c_str());
         (void)remove(full);
     }
+    server_bsp_photo_dir_changed();
 
     bool should_redraw = false;
     if (deleting_current)
@@ -2740,40 +4425,18 @@ esp_err_t post_photos_reorder_callback(httpd_req_t *req)
             continue;
         }
 
-        bool already = false;
-        for (const auto &x : new_order)
-        {
-            if (x == id)
-            {
-                already = true;
-                break;
-            }
-        }
-        if (!already)
-        {
-            new_order.push_back(id);
-        }
+        new_order.push_back(id);
     }
 
     // Append any missing IDs at the end (preserve previous relative order).
-    for (const auto &id : s_library_order)
-    {
-        bool already = false;
-        for (const auto &x : new_order)
-        {
-            if (x == id)
-            {
-                already = true;
-                break;
-            }
-        }
-        if (!already)
-        {
-            new_order.push_back(id);
-        }
-    }
+    // The filter below drops the duplicates, keeping each ID's first position.
+    new_order.insert(new_order.end(), s_library_order.begin(), s_library_order.end());
 
     s_library_order.swap(new_order);
+    server_bsp_library_filter_order_locked();
+
+    // A reorder touches every position, so it is persisted as a full rewrite (which also
+    // folds in the journal) rather than as journal records.
     (void)server_bsp_write_library_to_sd_locked();
 
     xSemaphoreGive(s_library_mutex);
@@ -2811,6 +4474,327 @@ static bool server_bsp_allocate_new_photo_id(char *out_id, size_t out_id_len)
     return server_bsp_photo_id_is_safe(out_id);
 }
 
+// Upload pipeline: the httpd task receives into one buffer while a writer task on the other
+// core pushes the previous one through sdcard_writer_t. Buffers travel through two queues;
+// when both are with the writer, the receiver blocks (and TCP flow control slows the sender).
+struct UploadChunk
+{
+    int idx; // -1 ends the upload
+    size_t len;
+};
+
+// The pipe is on the heap: if the writer stalls, the receiver gives up on it (abandoned) and
+// the writer frees everything whenever it gets unstuck. Until then its "<path>.tmp" stays on
+// the card; server_bsp_sweep_upload_temp_files() removes leftovers at the next start.
+// Either way the handler returns within 2 * kUploadStallMs.
+struct UploadPipe
+{
+    sdcard_writer_t writer;
+    uint8_t *buf[2];
+    QueueHandle_t filled; // UploadChunk, receiver -> writer
+    QueueHandle_t empty;  // buffer index, writer -> receiver
+    SemaphoreHandle_t done;
+    volatile bool failed;
+    uint64_t write_us;
+    portMUX_TYPE mux; // guards finished/abandoned
+    bool finished;    // writer task is past its loop
+    bool abandoned;   // receiver has left; the writer frees the pipe
+};
+
+// How long the receiver waits for the writer to free a buffer or finish.
+static const uint32_t kUploadStallMs = 15000;
+
+struct UploadStats
+{
+    size_t bytes;
+    uint64_t total_us;
+    uint64_t recv_us;  // inside httpd_req_recv
+    uint64_t write_us; // inside sdcard_writer_write/commit (on the writer task when piped)
+    uint64_t stall_us; // receiver waiting for a free buffer
+    bool piped;
+};
+
+// Frees the pipe and everything in it; drops the temp file unless it was committed.
+static void server_bsp_upload_pipe_free(UploadPipe *pipe)
+{
+    sdcard_writer_abort(&pipe->writer);
+    if (pipe->filled)
+    {
+        vQueueDelete(pipe->filled);
+    }
+    if (pipe->empty)
+    {
+        vQueueDelete(pipe->empty);
+    }
+    if (pipe->done)
+    {
+        vSemaphoreDelete(pipe->done);
+    }
+    heap_caps_free(pipe->buf[0]);
+    heap_caps_free(pipe->buf[1]);
+    free(pipe);
+}
+
+static void server_bsp_upload_writer_task(void *arg)
+{
+    UploadPipe *pipe = (UploadPipe *)arg;
+
+    for (;;)
+    {
+        UploadChunk c = {};
+        xQueueReceive(pipe->filled, &c, portMAX_DELAY);
+        if (c.idx < 0)
+        {
+            break;
+        }
+
+        if (!pipe->failed)
+        {
+            const int64_t t0 = esp_timer_get_time();
+            if (sdcard_writer_write(&pipe->writer, pipe->buf[c.idx], c.len) != ESP_OK)
+            {
+                pipe->failed = true;
+            }
+            pipe->write_us += (uint64_t)(esp_timer_get_time() - t0);
+        }
+        xQueueSend(pipe->empty, &c.idx, portMAX_DELAY);
+    }
+
+    portENTER_CRITICAL(&pipe->mux);
+    pipe->finished = true;
+    const bool abandoned = pipe->abandoned;
+    portEXIT_CRITICAL(&pipe->mux);
+    if (abandoned)
+    {
+        // Close without removing "<path>.tmp": by now a retried upload may be writing the
+        // same name. The start-up sweep removes it if nothing replaced it.
+        ESP_LOGW(TAG, "Upload writer finished after the upload was abandoned");
+        if (pipe->writer.f)
+        {
+            fclose(pipe->writer.f);
+            pipe->writer.f = NULL;
+        }
+        server_bsp_upload_pipe_free(pipe);
+    }
+    else
+    {
+        xSemaphoreGive(pipe->done);
+    }
+    vTaskDelete(NULL);
+}
+
+// Removes "*.tmp" files left in the photo directory by uploads that never finished (reset, or
+// a writer abandoned while stalled). Runs before any upload can start.
+static void server_bsp_sweep_upload_temp_files(void)
+{
+    DIR *dir = opendir(kUserPhotoDir);
+    if (!dir)
+    {
+        return;
+    }
+
+    // Collect first; don't mutate the directory while iterating it.
+    std::vector<std::string> victims;
+    struct dirent *ent = NULL;
+    while ((ent = readdir(dir)) != NULL)
+    {
+        if (ent->d_name[0] != '.' && server_bsp_ends_with_ignore_case(ent->d_name, ".tmp"))
+        {
+            victims.emplace_back(ent->d_name);
+        }
+    }
+    closedir(dir);
+
+    for (const auto &name : victims)
+    {
+        char full[256] = {0};
+        snprintf(full, sizeof(full), "%s/%s", kUserPhotoDir, name.c_str());
+        if (remove(full) == 0)
+        {
+            ESP_LOGW(TAG, "Removed leftover upload temp file %s", name.c_str());
+        }
+    }
+}
+
+// Receives the request body into `path` (via "<path>.tmp", see sdcard_writer_t).
+// Falls back to receive-then-write on one task if the pipeline cannot be set up.
+// On failure *out_msg is a short reason suitable for the HTTP error.
+static esp_err_t server_bsp_recv_body_to_file(httpd_req_t *req, const char *path, UploadStats *st, const char **out_msg)
+{
+    *st = {};
+    *out_msg = "";
+    const int64_t t_start = esp_timer_get_time();
+
+    UploadPipe *pipe = (UploadPipe *)calloc(1, sizeof(UploadPipe));
+    if (!pipe)
+    {
+        *out_msg = "Out of memory";
+        return ESP_ERR_NO_MEM;
+    }
+    portMUX_INITIALIZE(&pipe->mux);
+    if (sdcard_writer_open(&pipe->writer, path, 0) != ESP_OK)
+    {
+        free(pipe);
+        *out_msg = "Open failed";
+        return ESP_FAIL;
+    }
+
+    pipe->buf[0] = (uint8_t *)heap_caps_malloc(UPLOAD_PIPE_BUF_BYTES, MALLOC_CAP_SPIRAM);
+    pipe->buf[1] = (uint8_t *)heap_caps_malloc(UPLOAD_PIPE_BUF_BYTES, MALLOC_CAP_SPIRAM);
+    if (!pipe->buf[0])
+    {
+        server_bsp_upload_pipe_free(pipe);
+        *out_msg = "Out of memory";
+        return ESP_ERR_NO_MEM;
+    }
+
+    bool piped = false;
+    TaskHandle_t writer_task = NULL;
+    if (pipe->buf[1])
+    {
+        pipe->filled = xQueueCreate(3, sizeof(UploadChunk));
+        pipe->empty = xQueueCreate(2, sizeof(int));
+        pipe->done = xSemaphoreCreateBinary();
+        const BaseType_t core = (xPortGetCoreID() == 0) ? 1 : 0;
+        piped = pipe->filled && pipe->empty && pipe->done &&
+                xTaskCreatePinnedToCore(server_bsp_upload_writer_task, "upload_wr", 4 * 1024, pipe,
+                                        uxTaskPriorityGet(NULL), &writer_task, core) == pdPASS;
+        if (piped)
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                xQueueSend(pipe->empty, &i, 0);
+            }
+        }
+    }
+    st->piped = piped;
+
+    esp_err_t err = ESP_OK;
+    size_t remaining = req->content_len;
+    while (remaining > 0 && err == ESP_OK)
+    {
+        int idx = 0;
+        if (piped)
+        {
+            const int64_t t0 = esp_timer_get_time();
+            if (xQueueReceive(pipe->empty, &idx, pdMS_TO_TICKS(kUploadStallMs)) != pdTRUE)
+            {
+                err = ESP_ERR_TIMEOUT;
+                *out_msg = "Write stalled";
+                break;
+            }
+            st->stall_us += (uint64_t)(esp_timer_get_time() - t0);
+        }
+        if (pipe->failed)
+        {
+            err = ESP_FAIL;
+            *out_msg = "Write failed";
+            break;
+        }
+
+        uint8_t *buf = pipe->buf[idx];
+        size_t fill = 0;
+        while (fill < UPLOAD_PIPE_BUF_BYTES && remaining > 0)
+        {
+            const int64_t t0 = esp_timer_get_time();
+            const int ret = httpd_req_recv(req, (char *)buf + fill, MIN(remaining, UPLOAD_PIPE_BUF_BYTES - fill));
+            st->recv_us += (uint64_t)(esp_timer_get_time() - t0);
+            if (ret <= 0)
+            {
+                if (ret == HTTPD_SOCK_ERR_TIMEOUT)
+                {
+                    continue;
+                }
+                err = ESP_FAIL;
+                *out_msg = "Receive error";
+                break;
+            }
+            fill += (size_t)ret;
+            remaining -= (size_t)ret;
+            server_bsp_mark_activity_internal();
+        }
+        if (err != ESP_OK)
+        {
+            break;
+        }
+
+        if (piped)
+        {
+            // Never blocks: at most both buffers and the end marker are queued.
+            const UploadChunk c = {idx, fill};
+            xQueueSend(pipe->filled, &c, portMAX_DELAY);
+        }
+        else
+        {
+            const int64_t t0 = esp_timer_get_time();
+            if (sdcard_writer_write(&pipe->writer, buf, fill) != ESP_OK)
+            {
+                err = ESP_FAIL;
+                *out_msg = "Write failed";
+            }
+            st->write_us += (uint64_t)(esp_timer_get_time() - t0);
+        }
+    }
+
+    bool abandoned = false;
+    if (piped)
+    {
+        const UploadChunk end = {-1, 0};
+        xQueueSend(pipe->filled, &end, portMAX_DELAY);
+        if (xSemaphoreTake(pipe->done, pdMS_TO_TICKS(kUploadStallMs)) != pdTRUE)
+        {
+            // Still stuck in a write. Leave the pipe (and the temp file) to the writer, unless
+            // it finished just now, in which case its done signal is on the way.
+            portENTER_CRITICAL(&pipe->mux);
+            abandoned = !pipe->finished;
+            pipe->abandoned = abandoned;
+            portEXIT_CRITICAL(&pipe->mux);
+            if (!abandoned)
+            {
+                xSemaphoreTake(pipe->done, portMAX_DELAY);
+            }
+        }
+        if (abandoned)
+        {
+            err = ESP_ERR_TIMEOUT;
+            *out_msg = "Write stalled";
+            ESP_LOGW(TAG, "Upload writer stalled; abandoning %s.tmp", path);
+        }
+        else
+        {
+            st->write_us += pipe->write_us;
+            if (err == ESP_OK && pipe->failed)
+            {
+                err = ESP_FAIL;
+                *out_msg = "Write failed";
+            }
+        }
+    }
+
+    if (err == ESP_OK)
+    {
+        const int64_t t0 = esp_timer_get_time();
+        if (sdcard_writer_commit(&pipe->writer) != ESP_OK)
+        {
+            err = ESP_FAIL;
+            *out_msg = "Write failed";
+        }
+        st->write_us += (uint64_t)(esp_timer_get_time() - t0);
+    }
+    if (!abandoned)
+    {
+        server_bsp_upload_pipe_free(pipe);
+    }
+
+    st->bytes = req->content_len - remaining;
+    st->total_us = (uint64_t)(esp_timer_get_time() - t_start);
+    ESP_LOGI(TAG, "Upload %s: %u bytes in %u ms (recv %u ms, write %u ms, stall %u ms, %s)",
+             (err == ESP_OK) ? "ok" : "failed", (unsigned)st->bytes, (unsigned)(st->total_us / 1000),
+             (unsigned)(st->recv_us / 1000), (unsigned)(st->write_us / 1000), (unsigned)(st->stall_us / 1000),
+             piped ? "pipelined" : "serial");
+    return err;
+}
+
 esp_err_t post_photos_upload_callback(httpd_req_t *req)
 {
     server_bsp_mark_activity_internal();
@@ -2878,19 +4862,32 @@ esp_err_t post_photos_upload_callback(httpd_req_t *req)
         is_new = true;
     }
 
+    // The body is stored as sent; the extension records the format for the renderer.
+    char content_type[32] = {0};
+    (void)httpd_req_get_hdr_value_str(req, "Content-Type", content_type, sizeof(content_type));
+    const bool is_qoi = (strncasecmp(content_type, "image/qoi", 9) == 0);
+    const bool is_jpeg = (strncasecmp(content_type, "image/jpeg", 10) == 0);
+    const char *ext = is_jpeg ? "jpg" : (is_qoi ? "qoi" : "bmp");
+
+    if (is_jpeg && req->content_len > GUI_JPEG_MAX_FILE_BYTES)
+    {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "JPEG too large");
+        return ESP_OK;
+    }
+
     char filename[128] = {0};
     if (is_landscape)
     {
-        snprintf(filename, sizeof(filename), "%s_L_r0.bmp", id);
+        snprintf(filename, sizeof(filename), "%s_L_r0.%s", id, ext);
     }
     else if (is_portrait)
     {
-        snprintf(filename, sizeof(filename), "%s_P_r90.bmp", id);
+        snprintf(filename, sizeof(filename), "%s_P_r90.%s", id, ext);
     }
     else
     {
         // Square is stored as a single variant (treated like landscape in the library schema).
-        snprintf(filename, sizeof(filename), "%s_S_r0.bmp", id);
+        snprintf(filename, sizeof(filename), "%s_S_r0.%s", id, ext);
     }
 
     if (!server_bsp_photo_name_is_safe(filename))
@@ -2917,53 +4914,56 @@ esp_err_t post_photos_upload_callback(httpd_req_t *req)
             httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Unknown photo id");
             return ESP_OK;
         }
-    }
 
-    // Write body to SD.
-    char *buf = (char *)heap_caps_malloc(READ_LEN_MAX + 1, MALLOC_CAP_SPIRAM);
-    if (!buf)
-    {
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
-        return ESP_OK;
+        // A variant of this photo is about to be replaced.
+        server_bsp_frame_cache_invalidate_photo(id);
     }
 
-    size_t sdcard_len = 0;
-    size_t remaining = req->content_len;
-
+    // Write body to SD. The previous variant (if any) stays in place until the whole body is on the card.
     xEventGroupSetBits(server_groups, set_bit_button(0));
-    sdcard_write_offset(photo_path, NULL, 0, 0);
 
-    while (remaining > 0)
+    // A JPEG or QOI is only known to be decodable (baseline, within size) once its header is on
+    // the card, so it is staged next to the target and renamed into place after the check.
+    const bool is_staged = is_jpeg || is_qoi;
+    char staged_path[200] = {0};
+    snprintf(staged_path, sizeof(staged_path), "%s%s", photo_path, is_staged ? ".new" : "");
+
+    UploadStats stats;
+    const char *fail_msg = "";
+    if (server_bsp_recv_body_to_file(req, staged_path, &stats, &fail_msg) != ESP_OK)
     {
-        int ret = httpd_req_recv(req, buf, MIN(remaining, READ_LEN_MAX));
-        if (ret <= 0)
+        xEventGroupSetBits(server_groups, set_bit_button(3));
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, fail_msg);
+        return ESP_OK;
+    }
+    if (is_staged)
+    {
+        int img_w = 0;
+        int img_h = 0;
+        const bool decodable = is_jpeg ? GUI_Jpeg_GetDimensions(staged_path, &img_w, &img_h)
+                                       : GUI_Qoi_GetDimensions(staged_path, &img_w, &img_h);
+        if (!decodable)
         {
-            if (ret == HTTPD_SOCK_ERR_TIMEOUT)
-            {
-                continue;
-            }
-            heap_caps_free(buf);
+            (void)remove(staged_path);
             xEventGroupSetBits(server_groups, set_bit_button(3));
-            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Receive error");
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                                is_jpeg ? "Unsupported JPEG (baseline only)" : "Unsupported QOI (bad header or too large)");
             return ESP_OK;
         }
 
-        const size_t wr = sdcard_write_offset(photo_path, buf, ret, 1);
-        sdcard_len += wr;
-        remaining -= (size_t)ret;
-        server_bsp_mark_activity_internal();
+        // FATFS rename() does not replace an existing file.
+        (void)remove(photo_path);
+        if (rename(staged_path, photo_path) != 0)
+        {
+            (void)remove(staged_path);
+            xEventGroupSetBits(server_groups, set_bit_button(3));
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Rename failed");
+            return ESP_OK;
+        }
     }
-
-    heap_caps_free(buf);
+    server_bsp_photo_dir_changed();
     xEventGroupSetBits(server_groups, set_bit_button(1));
 
-    if (sdcard_len != req->content_len)
-    {
-        xEventGroupSetBits(server_groups, set_bit_button(3));
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Write failed");
-        return ESP_OK;
-    }
-
     // Persist into library.json only after the file write succeeds.
     if (!s_library_mutex || xSemaphoreTake(s_library_mutex, pdMS_TO_TICKS(2000)) != pdTRUE)
     {
@@ -2979,24 +4979,33 @@ esp_err_t post_photos_upload_callback(httpd_req_t *req)
         return ESP_OK;
     }
 
+    // A variant re-uploaded in the other format gets a new file name; drop the old file once the library points away from it.
+    std::string replaced;
     if (is_portrait)
     {
+        replaced = p->portrait;
         p->portrait = filename;
     }
     else
     {
         // landscape or square
+        replaced = p->landscape;
         p->landscape = filename;
     }
 
-    if (is_new)
-    {
-        s_library_order.push_back(id);
-    }
+    server_bsp_order_append_locked(p->id);
 
-    (void)server_bsp_write_library_to_sd_locked();
+    (void)server_bsp_journal_put_photo_locked(*p);
     xSemaphoreGive(s_library_mutex);
 
+    if (!replaced.empty() && replaced != filename)
+    {
+        char replaced_path[192] = {0};
+        snprintf(replaced_path, sizeof(replaced_path), "%s/%s", kUserPhotoDir, replaced.c_str());
+        (void)remove(replaced_path);
+        server_bsp_photo_dir_changed();
+    }
+
     // Decide whether to switch the display to this photo now.
     // - Legacy clients send landscape+portrait in two requests and expect the device
     //   to wait for the preferred orientation before switching.
@@ -3054,9 +5063,16 @@ esp_err_t post_photos_upload_callback(httpd_req_t *req)
     httpd_resp_set_type(req, "application/json");
     httpd_resp_set_hdr(req, "Cache-Control", "no-store");
 
-    char resp[256] = {0};
-    snprintf(resp, sizeof(resp), "{\"ok\":true,\"id\":\"%s\",\"variant\":\"%s\",\"filename\":\"%s\"}\n",
-             id, variant, filename);
+    const unsigned long long bytes_per_s =
+        stats.total_us ? (unsigned long long)stats.bytes * 1000000ULL / stats.total_us : 0ULL;
+    char resp[512] = {0};
+    snprintf(resp, sizeof(resp),
+             "{\"ok\":true,\"id\":\"%s\",\"variant\":\"%s\",\"filename\":\"%s\","
+             "\"stats\":{\"bytes\":%u,\"ms\":%u,\"bytes_per_s\":%llu,\"recv_ms\":%u,\"write_ms\":%u,"
+             "\"stall_ms\":%u,\"pipelined\":%s}}\n",
+             id, variant, filename, (unsigned)stats.bytes, (unsigned)(stats.total_us / 1000), bytes_per_s,
+             (unsigned)(stats.recv_us / 1000), (unsigned)(stats.write_us / 1000), (unsigned)(stats.stall_us / 1000),
+             stats.piped ? "true" : "false");
     httpd_resp_send(req, resp, HTTPD_RESP_USE_STRLEN);
 
     if (should_redraw)
@@ -3071,11 +5087,8 @@ esp_err_t post_photos_upload_callback(httpd_req_t *req)
 esp_err_t post_dataup_callback(httpd_req_t *req)
 {
     server_bsp_mark_activity_internal();
-    char *buf = (char *)heap_caps_malloc(READ_LEN_MAX + 1, MALLOC_CAP_SPIRAM);
-    size_t sdcard_len = 0;
     size_t remaining = req->content_len;
     const char *uri = req->uri;
-    size_t ret;
     ESP_LOGI("TAG", "用户POST的URI是:%s,字节:%d", uri, remaining);
     xEventGroupSetBits(server_groups, set_bit_button(0));
 
@@ -3102,27 +5115,16 @@ esp_err_t post_dataup_callback(httpd_req_t *req)
     char photo_path[192] = {0};
     snprintf(photo_path, sizeof(photo_path), "%s/img_%06u_r%u.bmp", kUserPhotoDir, (unsigned)seq, (unsigned)rot);
 
-    sdcard_write_offset(photo_path, NULL, 0, 0);
-    while (remaining > 0)
+    UploadStats stats;
+    const char *fail_msg = "";
+    const bool write_ok = (server_bsp_recv_body_to_file(req, photo_path, &stats, &fail_msg) == ESP_OK);
+    if (write_ok)
     {
-        /* Read the data for the request */
-        if ((ret = httpd_req_recv(req, buf, MIN(remaining, READ_LEN_MAX))) <= 0)
-        {
-            if (ret == HTTPD_SOCK_ERR_TIMEOUT)
-            {
-                /* Retry receiving if timeout occurred */
-                continue;
-            }
-            return ESP_FAIL;
-        }
-        size_t req_len = sdcard_write_offset(photo_path, buf, ret, 1);
-        sdcard_len += req_len; // Final comparison result
-        remaining -= ret;      // Subtract the data that has already been received
-        server_bsp_mark_activity_internal();
+        server_bsp_photo_dir_changed();
     }
     xEventGroupSetBits(server_groups, set_bit_button(1));
     bool should_redraw = false;
-    if (sdcard_len == req->content_len)
+    if (write_ok)
     {
         // Current image becomes the newly uploaded photo.
         server_bsp_set_current_image_internal(photo_path, rot);
@@ -3143,8 +5145,6 @@ esp_err_t post_dataup_callback(httpd_req_t *req)
         xEventGroupSetBits(server_groups, set_bit_button(2));
     }
 
-    heap_caps_free(buf);
-    buf = NULL;
     return ESP_OK;
 }
 
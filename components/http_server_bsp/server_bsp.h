@@ -2,6 +2,7 @@
 #define SERVER_BSP_H
 
 #include "freertos/FreeRTOS.h"
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "esp_err.h"
@@ -38,6 +39,17 @@ uint16_t server_bsp_get_image_rotation(void);
 // Full path to the current image on the SD card.
 const char *server_bsp_get_current_image_path(void);
 
+// Path of the pre-rendered frame for the current image at the current rotation
+// (packed 4bpp panel framebuffer, without the status icon overlay).
+// The dither mode is part of the key. Entries are dropped on re-upload, delete,
+// rotation change and dither setting changes.
+// Returns false if the current image is not cacheable (e.g. fallback frames).
+bool server_bsp_get_frame_cache_path(char *out_path, size_t out_path_len);
+
+// Dither mode for rendering the current image: the photo's own setting if it has one,
+// else the global one (/api/dither). A GUI_DitherMode value (see GUI_Dither.h).
+uint8_t server_bsp_get_dither_mode(void);
+
 // Select the next stored photo (lexicographic order) as the current image.
 // Returns ESP_OK if a photo was selected, otherwise an error.
 esp_err_t server_bsp_select_next_photo(void);
@@ -58,6 +70,19 @@ esp_err_t server_bsp_set_slideshow(bool enabled, uint32_t interval_s);
 // Safe to call multiple times.
 void server_bsp_init_state(void);
 
+// Current photo, current image and rotation are written to NVS lazily (batched, ~2 s after
+// the first change). Commits anything still pending; call before deep sleep or restart.
+esp_err_t server_bsp_flush_settings(void);
+
+// Resolve the photos for the next few wakes into RTC memory. Call right before deep sleep.
+void server_bsp_prepare_wake_plan(void);
+
+// Wake fast path: loads NVS state only and advances to the next photo from the RTC plan,
+// without loading the library. Returns false if the plan is missing or stale (library
+// files changed, rotation or current photo changed, slideshow disabled when
+// `require_slideshow`); call server_bsp_init_state() and select the next photo instead.
+bool server_bsp_advance_from_wake_plan(bool require_slideshow);
+
 // Network snapshot (for displaying connection info on the e-paper).
 // NOTE: Strings are null-terminated.
 typedef enum
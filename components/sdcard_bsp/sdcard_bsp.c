@@ -1,10 +1,12 @@
 #include "sdcard_bsp.h"
 #include "esp_err.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
 #include "esp_vfs_fat.h"
 #include "sdmmc_cmd.h"
 #include <dirent.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/unistd.h>
@@ -32,7 +34,7 @@ uint8_t _sdcard_init(void) {
         {
             .format_if_mount_failed = false,
             .max_files              = 5,
-            .allocation_unit_size   = 16 * 1024 * 3,
+            .allocation_unit_size   = SDCARD_ALLOC_UNIT_BYTES,
         };
 
     sdmmc_host_t host = SDMMC_HOST_DEFAULT();
@@ -204,35 +206,262 @@ int sdcard_write_offset(const char *path, const void *data, size_t len, bool app
     return bytes_written;
 }
 
-void list_scan_dir(const char *path) {
-    struct dirent *entry;
-    DIR           *dir = opendir(path);
+/**
+* @brief Open a streaming writer for path (data goes to path + ".tmp" until commit)
+* @param w       Writer state
+* @param path    Final file path
+* @param buf_len Write buffer size (0 = one FAT allocation unit)
+*/
+int sdcard_writer_open(sdcard_writer_t *w, const char *path, size_t buf_len) {
+    if (w == NULL || path == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(w, 0, sizeof(*w));
 
-    if (dir == NULL) {
-        ESP_LOGE("sdscan", "Failed to open directory: %s", path);
+    if (card_host == NULL) {
+        ESP_LOGE(TAG, "SD card not initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (sdmmc_get_status(card_host) != ESP_OK) {
+        ESP_LOGE(TAG, "SD card not ready");
+        return ESP_FAIL;
+    }
+
+    if (snprintf(w->path, sizeof(w->path), "%s", path) >= (int) sizeof(w->path) ||
+        snprintf(w->tmp_path, sizeof(w->tmp_path), "%s.tmp", path) >= (int) sizeof(w->tmp_path)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Internal DMA-capable memory lets FATFS hand whole sectors straight to the SDMMC
+    // driver; PSRAM works too, through the driver's bounce buffer.
+    w->buf_len = buf_len ? buf_len : SDCARD_ALLOC_UNIT_BYTES;
+    w->buf     = (uint8_t *) heap_caps_malloc(w->buf_len, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (w->buf == NULL) {
+        w->buf = (uint8_t *) heap_caps_malloc(w->buf_len, MALLOC_CAP_SPIRAM);
+    }
+    if (w->buf == NULL) {
+        ESP_LOGE(TAG, "Writer buffer allocation failed (%zu bytes)", w->buf_len);
+        return ESP_ERR_NO_MEM;
+    }
+
+    w->f = fopen(w->tmp_path, "wb");
+    if (w->f == NULL) {
+        ESP_LOGE(TAG, "Failed to open file for writing: %s", w->tmp_path);
+        heap_caps_free(w->buf);
+        w->buf = NULL;
+        return ESP_ERR_NOT_FOUND;
+    }
+    // We already write in allocation-unit blocks; stdio buffering would only add a copy.
+    setvbuf(w->f, NULL, _IONBF, 0);
+    return ESP_OK;
+}
+
+static int sdcard_writer_drain(sdcard_writer_t *w) {
+    if (w->fill == 0) {
+        return ESP_OK;
+    }
+    const size_t n = fwrite(w->buf, 1, w->fill, w->f);
+    w->written += n;
+    if (n != w->fill) {
+        ESP_LOGE(TAG, "Write failed (%zu/%zu bytes): %s", n, w->fill, w->tmp_path);
+        w->failed = true;
+        return ESP_FAIL;
+    }
+    w->fill = 0;
+    return ESP_OK;
+}
+
+/**
+* @brief Append data; the SD card only sees full buffers (except for the last one)
+*/
+int sdcard_writer_write(sdcard_writer_t *w, const void *data, size_t len) {
+    if (w == NULL || w->f == NULL || w->failed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const uint8_t *src = (const uint8_t *) data;
+    while (len > 0) {
+        size_t n = w->buf_len - w->fill;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(w->buf + w->fill, src, n);
+        w->fill += n;
+        src += n;
+        len -= n;
+
+        if (w->fill == w->buf_len && sdcard_writer_drain(w) != ESP_OK) {
+            return ESP_FAIL;
+        }
+    }
+    return ESP_OK;
+}
+
+/**
+* @brief Flush, close and move the temp file over the final path
+*/
+int sdcard_writer_commit(sdcard_writer_t *w) {
+    if (w == NULL || w->f == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    int err = w->failed ? ESP_FAIL : sdcard_writer_drain(w);
+    if (fclose(w->f) != 0 && err == ESP_OK) {
+        err = ESP_FAIL;
+    }
+    w->f = NULL;
+    heap_caps_free(w->buf);
+    w->buf = NULL;
+
+    if (err != ESP_OK) {
+        remove(w->tmp_path);
+        return err;
+    }
+
+    // FATFS rename() does not replace an existing file.
+    remove(w->path);
+    if (rename(w->tmp_path, w->path) != 0) {
+        ESP_LOGE(TAG, "Rename failed: %s", w->tmp_path);
+        remove(w->tmp_path);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+/**
+* @brief Drop the temp file; the final path is left untouched
+*/
+void sdcard_writer_abort(sdcard_writer_t *w) {
+    if (w == NULL) {
         return;
     }
+    if (w->f != NULL) {
+        fclose(w->f);
+        w->f = NULL;
+        remove(w->tmp_path);
+    }
+    heap_caps_free(w->buf);
+    w->buf = NULL;
+}
+
+void sdcard_scan_init(sdcard_scan_t *s, const char *path) {
+    memset(s, 0, sizeof(*s));
+    snprintf(s->path, sizeof(s->path), "%s", path);
+}
+
+/**
+* @brief Re-read the directory if it may have changed; the old listing stays on failure
+*/
+int sdcard_scan_refresh(sdcard_scan_t *s) {
+    struct stat st;
+    if (stat(s->path, &st) != 0 || !S_ISDIR(st.st_mode)) {
+        return ESP_FAIL;
+    }
+    if (s->valid && st.st_mtime == s->mtime) {
+        return ESP_OK;
+    }
 
+    DIR *dir = opendir(s->path);
+    if (dir == NULL) {
+        ESP_LOGE("sdscan", "Failed to open directory: %s", s->path);
+        return ESP_FAIL;
+    }
+
+    char    *names = NULL;
+    size_t   len   = 0;
+    size_t   cap   = 0;
+    uint32_t count = 0;
+    int      err   = ESP_OK;
+
+    struct dirent *entry;
     while ((entry = readdir(dir)) != NULL) {
         if (entry->d_type == DT_DIR) {
-            ESP_LOGI("sdscan", "Directory: %s", entry->d_name);
-        } else {
-            if (strstr(entry->d_name, ".bmp") == NULL) {
-                continue;
-            }
-            uint16_t       _strlen   = strlen(path) + strlen(entry->d_name) + 1 + 1;
-            sdcard_node_t *node_data = (sdcard_node_t *) LIST_MALLOC(sizeof(sdcard_node_t));
-            assert(node_data);
-            if (_strlen > 96) {
-                ESP_LOGE("sdcard", "scan file fill _strlen:%d", _strlen);
-                continue;
+            continue;
+        }
+        const size_t n = strlen(entry->d_name) + 1;
+        if (len + n > cap) {
+            const size_t new_cap = (cap * 2 > len + n) ? cap * 2 : len + n + 1024;
+            char *grown = (char *) realloc(names, new_cap);
+            if (grown == NULL) {
+                err = ESP_ERR_NO_MEM;
+                break;
             }
-            node_data->name_score = 0;
-            snprintf(node_data->sdcard_name, sizeof(node_data->sdcard_name) - 2, "%s/%s", path, entry->d_name);
-            list_rpush(sdcard_scan_listhandle, list_node_new(node_data));
+            names = grown;
+            cap   = new_cap;
         }
+        memcpy(names + len, entry->d_name, n);
+        len += n;
+        count++;
     }
     closedir(dir);
+
+    if (err != ESP_OK) {
+        free(names);
+        return err;
+    }
+
+    if (s->generation == 0 || len != s->names_len || (len > 0 && memcmp(names, s->names, len) != 0)) {
+        s->generation++;
+    }
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ (uint8_t) names[i]) * 16777619u;
+    }
+    s->hash      = hash;
+    free(s->names);
+    s->names     = names;
+    s->names_len = len;
+    s->count     = count;
+    s->mtime     = st.st_mtime;
+    s->valid     = true;
+    return ESP_OK;
+}
+
+void sdcard_scan_invalidate(sdcard_scan_t *s) {
+    s->valid = false;
+}
+
+/**
+* @brief Iterate the listing: pass NULL for the first name; returns NULL after the last
+*/
+const char *sdcard_scan_next(const sdcard_scan_t *s, const char *prev) {
+    const char *next = (prev == NULL) ? s->names : prev + strlen(prev) + 1;
+    return (next != NULL && next < s->names + s->names_len) ? next : NULL;
+}
+
+void sdcard_scan_free(sdcard_scan_t *s) {
+    free(s->names);
+    s->names      = NULL;
+    s->names_len  = 0;
+    s->count      = 0;
+    s->generation = 0;
+    s->hash       = 0;
+    s->valid      = false;
+}
+
+void list_scan_dir(const char *path) {
+    sdcard_scan_t scan;
+    sdcard_scan_init(&scan, path);
+    if (sdcard_scan_refresh(&scan) != ESP_OK) {
+        return;
+    }
+
+    for (const char *name = sdcard_scan_next(&scan, NULL); name != NULL; name = sdcard_scan_next(&scan, name)) {
+        if (strstr(name, ".bmp") == NULL) {
+            continue;
+        }
+        if (strlen(path) + strlen(name) + 2 > 96) {
+            ESP_LOGE("sdcard", "scan file name too long: %s", name);
+            continue;
+        }
+        sdcard_node_t *node_data = (sdcard_node_t *) LIST_MALLOC(sizeof(sdcard_node_t));
+        assert(node_data);
+        node_data->name_score = 0;
+        snprintf(node_data->sdcard_name, sizeof(node_data->sdcard_name) - 2, "%s/%s", path, name);
+        list_rpush(sdcard_scan_listhandle, list_node_new(node_data));
+    }
+    sdcard_scan_free(&scan);
 }
 
 int list_iterator(void)
@@ -1,15 +1,53 @@
 #ifndef SDCARD_BSP_H
 #define SDCARD_BSP_H
 
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
 #include "driver/sdmmc_host.h"
 #include "list.h"
 
+// FAT allocation unit used when formatting; also the default sdcard_writer_t buffer size.
+#define SDCARD_ALLOC_UNIT_BYTES (16 * 1024 * 3)
+
 typedef struct
 {
     char sdcard_name[100];
 	int name_score;       
 }sdcard_node_t; 
 
+// Streaming file writer: one open handle, writes in whole buffers, and writes to
+// "<path>.tmp" which only replaces <path> on sdcard_writer_commit().
+typedef struct
+{
+    FILE *f;
+    uint8_t *buf;
+    size_t buf_len;
+    size_t fill;
+    size_t written;
+    bool failed;
+    char path[160];
+    char tmp_path[168];
+}sdcard_writer_t;
+
+// Cached listing of the regular files in one directory. Basenames are packed back to back
+// (NUL-terminated) in `names`. The directory is only read again when its mtime changed or
+// after sdcard_scan_invalidate(); FAT does not update a directory's mtime when files come
+// and go, so code that adds or removes files must invalidate. `generation` changes only
+// when a re-read finds a different listing. `hash` identifies the listing itself, so unlike
+// `generation` it can be compared across restarts.
+typedef struct
+{
+    char path[96];
+    char *names;
+    size_t names_len;
+    uint32_t count;
+    time_t mtime;
+    uint32_t generation;
+    uint32_t hash;
+    bool valid;
+}sdcard_scan_t;
+
 
 
 extern sdmmc_card_t *card_host;
@@ -32,6 +70,17 @@ int sdcard_read_file(const char *path, uint8_t *buffer, size_t *outLen);
 int sdcard_read_offset(const char *path, void *buffer, size_t len, size_t offset);
 int sdcard_write_offset(const char *path, const void *data, size_t len, bool append);
 
+int sdcard_writer_open(sdcard_writer_t *w, const char *path, size_t buf_len);
+int sdcard_writer_write(sdcard_writer_t *w, const void *data, size_t len);
+int sdcard_writer_commit(sdcard_writer_t *w);
+void sdcard_writer_abort(sdcard_writer_t *w);
+
+void sdcard_scan_init(sdcard_scan_t *s, const char *path);
+int sdcard_scan_refresh(sdcard_scan_t *s);
+void sdcard_scan_invalidate(sdcard_scan_t *s);
+const char *sdcard_scan_next(const sdcard_scan_t *s, const char *prev);
+void sdcard_scan_free(sdcard_scan_t *s);
+
 
 #ifdef __cplusplus
 }
@@ -17,8 +17,11 @@
 #include "qrcodegen.h"
 #include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
 
 #include "GUI_BMPfile.h"
+#include "GUI_JPEGfile.h"
+#include "GUI_QOIfile.h"
 #include "GUI_Paint.h"
 #include "epaper_port.h"
 
@@ -715,23 +718,33 @@ static void BrowserUploadDrawWifiIcon48(int x, int y, bool connected, UWORD fg)
     }
 }
 
-static void BrowserUploadDrawStatusIconsOverlayIfEnabled(void)
-{
-    if (!server_bsp_get_status_icons_enabled())
-    {
-        return;
-    }
+// Status icons sit in the bottom-right corner: [Wi-Fi][battery], 48px each.
+static constexpr int kStatusIconSize = 48;
 
-    constexpr int kSize = 48;
+static void BrowserUploadGetStatusIconsLayout(int *x_wifi, int *x_batt, int *y)
+{
     constexpr int kGap = 6;
     constexpr int kMargin = 8;
 
     const int W = (int)Paint.Width;
     const int H = (int)Paint.Height;
 
-    const int y = H - kMargin - kSize;
-    const int x_batt = W - kMargin - kSize;
-    const int x_wifi = x_batt - kGap - kSize;
+    *y = H - kMargin - kStatusIconSize;
+    *x_batt = W - kMargin - kStatusIconSize;
+    *x_wifi = *x_batt - kGap - kStatusIconSize;
+}
+
+static void BrowserUploadDrawStatusIconsOverlayIfEnabled(void)
+{
+    if (!server_bsp_get_status_icons_enabled())
+    {
+        return;
+    }
+
+    int x_wifi = 0;
+    int x_batt = 0;
+    int y = 0;
+    BrowserUploadGetStatusIconsLayout(&x_wifi, &x_batt, &y);
 
     // Battery badge.
     int batt_pct = -1;
@@ -1186,6 +1199,341 @@ static void BrowserUploadRenderConnectionInfoOnce(void)
     heap_caps_free(epd_blackImage);
 }
 
+// Band pipeline state for the frame being drawn by the display task. Finished panel rows
+// are released to epaper_port while the rest is still rendering; the status overlay is
+// drawn as soon as the image rows under it are final, and those rows are kept aside so
+// the frame cache never stores the overlay.
+struct BrowserUploadBands
+{
+    uint8_t *image;
+    bool active;           // Pipeline running (otherwise the frame is sent at the end)
+    bool overlay_pending;  // Overlay enabled but not drawn yet
+    bool overlay_drawn;
+    uint16_t overlay_row0; // Panel rows touched by the overlay: [row0, row1)
+    uint16_t overlay_row1;
+    uint8_t *saved_rows;   // Image rows under the overlay, before it was drawn
+    uint16_t released;
+};
+static BrowserUploadBands s_bands = {};
+
+static constexpr uint32_t kBrowserUploadRowBytes = EXAMPLE_LCD_WIDTH / 2;
+
+static void BrowserUploadBandsDrawOverlay(void)
+{
+    s_bands.overlay_pending = false;
+    s_bands.overlay_drawn = true;
+
+    const size_t len = (size_t)(s_bands.overlay_row1 - s_bands.overlay_row0) * kBrowserUploadRowBytes;
+    s_bands.saved_rows = (uint8_t *)heap_caps_malloc(len, MALLOC_CAP_SPIRAM);
+    if (s_bands.saved_rows)
+    {
+        memcpy(s_bands.saved_rows, s_bands.image + (size_t)s_bands.overlay_row0 * kBrowserUploadRowBytes, len);
+    }
+    BrowserUploadDrawStatusIconsOverlayIfEnabled();
+}
+
+// Without `stream` the frame is sent whole by BrowserUploadBandsFinish().
+static void BrowserUploadBandsBegin(uint8_t *image, bool stream)
+{
+    s_bands = {};
+    s_bands.image = image;
+
+    if (server_bsp_get_status_icons_enabled())
+    {
+        int x_wifi = 0;
+        int x_batt = 0;
+        int y = 0;
+        BrowserUploadGetStatusIconsLayout(&x_wifi, &x_batt, &y);
+
+        // Logical bounding box of the badges (plus a pixel of slack), mapped to panel rows.
+        const int x0 = (x_wifi >= 0) ? x_wifi : x_batt;
+        const UWORD lx0 = (UWORD)((x0 > 0) ? x0 - 1 : 0);
+        const UWORD ly0 = (UWORD)((y > 0) ? y - 1 : 0);
+        const UWORD lx1 = (UWORD)BrowserUploadMinInt(x_batt + kStatusIconSize, (int)Paint.Width - 1);
+        const UWORD ly1 = (UWORD)BrowserUploadMinInt(y + kStatusIconSize, (int)Paint.Height - 1);
+
+        const UWORD corners[4] = {Paint_GetMemoryRow(lx0, ly0), Paint_GetMemoryRow(lx1, ly0),
+                                  Paint_GetMemoryRow(lx0, ly1), Paint_GetMemoryRow(lx1, ly1)};
+        UWORD r0 = corners[0];
+        UWORD r1 = corners[0];
+        for (UWORD r : corners)
+        {
+            r0 = (r < r0) ? r : r0;
+            r1 = (r > r1) ? r : r1;
+        }
+        s_bands.overlay_pending = true;
+        s_bands.overlay_row0 = r0;
+        s_bands.overlay_row1 = (uint16_t)BrowserUploadMinInt(r1 + 1, EXAMPLE_LCD_HEIGHT);
+    }
+
+    if (!stream)
+    {
+        return;
+    }
+    s_bands.active = (epaper_port_pipeline_begin(image) == ESP_OK);
+    if (!s_bands.active)
+    {
+        ESP_LOGW("browser_upload", "Band pipeline unavailable; sending the frame after rendering");
+    }
+}
+
+// Panel rows [0, rows) of the image are final.
+static void BrowserUploadBandsRelease(uint16_t rows)
+{
+    if (s_bands.overlay_pending && rows > s_bands.overlay_row0)
+    {
+        if (rows >= s_bands.overlay_row1)
+        {
+            BrowserUploadBandsDrawOverlay();
+        }
+        else
+        {
+            rows = s_bands.overlay_row0;
+        }
+    }
+
+    if (rows > s_bands.released)
+    {
+        s_bands.released = rows;
+        if (s_bands.active)
+        {
+            epaper_port_pipeline_release_rows(rows);
+        }
+    }
+}
+
+static void BrowserUploadBandsFinish(void)
+{
+    if (s_bands.overlay_pending)
+    {
+        BrowserUploadBandsDrawOverlay();
+    }
+
+    // Blink green once before the panel refresh.
+    led_set(LED_PIN_Green, LED_ON);
+    vTaskDelay(pdMS_TO_TICKS(120));
+    led_set(LED_PIN_Green, LED_OFF);
+
+    bool resend = !s_bands.active;
+    if (s_bands.active)
+    {
+        const esp_err_t err = epaper_port_pipeline_end(true);
+        if (err != ESP_OK)
+        {
+            ESP_LOGW("browser_upload", "Band pipeline failed (%s); resending frame", esp_err_to_name(err));
+            resend = true;
+        }
+    }
+    if (resend)
+    {
+        epaper_port_display(s_bands.image);
+    }
+
+    if (s_bands.saved_rows)
+    {
+        heap_caps_free(s_bands.saved_rows);
+    }
+    s_bands = {};
+}
+
+// At 0/180 each output row of the fit renderer is a panel row, produced top-down in panel
+// order. At 90/270 each one is a panel column that crosses every panel row the image
+// covers, so no band is final before the last row and there is nothing to stream.
+static bool BrowserUploadRowsAreBands(void)
+{
+    return Paint.Rotate == ROTATE_0 || Paint.Rotate == ROTATE_180;
+}
+
+// Fit renderer progress (only streamed when BrowserUploadRowsAreBands()).
+static void BrowserUploadOnRowDrawn(UWORD y, void *ctx)
+{
+    (void)ctx;
+    if (BrowserUploadRowsAreBands())
+    {
+        BrowserUploadBandsRelease((uint16_t)(Paint_GetMemoryRow(0, y) + 1));
+    }
+}
+
+// Loads a pre-rendered frame if it is complete and not older than the source image.
+// It is read whole before anything is sent, so an unchanged frame can be recognised
+// by its hash and skipped outright instead of going over SPI first.
+static bool BrowserUploadLoadFrameCache(const char *cache_path, const char *img_path, uint8_t *image, uint32_t imagesize)
+{
+    struct stat cst = {};
+    struct stat ist = {};
+    if (stat(cache_path, &cst) != 0 || (uint32_t)cst.st_size != imagesize)
+    {
+        return false;
+    }
+    if (stat(img_path, &ist) != 0 || cst.st_mtime < ist.st_mtime)
+    {
+        return false;
+    }
+
+    FILE *fp = fopen(cache_path, "rb");
+    if (!fp)
+    {
+        return false;
+    }
+
+    const bool ok = (fread(image, 1, imagesize, fp) == imagesize);
+    fclose(fp);
+
+    if (!ok)
+    {
+        // The caller re-renders into this buffer; drop what was read.
+        Paint_Clear(EPD_7IN3E_WHITE);
+    }
+    return ok;
+}
+
+// Writes via a temp file so a power cut never leaves a truncated entry behind.
+// Rows under an already drawn overlay are taken from the saved copy.
+static void BrowserUploadStoreFrameCache(const char *cache_path, const uint8_t *image, uint32_t imagesize)
+{
+    char tmp_path[232] = {0};
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", cache_path);
+
+    FILE *fp = fopen(tmp_path, "wb");
+    if (!fp)
+    {
+        ESP_LOGW("browser_upload", "Frame cache: cannot create %s", tmp_path);
+        return;
+    }
+
+    bool ok = true;
+    if (s_bands.saved_rows)
+    {
+        const uint32_t a = (uint32_t)s_bands.overlay_row0 * kBrowserUploadRowBytes;
+        const uint32_t b = (uint32_t)s_bands.overlay_row1 * kBrowserUploadRowBytes;
+        ok = (fwrite(image, 1, a, fp) == a) && (fwrite(s_bands.saved_rows, 1, b - a, fp) == b - a) &&
+             (fwrite(image + b, 1, imagesize - b, fp) == imagesize - b);
+    }
+    else if (s_bands.overlay_drawn)
+    {
+        // Overlay already drawn but its rows could not be saved; don't cache it.
+        ok = false;
+    }
+    else
+    {
+        ok = (fwrite(image, 1, imagesize, fp) == imagesize);
+    }
+    ok = (fclose(fp) == 0) && ok;
+
+    (void)remove(cache_path);
+    if (!ok || rename(tmp_path, cache_path) != 0)
+    {
+        ESP_LOGW("browser_upload", "Frame cache: write failed for %s", cache_path);
+        (void)remove(tmp_path);
+    }
+}
+
+// Stored photos are BMP, QOI or JPEG; the extension picks the decoder.
+static bool BrowserUploadGetImageDimensions(const char *img_path, int *iw, int *ih)
+{
+    if (GUI_Jpeg_IsJpegPath(img_path))
+    {
+        return GUI_Jpeg_GetDimensions(img_path, iw, ih);
+    }
+    if (GUI_Qoi_IsQoiPath(img_path))
+    {
+        return GUI_Qoi_GetDimensions(img_path, iw, ih);
+    }
+    return GUI_Bmp_GetDimensions(img_path, iw, ih);
+}
+
+// True only when every row of the image was drawn.
+static bool BrowserUploadDrawImageFit(const char *img_path, bool allow_upscale)
+{
+    const GUI_DitherMode dither = (GUI_DitherMode)server_bsp_get_dither_mode();
+    if (GUI_Jpeg_IsJpegPath(img_path))
+    {
+        return GUI_DrawJpeg_RGB_6Color_FitRows(img_path, 0, 0, Paint.Width, Paint.Height, allow_upscale, dither,
+                                               BrowserUploadOnRowDrawn, NULL) != 0;
+    }
+    if (GUI_Qoi_IsQoiPath(img_path))
+    {
+        return GUI_DrawQoi_RGB_6Color_FitRows(img_path, 0, 0, Paint.Width, Paint.Height, allow_upscale, dither,
+                                              BrowserUploadOnRowDrawn, NULL) != 0;
+    }
+    return GUI_DrawBmp_RGB_6Color_FitRows(img_path, 0, 0, Paint.Width, Paint.Height, allow_upscale, dither,
+                                          BrowserUploadOnRowDrawn, NULL) != 0;
+}
+
+// Renders img_path into the selected paint buffer, releasing finished rows to the band
+// pipeline, and stores the frame under cache_path (if set) when every row was drawn.
+static void BrowserUploadRenderCurrentImage(uint8_t *image, uint32_t imagesize, const char *img_path,
+                                            const char *cache_path, int64_t t0)
+{
+    int iw = 0;
+    int ih = 0;
+    const bool ok = BrowserUploadGetImageDimensions(img_path, &iw, &ih);
+    if (ok && iw > 0 && ih > 0)
+    {
+        const bool img_square = (iw == ih);
+        const bool img_landscape = (iw > ih);
+        const bool frame_landscape = (Paint.Width >= Paint.Height);
+        const bool mismatch = (!img_square) && (img_landscape != frame_landscape);
+
+        // If orientations differ, fit-scale to the frame; otherwise just center (no upscale).
+        const bool allow_upscale = mismatch;
+        if (!BrowserUploadDrawImageFit(img_path, allow_upscale))
+        {
+            // Whatever was drawn is shown, but a blank or partial frame must not be cached.
+            ESP_LOGW("browser_upload", "Render of %s failed after %lld ms", img_path,
+                     (long long)((esp_timer_get_time() - t0) / 1000));
+            return;
+        }
+        ESP_LOGI("browser_upload", "Rendered %s in %lld ms", img_path, (long long)((esp_timer_get_time() - t0) / 1000));
+
+        if (cache_path)
+        {
+            BrowserUploadStoreFrameCache(cache_path, image, imagesize);
+        }
+    }
+    else if (!GUI_Jpeg_IsJpegPath(img_path) && !GUI_Qoi_IsQoiPath(img_path))
+    {
+        // Fallback: best-effort draw without scaling (not cached).
+        GUI_ReadBmp_RGB_6Color(img_path, 0, 0);
+    }
+}
+
+// Draws the current image into the selected paint buffer (which must be cleared and
+// set up for the current rotation), then calls BrowserUploadBandsFinish() to show it.
+// Reuses the pre-rendered frame when available; otherwise finished rows go to the
+// band pipeline as they are rendered. At 90/270 the frame is sent whole after rendering,
+// which also lets epaper_port_display() skip it when it is unchanged.
+static void BrowserUploadShowCurrentImage(uint8_t *image, uint32_t imagesize)
+{
+    const char *img_path = server_bsp_get_current_image_path();
+    if (!img_path || img_path[0] == '\0')
+    {
+        BrowserUploadBandsBegin(image, false);
+        BrowserUploadBandsFinish();
+        return;
+    }
+
+    const int64_t t0 = esp_timer_get_time();
+
+    char cache_path[224] = {0};
+    const bool cacheable = server_bsp_get_frame_cache_path(cache_path, sizeof(cache_path));
+    if (cacheable && BrowserUploadLoadFrameCache(cache_path, img_path, image, imagesize))
+    {
+        ESP_LOGI("browser_upload", "Frame cache hit: %s (%lld ms)", cache_path,
+                 (long long)((esp_timer_get_time() - t0) / 1000));
+        // Complete before anything is sent: epaper_port_display() skips the transfer and
+        // the refresh when it matches what the panel already shows.
+        BrowserUploadBandsBegin(image, false);
+        BrowserUploadBandsRelease(EXAMPLE_LCD_HEIGHT);
+        BrowserUploadBandsFinish();
+        return;
+    }
+
+    BrowserUploadBandsBegin(image, BrowserUploadRowsAreBands());
+    BrowserUploadRenderCurrentImage(image, imagesize, img_path, cacheable ? cache_path : NULL, t0);
+    BrowserUploadBandsFinish();
+}
+
 // Minimal "app" that:
 // - runs a Wi-Fi AP + HTTP server (see components/http_server_bsp)
 // - accepts a raw 24-bit BMP via POST /dataUP
@@ -1244,39 +1592,9 @@ static void BrowserImageUploadDisplayTask(void *arg)
             Paint_SelectImage(epd_blackImage);
             Paint_Clear(EPD_7IN3E_WHITE);
 
-            const char *img_path = server_bsp_get_current_image_path();
-            if (img_path && img_path[0] != '\0')
-            {
-                int iw = 0;
-                int ih = 0;
-                const bool ok = GUI_Bmp_GetDimensions(img_path, &iw, &ih);
-                if (ok && iw > 0 && ih > 0)
-                {
-                    const bool img_square = (iw == ih);
-                    const bool img_landscape = (iw > ih);
-                    const bool frame_landscape = (Paint.Width >= Paint.Height);
-                    const bool mismatch = (!img_square) && (img_landscape != frame_landscape);
-
-                    // If orientations differ, fit-scale to the frame; otherwise just center (no upscale).
-                    const bool allow_upscale = mismatch;
-                    GUI_DrawBmp_RGB_6Color_Fit(img_path, 0, 0, Paint.Width, Paint.Height, allow_upscale);
-                }
-                else
-                {
-                    // Fallback: best-effort draw without scaling.
-                    GUI_ReadBmp_RGB_6Color(img_path, 0, 0);
-                }
-            }
-
-            // Optional status overlay (battery + Wi-Fi).
-            BrowserUploadDrawStatusIconsOverlayIfEnabled();
-
-            // Blink green once before the panel refresh.
-            led_set(LED_PIN_Green, LED_ON);
-            vTaskDelay(pdMS_TO_TICKS(120));
-            led_set(LED_PIN_Green, LED_OFF);
-
-            epaper_port_display(epd_blackImage);
+            // Render and send in bands; the optional status overlay (battery + Wi-Fi)
+            // is drawn as part of it.
+            BrowserUploadShowCurrentImage(epd_blackImage, imagesize);
 
             xSemaphoreGive(epaper_gui_semapHandle);
         }
@@ -1305,37 +1623,9 @@ static void BrowserUploadRenderCurrentOnce(void)
         Paint_SelectImage(epd_blackImage);
         Paint_Clear(EPD_7IN3E_WHITE);
 
-        const char *img_path = server_bsp_get_current_image_path();
-        if (img_path && img_path[0] != '\0')
-        {
-            int iw = 0;
-            int ih = 0;
-            const bool ok = GUI_Bmp_GetDimensions(img_path, &iw, &ih);
-            if (ok && iw > 0 && ih > 0)
-            {
-                const bool img_square = (iw == ih);
-                const bool img_landscape = (iw > ih);
-                const bool frame_landscape = (Paint.Width >= Paint.Height);
-                const bool mismatch = (!img_square) && (img_landscape != frame_landscape);
-
-                const bool allow_upscale = mismatch;
-                GUI_DrawBmp_RGB_6Color_Fit(img_path, 0, 0, Paint.Width, Paint.Height, allow_upscale);
-            }
-            else
-            {
-                GUI_ReadBmp_RGB_6Color(img_path, 0, 0);
-            }
-        }
-
-        // Optional status overlay (battery + Wi-Fi).
-        BrowserUploadDrawStatusIconsOverlayIfEnabled();
-
-        // Blink green once before the panel refresh.
-        led_set(LED_PIN_Green, LED_ON);
-        vTaskDelay(pdMS_TO_TICKS(120));
-        led_set(LED_PIN_Green, LED_OFF);
-
-        epaper_port_display(epd_blackImage);
+        // Render and send in bands; the optional status overlay (battery + Wi-Fi)
+        // is drawn as part of it.
+        BrowserUploadShowCurrentImage(epd_blackImage, imagesize);
         xSemaphoreGive(epaper_gui_semapHandle);
     }
 
@@ -1404,6 +1694,9 @@ static void BrowserUploadIdleSleepTask(void *arg)
                 ESP_ERROR_CHECK(esp_sleep_enable_timer_wakeup(interval_us));
             }
 
+            server_bsp_prepare_wake_plan();
+            (void)server_bsp_flush_settings();
+
             vTaskDelay(pdMS_TO_TICKS(200));
             esp_deep_sleep_start();
         }
@@ -1425,6 +1718,7 @@ static void key1_button_user_Task(void *arg)
             xEventGroupClearBits(key_groups, set_bit_button(1));
             server_bsp_mark_activity();
             ESP_LOGI("key", "Long press detected, rebooting");
+            (void)server_bsp_flush_settings();
             vTaskDelay(pdMS_TO_TICKS(100));
             esp_restart();
         }
@@ -1532,8 +1826,20 @@ uint8_t User_Mode_init(void)
     if (sdcard_win == 0)
         return 0;
 
-    // Load rotation/slideshow/library state from NVS/SD.
-    server_bsp_init_state();
+    const esp_sleep_wakeup_cause_t wake = esp_sleep_get_wakeup_cause();
+
+    // Slideshow and key wakes only advance one photo: take it from the RTC wake plan when
+    // possible so they skip the library load. Otherwise load rotation/slideshow/library
+    // state from NVS/SD.
+    bool wake_from_plan = false;
+    if (wake == ESP_SLEEP_WAKEUP_TIMER || wake == ESP_SLEEP_WAKEUP_EXT1)
+    {
+        wake_from_plan = server_bsp_advance_from_wake_plan(wake == ESP_SLEEP_WAKEUP_TIMER);
+    }
+    if (!wake_from_plan)
+    {
+        server_bsp_init_state();
+    }
 
     // Ensure the server event group exists even if the HTTP server is disabled.
     // Some tasks (e.g. BrowserImageUploadDisplayTask) wait on this handle.
@@ -1542,8 +1848,6 @@ uint8_t User_Mode_init(void)
         server_groups = xEventGroupCreate();
     }
 
-    const esp_sleep_wakeup_cause_t wake = esp_sleep_get_wakeup_cause();
-
     // Only refresh the e-paper at boot when the selected photo actually changed.
     // E-paper retains its image without power, so a "cold" start usually does not require a refresh.
     bool need_initial_render = false;
@@ -1552,7 +1856,12 @@ uint8_t User_Mode_init(void)
     if (wake == ESP_SLEEP_WAKEUP_TIMER && server_bsp_get_slideshow_enabled())
     {
         ESP_LOGI("browser_upload", "Woke from timer for slideshow; advancing photo and returning to sleep");
-        (void)server_bsp_select_next_photo();
+        if (!wake_from_plan)
+        {
+            (void)server_bsp_select_next_photo();
+        }
+        // Wi-Fi stays off on this path, so the CPU can light-sleep through the panel refresh.
+        epaper_port_set_busy_power(EPAPER_BUSY_POWER_LIGHT_SLEEP);
         BrowserUploadRenderCurrentOnce();
 
         constexpr gpio_num_t kWakeKeyPin = GPIO_NUM_4; // Key button (active-low)
@@ -1573,6 +1882,12 @@ uint8_t User_Mode_init(void)
         const uint64_t interval_us = (uint64_t)server_bsp_get_slideshow_interval_s() * 1000000ULL;
         ESP_ERROR_CHECK(esp_sleep_enable_timer_wakeup(interval_us));
 
+        server_bsp_prepare_wake_plan();
+        (void)server_bsp_flush_settings();
+        ESP_LOGI("browser_upload", "Wake handled in %lld ms (%s, panel busy %lu ms)",
+                 (long long)(esp_timer_get_time() / 1000), wake_from_plan ? "wake plan" : "library load",
+                 (unsigned long)(epaper_port_get_last_busy_us() / 1000));
+
         vTaskDelay(pdMS_TO_TICKS(200));
         esp_deep_sleep_start();
     }
@@ -1581,7 +1896,12 @@ uint8_t User_Mode_init(void)
     if (wake == ESP_SLEEP_WAKEUP_EXT1)
     {
         ESP_LOGI("browser_upload", "Woke from key button; advancing photo and returning to sleep");
-        (void)server_bsp_select_next_photo();
+        if (!wake_from_plan)
+        {
+            (void)server_bsp_select_next_photo();
+        }
+        // Wi-Fi stays off on this path, so the CPU can light-sleep through the panel refresh.
+        epaper_port_set_busy_power(EPAPER_BUSY_POWER_LIGHT_SLEEP);
         BrowserUploadRenderCurrentOnce();
 
         constexpr gpio_num_t kWakeKeyPin = GPIO_NUM_4; // Key button (active-low)
@@ -1624,6 +1944,12 @@ uint8_t User_Mode_init(void)
             ESP_ERROR_CHECK(esp_sleep_enable_timer_wakeup(interval_us));
         }
 
+        server_bsp_prepare_wake_plan();
+        (void)server_bsp_flush_settings();
+        ESP_LOGI("browser_upload", "Wake handled in %lld ms (%s, panel busy %lu ms)",
+                 (long long)(esp_timer_get_time() / 1000), wake_from_plan ? "wake plan" : "library load",
+                 (unsigned long)(epaper_port_get_last_busy_us() / 1000));
+
         vTaskDelay(pdMS_TO_TICKS(200));
         esp_deep_sleep_start();
     }
@@ -1,9 +1,12 @@
 import { http, HttpResponse, delay } from 'msw'
 
+const DITHER_MODES = ['floyd-steinberg', 'fs-serpentine', 'atkinson', 'stucki', 'bayer', 'blue-noise']
+
 interface Photo {
   id: string
   landscape: string
   portrait: string
+  dither?: string
 }
 
 const ALLOWED_INTERVALS = new Set([300, 600, 900, 1800, 3600, 10800, 21600, 86400, 259200, 604800])
@@ -13,6 +16,7 @@ let currentRotation = 180
 let slideshowEnabled = false
 let slideshowIntervalS = 3600
 let statusIconsEnabled = false
+let ditherMode = 'floyd-steinberg'
 
 let photos: Photo[] = [
   { id: 'img_000001', landscape: 'img_000001_L_r0.bmp', portrait: 'img_000001_P_r90.bmp' },
@@ -101,15 +105,51 @@ export const handlers = [
     return HttpResponse.json({ enabled: statusIconsEnabled })
   }),
 
+  // Dither mode (global or per photo)
+  http.get('*/api/dither', async () => {
+    await delay(120)
+    return HttpResponse.json({ mode: ditherMode, modes: DITHER_MODES })
+  }),
+
+  http.post('*/api/dither', async ({ request }) => {
+    await delay(160)
+
+    const body = (await request.json()) as { id?: unknown; mode?: unknown }
+    const validMode = typeof body.mode === 'string' && DITHER_MODES.includes(body.mode)
+
+    if (typeof body.id === 'string') {
+      const photo = photos.find((p) => p.id === body.id)
+      if (!photo) return new HttpResponse('Photo not found', { status: 404 })
+      if (body.mode === null || body.mode === undefined) {
+        delete photo.dither
+      } else if (validMode) {
+        photo.dither = body.mode as string
+      } else {
+        return new HttpResponse('Missing/invalid mode', { status: 400 })
+      }
+      return HttpResponse.json({ id: photo.id, dither: photo.dither ?? null })
+    }
+
+    if (!validMode) return new HttpResponse('Missing/invalid mode', { status: 400 })
+    ditherMode = body.mode as string
+    return HttpResponse.json({ mode: ditherMode, modes: DITHER_MODES })
+  }),
+
   // Get photos
-  http.get('*/api/photos', async () => {
+  http.get('*/api/photos', async ({ request }) => {
     await delay(200)
+    const params = new URL(request.url).searchParams
+    const offset = Number(params.get('offset') ?? 0) || 0
+    const limit = Number(params.get('limit') ?? 0) || 0
+    const page = photos.slice(offset, limit > 0 ? offset + limit : undefined)
     return HttpResponse.json({
       rotation: currentRotation,
       current: currentPhotoId,
       displaying: chooseDisplaying(),
-      photos,
-      count: photos.length,
+      total: photos.length,
+      offset,
+      photos: page,
+      count: page.length,
     })
   }),
 
@@ -119,7 +159,7 @@ export const handlers = [
     const filename = params.filename as string
 
     // Validate filename format
-    if (!filename || !filename.endsWith('.bmp')) {
+    if (!filename || !/\.(bmp|qoi|jpg)$/.test(filename)) {
       return new HttpResponse('Invalid filename', { status: 400 })
     }
 
@@ -129,7 +169,26 @@ export const handlers = [
       return new HttpResponse('Photo file not found', { status: 404 })
     }
 
-    // Generate a minimal valid BMP (1x1 pixel, 24-bit color)
+    if (filename.endsWith('.qoi')) {
+      // Minimal valid QOI (1x1 gray pixel): header, QOI_OP_RGB, end marker
+      const qoiData = new Uint8Array([
+        0x71, 0x6f, 0x69, 0x66, // Magic 'qoif'
+        0x00, 0x00, 0x00, 0x01, // Width (1 pixel, big-endian)
+        0x00, 0x00, 0x00, 0x01, // Height (1 pixel, big-endian)
+        0x03, 0x00, // Channels (RGB), colorspace (sRGB)
+        0xfe, 0x80, 0x80, 0x80, // QOI_OP_RGB gray pixel
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, // End marker
+      ])
+
+      return new HttpResponse(qoiData, {
+        headers: {
+          'Content-Type': 'image/qoi',
+          'Cache-Control': 'public, max-age=3600',
+        },
+      })
+    }
+
+    // Generate a minimal valid BMP (1x1 pixel, 24-bit color); also stands in for .jpg files
     // BMP Header (14 bytes) + DIB Header (40 bytes) + pixel data (3 bytes + 1 padding)
     const bmpData = new Uint8Array([
       // BMP Header
@@ -243,7 +302,7 @@ export const handlers = [
     return HttpResponse.json({ ok: true })
   }),
 
-  // Upload variant (raw BMP)
+  // Upload variant (raw JPEG, QOI or BMP)
   http.post('*/api/photos/upload', async ({ request }) => {
     await delay(800)
 
@@ -262,10 +321,13 @@ export const handlers = [
     const arrayBuffer = await blob.arrayBuffer()
     const view = new DataView(arrayBuffer)
 
-    // Validate it's a BMP (check for "BM" magic bytes)
-    if (view.getUint16(0, true) !== 0x4d42) {
+    // Validate it's a JPEG (SOI marker), QOI ("qoif") or BMP ("BM") file
+    const isJpeg = view.byteLength >= 2 && view.getUint16(0, false) === 0xffd8
+    const isQoi = view.byteLength >= 4 && view.getUint32(0, false) === 0x716f6966
+    if (!isJpeg && !isQoi && view.getUint16(0, true) !== 0x4d42) {
       return new HttpResponse('Upload failed', { status: 400 })
     }
+    const ext = isJpeg ? 'jpg' : isQoi ? 'qoi' : 'bmp'
 
     const isNew = !idParam
     const id = idParam || allocateId()
@@ -280,7 +342,7 @@ export const handlers = [
     }
 
     const filename =
-      variant === 'landscape' ? `${id}_L_r0.bmp` : variant === 'portrait' ? `${id}_P_r90.bmp` : `${id}_S_r0.bmp`
+      variant === 'landscape' ? `${id}_L_r0.${ext}` : variant === 'portrait' ? `${id}_P_r90.${ext}` : `${id}_S_r0.${ext}`
 
     if (variant === 'portrait') p.portrait = filename
     else p.landscape = filename
@@ -297,6 +359,7 @@ export function resetMockState() {
   slideshowEnabled = false
   slideshowIntervalS = 3600
   statusIconsEnabled = false
+  ditherMode = 'floyd-steinberg'
 
   photos = [
     { id: 'img_000001', landscape: 'img_000001_L_r0.bmp', portrait: 'img_000001_P_r90.bmp' },
@@ -314,6 +377,7 @@ export function getMockState() {
     slideshowEnabled,
     slideshowIntervalS,
     statusIconsEnabled,
+    ditherMode,
     currentPhotoId,
     displaying: chooseDisplaying(),
     photos: [...photos],
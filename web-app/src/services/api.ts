@@ -1,9 +1,12 @@
-import type { PhotoFrameState } from '@/stores/photoframe'
+import type { DitherMode, PhotoFrameState } from '@/stores/photoframe'
 
 // In production (served from the device), always use same-origin.
 // In dev, you can point at a device IP via VITE_API_BASE.
 const API_BASE = import.meta.env.DEV ? (import.meta.env.VITE_API_BASE || '') : ''
 
+// Last /api/photos body and its ETag; an unchanged list comes back as a bodyless 304.
+let photosCache: { etag: string; text: string } | null = null
+
 export interface RotationResponse {
   rotation: number
 }
@@ -31,6 +34,16 @@ export interface StatusIconsSettings {
   enabled: boolean
 }
 
+export interface DitherSettings {
+  mode: DitherMode
+  modes: DitherMode[]
+}
+
+export interface PhotoDitherResponse {
+  id: string
+  dither: DitherMode | null
+}
+
 export interface ReorderPhotosRequest {
   order: string[]
 }
@@ -116,10 +129,44 @@ export const api = {
     return await response.json()
   },
 
+  async getDither(): Promise<DitherSettings> {
+    const response = await fetch(`${API_BASE}/api/dither`)
+    if (!response.ok) throw new Error('Failed to fetch dither settings')
+    return await response.json()
+  },
+
+  async setDither(mode: DitherMode): Promise<DitherSettings> {
+    const response = await fetch(`${API_BASE}/api/dither`, {
+      method: 'POST',
+      headers: { 'Content-Type': 'application/json' },
+      body: JSON.stringify({ mode }),
+    })
+    if (!response.ok) throw new Error('Failed to save dither setting')
+    return await response.json()
+  },
+
+  // null puts the photo back on the global mode.
+  async setPhotoDither(id: string, mode: DitherMode | null): Promise<PhotoDitherResponse> {
+    const response = await fetch(`${API_BASE}/api/dither`, {
+      method: 'POST',
+      headers: { 'Content-Type': 'application/json' },
+      body: JSON.stringify({ id, mode }),
+    })
+    if (!response.ok) throw new Error('Failed to save photo dither setting')
+    return await response.json()
+  },
+
   async getPhotos(): Promise<PhotoFrameState> {
-    const response = await fetch(`${API_BASE}/api/photos`)
+    const headers: Record<string, string> = photosCache ? { 'If-None-Match': photosCache.etag } : {}
+    const response = await fetch(`${API_BASE}/api/photos`, { headers, cache: 'no-store' })
+    // Parse the cached text again: callers may rearrange the array they were given.
+    if (response.status === 304 && photosCache) return JSON.parse(photosCache.text)
     if (!response.ok) throw new Error('Failed to fetch photos')
-    return await response.json()
+
+    const text = await response.text()
+    const etag = response.headers.get('ETag')
+    photosCache = etag ? { etag, text } : null
+    return JSON.parse(text)
   },
 
   async reorderPhotos(order: string[]): Promise<ReorderPhotosResponse> {
@@ -161,7 +208,7 @@ export const api = {
     return await response.json()
   },
 
-  async uploadPhoto(orientation: UploadOrientation, bmpData: Blob, id?: string): Promise<UploadPhotoResponse> {
+  async uploadPhoto(orientation: UploadOrientation, photoData: Blob, id?: string): Promise<UploadPhotoResponse> {
     // New firmware supports `orientation=` (landscape|portrait|square).
     // We also send `variant=` for backward compatibility.
     const params = new URLSearchParams({ orientation })
@@ -170,8 +217,9 @@ export const api = {
 
     const response = await fetch(`${API_BASE}/api/photos/upload?${params.toString()}`, {
       method: 'POST',
-      headers: { 'Content-Type': 'image/bmp' },
-      body: bmpData,
+      // The firmware stores JPEG, QOI and BMP; the content type picks the file extension.
+      headers: { 'Content-Type': photoData.type || 'image/bmp' },
+      body: photoData,
     })
 
     if (!response.ok) throw new Error('Upload failed')
@@ -1,10 +1,14 @@
 import { defineStore } from 'pinia'
 import { ref, computed } from 'vue'
 
+export type DitherMode = 'floyd-steinberg' | 'fs-serpentine' | 'atkinson' | 'stucki' | 'bayer' | 'blue-noise'
+
 export interface Photo {
   id: string
   landscape: string
   portrait: string
+  // Set when the photo has its own dither mode instead of the global one.
+  dither?: DitherMode
 }
 
 // Response shape from GET /api/photos
@@ -12,6 +16,9 @@ export interface PhotoFrameState {
   rotation: number
   current: string
   displaying: string
+  // Photos in the library; `photos` is the page starting at `offset` (the whole list by default).
+  total: number
+  offset: number
   photos: Photo[]
   count: number
 }
@@ -1,3 +1,5 @@
+import { PALETTE, type PaletteColor } from '@/utils/palette'
+
 export interface CropParams {
   sx: number
   sy: number
@@ -104,28 +106,37 @@ export function fitAndResize(img: HTMLImageElement, targetWidth: number, targetH
   return ctx.getImageData(0, 0, targetWidth, targetHeight)
 }
 
-// 6-color palette for e-paper display
-const PALETTE = [
-  { name: 'black', r: 0, g: 0, b: 0 },
-  { name: 'white', r: 255, g: 255, b: 255 },
-  { name: 'yellow', r: 255, g: 255, b: 0 },
-  { name: 'red', r: 255, g: 0, b: 0 },
-  { name: 'blue', r: 0, g: 0, b: 255 },
-  { name: 'green', r: 0, g: 255, b: 0 },
-]
-
 function clamp255(v: number): number {
   return v < 0 ? 0 : v > 255 ? 255 : v
 }
 
-function closestPaletteColor(r: number, g: number, b: number) {
+function srgbToLinear(c: number): number {
+  c /= 255
+  return c <= 0.04045 ? c / 12.92 : ((c + 0.055) / 1.055) ** 2.4
+}
+
+function labF(t: number): number {
+  return t > 216 / 24389 ? Math.cbrt(t) : (24389 / 27 * t + 16) / 116
+}
+
+// CIELAB (D65); same conversion as the firmware's palette generator.
+function srgbToLab(r: number, g: number, b: number): [number, number, number] {
+  const lr = srgbToLinear(r)
+  const lg = srgbToLinear(g)
+  const lb = srgbToLinear(b)
+  const fx = labF((0.4124564 * lr + 0.3575761 * lg + 0.1804375 * lb) / 0.95047)
+  const fy = labF(0.2126729 * lr + 0.7151522 * lg + 0.072175 * lb)
+  const fz = labF((0.0193339 * lr + 0.119192 * lg + 0.9503041 * lb) / 1.08883)
+  return [116 * fy - 16, 500 * (fx - fy), 200 * (fy - fz)]
+}
+
+// Perceptually nearest panel color (CIELAB distance), as the firmware picks it.
+function closestPaletteColor(r: number, g: number, b: number): PaletteColor {
+  const [L, A, B] = srgbToLab(r, g, b)
   let best = PALETTE[0]!
   let bestD = Infinity
   for (const p of PALETTE) {
-    const dr = r - p.r
-    const dg = g - p.g
-    const db = b - p.b
-    const d = dr * dr + dg * dg + db * db
+    const d = (L - p.L) ** 2 + (A - p.A) ** 2 + (B - p.B) ** 2
     if (d < bestD) {
       bestD = d
       best = p
@@ -135,7 +146,7 @@ function closestPaletteColor(r: number, g: number, b: number) {
 }
 
 /**
- * Apply Floyd-Steinberg dithering to 6-color palette
+ * Apply Floyd-Steinberg dithering to the 6-color palette (a preview of what the panel shows)
  */
 export function ditherImage(imageData: ImageData): ImageData {
   const { data, width, height } = imageData
@@ -168,6 +179,7 @@ export function ditherImage(imageData: ImageData): ImageData {
       const g = clamp255(g0 + errG[x]!)
       const b = clamp255(b0 + errB[x]!)
 
+      // Show the panel's real color; the error is measured against it too.
       const p = closestPaletteColor(r, g, b)
       output.data[idx + 0] = p.r
       output.data[idx + 1] = p.g
@@ -281,6 +293,113 @@ export function imageToBMP(imageData: ImageData): Blob {
   return new Blob([buffer], { type: 'image/bmp' })
 }
 
+const QOI_OP_INDEX = 0x00
+const QOI_OP_DIFF = 0x40
+const QOI_OP_LUMA = 0x80
+const QOI_OP_RGB = 0xfe
+const QOI_OP_RGBA = 0xff
+const QOI_HEADER_SIZE = 14
+
+function qoiHash(r: number, g: number, b: number, a: number): number {
+  return (r * 3 + g * 5 + b * 7 + a * 11) % 64
+}
+
+/**
+ * Convert ImageData to a baseline JPEG blob (what the firmware decodes on-device).
+ * The device dithers to 6 colors, so compression artifacts at this quality don't show.
+ */
+export function imageToJPEG(imageData: ImageData, quality = 0.92): Promise<Blob> {
+  const canvas = document.createElement('canvas')
+  canvas.width = imageData.width
+  canvas.height = imageData.height
+  const ctx = canvas.getContext('2d')
+  if (!ctx) {
+    return Promise.reject(new Error('Failed to get canvas context'))
+  }
+  ctx.putImageData(imageData, 0, 0)
+
+  return new Promise((resolve, reject) => {
+    canvas.toBlob(
+      (blob) => (blob ? resolve(blob) : reject(new Error('Failed to encode JPEG'))),
+      'image/jpeg',
+      quality,
+    )
+  })
+}
+
+/**
+ * Decode a QOI file into ImageData (used to preview stored photos; browsers can't show QOI).
+ */
+export function qoiToImageData(buffer: ArrayBuffer): ImageData {
+  const bytes = new Uint8Array(buffer)
+  const view = new DataView(buffer)
+  if (bytes.length < QOI_HEADER_SIZE || view.getUint32(0, false) !== 0x716f6966) {
+    throw new Error('Not a QOI image')
+  }
+
+  const width = view.getUint32(4, false)
+  const height = view.getUint32(8, false)
+  const output = new ImageData(width, height)
+  const px = output.data
+
+  const index = new Uint8Array(64 * 4)
+  let r = 0
+  let g = 0
+  let b = 0
+  let a = 255
+  let run = 0
+  let p = QOI_HEADER_SIZE
+
+  for (let i = 0; i < px.length; i += 4) {
+    if (run > 0) {
+      run--
+    } else if (p < bytes.length) {
+      const b1 = bytes[p++]!
+      if (b1 === QOI_OP_RGB) {
+        r = bytes[p++]!
+        g = bytes[p++]!
+        b = bytes[p++]!
+      } else if (b1 === QOI_OP_RGBA) {
+        r = bytes[p++]!
+        g = bytes[p++]!
+        b = bytes[p++]!
+        a = bytes[p++]!
+      } else if ((b1 & 0xc0) === QOI_OP_INDEX) {
+        r = index[b1 * 4]!
+        g = index[b1 * 4 + 1]!
+        b = index[b1 * 4 + 2]!
+        a = index[b1 * 4 + 3]!
+      } else if ((b1 & 0xc0) === QOI_OP_DIFF) {
+        r = (r + ((b1 >> 4) & 0x03) - 2) & 0xff
+        g = (g + ((b1 >> 2) & 0x03) - 2) & 0xff
+        b = (b + (b1 & 0x03) - 2) & 0xff
+      } else if ((b1 & 0xc0) === QOI_OP_LUMA) {
+        const b2 = bytes[p++]!
+        const vg = (b1 & 0x3f) - 32
+        r = (r + vg - 8 + ((b2 >> 4) & 0x0f)) & 0xff
+        g = (g + vg) & 0xff
+        b = (b + vg - 8 + (b2 & 0x0f)) & 0xff
+      } else {
+        // QOI_OP_RUN
+        run = b1 & 0x3f
+      }
+
+      const h = qoiHash(r, g, b, a) * 4
+      index[h] = r
+      index[h + 1] = g
+      index[h + 2] = b
+      index[h + 3] = a
+    }
+
+    px[i] = r
+    px[i + 1] = g
+    px[i + 2] = b
+    px[i + 3] = 255
+  }
+
+  return output
+}
+
 /**
  * Get target dimensions based on device rotation
  */
@@ -0,0 +1,25 @@
+// Generated by components/epaper_src/tools/gen_palette6.py; edit the palette there
+// and re-run it instead of changing this file.
+
+export interface PaletteColor {
+  name: string
+  // Color as shown by the panel (what dithering aims for).
+  r: number
+  g: number
+  b: number
+  // CIELAB (D65) of the shown color.
+  L: number
+  A: number
+  B: number
+  // Color the firmware expects in pre-dithered images.
+  nominal: [number, number, number]
+}
+
+export const PALETTE: readonly PaletteColor[] = [
+  { name: 'black', r: 25, g: 30, b: 33, L: 10.8852, A: -1.4449, B: -2.8247, nominal: [0, 0, 0] },
+  { name: 'white', r: 232, g: 232, b: 232, L: 91.9959, A: 0.0000, B: 0.0000, nominal: [255, 255, 255] },
+  { name: 'yellow', r: 239, g: 222, b: 68, L: 87.4915, A: -10.6782, B: 73.1834, nominal: [255, 255, 0] },
+  { name: 'red', r: 178, g: 19, b: 24, L: 37.8422, A: 59.0405, B: 41.8224, nominal: [255, 0, 0] },
+  { name: 'blue', r: 33, g: 87, b: 186, L: 39.0419, A: 19.6710, B: -57.1323, nominal: [0, 0, 255] },
+  { name: 'green', r: 18, g: 95, b: 32, L: 34.8362, A: -36.8827, B: 28.9812, nominal: [0, 255, 0] },
+]
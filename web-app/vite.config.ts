@@ -1,16 +1,48 @@
+import { readdirSync, readFileSync, statSync, writeFileSync } from 'node:fs'
+import { join } from 'node:path'
 import { fileURLToPath, URL } from 'node:url'
+import { gzipSync } from 'node:zlib'
 
-import { defineConfig } from 'vite'
+import { defineConfig, type Plugin } from 'vite'
 import vue from '@vitejs/plugin-vue'
 import vueDevTools from 'vite-plugin-vue-devtools'
 import tailwindcss from '@tailwindcss/vite'
 
+// Writes .gz siblings next to compressible build output. The firmware serves them (with
+// Content-Encoding) instead of the original when the browser accepts gzip. No brotli:
+// browsers only offer br over HTTPS and the frame serves plain HTTP.
+function precompress(): Plugin {
+  const compressible = /\.(html|js|mjs|css|json|svg|txt|map)$/
+  const minBytes = 1024
+
+  const walk = (dir: string): string[] =>
+    readdirSync(dir).flatMap((name) => {
+      const path = join(dir, name)
+      return statSync(path).isDirectory() ? walk(path) : [path]
+    })
+
+  return {
+    name: 'milkee-precompress',
+    apply: 'build',
+    writeBundle(options) {
+      if (!options.dir) return
+      for (const file of walk(options.dir)) {
+        if (!compressible.test(file) || statSync(file).size < minBytes) continue
+        const data = readFileSync(file)
+        const gz = gzipSync(data, { level: 9 })
+        if (gz.length < data.length) writeFileSync(`${file}.gz`, gz)
+      }
+    },
+  }
+}
+
 // https://vite.dev/config/
 export default defineConfig({
   plugins: [
     vue(),
     vueDevTools(),
     tailwindcss(),
+    precompress(),
   ],
   resolve: {
     alias: {